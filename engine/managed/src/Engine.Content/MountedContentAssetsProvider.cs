@@ -1,3 +1,4 @@
+using System.Diagnostics.CodeAnalysis;
 using Engine.Core.Abstractions;
 
 namespace Engine.Content;
@@ -6,6 +7,7 @@ public sealed class MountedContentAssetsProvider : IAssetsProvider
 {
     private readonly IContentRuntimeFacade _contentRuntime;
     private readonly AssetsRuntimeMode _runtimeMode;
+    private readonly Dictionary<ulong, string> _pendingLoads = new();
 
     public MountedContentAssetsProvider(
         IContentRuntimeFacade contentRuntime,
@@ -49,6 +51,58 @@ public sealed class MountedContentAssetsProvider : IAssetsProvider
         return (T)boxed;
     }
 
+    // Starts a load on the native content I/O workers; poll TryEndLoad once
+    // per frame instead of blocking the game loop on the read.
+    public ulong BeginLoad(string path)
+    {
+        if (string.IsNullOrWhiteSpace(path))
+        {
+            throw new ArgumentException("Asset path cannot be empty.", nameof(path));
+        }
+
+        string normalizedPath = path.Trim();
+        ulong requestId = _contentRuntime.BeginReadFile(normalizedPath);
+        _pendingLoads.Add(requestId, normalizedPath);
+        return requestId;
+    }
+
+    public bool TryEndLoad<T>(ulong requestId, [MaybeNullWhen(false)] out T asset)
+    {
+        if (!_pendingLoads.TryGetValue(requestId, out string? normalizedPath))
+        {
+            throw new InvalidOperationException($"Asset load request '{requestId}' is not pending.");
+        }
+
+        byte[] bytes;
+        try
+        {
+            if (!_contentRuntime.TryEndReadFile(requestId, out bytes))
+            {
+                asset = default;
+                return false;
+            }
+        }
+        catch
+        {
+            _pendingLoads.Remove(requestId);
+            throw;
+        }
+
+        _pendingLoads.Remove(requestId);
+        asset = (T)DecodeAsset<T>(normalizedPath, bytes);
+        return true;
+    }
+
+    public void CancelLoad(ulong requestId)
+    {
+        if (!_pendingLoads.Remove(requestId))
+        {
+            throw new InvalidOperationException($"Asset load request '{requestId}' is not pending.");
+        }
+
+        _contentRuntime.CancelReadFile(requestId);
+    }
+
     public T GetOrCreate<T>(IAssetRecipe recipe)
     {
         ArgumentNullException.ThrowIfNull(recipe);
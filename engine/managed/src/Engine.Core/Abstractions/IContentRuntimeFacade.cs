@@ -7,4 +7,22 @@ public interface IContentRuntimeFacade
     void MountDirectory(string directoryPath);
 
     byte[] ReadFile(string assetPath);
+
+    ulong BeginReadFile(string assetPath);
+
+    bool TryEndReadFile(ulong requestId, out byte[] bytes);
+
+    void CancelReadFile(ulong requestId);
+
+    ulong BeginStreamFile(string assetPath, float priority);
+
+    void SetStreamPriority(ulong requestId, float priority);
+
+    bool TryEndStreamFile(ulong requestId, out byte[] bytes);
+
+    void CancelStreamFile(ulong requestId);
+
+    void SetStreamFrameBudget(ulong budgetBytes);
+
+    void UpdateStreaming();
 }
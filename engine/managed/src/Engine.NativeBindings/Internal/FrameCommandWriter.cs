@@ -0,0 +1,166 @@
+using System;
+using System.Collections.Generic;
+using System.Runtime.CompilerServices;
+using Engine.NativeBindings.Internal.Interop;
+
+namespace Engine.NativeBindings.Internal;
+
+// Packs engine_execute_frame_commands records into a region of native frame
+// memory. Flushed records stay where they are because submitted draw items are
+// referenced in place until present; the region is only rewound by attaching
+// to the next frame. The last TailBytes stay free for the records that end a
+// frame, so a full region can always be presented.
+internal sealed unsafe class FrameCommandWriter
+{
+    public const int TailBytes = HeaderBytes * 2 + BeginFrameBytes;
+
+    private const int Alignment = (int)EngineNativeConstants.FrameCommandAlignment;
+    private const int HeaderBytes = 8;
+    private const int BeginFrameBytes = HeaderBytes + 16;
+
+    private readonly List<uint> _pendingKinds = new();
+    private byte* _region;
+    private int _capacity;
+    private int _flushedOffset;
+    private int _offset;
+
+    public bool IsAttached => _region != null;
+
+    public int PendingCount => _pendingKinds.Count;
+
+    public IntPtr PendingCommands => (IntPtr)(_region + _flushedOffset);
+
+    public nuint PendingBytes => (nuint)(_offset - _flushedOffset);
+
+    public void Attach(IntPtr region, int capacityBytes)
+    {
+        if (region == IntPtr.Zero || ((nuint)region & (nuint)(Alignment - 1)) != 0)
+        {
+            throw new ArgumentException("Frame command region must be non-null and 8-byte aligned.", nameof(region));
+        }
+
+        if (capacityBytes < TailBytes)
+        {
+            throw new ArgumentOutOfRangeException(nameof(capacityBytes), "Frame command region is smaller than its reserved tail.");
+        }
+
+        _region = (byte*)region;
+        _capacity = capacityBytes & ~(Alignment - 1);
+        _flushedOffset = 0;
+        _offset = 0;
+        _pendingKinds.Clear();
+    }
+
+    public void Detach()
+    {
+        _region = null;
+        _capacity = 0;
+        _flushedOffset = 0;
+        _offset = 0;
+        _pendingKinds.Clear();
+    }
+
+    public uint PendingKindAt(int index)
+    {
+        if ((uint)index >= (uint)_pendingKinds.Count)
+        {
+            throw new ArgumentOutOfRangeException(nameof(index));
+        }
+
+        return _pendingKinds[index];
+    }
+
+    public void MarkFlushed()
+    {
+        _flushedOffset = _offset;
+        _pendingKinds.Clear();
+    }
+
+    public bool TryAppend(uint kind, bool intoTail = false)
+        => TryReserve(kind, 0, intoTail) != null;
+
+    public bool TryAppend<T>(uint kind, in T payload, bool intoTail = false)
+        where T : unmanaged
+    {
+        byte* payloadPtr = TryReserve(kind, sizeof(T), intoTail);
+        if (payloadPtr == null)
+        {
+            return false;
+        }
+
+        Unsafe.WriteUnaligned(payloadPtr, payload);
+        return true;
+    }
+
+    public bool TryAppendItems<T>(uint kind, ReadOnlySpan<T> items)
+        where T : unmanaged
+    {
+        int itemBytes = checked(items.Length * sizeof(T));
+        byte* payloadPtr = TryReserve(kind, sizeof(EngineNativeFrameCommandItems) + itemBytes, intoTail: false);
+        if (payloadPtr == null)
+        {
+            return false;
+        }
+
+        var header = new EngineNativeFrameCommandItems
+        {
+            ItemCount = checked((uint)items.Length),
+            Reserved0 = 0u
+        };
+        Unsafe.WriteUnaligned(payloadPtr, header);
+        items.CopyTo(new Span<T>(payloadPtr + sizeof(EngineNativeFrameCommandItems), items.Length));
+        return true;
+    }
+
+    // Only items the submit does not point at are carried inline.
+    public bool TryAppendSubmit(
+        in EngineNativeFrameCommandSubmit submit,
+        ReadOnlySpan<EngineNativeDrawItem> drawItems,
+        ReadOnlySpan<EngineNativeUiDrawItem> uiItems)
+    {
+        int drawBytes = checked(drawItems.Length * sizeof(EngineNativeDrawItem));
+        int uiBytes = checked(uiItems.Length * sizeof(EngineNativeUiDrawItem));
+        byte* payloadPtr = TryReserve(
+            EngineNativeConstants.FrameCommandRendererSubmit,
+            checked(sizeof(EngineNativeFrameCommandSubmit) + drawBytes + uiBytes),
+            intoTail: false);
+        if (payloadPtr == null)
+        {
+            return false;
+        }
+
+        Unsafe.WriteUnaligned(payloadPtr, submit);
+        byte* drawPtr = payloadPtr + sizeof(EngineNativeFrameCommandSubmit);
+        drawItems.CopyTo(new Span<EngineNativeDrawItem>(drawPtr, drawItems.Length));
+        uiItems.CopyTo(new Span<EngineNativeUiDrawItem>(drawPtr + drawBytes, uiItems.Length));
+        return true;
+    }
+
+    private byte* TryReserve(uint kind, int payloadBytes, bool intoTail)
+    {
+        if (_region == null)
+        {
+            return null;
+        }
+
+        long recordBytes = ((long)HeaderBytes + payloadBytes + Alignment - 1) & ~(long)(Alignment - 1);
+        long limit = intoTail ? _capacity : _capacity - TailBytes;
+        if (recordBytes > uint.MaxValue || _offset + recordBytes > limit)
+        {
+            return null;
+        }
+
+        byte* record = _region + _offset;
+        int usedBytes = HeaderBytes + payloadBytes;
+        Unsafe.InitBlockUnaligned(record + usedBytes, 0, (uint)(recordBytes - usedBytes));
+        Unsafe.WriteUnaligned(record, new EngineNativeFrameCommandHeader
+        {
+            Kind = kind,
+            Size = (uint)recordBytes
+        });
+
+        _pendingKinds.Add(kind);
+        _offset += (int)recordBytes;
+        return record + HeaderBytes;
+    }
+}
@@ -58,6 +58,24 @@ internal interface INativeContentApi
     void ContentMountDirectory(string directoryPath);
 
     byte[] ContentReadFile(string assetPath);
+
+    ulong ContentReadFileAsync(string assetPath);
+
+    bool ContentTryCompleteRead(ulong requestId, out byte[] payload);
+
+    void ContentCancelRead(ulong requestId);
+
+    ulong ContentStreamFile(string assetPath, float priority);
+
+    void ContentSetStreamPriority(ulong requestId, float priority);
+
+    bool ContentTryCompleteStream(ulong requestId, out byte[] payload);
+
+    void ContentCancelStream(ulong requestId);
+
+    void ContentSetStreamFrameBudget(ulong budgetBytes);
+
+    void ContentUpdateStreaming();
 }
 
 internal readonly record struct NativeNetEventData(
@@ -142,6 +142,17 @@ internal sealed partial class DffNativeInteropApi : INativeInteropApi
         return status;
     }
 
+    public EngineNativeStatus EngineExecuteFrameCommands(
+        IntPtr engine,
+        IntPtr commands,
+        nuint commandBytes,
+        out EngineNativeFrameCommandResults results)
+        => NativeMethods.EngineExecuteFrameCommandsHandle(
+            HandleFromToken(engine),
+            commands,
+            commandBytes,
+            out results);
+
     public EngineNativeStatus ContentMountPak(IntPtr engine, string pakPath)
     {
         ulong engineHandle = HandleFromToken(engine);
@@ -194,6 +205,177 @@ internal sealed partial class DffNativeInteropApi : INativeInteropApi
         }
     }
 
+    public EngineNativeStatus ContentMapFile(
+        IntPtr engine,
+        string assetPath,
+        out IntPtr data,
+        out nuint size)
+    {
+        ulong engineHandle = HandleFromToken(engine);
+        EngineNativeStringView pathView = CreateUtf8StringView(assetPath, out IntPtr allocatedUtf8);
+        try
+        {
+            return NativeMethods.ContentMapFileViewHandle(
+                engineHandle,
+                in pathView,
+                out data,
+                out size);
+        }
+        finally
+        {
+            FreeUtf8StringViewBuffer(allocatedUtf8);
+        }
+    }
+
+    public EngineNativeStatus ContentReadFileAsync(
+        IntPtr engine,
+        string assetPath,
+        IntPtr buffer,
+        nuint bufferSize,
+        out ulong requestId)
+    {
+        ulong engineHandle = HandleFromToken(engine);
+        EngineNativeStringView pathView = CreateUtf8StringView(assetPath, out IntPtr allocatedUtf8);
+        try
+        {
+            return NativeMethods.ContentReadFileAsyncViewHandle(
+                engineHandle,
+                in pathView,
+                buffer,
+                bufferSize,
+                out requestId);
+        }
+        finally
+        {
+            FreeUtf8StringViewBuffer(allocatedUtf8);
+        }
+    }
+
+    public EngineNativeStatus ContentPollRead(
+        IntPtr engine,
+        ulong requestId,
+        out EngineNativeContentReadResult result,
+        out byte isReady)
+        => NativeMethods.ContentPollReadHandle(HandleFromToken(engine), requestId, out result, out isReady);
+
+    public EngineNativeStatus ContentFreeReadResult(IntPtr engine, ref EngineNativeContentReadResult result)
+        => NativeMethods.ContentFreeReadResultHandle(HandleFromToken(engine), ref result);
+
+    public EngineNativeStatus ContentCancelRead(IntPtr engine, ulong requestId)
+        => NativeMethods.ContentCancelReadHandle(HandleFromToken(engine), requestId);
+
+    public EngineNativeStatus ContentStreamRequest(
+        IntPtr engine,
+        string assetPath,
+        float priority,
+        IntPtr buffer,
+        nuint bufferSize,
+        out ulong requestId)
+    {
+        ulong engineHandle = HandleFromToken(engine);
+        EngineNativeStringView pathView = CreateUtf8StringView(assetPath, out IntPtr allocatedUtf8);
+        try
+        {
+            return NativeMethods.ContentStreamRequestViewHandle(
+                engineHandle,
+                in pathView,
+                priority,
+                buffer,
+                bufferSize,
+                out requestId);
+        }
+        finally
+        {
+            FreeUtf8StringViewBuffer(allocatedUtf8);
+        }
+    }
+
+    public EngineNativeStatus ContentStreamSetPriority(IntPtr engine, ulong requestId, float priority)
+        => NativeMethods.ContentStreamSetPriorityHandle(HandleFromToken(engine), requestId, priority);
+
+    public EngineNativeStatus ContentStreamCancel(IntPtr engine, ulong requestId)
+        => NativeMethods.ContentStreamCancelHandle(HandleFromToken(engine), requestId);
+
+    public EngineNativeStatus ContentStreamPoll(
+        IntPtr engine,
+        ulong requestId,
+        out EngineNativeContentReadResult result,
+        out byte isReady)
+        => NativeMethods.ContentStreamPollHandle(HandleFromToken(engine), requestId, out result, out isReady);
+
+    public EngineNativeStatus ContentStreamSetFrameBudget(IntPtr engine, ulong budgetBytes)
+        => NativeMethods.ContentStreamSetFrameBudgetHandle(HandleFromToken(engine), budgetBytes);
+
+    public EngineNativeStatus ContentStreamUpdate(IntPtr engine)
+        => NativeMethods.ContentStreamUpdateHandle(HandleFromToken(engine));
+
+    public EngineNativeStatus ContentSetCacheBudget(IntPtr engine, ulong budgetBytes)
+        => NativeMethods.ContentSetCacheBudgetHandle(HandleFromToken(engine), budgetBytes);
+
+    public EngineNativeStatus ContentAcquireFile(
+        IntPtr engine,
+        string assetPath,
+        out IntPtr data,
+        out nuint size)
+    {
+        ulong engineHandle = HandleFromToken(engine);
+        EngineNativeStringView pathView = CreateUtf8StringView(assetPath, out IntPtr allocatedUtf8);
+        try
+        {
+            return NativeMethods.ContentAcquireFileViewHandle(
+                engineHandle,
+                in pathView,
+                out data,
+                out size);
+        }
+        finally
+        {
+            FreeUtf8StringViewBuffer(allocatedUtf8);
+        }
+    }
+
+    public EngineNativeStatus ContentReleaseFile(IntPtr engine, IntPtr data)
+        => NativeMethods.ContentReleaseFileHandle(HandleFromToken(engine), data);
+
+    public EngineNativeStatus ContentReadFileRange(
+        IntPtr engine,
+        string assetPath,
+        ulong offsetBytes,
+        IntPtr buffer,
+        nuint length,
+        out nuint outSize)
+    {
+        ulong engineHandle = HandleFromToken(engine);
+        EngineNativeStringView pathView = CreateUtf8StringView(assetPath, out IntPtr allocatedUtf8);
+        try
+        {
+            return NativeMethods.ContentReadFileRangeViewHandle(
+                engineHandle,
+                in pathView,
+                offsetBytes,
+                buffer,
+                length,
+                out outSize);
+        }
+        finally
+        {
+            FreeUtf8StringViewBuffer(allocatedUtf8);
+        }
+    }
+
+    public EngineNativeStatus ContentReadByKey(
+        IntPtr engine,
+        ulong assetKey,
+        IntPtr buffer,
+        nuint bufferSize,
+        out nuint outSize)
+        => NativeMethods.ContentReadByKeyHandle(
+            HandleFromToken(engine),
+            assetKey,
+            buffer,
+            bufferSize,
+            out outSize);
+
     public EngineNativeStatus RendererBeginFrame(
         IntPtr renderer,
         nuint requestedBytes,
@@ -205,6 +387,17 @@ internal sealed partial class DffNativeInteropApi : INativeInteropApi
             alignment,
             out frameMemory);
 
+    public EngineNativeStatus RendererResizeFrame(
+        IntPtr renderer,
+        nuint requestedBytes,
+        nuint alignment,
+        out IntPtr frameMemory)
+        => NativeMethods.RendererResizeFrameHandle(
+            HandleFromToken(renderer),
+            requestedBytes,
+            alignment,
+            out frameMemory);
+
     public EngineNativeStatus RendererSubmit(IntPtr renderer, in EngineNativeRenderPacket packet)
         => NativeMethods.RendererSubmitHandle(HandleFromToken(renderer), in packet);
 
@@ -275,6 +468,17 @@ internal sealed partial class DffNativeInteropApi : INativeInteropApi
         out EngineNativeRendererFrameStats stats)
         => NativeMethods.RendererGetLastFrameStatsHandle(HandleFromToken(renderer), out stats);
 
+    public EngineNativeStatus RendererPrewarmPipelines(
+        IntPtr renderer,
+        IntPtr items,
+        uint itemCount)
+        => NativeMethods.RendererPrewarmPipelinesHandle(HandleFromToken(renderer), items, itemCount);
+
+    public EngineNativeStatus RendererGetPipelinePrewarmProgress(
+        IntPtr renderer,
+        out EngineNativePipelinePrewarmProgress progress)
+        => NativeMethods.RendererGetPipelinePrewarmProgressHandle(HandleFromToken(renderer), out progress);
+
     public EngineNativeStatus RendererUiReset(IntPtr renderer)
         => NativeMethods.RendererUiResetHandle(HandleFromToken(renderer));
 
@@ -503,6 +707,14 @@ internal sealed partial class DffNativeInteropApi : INativeInteropApi
             ulong engine,
             out ulong outNet);
 
+        [LibraryImport(EngineNativeConstants.LibraryName, EntryPoint = "engine_execute_frame_commands_handle")]
+        [UnmanagedCallConv(CallConvs = [typeof(CallConvCdecl)])]
+        internal static partial EngineNativeStatus EngineExecuteFrameCommandsHandle(
+            ulong engine,
+            IntPtr commands,
+            nuint commandBytes,
+            out EngineNativeFrameCommandResults outResults);
+
         [LibraryImport(EngineNativeConstants.LibraryName, EntryPoint = "content_mount_pak_view_handle")]
         [UnmanagedCallConv(CallConvs = [typeof(CallConvCdecl)])]
         internal static partial EngineNativeStatus ContentMountPakViewHandle(
@@ -524,6 +736,123 @@ internal sealed partial class DffNativeInteropApi : INativeInteropApi
             nuint bufferSize,
             out nuint outSize);
 
+        [LibraryImport(EngineNativeConstants.LibraryName, EntryPoint = "content_map_file_view_handle")]
+        [UnmanagedCallConv(CallConvs = [typeof(CallConvCdecl)])]
+        internal static partial EngineNativeStatus ContentMapFileViewHandle(
+            ulong engine,
+            in EngineNativeStringView assetPath,
+            out IntPtr outData,
+            out nuint outSize);
+
+        [LibraryImport(EngineNativeConstants.LibraryName, EntryPoint = "content_read_file_async_view_handle")]
+        [UnmanagedCallConv(CallConvs = [typeof(CallConvCdecl)])]
+        internal static partial EngineNativeStatus ContentReadFileAsyncViewHandle(
+            ulong engine,
+            in EngineNativeStringView assetPath,
+            IntPtr buffer,
+            nuint bufferSize,
+            out ulong outRequestId);
+
+        [LibraryImport(EngineNativeConstants.LibraryName, EntryPoint = "content_poll_read_handle")]
+        [UnmanagedCallConv(CallConvs = [typeof(CallConvCdecl)])]
+        internal static partial EngineNativeStatus ContentPollReadHandle(
+            ulong engine,
+            ulong requestId,
+            out EngineNativeContentReadResult outResult,
+            out byte outIsReady);
+
+        [LibraryImport(EngineNativeConstants.LibraryName, EntryPoint = "content_free_read_result_handle")]
+        [UnmanagedCallConv(CallConvs = [typeof(CallConvCdecl)])]
+        internal static partial EngineNativeStatus ContentFreeReadResultHandle(
+            ulong engine,
+            ref EngineNativeContentReadResult result);
+
+        [LibraryImport(EngineNativeConstants.LibraryName, EntryPoint = "content_cancel_read_handle")]
+        [UnmanagedCallConv(CallConvs = [typeof(CallConvCdecl)])]
+        internal static partial EngineNativeStatus ContentCancelReadHandle(
+            ulong engine,
+            ulong requestId);
+
+        [LibraryImport(EngineNativeConstants.LibraryName, EntryPoint = "content_stream_request_view_handle")]
+        [UnmanagedCallConv(CallConvs = [typeof(CallConvCdecl)])]
+        internal static partial EngineNativeStatus ContentStreamRequestViewHandle(
+            ulong engine,
+            in EngineNativeStringView assetPath,
+            float priority,
+            IntPtr buffer,
+            nuint bufferSize,
+            out ulong outRequestId);
+
+        [LibraryImport(EngineNativeConstants.LibraryName, EntryPoint = "content_stream_set_priority_handle")]
+        [UnmanagedCallConv(CallConvs = [typeof(CallConvCdecl)])]
+        internal static partial EngineNativeStatus ContentStreamSetPriorityHandle(
+            ulong engine,
+            ulong requestId,
+            float priority);
+
+        [LibraryImport(EngineNativeConstants.LibraryName, EntryPoint = "content_stream_cancel_handle")]
+        [UnmanagedCallConv(CallConvs = [typeof(CallConvCdecl)])]
+        internal static partial EngineNativeStatus ContentStreamCancelHandle(
+            ulong engine,
+            ulong requestId);
+
+        [LibraryImport(EngineNativeConstants.LibraryName, EntryPoint = "content_stream_poll_handle")]
+        [UnmanagedCallConv(CallConvs = [typeof(CallConvCdecl)])]
+        internal static partial EngineNativeStatus ContentStreamPollHandle(
+            ulong engine,
+            ulong requestId,
+            out EngineNativeContentReadResult outResult,
+            out byte outIsReady);
+
+        [LibraryImport(EngineNativeConstants.LibraryName, EntryPoint = "content_stream_set_frame_budget_handle")]
+        [UnmanagedCallConv(CallConvs = [typeof(CallConvCdecl)])]
+        internal static partial EngineNativeStatus ContentStreamSetFrameBudgetHandle(
+            ulong engine,
+            ulong budgetBytes);
+
+        [LibraryImport(EngineNativeConstants.LibraryName, EntryPoint = "content_stream_update_handle")]
+        [UnmanagedCallConv(CallConvs = [typeof(CallConvCdecl)])]
+        internal static partial EngineNativeStatus ContentStreamUpdateHandle(ulong engine);
+
+        [LibraryImport(EngineNativeConstants.LibraryName, EntryPoint = "content_set_cache_budget_handle")]
+        [UnmanagedCallConv(CallConvs = [typeof(CallConvCdecl)])]
+        internal static partial EngineNativeStatus ContentSetCacheBudgetHandle(
+            ulong engine,
+            ulong budgetBytes);
+
+        [LibraryImport(EngineNativeConstants.LibraryName, EntryPoint = "content_acquire_file_view_handle")]
+        [UnmanagedCallConv(CallConvs = [typeof(CallConvCdecl)])]
+        internal static partial EngineNativeStatus ContentAcquireFileViewHandle(
+            ulong engine,
+            in EngineNativeStringView assetPath,
+            out IntPtr outData,
+            out nuint outSize);
+
+        [LibraryImport(EngineNativeConstants.LibraryName, EntryPoint = "content_release_file_handle")]
+        [UnmanagedCallConv(CallConvs = [typeof(CallConvCdecl)])]
+        internal static partial EngineNativeStatus ContentReleaseFileHandle(
+            ulong engine,
+            IntPtr data);
+
+        [LibraryImport(EngineNativeConstants.LibraryName, EntryPoint = "content_read_file_range_view_handle")]
+        [UnmanagedCallConv(CallConvs = [typeof(CallConvCdecl)])]
+        internal static partial EngineNativeStatus ContentReadFileRangeViewHandle(
+            ulong engine,
+            in EngineNativeStringView assetPath,
+            ulong offsetBytes,
+            IntPtr buffer,
+            nuint length,
+            out nuint outSize);
+
+        [LibraryImport(EngineNativeConstants.LibraryName, EntryPoint = "content_read_by_key_handle")]
+        [UnmanagedCallConv(CallConvs = [typeof(CallConvCdecl)])]
+        internal static partial EngineNativeStatus ContentReadByKeyHandle(
+            ulong engine,
+            ulong assetKey,
+            IntPtr buffer,
+            nuint bufferSize,
+            out nuint outSize);
+
         [LibraryImport(EngineNativeConstants.LibraryName, EntryPoint = "renderer_begin_frame_handle")]
         [UnmanagedCallConv(CallConvs = [typeof(CallConvCdecl)])]
         internal static partial EngineNativeStatus RendererBeginFrameHandle(
@@ -532,6 +861,14 @@ internal sealed partial class DffNativeInteropApi : INativeInteropApi
             nuint alignment,
             out IntPtr outFrameMemory);
 
+        [LibraryImport(EngineNativeConstants.LibraryName, EntryPoint = "renderer_resize_frame_handle")]
+        [UnmanagedCallConv(CallConvs = [typeof(CallConvCdecl)])]
+        internal static partial EngineNativeStatus RendererResizeFrameHandle(
+            ulong renderer,
+            nuint requestedBytes,
+            nuint alignment,
+            out IntPtr outFrameMemory);
+
         [LibraryImport(EngineNativeConstants.LibraryName, EntryPoint = "renderer_submit_handle")]
         [UnmanagedCallConv(CallConvs = [typeof(CallConvCdecl)])]
         internal static partial EngineNativeStatus RendererSubmitHandle(
@@ -598,6 +935,19 @@ internal sealed partial class DffNativeInteropApi : INativeInteropApi
             ulong renderer,
             out EngineNativeRendererFrameStats outStats);
 
+        [LibraryImport(EngineNativeConstants.LibraryName, EntryPoint = "renderer_prewarm_pipelines_handle")]
+        [UnmanagedCallConv(CallConvs = [typeof(CallConvCdecl)])]
+        internal static partial EngineNativeStatus RendererPrewarmPipelinesHandle(
+            ulong renderer,
+            IntPtr items,
+            uint itemCount);
+
+        [LibraryImport(EngineNativeConstants.LibraryName, EntryPoint = "renderer_get_pipeline_prewarm_progress_handle")]
+        [UnmanagedCallConv(CallConvs = [typeof(CallConvCdecl)])]
+        internal static partial EngineNativeStatus RendererGetPipelinePrewarmProgressHandle(
+            ulong renderer,
+            out EngineNativePipelinePrewarmProgress outProgress);
+
         [LibraryImport(EngineNativeConstants.LibraryName, EntryPoint = "renderer_ui_reset_handle")]
         [UnmanagedCallConv(CallConvs = [typeof(CallConvCdecl)])]
         internal static partial EngineNativeStatus RendererUiResetHandle(ulong renderer);
@@ -3,5 +3,18 @@ namespace Engine.NativeBindings.Internal.Interop;
 internal static class EngineNativeConstants
 {
     public const string LibraryName = "dff_native";
-    public const uint ApiVersion = 15;
+    public const uint ApiVersion = 32;
+    public const byte RenderPacketFlagDrawItemsInFrameMemory = 0x01;
+    public const uint FrameCommandRendererBeginFrame = 1;
+    public const uint FrameCommandRendererSubmit = 2;
+    public const uint FrameCommandRendererUiAppend = 3;
+    public const uint FrameCommandRendererPresent = 4;
+    public const uint FrameCommandPhysicsSyncFromWorld = 5;
+    public const uint FrameCommandPhysicsStep = 6;
+    public const uint FrameCommandPhysicsSyncToWorld = 7;
+    public const uint FrameCommandAudioSetEmitterParams = 8;
+    public const uint FrameCommandNetPump = 9;
+    public const uint FrameCommandRendererResizeFrame = 10;
+    public const uint FrameCommandAlignment = 8;
+    public const uint FrameCommandNoFailure = 0xFFFFFFFF;
 }
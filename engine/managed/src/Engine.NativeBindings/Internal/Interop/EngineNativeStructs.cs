@@ -118,6 +118,45 @@ internal struct EngineNativeRendererFrameStats
     public ulong TriangleCount;
     public ulong UploadBytes;
     public ulong GpuMemoryBytes;
+    public ulong FrameArenaReuseCount;
+    public ulong FrameArenaGrowCount;
+    public ulong FrameArenaHighWaterBytes;
+    public ulong FrameArenaReservedBytes;
+    public ulong FrameGraphCacheHits;
+    public ulong FrameGraphCacheMisses;
+    public ulong TransientNaiveBytes;
+    public ulong TransientAliasedBytes;
+    public ulong CulledPassMask;
+    public ulong PassRecordCpuNs;
+    public uint PassRecordLevelCount;
+    public uint PassRecordMaxParallelPasses;
+    public ulong DrawSortCpuNs;
+    public uint DrawBatchCount;
+    public uint DrawBatchMaxInstances;
+    public uint MaterialResolveLookups;
+    public uint MaterialResolveUnique;
+}
+
+[StructLayout(LayoutKind.Sequential)]
+internal struct EngineNativePipelinePrewarmItem
+{
+    public ulong Material;
+    public uint FeatureFlags;
+    public uint Reserved0;
+}
+
+[StructLayout(LayoutKind.Sequential)]
+internal struct EngineNativePipelinePrewarmProgress
+{
+    public uint RequestedCount;
+    public uint ResolvedCount;
+    public uint RejectedCount;
+    public uint AlreadyCachedCount;
+    public uint FirstFrameMissCount;
+    public byte IsComplete;
+    public byte FirstFrameMeasured;
+    public byte Reserved0;
+    public byte Reserved1;
 }
 
 internal enum EngineNativeRenderBackend : uint
@@ -149,6 +188,15 @@ internal struct EngineNativeCaptureResult
     public nuint PixelBytes;
 }
 
+[StructLayout(LayoutKind.Sequential)]
+internal struct EngineNativeContentReadResult
+{
+    public EngineNativeStatus Status;
+    public uint Reserved0;
+    public IntPtr Data;
+    public nuint Size;
+}
+
 internal enum EngineNativeCaptureSemantic : byte
 {
     Color = 0,
@@ -417,3 +465,76 @@ internal struct EngineNativeOverlapHit
     public byte Reserved1;
     public byte Reserved2;
 }
+
+[StructLayout(LayoutKind.Sequential)]
+internal struct EngineNativeFrameCommandHeader
+{
+    public uint Kind;
+    public uint Size;
+}
+
+[StructLayout(LayoutKind.Sequential)]
+internal struct EngineNativeFrameCommandBeginFrame
+{
+    public ulong RequestedBytes;
+    public ulong Alignment;
+}
+
+[StructLayout(LayoutKind.Sequential)]
+internal struct EngineNativeFrameCommandSubmit
+{
+    public IntPtr DrawItems;
+    public IntPtr UiItems;
+    public uint DrawItemCount;
+    public uint UiItemCount;
+    public byte DebugViewMode;
+    public byte RenderFeatureFlags;
+    public byte Reserved0;
+    public byte Reserved1;
+    public uint Reserved2;
+}
+
+[StructLayout(LayoutKind.Sequential)]
+internal struct EngineNativeFrameCommandItems
+{
+    public uint ItemCount;
+    public uint Reserved0;
+}
+
+[StructLayout(LayoutKind.Sequential)]
+internal struct EngineNativeFrameCommandPhysicsStep
+{
+    public double DtSeconds;
+}
+
+[StructLayout(LayoutKind.Sequential)]
+internal struct EngineNativeFrameCommandSyncToWorld
+{
+    public IntPtr Reads;
+    public uint ReadCapacity;
+    public uint Reserved0;
+}
+
+[StructLayout(LayoutKind.Sequential)]
+internal struct EngineNativeFrameCommandEmitterParams
+{
+    public ulong EmitterId;
+    public EngineNativeEmitterParams Params;
+}
+
+[StructLayout(LayoutKind.Sequential)]
+internal struct EngineNativeFrameCommandResults
+{
+    public uint ExecutedCommandCount;
+    public uint FailedCommandIndex;
+    public EngineNativeStatus FailedStatus;
+    public uint PhysicsReadCount;
+    public IntPtr FrameMemory;
+    public EngineNativeNetEvents NetEvents;
+    public EngineNativeRendererFrameStats FrameStats;
+    public byte HasFrameMemory;
+    public byte HasNetEvents;
+    public byte HasFrameStats;
+    public byte Reserved0;
+    public uint Reserved1;
+}
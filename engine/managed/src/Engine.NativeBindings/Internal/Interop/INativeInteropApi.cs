@@ -23,6 +23,12 @@ internal interface INativeInteropApi
 
     EngineNativeStatus EngineGetNet(IntPtr engine, out IntPtr net);
 
+    EngineNativeStatus EngineExecuteFrameCommands(
+        IntPtr engine,
+        IntPtr commands,
+        nuint commandBytes,
+        out EngineNativeFrameCommandResults results);
+
     EngineNativeStatus ContentMountPak(IntPtr engine, string pakPath);
 
     EngineNativeStatus ContentMountDirectory(IntPtr engine, string directoryPath);
@@ -34,12 +40,88 @@ internal interface INativeInteropApi
         nuint bufferSize,
         out nuint outSize);
 
+    EngineNativeStatus ContentMapFile(
+        IntPtr engine,
+        string assetPath,
+        out IntPtr data,
+        out nuint size);
+
+    EngineNativeStatus ContentReadFileAsync(
+        IntPtr engine,
+        string assetPath,
+        IntPtr buffer,
+        nuint bufferSize,
+        out ulong requestId);
+
+    EngineNativeStatus ContentPollRead(
+        IntPtr engine,
+        ulong requestId,
+        out EngineNativeContentReadResult result,
+        out byte isReady);
+
+    EngineNativeStatus ContentFreeReadResult(IntPtr engine, ref EngineNativeContentReadResult result);
+
+    EngineNativeStatus ContentCancelRead(IntPtr engine, ulong requestId);
+
+    EngineNativeStatus ContentStreamRequest(
+        IntPtr engine,
+        string assetPath,
+        float priority,
+        IntPtr buffer,
+        nuint bufferSize,
+        out ulong requestId);
+
+    EngineNativeStatus ContentStreamSetPriority(IntPtr engine, ulong requestId, float priority);
+
+    EngineNativeStatus ContentStreamCancel(IntPtr engine, ulong requestId);
+
+    EngineNativeStatus ContentStreamPoll(
+        IntPtr engine,
+        ulong requestId,
+        out EngineNativeContentReadResult result,
+        out byte isReady);
+
+    EngineNativeStatus ContentStreamSetFrameBudget(IntPtr engine, ulong budgetBytes);
+
+    EngineNativeStatus ContentStreamUpdate(IntPtr engine);
+
+    EngineNativeStatus ContentSetCacheBudget(IntPtr engine, ulong budgetBytes);
+
+    EngineNativeStatus ContentAcquireFile(
+        IntPtr engine,
+        string assetPath,
+        out IntPtr data,
+        out nuint size);
+
+    EngineNativeStatus ContentReleaseFile(IntPtr engine, IntPtr data);
+
+    EngineNativeStatus ContentReadFileRange(
+        IntPtr engine,
+        string assetPath,
+        ulong offsetBytes,
+        IntPtr buffer,
+        nuint length,
+        out nuint outSize);
+
+    EngineNativeStatus ContentReadByKey(
+        IntPtr engine,
+        ulong assetKey,
+        IntPtr buffer,
+        nuint bufferSize,
+        out nuint outSize);
+
     EngineNativeStatus RendererBeginFrame(
         IntPtr renderer,
         nuint requestedBytes,
         nuint alignment,
         out IntPtr frameMemory);
 
+    EngineNativeStatus RendererResizeFrame(
+        IntPtr renderer,
+        nuint requestedBytes,
+        nuint alignment,
+        out IntPtr frameMemory);
+
     EngineNativeStatus RendererSubmit(IntPtr renderer, in EngineNativeRenderPacket packet);
 
     EngineNativeStatus RendererPresent(IntPtr renderer);
@@ -82,6 +164,15 @@ internal interface INativeInteropApi
         IntPtr renderer,
         out EngineNativeRendererFrameStats stats);
 
+    EngineNativeStatus RendererPrewarmPipelines(
+        IntPtr renderer,
+        IntPtr items,
+        uint itemCount);
+
+    EngineNativeStatus RendererGetPipelinePrewarmProgress(
+        IntPtr renderer,
+        out EngineNativePipelinePrewarmProgress progress);
+
     EngineNativeStatus RendererUiReset(IntPtr renderer);
 
     EngineNativeStatus RendererUiAppend(
@@ -150,6 +150,8 @@ internal sealed class NativeContentApiStub : INativeContentApi
 {
     private readonly HashSet<string> _mountedPaths = new(StringComparer.OrdinalIgnoreCase);
     private readonly Dictionary<string, byte[]> _files = new(StringComparer.Ordinal);
+    private readonly Dictionary<ulong, string> _pendingReads = new();
+    private ulong _nextReadRequestId = 1u;
 
     public void ContentMountPak(string pakPath)
     {
@@ -186,6 +188,68 @@ internal sealed class NativeContentApiStub : INativeContentApi
 
         throw new FileNotFoundException($"Asset '{normalizedPath}' was not found in mounted content sources.");
     }
+
+    public ulong ContentReadFileAsync(string assetPath)
+    {
+        if (string.IsNullOrWhiteSpace(assetPath))
+        {
+            throw new ArgumentException("Asset path cannot be empty.", nameof(assetPath));
+        }
+
+        ulong requestId = _nextReadRequestId++;
+        _pendingReads.Add(requestId, assetPath);
+        return requestId;
+    }
+
+    public bool ContentTryCompleteRead(ulong requestId, out byte[] payload)
+    {
+        if (!_pendingReads.Remove(requestId, out string? assetPath))
+        {
+            throw new InvalidOperationException($"Content read request '{requestId}' is not pending.");
+        }
+
+        payload = ContentReadFile(assetPath);
+        return true;
+    }
+
+    public void ContentCancelRead(ulong requestId)
+    {
+        if (!_pendingReads.Remove(requestId))
+        {
+            throw new InvalidOperationException($"Content read request '{requestId}' is not pending.");
+        }
+    }
+
+    public ulong ContentStreamFile(string assetPath, float priority)
+    {
+        if (float.IsNaN(priority))
+        {
+            throw new ArgumentException("Stream priority must be a number.", nameof(priority));
+        }
+
+        return ContentReadFileAsync(assetPath);
+    }
+
+    public void ContentSetStreamPriority(ulong requestId, float priority)
+    {
+        if (!_pendingReads.ContainsKey(requestId))
+        {
+            throw new InvalidOperationException($"Content stream request '{requestId}' is not pending.");
+        }
+    }
+
+    public bool ContentTryCompleteStream(ulong requestId, out byte[] payload)
+        => ContentTryCompleteRead(requestId, out payload);
+
+    public void ContentCancelStream(ulong requestId) => ContentCancelRead(requestId);
+
+    public void ContentSetStreamFrameBudget(ulong budgetBytes)
+    {
+    }
+
+    public void ContentUpdateStreaming()
+    {
+    }
 }
 
 internal sealed class NativeNetApiStub : INativeNetApi
@@ -0,0 +1,11 @@
+namespace Engine.NativeBindings.Internal;
+
+internal enum NativeFrameSubmission
+{
+    // Every frame operation is its own native call.
+    Immediate = 0,
+
+    // Frame operations are recorded into frame memory and executed by
+    // engine_execute_frame_commands, normally once per frame at present.
+    Batched = 1
+}
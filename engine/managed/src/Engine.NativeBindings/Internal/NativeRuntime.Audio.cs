@@ -48,6 +48,17 @@ internal sealed partial class NativeRuntime
             throw new ArgumentOutOfRangeException(nameof(emitterId), "Emitter id must be non-zero.");
         }
 
+        var command = new EngineNativeFrameCommandEmitterParams
+        {
+            EmitterId = emitterId,
+            Params = emitterParams
+        };
+        if (_frameCommands.TryAppend(EngineNativeConstants.FrameCommandAudioSetEmitterParams, in command))
+        {
+            return;
+        }
+
+        FlushFrameCommands();
         NativeStatusGuard.ThrowIfFailed(
             _interop.AudioSetEmitterParams(_audio, emitterId, in emitterParams),
             "audio_set_emitter_params");
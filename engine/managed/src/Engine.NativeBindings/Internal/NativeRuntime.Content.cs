@@ -1,3 +1,4 @@
+using System.Runtime.InteropServices;
 using Engine.NativeBindings.Internal.Interop;
 
 namespace Engine.NativeBindings.Internal;
@@ -72,4 +73,142 @@ internal sealed partial class NativeRuntime
 
         return buffer;
     }
+
+    public ulong ContentReadFileAsync(string assetPath)
+    {
+        if (string.IsNullOrWhiteSpace(assetPath))
+        {
+            throw new ArgumentException("Asset path cannot be empty.", nameof(assetPath));
+        }
+
+        ThrowIfDisposed();
+        NativeStatusGuard.ThrowIfFailed(
+            _interop.ContentReadFileAsync(_engine, assetPath, IntPtr.Zero, 0u, out ulong requestId),
+            "content_read_file_async");
+
+        if (requestId == 0u)
+        {
+            throw new InvalidOperationException("Native content_read_file_async returned an invalid request identifier.");
+        }
+
+        return requestId;
+    }
+
+    public bool ContentTryCompleteRead(ulong requestId, out byte[] payload)
+    {
+        ThrowIfDisposed();
+        NativeStatusGuard.ThrowIfFailed(
+            _interop.ContentPollRead(_engine, requestId, out EngineNativeContentReadResult result, out byte isReady),
+            "content_poll_read");
+
+        return TryCopyReadResult(requestId, ref result, isReady, "content_read_file_async", out payload);
+    }
+
+    public void ContentCancelRead(ulong requestId)
+    {
+        ThrowIfDisposed();
+        NativeStatusGuard.ThrowIfFailed(
+            _interop.ContentCancelRead(_engine, requestId),
+            "content_cancel_read");
+    }
+
+    public ulong ContentStreamFile(string assetPath, float priority)
+    {
+        if (string.IsNullOrWhiteSpace(assetPath))
+        {
+            throw new ArgumentException("Asset path cannot be empty.", nameof(assetPath));
+        }
+
+        ThrowIfDisposed();
+        NativeStatusGuard.ThrowIfFailed(
+            _interop.ContentStreamRequest(_engine, assetPath, priority, IntPtr.Zero, 0u, out ulong requestId),
+            "content_stream_request");
+
+        if (requestId == 0u)
+        {
+            throw new InvalidOperationException("Native content_stream_request returned an invalid request identifier.");
+        }
+
+        return requestId;
+    }
+
+    public void ContentSetStreamPriority(ulong requestId, float priority)
+    {
+        ThrowIfDisposed();
+        NativeStatusGuard.ThrowIfFailed(
+            _interop.ContentStreamSetPriority(_engine, requestId, priority),
+            "content_stream_set_priority");
+    }
+
+    public bool ContentTryCompleteStream(ulong requestId, out byte[] payload)
+    {
+        ThrowIfDisposed();
+        NativeStatusGuard.ThrowIfFailed(
+            _interop.ContentStreamPoll(_engine, requestId, out EngineNativeContentReadResult result, out byte isReady),
+            "content_stream_poll");
+
+        return TryCopyReadResult(requestId, ref result, isReady, "content_stream_request", out payload);
+    }
+
+    public void ContentCancelStream(ulong requestId)
+    {
+        ThrowIfDisposed();
+        NativeStatusGuard.ThrowIfFailed(
+            _interop.ContentStreamCancel(_engine, requestId),
+            "content_stream_cancel");
+    }
+
+    public void ContentSetStreamFrameBudget(ulong budgetBytes)
+    {
+        ThrowIfDisposed();
+        NativeStatusGuard.ThrowIfFailed(
+            _interop.ContentStreamSetFrameBudget(_engine, budgetBytes),
+            "content_stream_set_frame_budget");
+    }
+
+    public void ContentUpdateStreaming()
+    {
+        ThrowIfDisposed();
+        NativeStatusGuard.ThrowIfFailed(
+            _interop.ContentStreamUpdate(_engine),
+            "content_stream_update");
+    }
+
+    private bool TryCopyReadResult(
+        ulong requestId,
+        ref EngineNativeContentReadResult result,
+        byte isReady,
+        string operation,
+        out byte[] payload)
+    {
+        if (isReady == 0u)
+        {
+            payload = Array.Empty<byte>();
+            return false;
+        }
+
+        try
+        {
+            NativeStatusGuard.ThrowIfFailed(result.Status, operation);
+            if (result.Size != 0u && result.Data == IntPtr.Zero)
+            {
+                throw new InvalidOperationException(
+                    $"Native content read '{requestId}' returned {result.Size} bytes without data.");
+            }
+
+            payload = result.Size == 0u ? Array.Empty<byte>() : new byte[checked((int)result.Size)];
+            if (payload.Length > 0)
+            {
+                Marshal.Copy(result.Data, payload, 0, payload.Length);
+            }
+
+            return true;
+        }
+        finally
+        {
+            NativeStatusGuard.ThrowIfFailed(
+                _interop.ContentFreeReadResult(_engine, ref result),
+                "content_free_read_result");
+        }
+    }
 }
@@ -0,0 +1,325 @@
+using System;
+using System.Collections.Generic;
+using Engine.NativeBindings.Internal.Interop;
+using Engine.Rendering;
+
+namespace Engine.NativeBindings.Internal;
+
+// Batched frame submission. Each native frame is requested with extra room
+// after the caller's arena for a command region; frame operations are recorded
+// there and present sends the whole frame, followed by the begin-frame for the
+// next one, through a single engine_execute_frame_commands call. Between
+// present and the next BeginFrame the runtime holds that pre-opened frame, so
+// physics and audio work issued before rendering lands in the same stream. A
+// BeginFrame that needs more room regrows that frame instead of presenting it.
+internal sealed partial class NativeRuntime
+{
+    private const int FrameCommandAlignment = (int)EngineNativeConstants.FrameCommandAlignment;
+    private const int FrameCommandReserveBytes = 64 * 1024;
+
+    private readonly NativeFrameSubmission _frameSubmission;
+    private readonly FrameCommandWriter _frameCommands = new();
+    private IntPtr _openFrameMemory;
+    private int _openFrameBytes;
+    private int _openFrameAlignment;
+    private bool _frameClaimed;
+    private bool _frameSubmitted;
+    private bool _netPumpRequested;
+    private IReadOnlyList<NativeNetEventData>? _bufferedNetEvents;
+
+    private bool IsBatched => _frameSubmission == NativeFrameSubmission.Batched;
+
+    private FrameArena BeginBatchedFrame(int requestedBytes, int alignment)
+    {
+        if (_frameClaimed)
+        {
+            throw new NativeCallException("renderer_begin_frame", EngineNativeStatus.InvalidState);
+        }
+
+        if (_openFrameMemory != IntPtr.Zero &&
+            (requestedBytes > _openFrameBytes || alignment > _openFrameAlignment))
+        {
+            ResizeOpenFrame(requestedBytes, alignment);
+        }
+
+        if (_openFrameMemory == IntPtr.Zero)
+        {
+            NativeStatusGuard.ThrowIfFailed(
+                _interop.RendererBeginFrame(
+                    _renderer,
+                    checked((nuint)BatchedFrameBytes(requestedBytes)),
+                    checked((nuint)BatchedFrameAlignment(alignment)),
+                    out var frameMemory),
+                "renderer_begin_frame");
+
+            if (frameMemory == IntPtr.Zero)
+            {
+                throw new InvalidOperationException("Native renderer_begin_frame returned null frame memory.");
+            }
+
+            OpenFrame(frameMemory, requestedBytes, alignment);
+        }
+
+        var arena = FrameArena.WrapExternalMemory(_openFrameMemory, requestedBytes, alignment);
+        _frameClaimed = true;
+        _frameMemory = _openFrameMemory;
+        _frameMemoryBytes = checked((nuint)requestedBytes);
+        return arena;
+    }
+
+    private void EndBatchedFrame(int nextFrameBytes, int nextFrameAlignment)
+    {
+        var beginFrame = new EngineNativeFrameCommandBeginFrame
+        {
+            RequestedBytes = checked((ulong)BatchedFrameBytes(nextFrameBytes)),
+            Alignment = checked((ulong)BatchedFrameAlignment(nextFrameAlignment))
+        };
+
+        int presentIndex = _frameCommands.PendingCount;
+        _frameCommands.TryAppend(EngineNativeConstants.FrameCommandRendererPresent, intoTail: true);
+        if (_netPumpRequested)
+        {
+            _frameCommands.TryAppend(EngineNativeConstants.FrameCommandNetPump, intoTail: true);
+            _netPumpRequested = false;
+        }
+
+        _frameCommands.TryAppend(EngineNativeConstants.FrameCommandRendererBeginFrame, in beginFrame, intoTail: true);
+
+        var status = ExecuteFrameCommands(out var results, out uint failedKind);
+        if (results.HasFrameStats != 0)
+        {
+            _lastFrameStats = MapFrameStats(results.FrameStats);
+        }
+
+        if (results.HasNetEvents != 0)
+        {
+            _bufferedNetEvents = CopyNetEvents(results.NetEvents);
+        }
+
+        if (status == EngineNativeStatus.Ok)
+        {
+            if (results.HasFrameMemory == 0 || results.FrameMemory == IntPtr.Zero)
+            {
+                ClearOpenFrame();
+                throw new InvalidOperationException("Native renderer_begin_frame returned null frame memory.");
+            }
+
+            OpenFrame(results.FrameMemory, nextFrameBytes, nextFrameAlignment);
+            return;
+        }
+
+        if (results.FailedCommandIndex <= (uint)presentIndex)
+        {
+            // The frame is still open; present retries it with a direct call.
+            throw new NativeCallException(FrameCommandName(failedKind), status);
+        }
+
+        ClearOpenFrame();
+        if (failedKind != EngineNativeConstants.FrameCommandRendererBeginFrame)
+        {
+            throw new NativeCallException(FrameCommandName(failedKind), status);
+        }
+
+        // Only opening the next frame failed; BeginFrame asks again directly
+        // and reports the failure there.
+    }
+
+    // Nothing has been submitted into the pre-opened frame yet, so it can be
+    // regrown in place; pending records go out in the same call.
+    private void ResizeOpenFrame(int requestedBytes, int alignment)
+    {
+        var resizeFrame = new EngineNativeFrameCommandBeginFrame
+        {
+            RequestedBytes = checked((ulong)BatchedFrameBytes(requestedBytes)),
+            Alignment = checked((ulong)BatchedFrameAlignment(alignment))
+        };
+
+        IntPtr frameMemory;
+        if (_frameCommands.IsAttached &&
+            _frameCommands.TryAppend(EngineNativeConstants.FrameCommandRendererResizeFrame, in resizeFrame, intoTail: true))
+        {
+            var status = ExecuteFrameCommands(out var results, out uint failedKind);
+            if (status != EngineNativeStatus.Ok)
+            {
+                if (failedKind == EngineNativeConstants.FrameCommandRendererResizeFrame)
+                {
+                    ClearOpenFrame();
+                }
+
+                throw new NativeCallException(FrameCommandName(failedKind), status);
+            }
+
+            frameMemory = results.HasFrameMemory != 0 ? results.FrameMemory : IntPtr.Zero;
+        }
+        else
+        {
+            FlushFrameCommands();
+            var status = _interop.RendererResizeFrame(
+                _renderer,
+                checked((nuint)resizeFrame.RequestedBytes),
+                checked((nuint)resizeFrame.Alignment),
+                out frameMemory);
+            if (status != EngineNativeStatus.Ok)
+            {
+                ClearOpenFrame();
+                throw new NativeCallException("renderer_resize_frame", status);
+            }
+        }
+
+        if (frameMemory == IntPtr.Zero)
+        {
+            ClearOpenFrame();
+            throw new InvalidOperationException("Native renderer_resize_frame returned null frame memory.");
+        }
+
+        OpenFrame(frameMemory, requestedBytes, alignment);
+    }
+
+    private EngineNativeFrameCommandResults FlushFrameCommands()
+    {
+        if (_frameCommands.PendingCount == 0)
+        {
+            return default;
+        }
+
+        var status = ExecuteFrameCommands(out var results, out uint failedKind);
+        if (status != EngineNativeStatus.Ok)
+        {
+            throw new NativeCallException(FrameCommandName(failedKind), status);
+        }
+
+        return results;
+    }
+
+    private EngineNativeStatus ExecuteFrameCommands(
+        out EngineNativeFrameCommandResults results,
+        out uint failedKind)
+    {
+        var status = _interop.EngineExecuteFrameCommands(
+            _engine,
+            _frameCommands.PendingCommands,
+            _frameCommands.PendingBytes,
+            out results);
+        failedKind = 0u;
+
+        if (status == EngineNativeStatus.Ok)
+        {
+            _frameCommands.MarkFlushed();
+            return status;
+        }
+
+        if (results.FailedCommandIndex < (uint)_frameCommands.PendingCount)
+        {
+            failedKind = _frameCommands.PendingKindAt((int)results.FailedCommandIndex);
+        }
+
+        // Nothing after the failed record ran; the rest of the frame goes
+        // through direct calls instead of replaying a partial stream.
+        _frameCommands.Detach();
+        return results.FailedStatus != EngineNativeStatus.Ok ? results.FailedStatus : status;
+    }
+
+    // Items already in the claimed frame arena are passed by pointer and stay
+    // there until present; anything else is copied into the record, since the
+    // stream runs after Submit returns.
+    private unsafe bool TryAppendSubmit(RenderPacket packet)
+    {
+        IntPtr drawItemsPtr = IntPtr.Zero;
+        int drawItemCount = packet.NativeDrawItemCount;
+        ReadOnlySpan<EngineNativeDrawItem> inlineDrawItems = default;
+        if (drawItemCount == 0)
+        {
+            inlineDrawItems = BuildDrawItems(packet.DrawCommands);
+            drawItemCount = inlineDrawItems.Length;
+        }
+        else if (IsInFrameMemory(packet.NativeDrawItemsPointer, (nuint)drawItemCount * (nuint)sizeof(EngineNativeDrawItem)))
+        {
+            drawItemsPtr = packet.NativeDrawItemsPointer;
+        }
+        else
+        {
+            inlineDrawItems = new ReadOnlySpan<EngineNativeDrawItem>((void*)packet.NativeDrawItemsPointer, drawItemCount);
+        }
+
+        IntPtr uiItemsPtr = IntPtr.Zero;
+        int uiItemCount = packet.NativeUiDrawItemCount;
+        ReadOnlySpan<EngineNativeUiDrawItem> inlineUiItems = default;
+        if (uiItemCount == 0)
+        {
+            inlineUiItems = BuildUiItems(packet.UiDrawCommands);
+            uiItemCount = inlineUiItems.Length;
+        }
+        else if (IsInFrameMemory(packet.NativeUiDrawItemsPointer, (nuint)uiItemCount * (nuint)sizeof(EngineNativeUiDrawItem)))
+        {
+            uiItemsPtr = packet.NativeUiDrawItemsPointer;
+        }
+        else
+        {
+            inlineUiItems = new ReadOnlySpan<EngineNativeUiDrawItem>((void*)packet.NativeUiDrawItemsPointer, uiItemCount);
+        }
+
+        var submit = new EngineNativeFrameCommandSubmit
+        {
+            DrawItems = drawItemsPtr,
+            UiItems = uiItemsPtr,
+            DrawItemCount = checked((uint)drawItemCount),
+            UiItemCount = checked((uint)uiItemCount),
+            DebugViewMode = (byte)packet.DebugViewMode,
+            RenderFeatureFlags = (byte)packet.FeatureFlags,
+            Reserved0 = 0,
+            Reserved1 = 0,
+            Reserved2 = 0
+        };
+
+        return _frameCommands.TryAppendSubmit(in submit, inlineDrawItems, inlineUiItems);
+    }
+
+    private void OpenFrame(IntPtr frameMemory, int requestedBytes, int alignment)
+    {
+        _openFrameMemory = frameMemory;
+        _openFrameBytes = requestedBytes;
+        _openFrameAlignment = alignment;
+        _frameClaimed = false;
+        _frameSubmitted = false;
+        _frameCommands.Attach(frameMemory + AlignFrameCommands(requestedBytes), FrameCommandReserveBytes);
+    }
+
+    private void ClearOpenFrame()
+    {
+        _frameCommands.Detach();
+        _openFrameMemory = IntPtr.Zero;
+        _openFrameBytes = 0;
+        _openFrameAlignment = 0;
+        _frameClaimed = false;
+        _frameSubmitted = false;
+    }
+
+    private static int AlignFrameCommands(int bytes)
+        => checked(bytes + FrameCommandAlignment - 1) & ~(FrameCommandAlignment - 1);
+
+    // Draw items live in the caller's arena and are referenced by pointer, so
+    // the command region only holds the records themselves.
+    private static int BatchedFrameBytes(int requestedBytes)
+        => checked(AlignFrameCommands(requestedBytes) + FrameCommandReserveBytes);
+
+    private static int BatchedFrameAlignment(int alignment)
+        => Math.Max(alignment, FrameCommandAlignment);
+
+    private static string FrameCommandName(uint kind)
+    {
+        return kind switch
+        {
+            EngineNativeConstants.FrameCommandRendererBeginFrame => "renderer_begin_frame",
+            EngineNativeConstants.FrameCommandRendererSubmit => "renderer_submit",
+            EngineNativeConstants.FrameCommandRendererUiAppend => "renderer_ui_append",
+            EngineNativeConstants.FrameCommandRendererPresent => "renderer_present_with_stats",
+            EngineNativeConstants.FrameCommandPhysicsSyncFromWorld => "physics_sync_from_world",
+            EngineNativeConstants.FrameCommandPhysicsStep => "physics_step",
+            EngineNativeConstants.FrameCommandPhysicsSyncToWorld => "physics_sync_to_world",
+            EngineNativeConstants.FrameCommandAudioSetEmitterParams => "audio_set_emitter_params",
+            EngineNativeConstants.FrameCommandNetPump => "net_pump",
+            EngineNativeConstants.FrameCommandRendererResizeFrame => "renderer_resize_frame",
+            _ => "engine_execute_frame_commands"
+        };
+    }
+}
@@ -10,7 +10,25 @@ internal sealed partial class NativeRuntime
     {
         ThrowIfDisposed();
 
+        // With a batched frame open the pump rides along with present; the
+        // events it collected are handed out by the next call.
+        if (_frameCommands.IsAttached)
+        {
+            _netPumpRequested = true;
+            if (_bufferedNetEvents is not null)
+            {
+                var bufferedEvents = _bufferedNetEvents;
+                _bufferedNetEvents = null;
+                return bufferedEvents;
+            }
+        }
+
         NativeStatusGuard.ThrowIfFailed(_interop.NetPump(_net, out EngineNativeNetEvents nativeEvents), "net_pump");
+        return CopyNetEvents(nativeEvents);
+    }
+
+    private static IReadOnlyList<NativeNetEventData> CopyNetEvents(in EngineNativeNetEvents nativeEvents)
+    {
         if (nativeEvents.EventCount == 0u)
         {
             return Array.Empty<NativeNetEventData>();
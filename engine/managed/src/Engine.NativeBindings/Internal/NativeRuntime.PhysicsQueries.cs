@@ -11,6 +11,7 @@ internal sealed partial class NativeRuntime
     public bool Sweep(in PhysicsSweepQuery query, out PhysicsSweepHit hit)
     {
         ThrowIfDisposed();
+        FlushFrameCommands();
 
         var nativeQuery = new EngineNativeSweepQuery
         {
@@ -52,6 +53,7 @@ internal sealed partial class NativeRuntime
     public int Overlap(in PhysicsOverlapQuery query, Span<PhysicsOverlapHit> hits)
     {
         ThrowIfDisposed();
+        FlushFrameCommands();
 
         var nativeQuery = new EngineNativeOverlapQuery
         {
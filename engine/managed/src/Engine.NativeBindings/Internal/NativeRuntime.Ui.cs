@@ -13,6 +13,15 @@ internal sealed partial class NativeRuntime
         _ = timing;
 
         ThrowIfDisposed();
+
+        // Beginning a frame already clears its UI items, so a batched frame
+        // only needs the reset once something has been submitted into it.
+        if (IsBatched && !_frameSubmitted)
+        {
+            return;
+        }
+
+        FlushFrameCommands();
         NativeStatusGuard.ThrowIfFailed(
             _interop.RendererUiReset(_renderer),
             "renderer_ui_reset");
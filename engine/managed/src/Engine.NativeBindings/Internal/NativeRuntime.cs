@@ -35,10 +35,18 @@ internal sealed partial class NativeRuntime
     private bool _disposed;
     private RenderingFrameStats _lastFrameStats = RenderingFrameStats.Empty;
     private RenderDebugViewMode _lastSubmittedDebugViewMode = RenderDebugViewMode.None;
+    private IntPtr _frameMemory;
+    private nuint _frameMemoryBytes;
 
     public NativeRuntime(INativeInteropApi interop)
+        : this(interop, NativeFrameSubmission.Immediate)
+    {
+    }
+
+    public NativeRuntime(INativeInteropApi interop, NativeFrameSubmission frameSubmission)
     {
         _interop = interop ?? throw new ArgumentNullException(nameof(interop));
+        _frameSubmission = frameSubmission;
         uint nativeApiVersion = _interop.EngineGetNativeApiVersion();
         if (nativeApiVersion != EngineNativeConstants.ApiVersion)
         {
@@ -103,6 +111,12 @@ internal sealed partial class NativeRuntime
         ThrowIfDisposed();
 
         var writes = BuildBodyWrites(world);
+        if (_frameCommands.TryAppendItems<EngineNativeBodyWrite>(EngineNativeConstants.FrameCommandPhysicsSyncFromWorld, writes))
+        {
+            return;
+        }
+
+        FlushFrameCommands();
         var pinnedWrites = default(GCHandle);
 
         try
@@ -136,6 +150,13 @@ internal sealed partial class NativeRuntime
 
         ThrowIfDisposed();
 
+        var step = new EngineNativeFrameCommandPhysicsStep { DtSeconds = deltaTime.TotalSeconds };
+        if (_frameCommands.TryAppend(EngineNativeConstants.FrameCommandPhysicsStep, in step))
+        {
+            return;
+        }
+
+        FlushFrameCommands();
         NativeStatusGuard.ThrowIfFailed(
             _interop.PhysicsStep(_physics, deltaTime.TotalSeconds),
             "physics_step");
@@ -160,9 +181,26 @@ internal sealed partial class NativeRuntime
                 readsPtr = pinnedReads.AddrOfPinnedObject();
             }
 
-            NativeStatusGuard.ThrowIfFailed(
-                _interop.PhysicsSyncToWorld(_physics, readsPtr, readCapacity, out var readCount),
-                "physics_sync_to_world");
+            // Post-physics systems read the results, so this flushes the
+            // batched frame up to here rather than waiting for present.
+            uint readCount;
+            var syncToWorld = new EngineNativeFrameCommandSyncToWorld
+            {
+                Reads = readsPtr,
+                ReadCapacity = readCapacity,
+                Reserved0 = 0u
+            };
+            if (_frameCommands.TryAppend(EngineNativeConstants.FrameCommandPhysicsSyncToWorld, in syncToWorld))
+            {
+                readCount = FlushFrameCommands().PhysicsReadCount;
+            }
+            else
+            {
+                FlushFrameCommands();
+                NativeStatusGuard.ThrowIfFailed(
+                    _interop.PhysicsSyncToWorld(_physics, readsPtr, readCapacity, out readCount),
+                    "physics_sync_to_world");
+            }
 
             if (readCount > readCapacity)
             {
@@ -203,6 +241,7 @@ internal sealed partial class NativeRuntime
     public bool Raycast(in PhysicsRaycastQuery query, out PhysicsRaycastHit hit)
     {
         ThrowIfDisposed();
+        FlushFrameCommands();
 
         var nativeQuery = new EngineNativeRaycastQuery
         {
@@ -241,6 +280,10 @@ internal sealed partial class NativeRuntime
     public FrameArena BeginFrame(int requestedBytes, int alignment)
     {
         ThrowIfDisposed();
+        if (IsBatched)
+        {
+            return BeginBatchedFrame(requestedBytes, alignment);
+        }
 
         NativeStatusGuard.ThrowIfFailed(
             _interop.RendererBeginFrame(
@@ -255,6 +298,8 @@ internal sealed partial class NativeRuntime
             throw new InvalidOperationException("Native renderer_begin_frame returned null frame memory.");
         }
 
+        _frameMemory = frameMemory;
+        _frameMemoryBytes = checked((nuint)requestedBytes);
         return FrameArena.WrapExternalMemory(frameMemory, requestedBytes, alignment);
     }
 
@@ -263,6 +308,13 @@ internal sealed partial class NativeRuntime
         ArgumentNullException.ThrowIfNull(packet);
         ThrowIfDisposed();
         _lastSubmittedDebugViewMode = packet.DebugViewMode;
+        _frameSubmitted = true;
+        if (_frameClaimed && _frameCommands.IsAttached && TryAppendSubmit(packet))
+        {
+            return;
+        }
+
+        FlushFrameCommands();
 
         var drawItemsPtr = packet.NativeDrawItemsPointer;
         var drawItemsCount = packet.NativeDrawItemCount;
@@ -291,6 +343,9 @@ internal sealed partial class NativeRuntime
                 uiItemsCount = uiItems.Length;
             }
             byte renderFeatureFlags = (byte)packet.FeatureFlags;
+            byte packetFlags = drawItems.Length == 0 && IsInFrameMemory(drawItemsPtr, drawItemsCount)
+                ? EngineNativeConstants.RenderPacketFlagDrawItemsInFrameMemory
+                : (byte)0;
 
             var nativePacket = new EngineNativeRenderPacket
             {
@@ -300,7 +355,7 @@ internal sealed partial class NativeRuntime
                 UiItemCount = checked((uint)uiItemsCount),
                 DebugViewMode = (byte)packet.DebugViewMode,
                 Reserved0 = renderFeatureFlags,
-                Reserved1 = 0,
+                Reserved1 = packetFlags,
                 Reserved2 = 0
             };
 
@@ -326,10 +381,31 @@ internal sealed partial class NativeRuntime
     {
         ThrowIfDisposed();
 
+        _frameMemory = IntPtr.Zero;
+        _frameMemoryBytes = 0;
+        if (_frameClaimed && _frameCommands.IsAttached)
+        {
+            EndBatchedFrame(_openFrameBytes, _openFrameAlignment);
+            return;
+        }
+
+        FlushFrameCommands();
+        ClearOpenFrame();
         NativeStatusGuard.ThrowIfFailed(
             _interop.RendererPresentWithStats(_renderer, out var nativeStats),
             "renderer_present_with_stats");
-        _lastFrameStats = new RenderingFrameStats(
+        _lastFrameStats = MapFrameStats(nativeStats);
+    }
+
+    public RenderingFrameStats GetLastFrameStats()
+    {
+        ThrowIfDisposed();
+        return _lastFrameStats;
+    }
+
+    private static RenderingFrameStats MapFrameStats(in EngineNativeRendererFrameStats nativeStats)
+    {
+        return new RenderingFrameStats(
             nativeStats.DrawItemCount,
             nativeStats.UiItemCount,
             nativeStats.ExecutedPassCount,
@@ -343,10 +419,28 @@ internal sealed partial class NativeRuntime
             MapRenderingBackend(nativeStats.Reserved0));
     }
 
-    public RenderingFrameStats GetLastFrameStats()
+    private unsafe bool IsInFrameMemory(IntPtr items, int itemCount)
     {
-        ThrowIfDisposed();
-        return _lastFrameStats;
+        if (itemCount <= 0)
+        {
+            return false;
+        }
+
+        return IsInFrameMemory(items, (nuint)itemCount * (nuint)sizeof(EngineNativeDrawItem));
+    }
+
+    private bool IsInFrameMemory(IntPtr data, nuint byteCount)
+    {
+        if (_frameMemory == IntPtr.Zero || data == IntPtr.Zero || byteCount == 0)
+        {
+            return false;
+        }
+
+        var begin = (nuint)_frameMemory;
+        var address = (nuint)data;
+        return address >= begin
+            && address - begin <= _frameMemoryBytes
+            && byteCount <= _frameMemoryBytes - (address - begin);
     }
 
     private static RenderingBackendKind MapRenderingBackend(uint backend)
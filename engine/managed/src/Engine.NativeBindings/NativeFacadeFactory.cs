@@ -16,7 +16,7 @@ namespace Engine.NativeBindings;
 public static class NativeFacadeFactory
 {
     public static NativeFacadeSet CreateNativeFacadeSet()
-        => CreateNativeFacadeSet(DffNativeInteropApi.Instance);
+        => CreateNativeFacadeSet(DffNativeInteropApi.Instance, NativeFrameSubmission.Batched);
 
     public static IPlatformFacade CreatePlatformFacade() => new NativePlatformFacade(new NativePlatformApiStub());
 
@@ -53,6 +53,9 @@ public static class NativeFacadeFactory
     internal static NativeFacadeSet CreateNativeFacadeSet(INativeInteropApi interop)
         => new(new NativeRuntime(interop));
 
+    internal static NativeFacadeSet CreateNativeFacadeSet(INativeInteropApi interop, NativeFrameSubmission frameSubmission)
+        => new(new NativeRuntime(interop, frameSubmission));
+
     private sealed class NativePlatformFacade : IPlatformFacade
     {
         private readonly INativePlatformApi _nativeApi;
@@ -128,6 +131,24 @@ public static class NativeFacadeFactory
         public void MountDirectory(string directoryPath) => _nativeApi.ContentMountDirectory(directoryPath);
 
         public byte[] ReadFile(string assetPath) => _nativeApi.ContentReadFile(assetPath);
+
+        public ulong BeginReadFile(string assetPath) => _nativeApi.ContentReadFileAsync(assetPath);
+
+        public bool TryEndReadFile(ulong requestId, out byte[] bytes) => _nativeApi.ContentTryCompleteRead(requestId, out bytes);
+
+        public void CancelReadFile(ulong requestId) => _nativeApi.ContentCancelRead(requestId);
+
+        public ulong BeginStreamFile(string assetPath, float priority) => _nativeApi.ContentStreamFile(assetPath, priority);
+
+        public void SetStreamPriority(ulong requestId, float priority) => _nativeApi.ContentSetStreamPriority(requestId, priority);
+
+        public bool TryEndStreamFile(ulong requestId, out byte[] bytes) => _nativeApi.ContentTryCompleteStream(requestId, out bytes);
+
+        public void CancelStreamFile(ulong requestId) => _nativeApi.ContentCancelStream(requestId);
+
+        public void SetStreamFrameBudget(ulong budgetBytes) => _nativeApi.ContentSetStreamFrameBudget(budgetBytes);
+
+        public void UpdateStreaming() => _nativeApi.ContentUpdateStreaming();
     }
 
     private sealed class NativeAudioFacade : IAudioFacade
@@ -101,6 +101,51 @@ public sealed class MountedContentAssetsProviderTests
         Assert.Contains("does not support runtime recipe generation", exception.Message, StringComparison.Ordinal);
     }
 
+    [Fact]
+    public void BeginLoad_ShouldCompleteThroughPollingWithoutBlocking()
+    {
+        var runtime = new FakeContentRuntimeFacade { PollsBeforeReady = 2 };
+        runtime.Files["textures/hero.bin"] = [9, 8, 7];
+        var provider = new MountedContentAssetsProvider(runtime);
+
+        ulong requestId = provider.BeginLoad("  textures/hero.bin ");
+
+        Assert.Equal("textures/hero.bin", runtime.PendingReads[requestId]);
+        Assert.False(provider.TryEndLoad(requestId, out byte[]? pending));
+        Assert.Null(pending);
+        Assert.False(provider.TryEndLoad(requestId, out pending));
+        Assert.True(provider.TryEndLoad(requestId, out byte[]? payload));
+        Assert.Equal([9, 8, 7], payload);
+        Assert.Throws<InvalidOperationException>(() => provider.TryEndLoad(requestId, out byte[]? _));
+    }
+
+    [Fact]
+    public void CancelLoad_ShouldReleaseNativeRequest()
+    {
+        var runtime = new FakeContentRuntimeFacade();
+        runtime.Files["textures/hero.bin"] = [1];
+        var provider = new MountedContentAssetsProvider(runtime);
+
+        ulong requestId = provider.BeginLoad("textures/hero.bin");
+        provider.CancelLoad(requestId);
+
+        Assert.Empty(runtime.PendingReads);
+        Assert.Throws<InvalidOperationException>(() => provider.CancelLoad(requestId));
+        Assert.Throws<ArgumentException>(() => provider.BeginLoad(" "));
+    }
+
+    [Fact]
+    public void TryEndLoad_ShouldForgetRequestWhenReadFails()
+    {
+        var runtime = new FakeContentRuntimeFacade();
+        var provider = new MountedContentAssetsProvider(runtime);
+
+        ulong requestId = provider.BeginLoad("textures/missing.bin");
+
+        Assert.Throws<FileNotFoundException>(() => provider.TryEndLoad(requestId, out byte[]? _));
+        Assert.Throws<InvalidOperationException>(() => provider.TryEndLoad(requestId, out byte[]? _));
+    }
+
     [Fact]
     public void BakeAll_ShouldThrowInMountedMode()
     {
@@ -134,6 +179,12 @@ public sealed class MountedContentAssetsProviderTests
 
         public string? LastReadPath { get; private set; }
 
+        public Dictionary<ulong, string> PendingReads { get; } = new();
+
+        public int PollsBeforeReady { get; set; }
+
+        private ulong _nextRequestId = 1u;
+
         public void MountPak(string pakPath)
         {
             LastMountedPakPath = pakPath;
@@ -154,5 +205,50 @@ public sealed class MountedContentAssetsProviderTests
 
             return payload.ToArray();
         }
+
+        public ulong BeginReadFile(string assetPath)
+        {
+            ulong requestId = _nextRequestId++;
+            PendingReads.Add(requestId, assetPath);
+            return requestId;
+        }
+
+        public bool TryEndReadFile(ulong requestId, out byte[] bytes)
+        {
+            if (PollsBeforeReady > 0)
+            {
+                PollsBeforeReady--;
+                bytes = Array.Empty<byte>();
+                return false;
+            }
+
+            string assetPath = PendingReads[requestId];
+            PendingReads.Remove(requestId);
+            bytes = ReadFile(assetPath);
+            return true;
+        }
+
+        public void CancelReadFile(ulong requestId)
+        {
+            PendingReads.Remove(requestId);
+        }
+
+        public ulong BeginStreamFile(string assetPath, float priority) => BeginReadFile(assetPath);
+
+        public void SetStreamPriority(ulong requestId, float priority)
+        {
+        }
+
+        public bool TryEndStreamFile(ulong requestId, out byte[] bytes) => TryEndReadFile(requestId, out bytes);
+
+        public void CancelStreamFile(ulong requestId) => CancelReadFile(requestId);
+
+        public void SetStreamFrameBudget(ulong budgetBytes)
+        {
+        }
+
+        public void UpdateStreaming()
+        {
+        }
     }
 }
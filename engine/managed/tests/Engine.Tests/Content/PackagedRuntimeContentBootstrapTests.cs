@@ -220,5 +220,50 @@ public sealed class PackagedRuntimeContentBootstrapTests
         {
             throw new NotSupportedException("Asset reads are not used by packaged runtime bootstrap.");
         }
+
+        public ulong BeginReadFile(string assetPath)
+        {
+            throw new NotSupportedException("Asset reads are not used by packaged runtime bootstrap.");
+        }
+
+        public bool TryEndReadFile(ulong requestId, out byte[] bytes)
+        {
+            throw new NotSupportedException("Asset reads are not used by packaged runtime bootstrap.");
+        }
+
+        public void CancelReadFile(ulong requestId)
+        {
+            throw new NotSupportedException("Asset reads are not used by packaged runtime bootstrap.");
+        }
+
+        public ulong BeginStreamFile(string assetPath, float priority)
+        {
+            throw new NotSupportedException("Asset reads are not used by packaged runtime bootstrap.");
+        }
+
+        public void SetStreamPriority(ulong requestId, float priority)
+        {
+            throw new NotSupportedException("Asset reads are not used by packaged runtime bootstrap.");
+        }
+
+        public bool TryEndStreamFile(ulong requestId, out byte[] bytes)
+        {
+            throw new NotSupportedException("Asset reads are not used by packaged runtime bootstrap.");
+        }
+
+        public void CancelStreamFile(ulong requestId)
+        {
+            throw new NotSupportedException("Asset reads are not used by packaged runtime bootstrap.");
+        }
+
+        public void SetStreamFrameBudget(ulong budgetBytes)
+        {
+            throw new NotSupportedException("Asset reads are not used by packaged runtime bootstrap.");
+        }
+
+        public void UpdateStreaming()
+        {
+            throw new NotSupportedException("Asset reads are not used by packaged runtime bootstrap.");
+        }
     }
 }
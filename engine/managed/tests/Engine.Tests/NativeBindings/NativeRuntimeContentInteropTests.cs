@@ -57,4 +57,88 @@ public sealed class NativeRuntimeContentInteropTests
         NativeCallException exception = Assert.Throws<NativeCallException>(() => runtime.ContentReadFile("missing.bin"));
         Assert.Contains("content_read_file", exception.Message, StringComparison.Ordinal);
     }
+
+    [Fact]
+    public void ContentReadFileAsync_ShouldPollUntilReadyAndFreeResult()
+    {
+        var backend = new FakeNativeInteropApi { ContentReadPollsBeforeReady = 1 };
+        backend.ContentFilesToReturn["textures/hero.bin"] = [4, 5, 6];
+        using var runtime = new NativeRuntime(backend);
+
+        ulong requestId = runtime.ContentReadFileAsync("textures/hero.bin");
+
+        Assert.False(runtime.ContentTryCompleteRead(requestId, out byte[] pending));
+        Assert.Empty(pending);
+        Assert.True(runtime.ContentTryCompleteRead(requestId, out byte[] payload));
+        Assert.Equal([4, 5, 6], payload);
+        Assert.Equal(2, backend.CountCall("content_poll_read"));
+        Assert.Equal(1, backend.ContentReadResultsFreed);
+        Assert.Equal(0, backend.CountCall("content_read_file"));
+    }
+
+    [Fact]
+    public void ContentReadFileAsync_ShouldSurfaceReadFailureAndStillFreeResult()
+    {
+        var backend = new FakeNativeInteropApi();
+        using var runtime = new NativeRuntime(backend);
+
+        ulong requestId = runtime.ContentReadFileAsync("missing.bin");
+
+        NativeCallException exception = Assert.Throws<NativeCallException>(
+            () => runtime.ContentTryCompleteRead(requestId, out byte[] _));
+        Assert.Contains("content_read_file_async", exception.Message, StringComparison.Ordinal);
+        Assert.Equal(1, backend.ContentReadResultsFreed);
+    }
+
+    [Fact]
+    public void ContentCancelRead_ShouldForwardAndThrowForUnknownRequests()
+    {
+        var backend = new FakeNativeInteropApi();
+        using var runtime = new NativeRuntime(backend);
+
+        ulong requestId = runtime.ContentReadFileAsync("textures/hero.bin");
+        runtime.ContentCancelRead(requestId);
+
+        Assert.Empty(backend.ContentPendingReads);
+        Assert.Throws<NativeCallException>(() => runtime.ContentCancelRead(requestId));
+        Assert.Throws<ArgumentException>(() => runtime.ContentReadFileAsync(" "));
+    }
+
+    [Fact]
+    public void ContentStreamFile_ShouldWaitForUpdateBeforeCompleting()
+    {
+        var backend = new FakeNativeInteropApi();
+        backend.ContentFilesToReturn["world/terrain.bin"] = [7, 8];
+        using var runtime = new NativeRuntime(backend);
+
+        runtime.ContentSetStreamFrameBudget(4096u);
+        ulong requestId = runtime.ContentStreamFile("world/terrain.bin", 12.5f);
+        runtime.ContentSetStreamPriority(requestId, 1.0f);
+
+        Assert.False(runtime.ContentTryCompleteStream(requestId, out byte[] pending));
+        Assert.Empty(pending);
+        Assert.Equal(1.0f, backend.ContentPendingStreams[requestId].Priority);
+
+        runtime.ContentUpdateStreaming();
+
+        Assert.True(runtime.ContentTryCompleteStream(requestId, out byte[] payload));
+        Assert.Equal([7, 8], payload);
+        Assert.Equal(4096u, backend.ContentStreamFrameBudget);
+        Assert.Equal(1, backend.ContentReadResultsFreed);
+    }
+
+    [Fact]
+    public void ContentCancelStream_ShouldForwardAndThrowForUnknownRequests()
+    {
+        var backend = new FakeNativeInteropApi();
+        using var runtime = new NativeRuntime(backend);
+
+        ulong requestId = runtime.ContentStreamFile("world/far.bin", 900.0f);
+        runtime.ContentCancelStream(requestId);
+
+        Assert.Empty(backend.ContentPendingStreams);
+        Assert.Throws<NativeCallException>(() => runtime.ContentCancelStream(requestId));
+        Assert.Throws<NativeCallException>(() => runtime.ContentSetStreamPriority(requestId, 1.0f));
+        Assert.Throws<ArgumentException>(() => runtime.ContentStreamFile("", 1.0f));
+    }
 }
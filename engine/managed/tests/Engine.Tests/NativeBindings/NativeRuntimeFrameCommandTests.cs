@@ -0,0 +1,260 @@
+using System;
+using System.Numerics;
+using System.Runtime.InteropServices;
+using Engine.Core.Handles;
+using Engine.Core.Timing;
+using Engine.ECS;
+using Engine.NativeBindings.Internal;
+using Engine.NativeBindings.Internal.Interop;
+using Engine.Physics;
+using Engine.Rendering;
+
+namespace Engine.Tests.NativeBindings;
+
+public sealed class NativeRuntimeFrameCommandTests
+{
+    private const int FrameArenaBytes = 1024;
+    private const int FrameArenaAlignment = 16;
+    private const int FrameMemoryBytes = 128 * 1024;
+
+    [Fact]
+    public void BatchedRuntime_IssuesOneInteropCallPerFrame()
+    {
+        IntPtr frameMemory = Marshal.AllocHGlobal(FrameMemoryBytes);
+        try
+        {
+            var backend = new FakeNativeInteropApi
+            {
+                RendererBeginFrameMemory = frameMemory,
+                RendererFrameStatsToReturn = new EngineNativeRendererFrameStats
+                {
+                    DrawItemCount = 1,
+                    PresentCount = 7
+                }
+            };
+            var world = new World();
+            EntityId entity = world.CreateEntity();
+            using var runtime = new NativeRuntime(backend, NativeFrameSubmission.Batched);
+
+            WarmUp(runtime, world, entity);
+            Assert.Contains("renderer_begin_frame", backend.Calls);
+
+            for (var frame = 0; frame < 3; frame++)
+            {
+                backend.Calls.Clear();
+                backend.FrameCommandCalls.Clear();
+
+                RunFrame(runtime, world, entity);
+
+                Assert.Equal(["engine_execute_frame_commands"], backend.Calls);
+                Assert.Equal(
+                    [
+                        "audio_set_emitter_params",
+                        "renderer_submit",
+                        "renderer_present_with_stats",
+                        "net_pump",
+                        "renderer_begin_frame"
+                    ],
+                    backend.FrameCommandCalls);
+                Assert.Equal((ulong)10, backend.LastSubmittedDrawItem?.Mesh);
+                Assert.Equal((ulong)0x55, backend.LastAudioSetEmitterId);
+                Assert.Equal((uint)1, runtime.GetLastFrameStats().DrawItemCount);
+                Assert.Equal((ulong)7, runtime.GetLastFrameStats().PresentCount);
+            }
+        }
+        finally
+        {
+            Marshal.FreeHGlobal(frameMemory);
+        }
+    }
+
+    [Fact]
+    public void BatchedRuntime_ReferencesArenaDrawItemsAndReservesOnlyTheCommandRegion()
+    {
+        IntPtr frameMemory = Marshal.AllocHGlobal(FrameMemoryBytes);
+        try
+        {
+            var backend = new FakeNativeInteropApi { RendererBeginFrameMemory = frameMemory };
+            var world = new World();
+            EntityId entity = world.CreateEntity();
+            using var runtime = new NativeRuntime(backend, NativeFrameSubmission.Batched);
+            WarmUp(runtime, world, entity);
+            Assert.Equal((nuint)(FrameArenaBytes + 64 * 1024), backend.LastFrameRequestedBytes);
+
+            RenderPacket packet;
+            using (FrameArena frameArena = runtime.BeginFrame(FrameArenaBytes, FrameArenaAlignment))
+            {
+                var drawCommand = new DrawCommand(entity, new MeshHandle(10), new MaterialHandle(20), new TextureHandle(30));
+                packet = RenderPacketMarshaller.Marshal(0, frameArena, [drawCommand], Array.Empty<UiDrawCommand>());
+                runtime.Submit(packet);
+                runtime.Present();
+            }
+
+            EngineNativeFrameCommandSubmit submit = Assert.NotNull(backend.LastFrameCommandSubmit);
+            Assert.Equal(packet.NativeDrawItemsPointer, submit.DrawItems);
+            Assert.Equal(IntPtr.Zero, submit.UiItems);
+            Assert.Equal(packet.NativeDrawItemsPointer, backend.LastRendererSubmitPacket.DrawItems);
+            Assert.Equal((ulong)10, backend.LastSubmittedDrawItem?.Mesh);
+        }
+        finally
+        {
+            Marshal.FreeHGlobal(frameMemory);
+        }
+    }
+
+    [Fact]
+    public void BatchedRuntime_RegrowsPreOpenedFrameWithoutPresenting()
+    {
+        IntPtr frameMemory = Marshal.AllocHGlobal(FrameMemoryBytes);
+        try
+        {
+            var backend = new FakeNativeInteropApi { RendererBeginFrameMemory = frameMemory };
+            var world = new World();
+            EntityId entity = world.CreateEntity();
+            using var runtime = new NativeRuntime(backend, NativeFrameSubmission.Batched);
+            WarmUp(runtime, world, entity);
+            backend.Calls.Clear();
+            backend.FrameCommandCalls.Clear();
+
+            RunFrame(runtime, world, entity, FrameArenaBytes * 4);
+
+            Assert.Equal(["engine_execute_frame_commands", "engine_execute_frame_commands"], backend.Calls);
+            Assert.Equal(
+                [
+                    "audio_set_emitter_params",
+                    "renderer_resize_frame",
+                    "renderer_submit",
+                    "renderer_present_with_stats",
+                    "net_pump",
+                    "renderer_begin_frame"
+                ],
+                backend.FrameCommandCalls);
+            Assert.Equal((nuint)(FrameArenaBytes * 4 + 64 * 1024), backend.LastFrameRequestedBytes);
+        }
+        finally
+        {
+            Marshal.FreeHGlobal(frameMemory);
+        }
+    }
+
+    [Fact]
+    public void BatchedRuntime_FlushesPhysicsOnceForReadback()
+    {
+        IntPtr frameMemory = Marshal.AllocHGlobal(FrameMemoryBytes);
+        try
+        {
+            var backend = new FakeNativeInteropApi
+            {
+                RendererBeginFrameMemory = frameMemory,
+                PhysicsReadsToReturn =
+                [
+                    new EngineNativeBodyRead
+                    {
+                        Body = 101,
+                        Position0 = 10.0f,
+                        Position1 = 20.0f,
+                        Position2 = 30.0f,
+                        Rotation3 = 1.0f,
+                        IsActive = 1
+                    }
+                ]
+            };
+            var world = new World();
+            EntityId entity = world.CreateEntity();
+            world.AddComponent(
+                entity,
+                new PhysicsBody(
+                    new BodyHandle(101),
+                    PhysicsBodyType.Dynamic,
+                    new PhysicsCollider(ColliderShapeType.Box, Vector3.One, isTrigger: false, PhysicsMaterial.Default),
+                    Vector3.Zero,
+                    Quaternion.Identity,
+                    Vector3.Zero,
+                    Vector3.Zero,
+                    isActive: true));
+            using var runtime = new NativeRuntime(backend, NativeFrameSubmission.Batched);
+            WarmUp(runtime, world, entity);
+            backend.Calls.Clear();
+            backend.FrameCommandCalls.Clear();
+
+            runtime.SyncToPhysics(world);
+            runtime.Step(TimeSpan.FromSeconds(1.0 / 60.0));
+            runtime.Step(TimeSpan.FromSeconds(1.0 / 60.0));
+            Assert.Empty(backend.Calls);
+
+            runtime.SyncFromPhysics(world);
+
+            Assert.Equal(["engine_execute_frame_commands"], backend.Calls);
+            Assert.Equal(
+                ["physics_sync_from_world", "physics_step", "physics_step", "physics_sync_to_world"],
+                backend.FrameCommandCalls);
+            Assert.Equal((uint)1, backend.LastPhysicsWriteCount);
+            Assert.True(world.TryGetComponent(entity, out PhysicsBody updated));
+            Assert.Equal(new Vector3(10.0f, 20.0f, 30.0f), updated.Position);
+
+            RunFrame(runtime, world, entity);
+            Assert.Equal(["engine_execute_frame_commands", "engine_execute_frame_commands"], backend.Calls);
+        }
+        finally
+        {
+            Marshal.FreeHGlobal(frameMemory);
+        }
+    }
+
+    [Fact]
+    public void BatchedRuntime_ReportsFailedCommandAndPresentsDirectlyOnRetry()
+    {
+        IntPtr frameMemory = Marshal.AllocHGlobal(FrameMemoryBytes);
+        try
+        {
+            var backend = new FakeNativeInteropApi { RendererBeginFrameMemory = frameMemory };
+            var world = new World();
+            EntityId entity = world.CreateEntity();
+            using var runtime = new NativeRuntime(backend, NativeFrameSubmission.Batched);
+            WarmUp(runtime, world, entity);
+            backend.RendererSubmitStatus = EngineNativeStatus.InvalidState;
+            backend.Calls.Clear();
+
+            using (runtime.BeginFrame(FrameArenaBytes, FrameArenaAlignment))
+            {
+                runtime.Submit(CreatePacket(entity));
+                var exception = Assert.Throws<NativeCallException>(() => runtime.Present());
+                Assert.Contains("renderer_submit", exception.Message, StringComparison.Ordinal);
+            }
+
+            runtime.Present();
+
+            Assert.Equal(["engine_execute_frame_commands", "renderer_present_with_stats"], backend.Calls);
+        }
+        finally
+        {
+            Marshal.FreeHGlobal(frameMemory);
+        }
+    }
+
+    // The first frame opens frame memory with a direct call and the second
+    // primes the net pump that later frames get from the previous present.
+    private static void WarmUp(NativeRuntime runtime, World world, EntityId entity)
+    {
+        RunFrame(runtime, world, entity);
+        RunFrame(runtime, world, entity);
+    }
+
+    private static void RunFrame(NativeRuntime runtime, World world, EntityId entity, int frameArenaBytes = FrameArenaBytes)
+    {
+        runtime.Update(world, new FrameTiming(0, TimeSpan.FromMilliseconds(16), TimeSpan.Zero));
+        var emitterParams = new EngineNativeEmitterParams { Volume = 0.5f, Pitch = 1.0f, Lowpass = 1.0f };
+        runtime.SetAudioEmitterParams(0x55, in emitterParams);
+        _ = runtime.NetPump();
+
+        using FrameArena frameArena = runtime.BeginFrame(frameArenaBytes, FrameArenaAlignment);
+        runtime.Submit(CreatePacket(entity));
+        runtime.Present();
+    }
+
+    private static RenderPacket CreatePacket(EntityId entity)
+    {
+        var drawCommand = new DrawCommand(entity, new MeshHandle(10), new MaterialHandle(20), new TextureHandle(30));
+        return new RenderPacket(0, [drawCommand]);
+    }
+}
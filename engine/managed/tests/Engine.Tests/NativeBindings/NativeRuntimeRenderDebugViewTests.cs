@@ -59,4 +59,34 @@ public sealed class NativeRuntimeRenderDebugViewTests
         Assert.Equal((byte)0, backend.LastRendererSubmitPacket.Reserved1);
         Assert.Equal((byte)0, backend.LastRendererSubmitPacket.Reserved2);
     }
+
+    [Fact]
+    public void NativeRuntimeSubmit_MarksDrawItemsInsideFrameMemoryForZeroCopySubmission()
+    {
+        var backend = new FakeNativeInteropApi();
+        using var nativeSet = NativeFacadeFactory.CreateNativeFacadeSet(backend);
+        using var frameArena = nativeSet.Rendering.BeginFrame(1024, 64);
+
+        var insidePacket = RenderPacket.CreateNative(
+            0,
+            Array.Empty<DrawCommand>(),
+            Array.Empty<UiDrawCommand>(),
+            backend.RendererBeginFrameMemory,
+            2,
+            IntPtr.Zero,
+            0);
+        nativeSet.Rendering.Submit(insidePacket);
+        Assert.Equal((byte)0x01, backend.LastRendererSubmitPacket.Reserved1);
+
+        var outsidePacket = RenderPacket.CreateNative(
+            0,
+            Array.Empty<DrawCommand>(),
+            Array.Empty<UiDrawCommand>(),
+            backend.RendererBeginFrameMemory + 1024,
+            1,
+            IntPtr.Zero,
+            0);
+        nativeSet.Rendering.Submit(outsidePacket);
+        Assert.Equal((byte)0, backend.LastRendererSubmitPacket.Reserved1);
+    }
 }
@@ -15,10 +15,16 @@ internal sealed class FakeNativeInteropApi : INativeInteropApi
 
     public List<string> Calls { get; } = [];
 
+    public List<string> FrameCommandCalls { get; } = [];
+
     public IntPtr RendererBeginFrameMemory { get; set; } = new(4096);
 
     public EngineNativeRenderPacket LastRendererSubmitPacket { get; private set; }
 
+    public EngineNativeFrameCommandSubmit? LastFrameCommandSubmit { get; private set; }
+
+    public nuint LastFrameRequestedBytes { get; private set; }
+
     public EngineNativeDrawItem? LastSubmittedDrawItem { get; private set; }
 
     public EngineNativeUiDrawItem? LastSubmittedUiItem { get; private set; }
@@ -59,6 +65,8 @@ internal sealed class FakeNativeInteropApi : INativeInteropApi
 
     public EngineNativeStatus EngineGetNetStatus { get; set; } = EngineNativeStatus.Ok;
 
+    public EngineNativeStatus EngineExecuteFrameCommandsStatus { get; set; } = EngineNativeStatus.Ok;
+
     public EngineNativeStatus ContentMountPakStatus { get; set; } = EngineNativeStatus.Ok;
 
     public EngineNativeStatus ContentMountDirectoryStatus { get; set; } = EngineNativeStatus.Ok;
@@ -67,8 +75,42 @@ internal sealed class FakeNativeInteropApi : INativeInteropApi
 
     public Dictionary<string, byte[]> ContentFilesToReturn { get; } = new(StringComparer.Ordinal);
 
+    public Dictionary<ulong, byte[]> ContentKeysToReturn { get; } = new();
+
+    public EngineNativeStatus ContentMapFileStatus { get; set; } = EngineNativeStatus.Ok;
+
+    public IntPtr ContentMappedDataToReturn { get; set; }
+
+    public nuint ContentMappedSizeToReturn { get; set; }
+
+    public EngineNativeStatus ContentReadFileAsyncStatus { get; set; } = EngineNativeStatus.Ok;
+
+    public EngineNativeStatus ContentCancelReadStatus { get; set; } = EngineNativeStatus.Ok;
+
+    public int ContentReadPollsBeforeReady { get; set; }
+
+    public Dictionary<ulong, string> ContentPendingReads { get; } = new();
+
+    public int ContentReadResultsFreed { get; private set; }
+
+    private ulong _nextContentReadRequestId = 1u;
+
+    public Dictionary<ulong, (string AssetPath, float Priority)> ContentPendingStreams { get; } = new();
+
+    public HashSet<ulong> ContentIssuedStreams { get; } = new();
+
+    public ulong ContentStreamFrameBudget { get; private set; }
+
+    private int _nextContentAcquiredSlot;
+
+    public ulong ContentCacheBudget { get; private set; }
+
+    public Dictionary<IntPtr, (string AssetPath, int Pins)> ContentAcquiredFiles { get; } = new();
+
     public EngineNativeStatus RendererBeginFrameStatus { get; set; } = EngineNativeStatus.Ok;
 
+    public EngineNativeStatus RendererResizeFrameStatus { get; set; } = EngineNativeStatus.Ok;
+
     public EngineNativeStatus RendererSubmitStatus { get; set; } = EngineNativeStatus.Ok;
 
     public EngineNativeStatus RendererPresentStatus { get; set; } = EngineNativeStatus.Ok;
@@ -109,6 +151,10 @@ internal sealed class FakeNativeInteropApi : INativeInteropApi
 
     public EngineNativeRendererFrameStats RendererFrameStatsToReturn { get; set; }
 
+    public EngineNativeStatus RendererPrewarmPipelinesStatus { get; set; } = EngineNativeStatus.Ok;
+
+    public EngineNativePipelinePrewarmProgress RendererPipelinePrewarmProgressToReturn { get; set; }
+
     public EngineNativeStatus CaptureRequestStatus { get; set; } = EngineNativeStatus.Ok;
 
     public EngineNativeStatus CapturePollStatus { get; set; } = EngineNativeStatus.Ok;
@@ -263,6 +309,163 @@ internal sealed class FakeNativeInteropApi : INativeInteropApi
         return EngineGetNetStatus;
     }
 
+    public EngineNativeStatus EngineExecuteFrameCommands(
+        IntPtr engine,
+        IntPtr commands,
+        nuint commandBytes,
+        out EngineNativeFrameCommandResults results)
+    {
+        Calls.Add("engine_execute_frame_commands");
+        results = new EngineNativeFrameCommandResults
+        {
+            FailedCommandIndex = EngineNativeConstants.FrameCommandNoFailure,
+            FailedStatus = EngineNativeStatus.Ok
+        };
+
+        if (EngineExecuteFrameCommandsStatus != EngineNativeStatus.Ok)
+        {
+            return EngineExecuteFrameCommandsStatus;
+        }
+
+        if (commandBytes > 0 && commands == IntPtr.Zero)
+        {
+            return EngineNativeStatus.InvalidArgument;
+        }
+
+        // Replays each record through the per-call fakes, which log into
+        // FrameCommandCalls so Calls only shows the batched interop call.
+        int callsBefore = Calls.Count;
+        int headerSize = Marshal.SizeOf<EngineNativeFrameCommandHeader>();
+        var offset = 0;
+        for (uint index = 0u; offset < (int)commandBytes; index++)
+        {
+            IntPtr record = commands + offset;
+            var header = Marshal.PtrToStructure<EngineNativeFrameCommandHeader>(record);
+            EngineNativeStatus status = ExecuteFrameCommand(header.Kind, record + headerSize, ref results);
+            FrameCommandCalls.AddRange(Calls.GetRange(callsBefore, Calls.Count - callsBefore));
+            Calls.RemoveRange(callsBefore, Calls.Count - callsBefore);
+            if (status != EngineNativeStatus.Ok)
+            {
+                results.FailedCommandIndex = index;
+                results.FailedStatus = status;
+                return status;
+            }
+
+            results.ExecutedCommandCount++;
+            offset += checked((int)header.Size);
+        }
+
+        return EngineNativeStatus.Ok;
+    }
+
+    private EngineNativeStatus ExecuteFrameCommand(
+        uint kind,
+        IntPtr payload,
+        ref EngineNativeFrameCommandResults results)
+    {
+        switch (kind)
+        {
+            case EngineNativeConstants.FrameCommandRendererBeginFrame:
+            case EngineNativeConstants.FrameCommandRendererResizeFrame:
+            {
+                var begin = Marshal.PtrToStructure<EngineNativeFrameCommandBeginFrame>(payload);
+                IntPtr frameMemory;
+                EngineNativeStatus status = kind == EngineNativeConstants.FrameCommandRendererBeginFrame
+                    ? RendererBeginFrame(
+                        _rendererHandle,
+                        checked((nuint)begin.RequestedBytes),
+                        checked((nuint)begin.Alignment),
+                        out frameMemory)
+                    : RendererResizeFrame(
+                        _rendererHandle,
+                        checked((nuint)begin.RequestedBytes),
+                        checked((nuint)begin.Alignment),
+                        out frameMemory);
+                results.FrameMemory = frameMemory;
+                results.HasFrameMemory = status == EngineNativeStatus.Ok ? (byte)1 : (byte)0;
+                return status;
+            }
+            case EngineNativeConstants.FrameCommandRendererSubmit:
+            {
+                var submit = Marshal.PtrToStructure<EngineNativeFrameCommandSubmit>(payload);
+                IntPtr inlineItems = payload + Marshal.SizeOf<EngineNativeFrameCommandSubmit>();
+                IntPtr drawItems = submit.DrawItems;
+                if (drawItems == IntPtr.Zero)
+                {
+                    drawItems = inlineItems;
+                    inlineItems += checked((int)submit.DrawItemCount * Marshal.SizeOf<EngineNativeDrawItem>());
+                }
+
+                IntPtr uiItems = submit.UiItems != IntPtr.Zero ? submit.UiItems : inlineItems;
+                LastFrameCommandSubmit = submit;
+                var packet = new EngineNativeRenderPacket
+                {
+                    DrawItems = submit.DrawItemCount > 0u ? drawItems : IntPtr.Zero,
+                    DrawItemCount = submit.DrawItemCount,
+                    UiItems = submit.UiItemCount > 0u ? uiItems : IntPtr.Zero,
+                    UiItemCount = submit.UiItemCount,
+                    DebugViewMode = submit.DebugViewMode,
+                    Reserved0 = submit.RenderFeatureFlags,
+                    Reserved1 = 0,
+                    Reserved2 = 0
+                };
+                return RendererSubmit(_rendererHandle, in packet);
+            }
+            case EngineNativeConstants.FrameCommandRendererUiAppend:
+            {
+                var items = Marshal.PtrToStructure<EngineNativeFrameCommandItems>(payload);
+                return RendererUiAppend(
+                    _rendererHandle,
+                    payload + Marshal.SizeOf<EngineNativeFrameCommandItems>(),
+                    items.ItemCount);
+            }
+            case EngineNativeConstants.FrameCommandRendererPresent:
+            {
+                EngineNativeStatus status = RendererPresentWithStats(_rendererHandle, out var stats);
+                results.FrameStats = stats;
+                results.HasFrameStats = status == EngineNativeStatus.Ok ? (byte)1 : (byte)0;
+                return status;
+            }
+            case EngineNativeConstants.FrameCommandPhysicsSyncFromWorld:
+            {
+                var items = Marshal.PtrToStructure<EngineNativeFrameCommandItems>(payload);
+                return PhysicsSyncFromWorld(
+                    _physicsHandle,
+                    payload + Marshal.SizeOf<EngineNativeFrameCommandItems>(),
+                    items.ItemCount);
+            }
+            case EngineNativeConstants.FrameCommandPhysicsStep:
+                return PhysicsStep(
+                    _physicsHandle,
+                    Marshal.PtrToStructure<EngineNativeFrameCommandPhysicsStep>(payload).DtSeconds);
+            case EngineNativeConstants.FrameCommandPhysicsSyncToWorld:
+            {
+                var sync = Marshal.PtrToStructure<EngineNativeFrameCommandSyncToWorld>(payload);
+                EngineNativeStatus status = PhysicsSyncToWorld(
+                    _physicsHandle,
+                    sync.Reads,
+                    sync.ReadCapacity,
+                    out uint readCount);
+                results.PhysicsReadCount = readCount;
+                return status;
+            }
+            case EngineNativeConstants.FrameCommandAudioSetEmitterParams:
+            {
+                var emitter = Marshal.PtrToStructure<EngineNativeFrameCommandEmitterParams>(payload);
+                return AudioSetEmitterParams(_audioHandle, emitter.EmitterId, in emitter.Params);
+            }
+            case EngineNativeConstants.FrameCommandNetPump:
+            {
+                EngineNativeStatus status = NetPump(_netHandle, out var events);
+                results.NetEvents = events;
+                results.HasNetEvents = status == EngineNativeStatus.Ok ? (byte)1 : (byte)0;
+                return status;
+            }
+            default:
+                return EngineNativeStatus.InvalidArgument;
+        }
+    }
+
     public EngineNativeStatus ContentMountPak(IntPtr engine, string pakPath)
     {
         Calls.Add("content_mount_pak");
@@ -314,6 +517,325 @@ internal sealed class FakeNativeInteropApi : INativeInteropApi
         return EngineNativeStatus.Ok;
     }
 
+    public EngineNativeStatus ContentMapFile(
+        IntPtr engine,
+        string assetPath,
+        out IntPtr data,
+        out nuint size)
+    {
+        Calls.Add("content_map_file");
+        if (ContentMapFileStatus != EngineNativeStatus.Ok)
+        {
+            data = IntPtr.Zero;
+            size = 0u;
+            return ContentMapFileStatus;
+        }
+
+        data = ContentMappedDataToReturn;
+        size = ContentMappedSizeToReturn;
+        return EngineNativeStatus.Ok;
+    }
+
+    public EngineNativeStatus ContentReadFileAsync(
+        IntPtr engine,
+        string assetPath,
+        IntPtr buffer,
+        nuint bufferSize,
+        out ulong requestId)
+    {
+        Calls.Add("content_read_file_async");
+        requestId = 0u;
+        if (ContentReadFileAsyncStatus != EngineNativeStatus.Ok)
+        {
+            return ContentReadFileAsyncStatus;
+        }
+
+        requestId = _nextContentReadRequestId++;
+        ContentPendingReads.Add(requestId, assetPath);
+        return EngineNativeStatus.Ok;
+    }
+
+    public EngineNativeStatus ContentPollRead(
+        IntPtr engine,
+        ulong requestId,
+        out EngineNativeContentReadResult result,
+        out byte isReady)
+    {
+        Calls.Add("content_poll_read");
+        result = default;
+        isReady = 0;
+        if (!ContentPendingReads.TryGetValue(requestId, out string? assetPath))
+        {
+            return EngineNativeStatus.NotFound;
+        }
+
+        if (ContentReadPollsBeforeReady > 0)
+        {
+            ContentReadPollsBeforeReady--;
+            return EngineNativeStatus.Ok;
+        }
+
+        ContentPendingReads.Remove(requestId);
+        isReady = 1;
+        result = CreateContentReadResult(assetPath);
+        return EngineNativeStatus.Ok;
+    }
+
+    public EngineNativeStatus ContentFreeReadResult(IntPtr engine, ref EngineNativeContentReadResult result)
+    {
+        Calls.Add("content_free_read_result");
+        ContentReadResultsFreed++;
+        if (result.Data != IntPtr.Zero)
+        {
+            Marshal.FreeHGlobal(result.Data);
+        }
+
+        result = default;
+        return EngineNativeStatus.Ok;
+    }
+
+    public EngineNativeStatus ContentCancelRead(IntPtr engine, ulong requestId)
+    {
+        Calls.Add("content_cancel_read");
+        if (ContentCancelReadStatus != EngineNativeStatus.Ok)
+        {
+            return ContentCancelReadStatus;
+        }
+
+        return ContentPendingReads.Remove(requestId)
+            ? EngineNativeStatus.Ok
+            : EngineNativeStatus.NotFound;
+    }
+
+    public EngineNativeStatus ContentStreamRequest(
+        IntPtr engine,
+        string assetPath,
+        float priority,
+        IntPtr buffer,
+        nuint bufferSize,
+        out ulong requestId)
+    {
+        Calls.Add("content_stream_request");
+        requestId = _nextContentReadRequestId++;
+        ContentPendingStreams.Add(requestId, (assetPath, priority));
+        return EngineNativeStatus.Ok;
+    }
+
+    public EngineNativeStatus ContentStreamSetPriority(IntPtr engine, ulong requestId, float priority)
+    {
+        Calls.Add("content_stream_set_priority");
+        if (!ContentPendingStreams.TryGetValue(requestId, out (string AssetPath, float Priority) request))
+        {
+            return EngineNativeStatus.NotFound;
+        }
+
+        ContentPendingStreams[requestId] = (request.AssetPath, priority);
+        return EngineNativeStatus.Ok;
+    }
+
+    public EngineNativeStatus ContentStreamCancel(IntPtr engine, ulong requestId)
+    {
+        Calls.Add("content_stream_cancel");
+        ContentIssuedStreams.Remove(requestId);
+        return ContentPendingStreams.Remove(requestId)
+            ? EngineNativeStatus.Ok
+            : EngineNativeStatus.NotFound;
+    }
+
+    public EngineNativeStatus ContentStreamPoll(
+        IntPtr engine,
+        ulong requestId,
+        out EngineNativeContentReadResult result,
+        out byte isReady)
+    {
+        Calls.Add("content_stream_poll");
+        result = default;
+        isReady = 0;
+        if (!ContentPendingStreams.TryGetValue(requestId, out (string AssetPath, float Priority) request))
+        {
+            return EngineNativeStatus.NotFound;
+        }
+
+        if (!ContentIssuedStreams.Remove(requestId))
+        {
+            return EngineNativeStatus.Ok;
+        }
+
+        ContentPendingStreams.Remove(requestId);
+        isReady = 1;
+        result = CreateContentReadResult(request.AssetPath);
+        return EngineNativeStatus.Ok;
+    }
+
+    public EngineNativeStatus ContentStreamSetFrameBudget(IntPtr engine, ulong budgetBytes)
+    {
+        Calls.Add("content_stream_set_frame_budget");
+        ContentStreamFrameBudget = budgetBytes;
+        return EngineNativeStatus.Ok;
+    }
+
+    public EngineNativeStatus ContentStreamUpdate(IntPtr engine)
+    {
+        Calls.Add("content_stream_update");
+        ContentIssuedStreams.UnionWith(ContentPendingStreams.Keys);
+        return EngineNativeStatus.Ok;
+    }
+
+    public EngineNativeStatus ContentSetCacheBudget(IntPtr engine, ulong budgetBytes)
+    {
+        Calls.Add("content_set_cache_budget");
+        ContentCacheBudget = budgetBytes;
+        return EngineNativeStatus.Ok;
+    }
+
+    public EngineNativeStatus ContentAcquireFile(
+        IntPtr engine,
+        string assetPath,
+        out IntPtr data,
+        out nuint size)
+    {
+        Calls.Add("content_acquire_file");
+        data = IntPtr.Zero;
+        size = 0u;
+        if (!ContentFilesToReturn.TryGetValue(assetPath, out byte[]? bytes))
+        {
+            return EngineNativeStatus.NotFound;
+        }
+
+        foreach ((IntPtr acquired, (string AssetPath, int Pins) entry) in ContentAcquiredFiles)
+        {
+            if (entry.AssetPath == assetPath)
+            {
+                ContentAcquiredFiles[acquired] = (assetPath, entry.Pins + 1);
+                data = acquired;
+                size = (nuint)bytes.Length;
+                return EngineNativeStatus.Ok;
+            }
+        }
+
+        data = new IntPtr(0x7000 + (_nextContentAcquiredSlot++ * 0x100));
+        size = (nuint)bytes.Length;
+        ContentAcquiredFiles.Add(data, (assetPath, 1));
+        return EngineNativeStatus.Ok;
+    }
+
+    public EngineNativeStatus ContentReleaseFile(IntPtr engine, IntPtr data)
+    {
+        Calls.Add("content_release_file");
+        if (data == IntPtr.Zero)
+        {
+            return EngineNativeStatus.Ok;
+        }
+
+        if (!ContentAcquiredFiles.TryGetValue(data, out (string AssetPath, int Pins) entry))
+        {
+            return EngineNativeStatus.NotFound;
+        }
+
+        if (entry.Pins > 1)
+        {
+            ContentAcquiredFiles[data] = (entry.AssetPath, entry.Pins - 1);
+        }
+        else
+        {
+            ContentAcquiredFiles.Remove(data);
+        }
+
+        return EngineNativeStatus.Ok;
+    }
+
+    public EngineNativeStatus ContentReadFileRange(
+        IntPtr engine,
+        string assetPath,
+        ulong offsetBytes,
+        IntPtr buffer,
+        nuint length,
+        out nuint outSize)
+    {
+        Calls.Add("content_read_file_range");
+        outSize = 0u;
+        if (buffer == IntPtr.Zero && length != 0u)
+        {
+            return EngineNativeStatus.InvalidArgument;
+        }
+
+        if (!ContentFilesToReturn.TryGetValue(assetPath, out byte[]? bytes))
+        {
+            return EngineNativeStatus.NotFound;
+        }
+
+        if (offsetBytes > (ulong)bytes.Length)
+        {
+            return EngineNativeStatus.InvalidArgument;
+        }
+
+        int count = (int)Math.Min((ulong)length, (ulong)bytes.Length - offsetBytes);
+        if (count > 0)
+        {
+            Marshal.Copy(bytes, (int)offsetBytes, buffer, count);
+        }
+
+        outSize = (nuint)count;
+        return EngineNativeStatus.Ok;
+    }
+
+    public EngineNativeStatus ContentReadByKey(
+        IntPtr engine,
+        ulong assetKey,
+        IntPtr buffer,
+        nuint bufferSize,
+        out nuint outSize)
+    {
+        Calls.Add("content_read_by_key");
+        outSize = 0u;
+        if (assetKey == 0u || (buffer == IntPtr.Zero && bufferSize != 0u))
+        {
+            return EngineNativeStatus.InvalidArgument;
+        }
+
+        if (!ContentKeysToReturn.TryGetValue(assetKey, out byte[]? bytes))
+        {
+            return EngineNativeStatus.NotFound;
+        }
+
+        outSize = (nuint)bytes.Length;
+        if (buffer == IntPtr.Zero)
+        {
+            return EngineNativeStatus.Ok;
+        }
+
+        if (bufferSize < (nuint)bytes.Length)
+        {
+            return EngineNativeStatus.InvalidArgument;
+        }
+
+        if (bytes.Length > 0)
+        {
+            Marshal.Copy(bytes, 0, buffer, bytes.Length);
+        }
+
+        return EngineNativeStatus.Ok;
+    }
+
+    private EngineNativeContentReadResult CreateContentReadResult(string assetPath)
+    {
+        EngineNativeContentReadResult result = default;
+        if (!ContentFilesToReturn.TryGetValue(assetPath, out byte[]? bytes))
+        {
+            result.Status = EngineNativeStatus.NotFound;
+            return result;
+        }
+
+        result.Size = checked((nuint)bytes.Length);
+        if (bytes.Length > 0)
+        {
+            result.Data = Marshal.AllocHGlobal(bytes.Length);
+            Marshal.Copy(bytes, 0, result.Data, bytes.Length);
+        }
+
+        return result;
+    }
+
     public EngineNativeStatus RendererBeginFrame(
         IntPtr renderer,
         nuint requestedBytes,
@@ -321,10 +843,23 @@ internal sealed class FakeNativeInteropApi : INativeInteropApi
         out IntPtr frameMemory)
     {
         Calls.Add("renderer_begin_frame");
+        LastFrameRequestedBytes = requestedBytes;
         frameMemory = RendererBeginFrameStatus == EngineNativeStatus.Ok ? RendererBeginFrameMemory : IntPtr.Zero;
         return RendererBeginFrameStatus;
     }
 
+    public EngineNativeStatus RendererResizeFrame(
+        IntPtr renderer,
+        nuint requestedBytes,
+        nuint alignment,
+        out IntPtr frameMemory)
+    {
+        Calls.Add("renderer_resize_frame");
+        LastFrameRequestedBytes = requestedBytes;
+        frameMemory = RendererResizeFrameStatus == EngineNativeStatus.Ok ? RendererBeginFrameMemory : IntPtr.Zero;
+        return RendererResizeFrameStatus;
+    }
+
     public EngineNativeStatus RendererSubmit(IntPtr renderer, in EngineNativeRenderPacket packet)
     {
         Calls.Add("renderer_submit");
@@ -428,6 +963,29 @@ internal sealed class FakeNativeInteropApi : INativeInteropApi
         return RendererGetLastFrameStatsStatus;
     }
 
+    public EngineNativeStatus RendererPrewarmPipelines(
+        IntPtr renderer,
+        IntPtr items,
+        uint itemCount)
+    {
+        Calls.Add("renderer_prewarm_pipelines");
+        if (itemCount > 0 && items == IntPtr.Zero)
+        {
+            return EngineNativeStatus.InvalidArgument;
+        }
+
+        return RendererPrewarmPipelinesStatus;
+    }
+
+    public EngineNativeStatus RendererGetPipelinePrewarmProgress(
+        IntPtr renderer,
+        out EngineNativePipelinePrewarmProgress progress)
+    {
+        Calls.Add("renderer_get_pipeline_prewarm_progress");
+        progress = RendererPipelinePrewarmProgressToReturn;
+        return EngineNativeStatus.Ok;
+    }
+
     public EngineNativeStatus RendererUiReset(IntPtr renderer)
     {
         Calls.Add("renderer_ui_reset");
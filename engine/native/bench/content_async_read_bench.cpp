@@ -0,0 +1,136 @@
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "content/content_read_queue.h"
+#include "content/content_runtime.h"
+
+namespace {
+
+constexpr uint32_t kAssetCount = 256u;
+constexpr size_t kAssetBytes = 256u * 1024u;
+constexpr uint32_t kReadsPerFrame = 8u;
+
+using dff::native::content::ContentReadQueue;
+using dff::native::content::ContentRuntime;
+
+std::string AssetPath(uint32_t index) {
+  return "streamed/asset_" + std::to_string(index) + ".bin";
+}
+
+void WriteBenchAssets(const std::filesystem::path& root) {
+  const std::string payload(kAssetBytes, 's');
+  for (uint32_t i = 0u; i < kAssetCount; ++i) {
+    const std::filesystem::path path = root / AssetPath(i);
+    std::filesystem::create_directories(path.parent_path());
+    std::ofstream stream(path, std::ios::binary | std::ios::trunc);
+    stream.write(payload.data(), static_cast<std::streamsize>(payload.size()));
+  }
+}
+
+uint64_t ElapsedNs(std::chrono::steady_clock::time_point start) {
+  return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                   std::chrono::steady_clock::now() - start)
+                                   .count());
+}
+
+}  // namespace
+
+int main() {
+  const std::filesystem::path root =
+      std::filesystem::temp_directory_path() / "dff_native_content_async_read_bench";
+  std::filesystem::remove_all(root);
+  WriteBenchAssets(root);
+
+  ContentRuntime runtime;
+  if (runtime.MountDirectory(root.string()) != ENGINE_NATIVE_STATUS_OK) {
+    std::printf("failed to mount bench directory\n");
+    return 1;
+  }
+
+  std::vector<uint8_t> buffer(kAssetBytes);
+  uint64_t checksum = 0u;
+  size_t out_size = 0u;
+
+  // Baseline: every streamed read blocks the frame that requested it.
+  uint64_t sync_worst_frame_ns = 0u;
+  auto start = std::chrono::steady_clock::now();
+  for (uint32_t first = 0u; first < kAssetCount; first += kReadsPerFrame) {
+    const auto frame_start = std::chrono::steady_clock::now();
+    for (uint32_t i = first; i < first + kReadsPerFrame; ++i) {
+      static_cast<void>(runtime.ReadFile(AssetPath(i), buffer.data(), buffer.size(),
+                                         &out_size));
+      checksum += buffer[0];
+    }
+    sync_worst_frame_ns = std::max(sync_worst_frame_ns, ElapsedNs(frame_start));
+  }
+  const uint64_t sync_total_ns = ElapsedNs(start);
+
+  ContentReadQueue queue(runtime);
+  uint64_t async_caller_ns = 0u;
+  uint64_t async_worst_frame_ns = 0u;
+  std::vector<uint64_t> pending;
+  uint32_t next_asset = 0u;
+  start = std::chrono::steady_clock::now();
+  while (next_asset < kAssetCount || !pending.empty()) {
+    const auto frame_start = std::chrono::steady_clock::now();
+    for (uint32_t i = 0u; i < kReadsPerFrame && next_asset < kAssetCount; ++i) {
+      uint64_t request_id = 0u;
+      static_cast<void>(queue.Submit(AssetPath(next_asset++), nullptr, 0u, &request_id));
+      pending.push_back(request_id);
+    }
+    for (size_t i = 0u; i < pending.size();) {
+      engine_native_content_read_result_t result{};
+      uint8_t is_ready = 0u;
+      static_cast<void>(queue.Poll(pending[i], &result, &is_ready));
+      if (is_ready == 0u) {
+        ++i;
+        continue;
+      }
+      checksum += result.data != nullptr ? result.data[0] : 0u;
+      static_cast<void>(queue.FreeResult(&result));
+      pending[i] = pending.back();
+      pending.pop_back();
+    }
+    const uint64_t frame_ns = ElapsedNs(frame_start);
+    async_caller_ns += frame_ns;
+    async_worst_frame_ns = std::max(async_worst_frame_ns, frame_ns);
+    std::this_thread::sleep_for(std::chrono::microseconds(200));
+  }
+  const uint64_t async_total_ns = ElapsedNs(start);
+
+  engine_native_content_read_stats_t stats{};
+  static_cast<void>(queue.GetStats(&stats));
+  std::filesystem::remove_all(root);
+
+  std::printf("assets: %u x %zu bytes, reads per frame: %u, workers: %u\n",
+              kAssetCount, kAssetBytes, kReadsPerFrame, stats.worker_count);
+  std::printf("%8s %16s %16s %14s\n", "path", "caller_ns/read", "worst_frame_ns",
+              "total_ms");
+  std::printf("%8s %16.0f %16llu %14.2f\n", "sync",
+              static_cast<double>(sync_total_ns) / kAssetCount,
+              static_cast<unsigned long long>(sync_worst_frame_ns),
+              static_cast<double>(sync_total_ns) / 1e6);
+  std::printf("%8s %16.0f %16llu %14.2f\n", "async",
+              static_cast<double>(async_caller_ns) / kAssetCount,
+              static_cast<unsigned long long>(async_worst_frame_ns),
+              static_cast<double>(async_total_ns) / 1e6);
+  std::printf("queue: max depth %u, mean latency %.0f ns, max latency %llu ns\n",
+              stats.max_queue_depth,
+              stats.completed_count == 0u
+                  ? 0.0
+                  : static_cast<double>(stats.total_latency_ns) /
+                        static_cast<double>(stats.completed_count),
+              static_cast<unsigned long long>(stats.max_latency_ns));
+  if (checksum == 0u) {
+    std::printf(" ");
+  }
+  return 0;
+}
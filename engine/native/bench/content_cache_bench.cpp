@@ -0,0 +1,112 @@
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "content/content_runtime.h"
+
+namespace {
+
+constexpr uint32_t kAssetCount = 64u;
+constexpr size_t kAssetBytes = 64u * 1024u;
+constexpr uint32_t kPasses = 16u;
+constexpr uint64_t kCacheBudgetBytes = 8u * 1024u * 1024u;
+
+using dff::native::content::ContentRuntime;
+
+std::string AssetPath(uint32_t index) {
+  return "shared/material_" + std::to_string(index) + ".bin";
+}
+
+void WriteBenchAssets(const std::filesystem::path& root) {
+  const std::string payload(kAssetBytes, 'm');
+  for (uint32_t i = 0u; i < kAssetCount; ++i) {
+    const std::filesystem::path path = root / AssetPath(i);
+    std::filesystem::create_directories(path.parent_path());
+    std::ofstream stream(path, std::ios::binary | std::ios::trunc);
+    stream.write(payload.data(), static_cast<std::streamsize>(payload.size()));
+  }
+}
+
+double NanosecondsPerOp(std::chrono::steady_clock::time_point start,
+                        size_t operations) {
+  const auto elapsed = std::chrono::steady_clock::now() - start;
+  return static_cast<double>(
+             std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count()) /
+         static_cast<double>(operations);
+}
+
+// Re-requests the same set of loose assets every pass, as a scene switch
+// re-requesting shared materials and atlases would.
+double MeasureReads(const ContentRuntime& runtime, uint64_t* checksum) {
+  std::vector<uint8_t> buffer(kAssetBytes);
+  size_t out_size = 0u;
+  const auto start = std::chrono::steady_clock::now();
+  for (uint32_t pass = 0u; pass < kPasses; ++pass) {
+    for (uint32_t i = 0u; i < kAssetCount; ++i) {
+      static_cast<void>(runtime.ReadFile(AssetPath(i), buffer.data(),
+                                         buffer.size(), &out_size));
+      *checksum += buffer[0];
+    }
+  }
+  return NanosecondsPerOp(start, static_cast<size_t>(kAssetCount) * kPasses);
+}
+
+double MeasureAcquires(const ContentRuntime& runtime, uint64_t* checksum) {
+  size_t out_size = 0u;
+  const auto start = std::chrono::steady_clock::now();
+  for (uint32_t pass = 0u; pass < kPasses; ++pass) {
+    for (uint32_t i = 0u; i < kAssetCount; ++i) {
+      const void* data = nullptr;
+      static_cast<void>(runtime.AcquireFile(AssetPath(i), &data, &out_size));
+      *checksum += static_cast<const uint8_t*>(data)[0];
+      static_cast<void>(runtime.ReleaseFile(data));
+    }
+  }
+  return NanosecondsPerOp(start, static_cast<size_t>(kAssetCount) * kPasses);
+}
+
+}  // namespace
+
+int main() {
+  const std::filesystem::path root =
+      std::filesystem::temp_directory_path() / "dff_native_content_cache_bench";
+  std::filesystem::remove_all(root);
+  WriteBenchAssets(root);
+
+  ContentRuntime runtime;
+  if (runtime.MountDirectory(root.string()) != ENGINE_NATIVE_STATUS_OK) {
+    std::printf("failed to mount bench directory\n");
+    return 1;
+  }
+
+  uint64_t checksum = 0u;
+  const double uncached_ns = MeasureReads(runtime, &checksum);
+  static_cast<void>(runtime.SetCacheBudget(kCacheBudgetBytes));
+  const double cached_ns = MeasureReads(runtime, &checksum);
+  const double acquire_ns = MeasureAcquires(runtime, &checksum);
+
+  engine_native_content_cache_stats_t stats{};
+  static_cast<void>(runtime.GetCacheStats(&stats));
+  std::filesystem::remove_all(root);
+
+  std::printf("assets: %u x %zu bytes, passes: %u, budget: %llu bytes\n",
+              kAssetCount, kAssetBytes, kPasses,
+              static_cast<unsigned long long>(kCacheBudgetBytes));
+  std::printf("%14s %12s\n", "path", "read_ns");
+  std::printf("%14s %12.2f\n", "uncached_read", uncached_ns);
+  std::printf("%14s %12.2f\n", "cached_read", cached_ns);
+  std::printf("%14s %12.2f\n", "acquire", acquire_ns);
+  std::printf("hits: %llu, misses: %llu, inserts: %llu\n",
+              static_cast<unsigned long long>(stats.hit_count),
+              static_cast<unsigned long long>(stats.miss_count),
+              static_cast<unsigned long long>(stats.insert_count));
+  if (checksum == 0u) {
+    std::printf(" ");
+  }
+  return 0;
+}
@@ -0,0 +1,184 @@
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "content/mapped_file.h"
+#include "content/pak_index.h"
+
+namespace {
+
+constexpr uint32_t kPakMagic = 0x50464644u;  // DFFP
+constexpr uint32_t kPakVersionLegacy = 3u;
+constexpr uint32_t kAssetCount = 4096u;
+constexpr size_t kAssetBytes = 512u;
+constexpr uint32_t kPasses = 4u;
+
+using dff::native::content::PakAssetEntry;
+
+// Baseline: the per-read ifstream path the mapped mount replaced.
+engine_native_status_t LegacyReadPakAssetBytes(const std::filesystem::path& pak_path,
+                                               const PakAssetEntry& entry,
+                                               void* buffer,
+                                               size_t buffer_size,
+                                               size_t* out_size) {
+  *out_size = static_cast<size_t>(entry.size_bytes);
+  if (buffer_size < static_cast<size_t>(entry.size_bytes)) {
+    return ENGINE_NATIVE_STATUS_INVALID_ARGUMENT;
+  }
+
+  std::ifstream stream(pak_path, std::ios::binary | std::ios::ate);
+  if (!stream.is_open()) {
+    return ENGINE_NATIVE_STATUS_NOT_FOUND;
+  }
+
+  const uint64_t file_size = static_cast<uint64_t>(stream.tellg());
+  if (entry.offset_bytes > file_size ||
+      entry.size_bytes > file_size - entry.offset_bytes) {
+    return ENGINE_NATIVE_STATUS_INTERNAL_ERROR;
+  }
+
+  stream.seekg(static_cast<std::streamoff>(entry.offset_bytes), std::ios::beg);
+  stream.read(static_cast<char*>(buffer),
+              static_cast<std::streamsize>(entry.size_bytes));
+  return stream.gcount() == static_cast<std::streamsize>(entry.size_bytes)
+             ? ENGINE_NATIVE_STATUS_OK
+             : ENGINE_NATIVE_STATUS_INTERNAL_ERROR;
+}
+
+void WriteString(std::ostream* stream, const std::string& value) {
+  uint32_t length = static_cast<uint32_t>(value.size());
+  while (length >= 0x80u) {
+    stream->put(static_cast<char>((length & 0x7Fu) | 0x80u));
+    length >>= 7u;
+  }
+  stream->put(static_cast<char>(length));
+  stream->write(value.data(), static_cast<std::streamsize>(value.size()));
+}
+
+void WriteBenchPak(const std::filesystem::path& pak_path) {
+  std::vector<std::string> paths;
+  size_t index_size = 0u;
+  for (uint32_t i = 0u; i < kAssetCount; ++i) {
+    paths.push_back("assets/bench/asset_" + std::to_string(i) + ".bin");
+    index_size += 1u + paths.back().size() + 4u + 1u + 1u +
+                  sizeof(int64_t) * 2u;
+  }
+
+  std::ofstream stream(pak_path, std::ios::binary | std::ios::trunc);
+  const int32_t entry_count = static_cast<int32_t>(kAssetCount);
+  const uint32_t reserved = 0u;
+  const int64_t created_at_ticks = 0;
+  stream.write(reinterpret_cast<const char*>(&kPakMagic), sizeof(kPakMagic));
+  stream.write(reinterpret_cast<const char*>(&kPakVersionLegacy),
+               sizeof(kPakVersionLegacy));
+  stream.write(reinterpret_cast<const char*>(&entry_count), sizeof(entry_count));
+  stream.write(reinterpret_cast<const char*>(&reserved), sizeof(reserved));
+  stream.write(reinterpret_cast<const char*>(&created_at_ticks),
+               sizeof(created_at_ticks));
+
+  int64_t next_offset = static_cast<int64_t>(24u + index_size);
+  for (const std::string& path : paths) {
+    WriteString(&stream, path);
+    WriteString(&stream, "raw");
+    WriteString(&stream, "");
+    WriteString(&stream, "");
+    const int64_t size_bytes = static_cast<int64_t>(kAssetBytes);
+    stream.write(reinterpret_cast<const char*>(&next_offset), sizeof(next_offset));
+    stream.write(reinterpret_cast<const char*>(&size_bytes), sizeof(size_bytes));
+    next_offset += size_bytes;
+  }
+
+  const std::string payload(kAssetBytes, 'x');
+  for (uint32_t i = 0u; i < kAssetCount; ++i) {
+    stream.write(payload.data(), static_cast<std::streamsize>(payload.size()));
+  }
+}
+
+double NanosecondsPerOp(std::chrono::steady_clock::time_point start,
+                        size_t operations) {
+  const auto elapsed = std::chrono::steady_clock::now() - start;
+  return static_cast<double>(
+             std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count()) /
+         static_cast<double>(operations);
+}
+
+}  // namespace
+
+int main() {
+  const std::filesystem::path pak_path =
+      std::filesystem::temp_directory_path() / "dff_native_content_read_bench.pak";
+  WriteBenchPak(pak_path);
+
+  dff::native::content::MappedFile mapping;
+  dff::native::content::PakIndex index;
+  if (mapping.Open(pak_path) != ENGINE_NATIVE_STATUS_OK ||
+      index.Load(mapping.data(), mapping.size()) != ENGINE_NATIVE_STATUS_OK) {
+    std::printf("failed to open bench pak\n");
+    return 1;
+  }
+
+  std::vector<PakAssetEntry> order(kAssetCount);
+  for (uint32_t i = 0u; i < kAssetCount; ++i) {
+    const std::string path = "assets/bench/asset_" + std::to_string(i) + ".bin";
+    if (!index.Find(path, &order[i])) {
+      std::printf("missing bench asset %s\n", path.c_str());
+      return 1;
+    }
+  }
+
+  const size_t reads = order.size() * kPasses;
+  std::vector<uint8_t> buffer(kAssetBytes);
+  uint64_t checksum = 0u;
+  size_t out_size = 0u;
+
+  auto start = std::chrono::steady_clock::now();
+  for (uint32_t pass = 0u; pass < kPasses; ++pass) {
+    for (const PakAssetEntry& entry : order) {
+      static_cast<void>(LegacyReadPakAssetBytes(pak_path, entry, buffer.data(),
+                                                buffer.size(), &out_size));
+      checksum += buffer[0];
+    }
+  }
+  const double legacy_ns = NanosecondsPerOp(start, reads);
+
+  start = std::chrono::steady_clock::now();
+  for (uint32_t pass = 0u; pass < kPasses; ++pass) {
+    for (const PakAssetEntry& entry : order) {
+      static_cast<void>(dff::native::content::ReadPakAssetBytes(
+          mapping.data(), mapping.size(), entry, buffer.data(), buffer.size(),
+          &out_size));
+      checksum += buffer[0];
+    }
+  }
+  const double mapped_copy_ns = NanosecondsPerOp(start, reads);
+
+  start = std::chrono::steady_clock::now();
+  for (uint32_t pass = 0u; pass < kPasses; ++pass) {
+    for (const PakAssetEntry& entry : order) {
+      const void* data = nullptr;
+      static_cast<void>(dff::native::content::MapPakAsset(
+          mapping.data(), mapping.size(), entry, &data, &out_size));
+      checksum += static_cast<const uint8_t*>(data)[0];
+    }
+  }
+  const double mapped_view_ns = NanosecondsPerOp(start, reads);
+
+  mapping.Close();
+  std::filesystem::remove(pak_path);
+
+  std::printf("assets: %u x %zu bytes, passes: %u\n", kAssetCount, kAssetBytes,
+              kPasses);
+  std::printf("%14s %12s\n", "path", "read_ns");
+  std::printf("%14s %12.2f\n", "ifstream", legacy_ns);
+  std::printf("%14s %12.2f\n", "mapped_copy", mapped_copy_ns);
+  std::printf("%14s %12.2f\n", "mapped_view", mapped_view_ns);
+  if (checksum == 0u) {
+    std::printf(" ");
+  }
+  return 0;
+}
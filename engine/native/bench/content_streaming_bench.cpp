@@ -0,0 +1,146 @@
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "content/content_read_queue.h"
+#include "content/content_runtime.h"
+#include "content/streaming_scheduler.h"
+
+namespace {
+
+constexpr uint32_t kAssetCount = 256u;
+constexpr size_t kAssetBytes = 128u * 1024u;
+constexpr uint32_t kNearAssetCount = 16u;
+constexpr uint64_t kFrameBudgetBytes = 2u * 1024u * 1024u;
+
+using dff::native::content::ContentReadQueue;
+using dff::native::content::ContentRuntime;
+using dff::native::content::StreamingScheduler;
+
+std::string AssetPath(uint32_t index) {
+  return "level/chunk_" + std::to_string(index) + ".bin";
+}
+
+void WriteBenchAssets(const std::filesystem::path& root) {
+  const std::string payload(kAssetBytes, 'l');
+  for (uint32_t i = 0u; i < kAssetCount; ++i) {
+    const std::filesystem::path path = root / AssetPath(i);
+    std::filesystem::create_directories(path.parent_path());
+    std::ofstream stream(path, std::ios::binary | std::ios::trunc);
+    stream.write(payload.data(), static_cast<std::streamsize>(payload.size()));
+  }
+}
+
+uint64_t ElapsedNs(std::chrono::steady_clock::time_point start) {
+  return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                   std::chrono::steady_clock::now() - start)
+                                   .count());
+}
+
+struct BurstResult {
+  uint64_t near_ready_ns = 0u;
+  uint64_t all_ready_ns = 0u;
+  uint32_t frames = 0u;
+  uint64_t worst_frame_bytes = 0u;
+};
+
+// Simulates a level transition: every chunk is requested on the same frame
+// and the chunks nearest the camera gate the first rendered frame.
+BurstResult RunBurst(const ContentRuntime& runtime,
+                     const std::vector<float>& distances,
+                     bool scheduled) {
+  ContentReadQueue reads(runtime);
+  StreamingScheduler scheduler(runtime, reads);
+  static_cast<void>(scheduler.SetFrameBudget(scheduled ? kFrameBudgetBytes : 0u));
+
+  std::vector<uint64_t> request_ids(kAssetCount, 0u);
+  for (uint32_t i = 0u; i < kAssetCount; ++i) {
+    static_cast<void>(scheduler.Request(AssetPath(i),
+                                        scheduled ? distances[i] : 0.0f, nullptr,
+                                        0u, &request_ids[i]));
+  }
+
+  BurstResult result;
+  uint32_t near_remaining = kNearAssetCount;
+  size_t remaining = kAssetCount;
+  const auto start = std::chrono::steady_clock::now();
+  while (remaining > 0u) {
+    static_cast<void>(scheduler.Update());
+    engine_native_content_stream_stats_t stats{};
+    static_cast<void>(scheduler.GetStats(&stats));
+    result.worst_frame_bytes =
+        std::max(result.worst_frame_bytes, stats.last_frame_issued_bytes);
+    ++result.frames;
+
+    for (uint32_t i = 0u; i < kAssetCount; ++i) {
+      if (request_ids[i] == 0u) {
+        continue;
+      }
+      engine_native_content_read_result_t read{};
+      uint8_t is_ready = 0u;
+      static_cast<void>(scheduler.Poll(request_ids[i], &read, &is_ready));
+      if (is_ready == 0u) {
+        continue;
+      }
+      static_cast<void>(reads.FreeResult(&read));
+      request_ids[i] = 0u;
+      --remaining;
+      if (distances[i] < static_cast<float>(kNearAssetCount) &&
+          --near_remaining == 0u) {
+        result.near_ready_ns = ElapsedNs(start);
+      }
+    }
+    std::this_thread::sleep_for(std::chrono::microseconds(500));
+  }
+  result.all_ready_ns = ElapsedNs(start);
+  return result;
+}
+
+}  // namespace
+
+int main() {
+  const std::filesystem::path root =
+      std::filesystem::temp_directory_path() / "dff_native_content_streaming_bench";
+  std::filesystem::remove_all(root);
+  WriteBenchAssets(root);
+
+  ContentRuntime runtime;
+  if (runtime.MountDirectory(root.string()) != ENGINE_NATIVE_STATUS_OK) {
+    std::printf("failed to mount bench directory\n");
+    return 1;
+  }
+
+  std::vector<float> distances(kAssetCount);
+  for (uint32_t i = 0u; i < kAssetCount; ++i) {
+    distances[i] = static_cast<float>(i);
+  }
+  std::mt19937 rng(7u);
+  std::shuffle(distances.begin(), distances.end(), rng);
+
+  const BurstResult fifo = RunBurst(runtime, distances, false);
+  const BurstResult scheduled = RunBurst(runtime, distances, true);
+  std::filesystem::remove_all(root);
+
+  std::printf("assets: %u x %zu bytes, near set: %u, budget: %llu bytes/frame\n",
+              kAssetCount, kAssetBytes, kNearAssetCount,
+              static_cast<unsigned long long>(kFrameBudgetBytes));
+  std::printf("%10s %14s %14s %8s %18s\n", "issue", "near_ready_ms",
+              "all_ready_ms", "frames", "worst_frame_bytes");
+  const auto print_row = [](const char* name, const BurstResult& result) {
+    std::printf("%10s %14.2f %14.2f %8u %18llu\n", name,
+                static_cast<double>(result.near_ready_ns) / 1e6,
+                static_cast<double>(result.all_ready_ns) / 1e6, result.frames,
+                static_cast<unsigned long long>(result.worst_frame_bytes));
+  };
+  print_row("fifo", fifo);
+  print_row("scheduled", scheduled);
+  return 0;
+}
@@ -0,0 +1,247 @@
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "content/content_runtime.h"
+#include "content/mapped_file.h"
+#include "content/pak_index.h"
+#include "content/vfs_index.h"
+
+namespace {
+
+constexpr uint32_t kPakMagic = 0x50464644u;  // DFFP
+constexpr uint32_t kPakCount = 8u;
+constexpr uint32_t kAssetsPerPak = 25000u;
+constexpr size_t kReadCount = 200000u;
+
+using dff::native::content::ContentRuntime;
+using dff::native::content::HashAssetKey;
+using dff::native::content::HashPakPath;
+using dff::native::content::MappedFile;
+using dff::native::content::PakAssetEntry;
+using dff::native::content::PakIndex;
+using dff::native::content::VfsEntry;
+using dff::native::content::VfsIndex;
+using dff::native::content::VfsSource;
+
+template <typename T>
+void Append(std::vector<uint8_t>* bytes, const T& value) {
+  const size_t offset = bytes->size();
+  bytes->resize(offset + sizeof(T));
+  std::memcpy(bytes->data() + offset, &value, sizeof(T));
+}
+
+std::string AssetPath(uint32_t pak, uint32_t i) {
+  return "assets/pak_" + std::to_string(pak) + "/asset_" + std::to_string(i) +
+         ".bin";
+}
+
+void WriteHashedPak(const std::filesystem::path& path, uint32_t pak) {
+  std::vector<std::pair<uint64_t, uint32_t>> order;
+  std::vector<std::string> paths;
+  std::string strings;
+  for (uint32_t i = 0u; i < kAssetsPerPak; ++i) {
+    paths.push_back(AssetPath(pak, i));
+    order.emplace_back(HashPakPath(paths.back()), i);
+  }
+  std::sort(order.begin(), order.end());
+
+  uint32_t bucket_bits = 0u;
+  while ((uint32_t{1} << bucket_bits) < kAssetsPerPak) {
+    ++bucket_bits;
+  }
+  const uint32_t bucket_count = uint32_t{1} << bucket_bits;
+  const uint64_t toc_offset = 64u;
+  const uint64_t buckets_offset = toc_offset + uint64_t{kAssetsPerPak} * 56u;
+  const uint64_t strings_offset =
+      buckets_offset + (uint64_t{bucket_count} + 1u) * sizeof(uint32_t);
+  std::vector<uint32_t> string_offsets(kAssetsPerPak);
+  for (uint32_t i = 0u; i < kAssetsPerPak; ++i) {
+    string_offsets[i] = static_cast<uint32_t>(strings.size());
+    strings += paths[i];
+  }
+  const uint64_t payload_offset = strings_offset + strings.size();
+
+  std::vector<uint8_t> bytes;
+  Append(&bytes, kPakMagic);
+  Append(&bytes, uint32_t{4u});
+  Append(&bytes, static_cast<int32_t>(kAssetsPerPak));
+  Append(&bytes, uint32_t{0u});
+  Append(&bytes, int64_t{0});
+  Append(&bytes, toc_offset);
+  Append(&bytes, strings_offset);
+  Append(&bytes, static_cast<uint64_t>(strings.size()));
+  Append(&bytes, buckets_offset);
+  Append(&bytes, bucket_bits);
+  Append(&bytes, uint32_t{0u});
+  for (const auto& [hash, index] : order) {
+    Append(&bytes, hash);
+    Append(&bytes, payload_offset);
+    Append(&bytes, uint64_t{8u});
+    Append(&bytes, string_offsets[index]);
+    Append(&bytes, static_cast<uint32_t>(paths[index].size()));
+    for (uint32_t field = 0u; field < 4u; ++field) {
+      Append(&bytes, uint32_t{0u});
+    }
+    Append(&bytes, string_offsets[index]);
+    Append(&bytes, static_cast<uint32_t>(paths[index].size()));
+  }
+  uint32_t next_record = 0u;
+  for (uint32_t bucket = 0u; bucket <= bucket_count; ++bucket) {
+    while (next_record < kAssetsPerPak &&
+           (order[next_record].first >> (64u - bucket_bits)) < bucket) {
+      ++next_record;
+    }
+    Append(&bytes, next_record);
+  }
+  bytes.insert(bytes.end(), strings.begin(), strings.end());
+  bytes.resize(bytes.size() + 8u, 0x5Au);
+
+  std::ofstream stream(path, std::ios::binary | std::ios::trunc);
+  stream.write(reinterpret_cast<const char*>(bytes.data()),
+               static_cast<std::streamsize>(bytes.size()));
+}
+
+// Baseline: the per-mount walk the merged index replaced. Every pak is asked
+// newest first before any directory root is probed.
+class LegacyMountWalk {
+ public:
+  void AddPak(const std::filesystem::path& path) {
+    paks_.emplace_back();
+    paks_.back().first.Open(path);
+    paks_.back().second.Load(paks_.back().first.data(),
+                             paks_.back().first.size());
+  }
+
+  bool Resolve(std::string_view path, PakAssetEntry* out_entry) const {
+    for (auto it = paks_.rbegin(); it != paks_.rend(); ++it) {
+      if (it->second.Find(path, out_entry)) {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  void IndexInto(VfsIndex* index) const {
+    for (uint32_t mount = 0u; mount < paks_.size(); ++mount) {
+      const PakIndex& pak = paks_[mount].second;
+      index->Reserve(pak.entry_count());
+      pak.ForEachEntry([&](std::string_view path, uint64_t hash,
+                           const PakAssetEntry& entry) {
+        index->Insert(path, hash, VfsEntry{VfsSource::kPak, mount, entry});
+      });
+    }
+  }
+
+ private:
+  std::vector<std::pair<MappedFile, PakIndex>> paks_;
+};
+
+double NanosecondsPerOp(std::chrono::steady_clock::time_point start,
+                        size_t operations) {
+  const auto elapsed = std::chrono::steady_clock::now() - start;
+  return static_cast<double>(
+             std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count()) /
+         static_cast<double>(operations);
+}
+
+}  // namespace
+
+int main() {
+  const std::filesystem::path root =
+      std::filesystem::temp_directory_path() / "dff_native_content_vfs_bench";
+  std::filesystem::remove_all(root);
+  std::filesystem::create_directories(root);
+  for (uint32_t pak = 0u; pak < kPakCount; ++pak) {
+    WriteHashedPak(root / ("content_" + std::to_string(pak) + ".pak"), pak);
+  }
+
+  LegacyMountWalk legacy;
+  ContentRuntime runtime;
+  double mount_ns = 0.0;
+  for (uint32_t pak = 0u; pak < kPakCount; ++pak) {
+    const std::filesystem::path path =
+        root / ("content_" + std::to_string(pak) + ".pak");
+    legacy.AddPak(path);
+    const auto start = std::chrono::steady_clock::now();
+    runtime.MountPak(path.string());
+    mount_ns += NanosecondsPerOp(start, 1u);
+  }
+  VfsIndex index;
+  legacy.IndexInto(&index);
+
+  std::vector<std::string> oldest_paths;
+  std::vector<uint64_t> oldest_keys;
+  std::vector<std::string> missing_paths;
+  for (uint32_t i = 0u; i < 4096u; ++i) {
+    oldest_paths.push_back(AssetPath(0u, (i * 7919u) % kAssetsPerPak));
+    oldest_keys.push_back(HashAssetKey(oldest_paths.back()));
+    missing_paths.push_back("loose/asset_" + std::to_string(i) + ".bin");
+  }
+
+  PakAssetEntry entry;
+  uint64_t checksum = 0u;
+  auto start = std::chrono::steady_clock::now();
+  for (size_t i = 0u; i < kReadCount; ++i) {
+    checksum += legacy.Resolve(oldest_paths[i & 4095u], &entry) ? entry.size_bytes : 0u;
+  }
+  const double walk_hit_ns = NanosecondsPerOp(start, kReadCount);
+
+  start = std::chrono::steady_clock::now();
+  for (size_t i = 0u; i < kReadCount; ++i) {
+    const VfsEntry* found = index.Find(oldest_paths[i & 4095u]);
+    checksum += found != nullptr ? found->pak_entry.size_bytes : 0u;
+  }
+  const double vfs_hit_ns = NanosecondsPerOp(start, kReadCount);
+
+  start = std::chrono::steady_clock::now();
+  for (size_t i = 0u; i < kReadCount; ++i) {
+    checksum += legacy.Resolve(missing_paths[i & 4095u], &entry) ? 1u : 0u;
+  }
+  const double walk_miss_ns = NanosecondsPerOp(start, kReadCount);
+
+  start = std::chrono::steady_clock::now();
+  for (size_t i = 0u; i < kReadCount; ++i) {
+    checksum += index.Find(missing_paths[i & 4095u]) != nullptr ? 1u : 0u;
+  }
+  const double vfs_miss_ns = NanosecondsPerOp(start, kReadCount);
+
+  uint8_t buffer[8] = {};
+  size_t out_size = 0u;
+  start = std::chrono::steady_clock::now();
+  for (size_t i = 0u; i < kReadCount; ++i) {
+    runtime.ReadFile(oldest_paths[i & 4095u], buffer, sizeof(buffer), &out_size);
+    checksum += buffer[0];
+  }
+  const double read_ns = NanosecondsPerOp(start, kReadCount);
+
+  start = std::chrono::steady_clock::now();
+  for (size_t i = 0u; i < kReadCount; ++i) {
+    runtime.ReadByKey(oldest_keys[i & 4095u], buffer, sizeof(buffer), &out_size);
+    checksum += buffer[0];
+  }
+  const double read_by_key_ns = NanosecondsPerOp(start, kReadCount);
+
+  std::filesystem::remove_all(root);
+  std::printf("mounts: %u paks x %u entries, %zu indexed paths\n", kPakCount,
+              kAssetsPerPak, runtime.indexed_path_count());
+  std::printf("indexed mount: %.2f us per pak\n", mount_ns / kPakCount / 1000.0);
+  std::printf("%10s %16s %12s\n", "resolve", "oldest_pak_ns", "miss_ns");
+  std::printf("%10s %16.2f %12.2f\n", "walk", walk_hit_ns, walk_miss_ns);
+  std::printf("%10s %16.2f %12.2f\n", "vfs", vfs_hit_ns, vfs_miss_ns);
+  std::printf("read_file (normalize + resolve + copy): %.2f ns\n", read_ns);
+  std::printf("read_by_key (key lookup + copy): %.2f ns\n", read_by_key_ns);
+  if (checksum == 0u) {
+    std::printf(" ");
+  }
+  return 0;
+}
@@ -0,0 +1,182 @@
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <mutex>
+#include <random>
+#include <vector>
+
+#include "bridge_capi/handle_table.h"
+
+namespace {
+
+// Baseline: the scanning registry HandleTable replaced.
+class LegacyHandleRegistry {
+ public:
+  engine_native_status_t GetOrCreate(void* object,
+                                     engine_native_engine_t* owner,
+                                     bool owns_state,
+                                     uint64_t* out_handle) {
+    std::lock_guard<std::mutex> guard(mutex_);
+    for (size_t i = 0u; i < entries_.size(); ++i) {
+      if (entries_[i].object == object) {
+        *out_handle = Encode(i, entries_[i].generation);
+        return ENGINE_NATIVE_STATUS_OK;
+      }
+    }
+
+    size_t index = entries_.size();
+    for (size_t i = 0u; i < entries_.size(); ++i) {
+      if (entries_[i].object == nullptr) {
+        index = i;
+        break;
+      }
+    }
+    if (index == entries_.size()) {
+      entries_.push_back(Entry{});
+    }
+
+    Entry& entry = entries_[index];
+    entry.object = object;
+    entry.owner = owner;
+    entry.owns_state = owns_state ? 1u : 0u;
+    *out_handle = Encode(index, entry.generation);
+    return ENGINE_NATIVE_STATUS_OK;
+  }
+
+  engine_native_status_t Resolve(uint64_t handle,
+                                 void** out_object,
+                                 engine_native_engine_t** out_owner,
+                                 bool* out_owns_state) const {
+    const size_t index = static_cast<size_t>((handle & 0xFFFFFFFFull) - 1u);
+    const uint32_t generation = static_cast<uint32_t>(handle >> 32u);
+    std::lock_guard<std::mutex> guard(mutex_);
+    if (index >= entries_.size() || entries_[index].object == nullptr ||
+        entries_[index].generation != generation) {
+      return ENGINE_NATIVE_STATUS_NOT_FOUND;
+    }
+    *out_object = entries_[index].object;
+    if (out_owner != nullptr) {
+      *out_owner = entries_[index].owner;
+    }
+    if (out_owns_state != nullptr) {
+      *out_owns_state = entries_[index].owns_state != 0u;
+    }
+    return ENGINE_NATIVE_STATUS_OK;
+  }
+
+  void RemoveByObject(void* object) {
+    std::lock_guard<std::mutex> guard(mutex_);
+    for (Entry& entry : entries_) {
+      if (entry.object == object) {
+        entry.object = nullptr;
+        entry.owner = nullptr;
+        ++entry.generation;
+      }
+    }
+  }
+
+ private:
+  struct Entry {
+    uint32_t generation = 1u;
+    void* object = nullptr;
+    engine_native_engine_t* owner = nullptr;
+    uint8_t owns_state = 0u;
+  };
+
+  static uint64_t Encode(size_t index, uint32_t generation) {
+    return (static_cast<uint64_t>(generation) << 32u) |
+           static_cast<uint64_t>(index + 1u);
+  }
+
+  mutable std::mutex mutex_;
+  std::vector<Entry> entries_;
+};
+
+constexpr uint32_t kLiveHandleCount = 10000u;
+constexpr uint32_t kChurnCount = 2000u;
+constexpr size_t kResolveCount = 1u << 22u;
+
+struct BenchResult {
+  double register_ns = 0.0;
+  double lookup_existing_ns = 0.0;
+  double resolve_ns = 0.0;
+  double churn_ns = 0.0;
+};
+
+void* FakeObject(uint32_t value) {
+  return reinterpret_cast<void*>(static_cast<uintptr_t>(value + 1u) * 64u);
+}
+
+double NanosecondsPerOp(std::chrono::steady_clock::time_point start,
+                        size_t operations) {
+  const auto elapsed = std::chrono::steady_clock::now() - start;
+  return static_cast<double>(
+             std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count()) /
+         static_cast<double>(operations);
+}
+
+template <typename Registry>
+BenchResult RunCase() {
+  BenchResult result;
+  Registry registry;
+  std::vector<uint64_t> handles(kLiveHandleCount);
+
+  auto start = std::chrono::steady_clock::now();
+  for (uint32_t i = 0u; i < kLiveHandleCount; ++i) {
+    static_cast<void>(registry.GetOrCreate(FakeObject(i), nullptr, false, &handles[i]));
+  }
+  result.register_ns = NanosecondsPerOp(start, kLiveHandleCount);
+
+  uint64_t checksum = 0u;
+  start = std::chrono::steady_clock::now();
+  for (uint32_t i = 0u; i < kLiveHandleCount; ++i) {
+    uint64_t handle = 0u;
+    static_cast<void>(registry.GetOrCreate(FakeObject(i), nullptr, false, &handle));
+    checksum += handle;
+  }
+  result.lookup_existing_ns = NanosecondsPerOp(start, kLiveHandleCount);
+
+  std::mt19937 random(7u);
+  std::vector<uint32_t> order(4096u);
+  for (uint32_t& index : order) {
+    index = random() % kLiveHandleCount;
+  }
+  start = std::chrono::steady_clock::now();
+  for (size_t i = 0u; i < kResolveCount; ++i) {
+    void* object = nullptr;
+    static_cast<void>(registry.Resolve(handles[order[i & 4095u]], &object,
+                                       nullptr, nullptr));
+    checksum += reinterpret_cast<uintptr_t>(object);
+  }
+  result.resolve_ns = NanosecondsPerOp(start, kResolveCount);
+
+  start = std::chrono::steady_clock::now();
+  for (uint32_t i = 0u; i < kChurnCount; ++i) {
+    void* object = FakeObject(kLiveHandleCount + i);
+    uint64_t handle = 0u;
+    static_cast<void>(registry.GetOrCreate(object, nullptr, false, &handle));
+    registry.RemoveByObject(object);
+  }
+  result.churn_ns = NanosecondsPerOp(start, kChurnCount);
+
+  if (checksum == 0u) {
+    std::printf(" ");
+  }
+  return result;
+}
+
+}  // namespace
+
+int main() {
+  const BenchResult legacy = RunCase<LegacyHandleRegistry>();
+  const BenchResult table = RunCase<dff::native::bridge::HandleTable>();
+  std::printf("live handles: %u\n", kLiveHandleCount);
+  std::printf("%10s %14s %14s %12s %14s\n", "registry", "register_ns",
+              "get_existing_ns", "resolve_ns", "create_remove_ns");
+  std::printf("%10s %14.2f %14.2f %12.2f %14.2f\n", "legacy", legacy.register_ns,
+              legacy.lookup_existing_ns, legacy.resolve_ns, legacy.churn_ns);
+  std::printf("%10s %14.2f %14.2f %12.2f %14.2f\n", "table", table.register_ns,
+              table.lookup_existing_ns, table.resolve_ns, table.churn_ns);
+  return 0;
+}
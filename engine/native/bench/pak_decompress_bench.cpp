@@ -0,0 +1,162 @@
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <thread>
+#include <vector>
+
+#include "content/lz4_block.h"
+#include "content/pak_index.h"
+
+namespace {
+
+constexpr size_t kAssetBytes = size_t{64} << 20u;
+constexpr uint32_t kChunkSize = 64u * 1024u;
+constexpr uint32_t kChunkStoredBit = 0x80000000u;
+constexpr uint32_t kPasses = 4u;
+constexpr size_t kRangeBytes = 256u * 1024u;
+constexpr size_t kRangeSkew = 1000u;
+
+using dff::native::content::DecodePakAssetChunks;
+using dff::native::content::Lz4CompressBlock;
+using dff::native::content::Lz4CompressBound;
+using dff::native::content::PakAssetChunkCount;
+using dff::native::content::PakAssetEntry;
+using dff::native::content::PakCodec;
+using dff::native::content::ReadPakAssetBytes;
+using dff::native::content::ReadPakAssetRange;
+
+// Texture-like payload: smooth gradients with a few noisy low bits, so LZ4
+// lands near the 3-4x ratio packed textures and meshes see.
+std::vector<uint8_t> MakeAssetBytes() {
+  std::vector<uint8_t> bytes(kAssetBytes);
+  uint32_t state = 17u;
+  for (size_t i = 0u; i < bytes.size(); ++i) {
+    state = state * 1664525u + 1013904223u;
+    const uint8_t gradient = static_cast<uint8_t>((i >> 10u) + ((i & 3u) << 6u));
+    bytes[i] = (state >> 28u) == 0u ? static_cast<uint8_t>(state >> 20u) : gradient;
+  }
+  return bytes;
+}
+
+std::vector<uint8_t> CompressChunked(const std::vector<uint8_t>& asset) {
+  const size_t chunk_count = (asset.size() + kChunkSize - 1u) / kChunkSize;
+  std::vector<uint8_t> stored(chunk_count * sizeof(uint32_t));
+  std::vector<uint8_t> scratch(Lz4CompressBound(kChunkSize));
+  for (size_t chunk = 0u; chunk < chunk_count; ++chunk) {
+    const size_t offset = chunk * kChunkSize;
+    const size_t size = std::min<size_t>(kChunkSize, asset.size() - offset);
+    size_t compressed =
+        Lz4CompressBlock(asset.data() + offset, size, scratch.data(), scratch.size());
+    uint32_t descriptor = static_cast<uint32_t>(compressed);
+    if (compressed == 0u || compressed >= size) {
+      descriptor = static_cast<uint32_t>(size) | kChunkStoredBit;
+      stored.insert(stored.end(), asset.begin() + offset,
+                    asset.begin() + offset + size);
+    } else {
+      stored.insert(stored.end(), scratch.begin(), scratch.begin() + compressed);
+    }
+    std::memcpy(stored.data() + chunk * sizeof(uint32_t), &descriptor,
+                sizeof(descriptor));
+  }
+  return stored;
+}
+
+double MegabytesPerSecond(std::chrono::steady_clock::time_point start,
+                          size_t bytes) {
+  const auto elapsed = std::chrono::steady_clock::now() - start;
+  const double seconds = std::chrono::duration<double>(elapsed).count();
+  return static_cast<double>(bytes) / (1024.0 * 1024.0) / seconds;
+}
+
+}  // namespace
+
+int main() {
+  const std::vector<uint8_t> asset = MakeAssetBytes();
+  const std::vector<uint8_t> compressed = CompressChunked(asset);
+
+  PakAssetEntry stored_entry;
+  stored_entry.size_bytes = asset.size();
+  stored_entry.uncompressed_size_bytes = asset.size();
+
+  PakAssetEntry lz4_entry;
+  lz4_entry.size_bytes = compressed.size();
+  lz4_entry.uncompressed_size_bytes = asset.size();
+  lz4_entry.codec = PakCodec::kLz4Chunked;
+  lz4_entry.chunk_size_bytes = kChunkSize;
+
+  std::vector<uint8_t> output(asset.size());
+  size_t out_size = 0u;
+  auto start = std::chrono::steady_clock::now();
+  for (uint32_t pass = 0u; pass < kPasses; ++pass) {
+    ReadPakAssetBytes(asset.data(), asset.size(), stored_entry, output.data(),
+                      output.size(), &out_size);
+  }
+  const double stored_mbps = MegabytesPerSecond(start, asset.size() * kPasses);
+
+  start = std::chrono::steady_clock::now();
+  for (uint32_t pass = 0u; pass < kPasses; ++pass) {
+    ReadPakAssetBytes(compressed.data(), compressed.size(), lz4_entry,
+                      output.data(), output.size(), &out_size);
+  }
+  const double lz4_mbps = MegabytesPerSecond(start, asset.size() * kPasses);
+  if (output != asset) {
+    std::printf("decode mismatch\n");
+    return 1;
+  }
+
+  const uint64_t chunk_count = PakAssetChunkCount(lz4_entry);
+  const size_t thread_count =
+      std::max<size_t>(1u, std::min<size_t>(std::thread::hardware_concurrency(), 8u));
+  start = std::chrono::steady_clock::now();
+  for (uint32_t pass = 0u; pass < kPasses; ++pass) {
+    std::vector<std::thread> workers;
+    for (size_t t = 0u; t < thread_count; ++t) {
+      const uint64_t first = chunk_count * t / thread_count;
+      const uint64_t last = chunk_count * (t + 1u) / thread_count;
+      workers.emplace_back([&, first, last]() {
+        DecodePakAssetChunks(compressed.data(), compressed.size(), lz4_entry, first,
+                             last - first, output.data(), output.size());
+      });
+    }
+    for (std::thread& worker : workers) {
+      worker.join();
+    }
+  }
+  const double parallel_mbps = MegabytesPerSecond(start, asset.size() * kPasses);
+
+  // Streams the asset through one small buffer in windows that straddle chunk
+  // boundaries, as a music or mip-tail stream would.
+  std::vector<uint8_t> window(kRangeBytes);
+  bool range_matches = true;
+  start = std::chrono::steady_clock::now();
+  for (uint32_t pass = 0u; pass < kPasses; ++pass) {
+    ReadPakAssetRange(compressed.data(), compressed.size(), lz4_entry, 0u,
+                      window.data(), kRangeSkew, &out_size);
+    for (uint64_t offset = kRangeSkew; offset < asset.size(); offset += out_size) {
+      ReadPakAssetRange(compressed.data(), compressed.size(), lz4_entry, offset,
+                        window.data(), window.size(), &out_size);
+      range_matches = range_matches && out_size != 0u &&
+                      std::memcmp(window.data(), asset.data() + offset, out_size) == 0;
+    }
+  }
+  const double range_mbps = MegabytesPerSecond(start, asset.size() * kPasses);
+  if (!range_matches) {
+    std::printf("range mismatch\n");
+    return 1;
+  }
+
+  std::printf("asset: %zu MiB, %u KiB chunks, ratio %.2fx\n", kAssetBytes >> 20u,
+              kChunkSize / 1024u,
+              static_cast<double>(asset.size()) / static_cast<double>(compressed.size()));
+  std::printf("%16s %14s\n", "read", "decoded_MBps");
+  std::printf("%16s %14.0f\n", "stored", stored_mbps);
+  std::printf("%16s %14.0f\n", "lz4_1_core", lz4_mbps);
+  std::printf("%16s %14.0f  (%zu threads)\n", "lz4_chunked", parallel_mbps,
+              thread_count);
+  std::printf("%16s %14.0f  (%zu KiB buffer)\n", "lz4_range", range_mbps,
+              kRangeBytes / 1024u);
+  return 0;
+}
@@ -0,0 +1,170 @@
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "content/pak_index.h"
+
+namespace {
+
+constexpr uint32_t kPakMagic = 0x50464644u;  // DFFP
+constexpr uint32_t kAssetCount = 200000u;
+constexpr size_t kLookupCount = 1000000u;
+
+template <typename T>
+void Append(std::vector<uint8_t>* bytes, const T& value) {
+  const size_t offset = bytes->size();
+  bytes->resize(offset + sizeof(T));
+  std::memcpy(bytes->data() + offset, &value, sizeof(T));
+}
+
+void AppendString(std::vector<uint8_t>* bytes, const std::string& value) {
+  uint32_t length = static_cast<uint32_t>(value.size());
+  while (length >= 0x80u) {
+    bytes->push_back(static_cast<uint8_t>((length & 0x7Fu) | 0x80u));
+    length >>= 7u;
+  }
+  bytes->push_back(static_cast<uint8_t>(length));
+  bytes->insert(bytes->end(), value.begin(), value.end());
+}
+
+std::string AssetPath(uint32_t i) {
+  return "assets/level_" + std::to_string(i % 64u) + "/props/prop_" +
+         std::to_string(i) + ".mesh";
+}
+
+std::vector<uint8_t> BuildLegacyPak() {
+  std::vector<uint8_t> bytes;
+  Append(&bytes, kPakMagic);
+  Append(&bytes, uint32_t{3u});
+  Append(&bytes, static_cast<int32_t>(kAssetCount));
+  Append(&bytes, uint32_t{0u});
+  Append(&bytes, int64_t{0});
+  for (uint32_t i = 0u; i < kAssetCount; ++i) {
+    AppendString(&bytes, AssetPath(i));
+    AppendString(&bytes, "mesh");
+    AppendString(&bytes, "mesh/" + std::to_string(i) + ".bin");
+    AppendString(&bytes, "key_" + std::to_string(i));
+    Append(&bytes, int64_t{0});
+    Append(&bytes, int64_t{0});
+  }
+  return bytes;
+}
+
+std::vector<uint8_t> BuildHashedPak() {
+  std::vector<uint8_t> strings_bytes;
+  std::vector<std::pair<uint64_t, uint32_t>> order;
+  std::vector<uint32_t> string_refs;
+  for (uint32_t i = 0u; i < kAssetCount; ++i) {
+    const std::string fields[] = {AssetPath(i), "mesh",
+                                  "mesh/" + std::to_string(i) + ".bin",
+                                  "key_" + std::to_string(i)};
+    for (const std::string& field : fields) {
+      string_refs.push_back(static_cast<uint32_t>(strings_bytes.size()));
+      string_refs.push_back(static_cast<uint32_t>(field.size()));
+      strings_bytes.insert(strings_bytes.end(), field.begin(), field.end());
+    }
+    order.emplace_back(dff::native::content::HashPakPath(fields[0]), i);
+  }
+  std::sort(order.begin(), order.end());
+
+  uint32_t bucket_bits = 0u;
+  while ((uint32_t{1} << bucket_bits) < kAssetCount) {
+    ++bucket_bits;
+  }
+  const uint32_t bucket_count = uint32_t{1} << bucket_bits;
+  const uint64_t toc_offset = 64u;
+  const uint64_t buckets_offset = toc_offset + uint64_t{kAssetCount} * 56u;
+  const uint64_t strings_offset =
+      buckets_offset + (uint64_t{bucket_count} + 1u) * sizeof(uint32_t);
+  std::vector<uint8_t> bytes;
+  Append(&bytes, kPakMagic);
+  Append(&bytes, uint32_t{4u});
+  Append(&bytes, static_cast<int32_t>(kAssetCount));
+  Append(&bytes, uint32_t{0u});
+  Append(&bytes, int64_t{0});
+  Append(&bytes, toc_offset);
+  Append(&bytes, strings_offset);
+  Append(&bytes, static_cast<uint64_t>(strings_bytes.size()));
+  Append(&bytes, buckets_offset);
+  Append(&bytes, bucket_bits);
+  Append(&bytes, uint32_t{0u});
+  for (const auto& [hash, index] : order) {
+    Append(&bytes, hash);
+    Append(&bytes, uint64_t{0u});
+    Append(&bytes, uint64_t{0u});
+    for (uint32_t field = 0u; field < 8u; ++field) {
+      Append(&bytes, string_refs[index * 8u + field]);
+    }
+  }
+  uint32_t next_record = 0u;
+  for (uint32_t bucket = 0u; bucket <= bucket_count; ++bucket) {
+    while (next_record < kAssetCount &&
+           (order[next_record].first >> (64u - bucket_bits)) < bucket) {
+      ++next_record;
+    }
+    Append(&bytes, next_record);
+  }
+  bytes.insert(bytes.end(), strings_bytes.begin(), strings_bytes.end());
+  return bytes;
+}
+
+double Microseconds(std::chrono::steady_clock::time_point start) {
+  return static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                 std::chrono::steady_clock::now() - start)
+                                 .count()) /
+         1000.0;
+}
+
+struct BenchResult {
+  double mount_us = 0.0;
+  double lookup_ns = 0.0;
+};
+
+BenchResult RunCase(const std::vector<uint8_t>& pak,
+                    const std::vector<std::string>& queries) {
+  BenchResult result;
+  dff::native::content::PakIndex index;
+  auto start = std::chrono::steady_clock::now();
+  if (index.Load(pak.data(), pak.size()) != ENGINE_NATIVE_STATUS_OK) {
+    std::printf("failed to load bench pak\n");
+    return result;
+  }
+  result.mount_us = Microseconds(start);
+
+  size_t found = 0u;
+  start = std::chrono::steady_clock::now();
+  for (size_t i = 0u; i < kLookupCount; ++i) {
+    dff::native::content::PakAssetEntry entry;
+    found += index.Find(queries[i % queries.size()], &entry) ? 1u : 0u;
+  }
+  result.lookup_ns = Microseconds(start) * 1000.0 / kLookupCount;
+  if (found != kLookupCount) {
+    std::printf("lookup misses: %zu\n", kLookupCount - found);
+  }
+  return result;
+}
+
+}  // namespace
+
+int main() {
+  std::vector<std::string> queries;
+  for (uint32_t i = 0u; i < 4096u; ++i) {
+    queries.push_back(AssetPath((i * 7919u) % kAssetCount));
+  }
+
+  const BenchResult legacy = RunCase(BuildLegacyPak(), queries);
+  const BenchResult hashed = RunCase(BuildHashedPak(), queries);
+  std::printf("entries: %u\n", kAssetCount);
+  std::printf("%10s %14s %12s\n", "toc", "mount_us", "lookup_ns");
+  std::printf("%10s %14.2f %12.2f\n", "v3_parse", legacy.mount_us,
+              legacy.lookup_ns);
+  std::printf("%10s %14.2f %12.2f\n", "v4_hashed", hashed.mount_us,
+              hashed.lookup_ns);
+  return 0;
+}
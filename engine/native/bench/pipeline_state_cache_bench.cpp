@@ -0,0 +1,111 @@
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <list>
+#include <random>
+#include <unordered_map>
+#include <vector>
+
+#include "rhi/pipeline_state_cache.h"
+
+namespace {
+
+// Baseline: the std::list + std::unordered_map cache this table replaced.
+class LegacyPipelineStateCache {
+ public:
+  explicit LegacyPipelineStateCache(size_t capacity) : capacity_(capacity) {}
+
+  const dff::native::rhi::PipelineStateRecord& GetOrCreate(uint64_t key) {
+    auto entry_it = entries_.find(key);
+    if (entry_it != entries_.end()) {
+      lru_keys_.splice(lru_keys_.end(), lru_keys_, entry_it->second.lru_it);
+      return entry_it->second.record;
+    }
+
+    while (entries_.size() >= capacity_ && !lru_keys_.empty()) {
+      entries_.erase(lru_keys_.front());
+      lru_keys_.pop_front();
+    }
+
+    lru_keys_.push_back(key);
+    const auto [inserted_it, _] = entries_.emplace(
+        key, CacheEntry{{key, next_generation_++}, std::prev(lru_keys_.end())});
+    return inserted_it->second.record;
+  }
+
+ private:
+  struct CacheEntry {
+    dff::native::rhi::PipelineStateRecord record;
+    std::list<uint64_t>::iterator lru_it;
+  };
+
+  size_t capacity_ = 0u;
+  uint64_t next_generation_ = 1u;
+  std::list<uint64_t> lru_keys_;
+  std::unordered_map<uint64_t, CacheEntry> entries_;
+};
+
+constexpr size_t kOperationsPerRun = 1u << 21u;
+
+std::vector<uint64_t> MakeKeys(size_t count, uint64_t seed) {
+  std::mt19937_64 random(seed);
+  std::vector<uint64_t> keys(count);
+  for (uint64_t& key : keys) {
+    key = random();
+  }
+  return keys;
+}
+
+template <typename Cache>
+double MeasureNanosecondsPerOp(Cache* cache, const std::vector<uint64_t>& keys) {
+  uint64_t checksum = 0u;
+  const auto start = std::chrono::steady_clock::now();
+  for (size_t i = 0u; i < kOperationsPerRun; ++i) {
+    checksum += cache->GetOrCreate(keys[i % keys.size()]).generation;
+  }
+  const auto elapsed = std::chrono::steady_clock::now() - start;
+  if (checksum == 0u) {
+    std::printf(" ");
+  }
+  return static_cast<double>(
+             std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count()) /
+         static_cast<double>(kOperationsPerRun);
+}
+
+template <typename Cache>
+void RunCase(size_t capacity, double* out_hit_ns, double* out_miss_ns) {
+  const std::vector<uint64_t> resident_keys = MakeKeys(capacity, capacity);
+  std::vector<uint64_t> shuffled_keys = resident_keys;
+  std::shuffle(shuffled_keys.begin(), shuffled_keys.end(), std::mt19937_64(7u));
+
+  Cache hit_cache(capacity);
+  for (uint64_t key : resident_keys) {
+    static_cast<void>(hit_cache.GetOrCreate(key));
+  }
+  *out_hit_ns = MeasureNanosecondsPerOp(&hit_cache, shuffled_keys);
+
+  Cache miss_cache(capacity);
+  *out_miss_ns =
+      MeasureNanosecondsPerOp(&miss_cache, MakeKeys(kOperationsPerRun, capacity + 1u));
+}
+
+}  // namespace
+
+int main() {
+  std::printf("%10s %14s %14s %14s %14s\n", "capacity", "legacy_hit_ns",
+              "table_hit_ns", "legacy_miss_ns", "table_miss_ns");
+  for (size_t capacity = 256u; capacity <= 65536u; capacity *= 4u) {
+    double legacy_hit_ns = 0.0;
+    double legacy_miss_ns = 0.0;
+    double table_hit_ns = 0.0;
+    double table_miss_ns = 0.0;
+    RunCase<LegacyPipelineStateCache>(capacity, &legacy_hit_ns, &legacy_miss_ns);
+    RunCase<dff::native::rhi::PipelineStateCache>(capacity, &table_hit_ns,
+                                                  &table_miss_ns);
+    std::printf("%10zu %14.2f %14.2f %14.2f %14.2f\n", capacity, legacy_hit_ns,
+                table_hit_ns, legacy_miss_ns, table_miss_ns);
+  }
+  return 0;
+}
@@ -0,0 +1,171 @@
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <limits>
+#include <optional>
+#include <random>
+#include <vector>
+
+#include "core/resource_table.h"
+
+namespace {
+
+// Baseline: the std::vector<std::optional<T>> table this slab replaced.
+template <typename T>
+class LegacyResourceTable {
+ public:
+  engine_native_status_t Insert(T value, dff::native::ResourceHandle* out_handle) {
+    if (!free_indices_.empty()) {
+      const uint32_t index = free_indices_.back();
+      free_indices_.pop_back();
+      Slot& slot = slots_[index];
+      slot.value.emplace(std::move(value));
+      *out_handle = dff::native::ResourceHandle{.index = index,
+                                                .generation = slot.generation};
+      return ENGINE_NATIVE_STATUS_OK;
+    }
+
+    Slot slot;
+    slot.value.emplace(std::move(value));
+    slots_.push_back(std::move(slot));
+    *out_handle = dff::native::ResourceHandle{
+        .index = static_cast<uint32_t>(slots_.size() - 1u), .generation = 1u};
+    return ENGINE_NATIVE_STATUS_OK;
+  }
+
+  bool Remove(dff::native::ResourceHandle handle) {
+    if (handle.index >= slots_.size()) {
+      return false;
+    }
+
+    Slot& slot = slots_[handle.index];
+    if (!slot.value.has_value() || slot.generation != handle.generation) {
+      return false;
+    }
+
+    slot.value.reset();
+    ++slot.generation;
+    free_indices_.push_back(handle.index);
+    return true;
+  }
+
+  T* Get(dff::native::ResourceHandle handle) {
+    if (handle.index >= slots_.size()) {
+      return nullptr;
+    }
+
+    Slot& slot = slots_[handle.index];
+    if (!slot.value.has_value() || slot.generation != handle.generation) {
+      return nullptr;
+    }
+
+    return &slot.value.value();
+  }
+
+  template <typename Fn>
+  void ForEach(Fn&& fn) {
+    for (size_t index = 0u; index < slots_.size(); ++index) {
+      Slot& slot = slots_[index];
+      if (slot.value.has_value()) {
+        fn(dff::native::ResourceHandle{.index = static_cast<uint32_t>(index),
+                                       .generation = slot.generation},
+           slot.value.value());
+      }
+    }
+  }
+
+ private:
+  struct Slot {
+    std::optional<T> value;
+    uint32_t generation = 1u;
+  };
+
+  std::vector<Slot> slots_;
+  std::vector<uint32_t> free_indices_;
+};
+
+struct BenchBlob {
+  uint32_t kind = 0u;
+  uint64_t triangle_count = 0u;
+  std::vector<uint8_t> bytes;
+};
+
+constexpr size_t kHandleCount = 1000000u;
+
+struct BenchResult {
+  double insert_ns = 0.0;
+  double get_ns = 0.0;
+  double for_each_ns = 0.0;
+  double remove_ns = 0.0;
+};
+
+double NanosecondsPerOp(std::chrono::steady_clock::time_point start,
+                        size_t operations) {
+  const auto elapsed = std::chrono::steady_clock::now() - start;
+  return static_cast<double>(
+             std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count()) /
+         static_cast<double>(operations);
+}
+
+template <typename Table>
+BenchResult RunCase() {
+  BenchResult result;
+  Table table;
+  std::vector<dff::native::ResourceHandle> handles(kHandleCount);
+
+  auto start = std::chrono::steady_clock::now();
+  for (size_t i = 0u; i < kHandleCount; ++i) {
+    BenchBlob blob;
+    blob.triangle_count = i;
+    static_cast<void>(table.Insert(std::move(blob), &handles[i]));
+  }
+  result.insert_ns = NanosecondsPerOp(start, kHandleCount);
+
+  std::vector<dff::native::ResourceHandle> shuffled = handles;
+  std::shuffle(shuffled.begin(), shuffled.end(), std::mt19937_64(7u));
+
+  for (size_t i = 0u; i < kHandleCount; i += 2u) {
+    static_cast<void>(table.Remove(shuffled[i]));
+  }
+
+  uint64_t checksum = 0u;
+  start = std::chrono::steady_clock::now();
+  for (const dff::native::ResourceHandle handle : shuffled) {
+    const BenchBlob* blob = table.Get(handle);
+    checksum += blob != nullptr ? blob->triangle_count : 1u;
+  }
+  result.get_ns = NanosecondsPerOp(start, kHandleCount);
+
+  start = std::chrono::steady_clock::now();
+  table.ForEach([&checksum](dff::native::ResourceHandle, BenchBlob& blob) {
+    checksum += blob.triangle_count;
+  });
+  result.for_each_ns = NanosecondsPerOp(start, kHandleCount / 2u);
+
+  start = std::chrono::steady_clock::now();
+  for (size_t i = 1u; i < kHandleCount; i += 2u) {
+    static_cast<void>(table.Remove(shuffled[i]));
+  }
+  result.remove_ns = NanosecondsPerOp(start, kHandleCount / 2u);
+
+  if (checksum == 0u) {
+    std::printf(" ");
+  }
+  return result;
+}
+
+}  // namespace
+
+int main() {
+  const BenchResult legacy = RunCase<LegacyResourceTable<BenchBlob>>();
+  const BenchResult slab = RunCase<dff::native::ResourceTable<BenchBlob>>();
+  std::printf("%10s %12s %12s %12s %12s\n", "table", "insert_ns", "get_ns",
+              "for_each_ns", "remove_ns");
+  std::printf("%10s %12.2f %12.2f %12.2f %12.2f\n", "legacy", legacy.insert_ns,
+              legacy.get_ns, legacy.for_each_ns, legacy.remove_ns);
+  std::printf("%10s %12.2f %12.2f %12.2f %12.2f\n", "slab", slab.insert_ns,
+              slab.get_ns, slab.for_each_ns, slab.remove_ns);
+  return 0;
+}
@@ -18,7 +18,7 @@
 #define ENGINE_NATIVE_API __attribute__((visibility("default")))
 #endif
 
-#define ENGINE_NATIVE_API_VERSION 15u
+#define ENGINE_NATIVE_API_VERSION 32u
 
 typedef struct engine_native_engine engine_native_engine_t;
 typedef struct engine_native_renderer engine_native_renderer_t;
@@ -116,6 +116,8 @@ typedef enum engine_native_debug_view_mode {
 #define ENGINE_NATIVE_RENDER_FLAG_REQUIRE_FORWARD_PLUS 0x04u
 #define ENGINE_NATIVE_RENDER_FLAG_REQUIRE_CSM 0x08u
 
+#define ENGINE_NATIVE_RENDER_PACKET_FLAG_DRAW_ITEMS_IN_FRAME_MEMORY 0x01u
+
 #define ENGINE_NATIVE_RENDER_BACKEND_UNKNOWN 0u
 #define ENGINE_NATIVE_RENDER_BACKEND_VULKAN 1u
 #define ENGINE_NATIVE_RENDER_BACKEND_NOOP 2u
@@ -143,8 +145,43 @@ typedef struct engine_native_renderer_frame_stats {
   uint64_t triangle_count;
   uint64_t upload_bytes;
   uint64_t gpu_memory_bytes;
+  uint64_t frame_arena_reuse_count;
+  uint64_t frame_arena_grow_count;
+  uint64_t frame_arena_high_water_bytes;
+  uint64_t frame_arena_reserved_bytes;
+  uint64_t frame_graph_cache_hits;
+  uint64_t frame_graph_cache_misses;
+  uint64_t transient_naive_bytes;
+  uint64_t transient_aliased_bytes;
+  uint64_t culled_pass_mask;
+  uint64_t pass_record_cpu_ns;
+  uint32_t pass_record_level_count;
+  uint32_t pass_record_max_parallel_passes;
+  uint64_t draw_sort_cpu_ns;
+  uint32_t draw_batch_count;
+  uint32_t draw_batch_max_instances;
+  uint32_t material_resolve_lookups;
+  uint32_t material_resolve_unique;
 } engine_native_renderer_frame_stats_t;
 
+typedef struct engine_native_pipeline_prewarm_item {
+  engine_native_resource_handle_t material;
+  uint32_t feature_flags;
+  uint32_t reserved0;
+} engine_native_pipeline_prewarm_item_t;
+
+typedef struct engine_native_pipeline_prewarm_progress {
+  uint32_t requested_count;
+  uint32_t resolved_count;
+  uint32_t rejected_count;
+  uint32_t already_cached_count;
+  uint32_t first_frame_miss_count;
+  uint8_t is_complete;
+  uint8_t first_frame_measured;
+  uint8_t reserved0;
+  uint8_t reserved1;
+} engine_native_pipeline_prewarm_progress_t;
+
 typedef enum engine_native_capture_format {
   ENGINE_NATIVE_CAPTURE_FORMAT_RGBA8_UNORM = 1,
   ENGINE_NATIVE_CAPTURE_FORMAT_RGBA16_FLOAT = 2
@@ -176,6 +213,56 @@ typedef struct engine_native_capture_result {
   size_t pixel_bytes;
 } engine_native_capture_result_t;
 
+typedef struct engine_native_content_read_result {
+  engine_native_status_t status;
+  uint32_t reserved0;
+  const uint8_t* data;
+  size_t size;
+} engine_native_content_read_result_t;
+
+typedef struct engine_native_content_read_stats {
+  uint32_t queued_count;
+  uint32_t in_flight_count;
+  uint32_t worker_count;
+  uint32_t max_queue_depth;
+  uint64_t submitted_count;
+  uint64_t completed_count;
+  uint64_t cancelled_count;
+  uint64_t failed_count;
+  uint64_t total_latency_ns;
+  uint64_t max_latency_ns;
+  uint64_t pooled_buffer_bytes;
+} engine_native_content_read_stats_t;
+
+typedef struct engine_native_content_stream_stats {
+  uint32_t pending_count;
+  uint32_t issued_count;
+  uint32_t last_frame_issued_count;
+  uint32_t reserved0;
+  uint64_t pending_bytes;
+  uint64_t frame_budget_bytes;
+  uint64_t last_frame_issued_bytes;
+  uint64_t issued_bytes;
+  uint64_t completed_count;
+  uint64_t completed_bytes;
+  uint64_t cancelled_count;
+  uint64_t reprioritized_count;
+  uint64_t frame_count;
+  uint64_t throughput_bytes_per_second;
+} engine_native_content_stream_stats_t;
+
+typedef struct engine_native_content_cache_stats {
+  uint32_t entry_count;
+  uint32_t pinned_entry_count;
+  uint64_t budget_bytes;
+  uint64_t resident_bytes;
+  uint64_t pinned_bytes;
+  uint64_t hit_count;
+  uint64_t miss_count;
+  uint64_t insert_count;
+  uint64_t eviction_count;
+} engine_native_content_cache_stats_t;
+
 typedef enum engine_native_audio_bus {
   ENGINE_NATIVE_AUDIO_BUS_MASTER = 0,
   ENGINE_NATIVE_AUDIO_BUS_MUSIC = 1,
@@ -344,6 +431,94 @@ typedef struct engine_native_overlap_hit {
   uint8_t reserved2;
 } engine_native_overlap_hit_t;
 
+#define ENGINE_NATIVE_FRAME_COMMAND_RENDERER_BEGIN_FRAME 1u
+#define ENGINE_NATIVE_FRAME_COMMAND_RENDERER_SUBMIT 2u
+#define ENGINE_NATIVE_FRAME_COMMAND_RENDERER_UI_APPEND 3u
+#define ENGINE_NATIVE_FRAME_COMMAND_RENDERER_PRESENT 4u
+#define ENGINE_NATIVE_FRAME_COMMAND_PHYSICS_SYNC_FROM_WORLD 5u
+#define ENGINE_NATIVE_FRAME_COMMAND_PHYSICS_STEP 6u
+#define ENGINE_NATIVE_FRAME_COMMAND_PHYSICS_SYNC_TO_WORLD 7u
+#define ENGINE_NATIVE_FRAME_COMMAND_AUDIO_SET_EMITTER_PARAMS 8u
+#define ENGINE_NATIVE_FRAME_COMMAND_NET_PUMP 9u
+#define ENGINE_NATIVE_FRAME_COMMAND_RENDERER_RESIZE_FRAME 10u
+
+#define ENGINE_NATIVE_FRAME_COMMAND_ALIGNMENT 8u
+#define ENGINE_NATIVE_FRAME_COMMAND_NO_FAILURE 0xFFFFFFFFu
+
+/*
+ * A frame command stream is a sequence of records, each starting with this
+ * header. size covers the header and its payload and is a multiple of
+ * ENGINE_NATIVE_FRAME_COMMAND_ALIGNMENT. The stream must start on that
+ * alignment. UI append and physics sync-from-world records carry their items
+ * inline after the payload struct. A submit record points at its items or
+ * carries them inline; draw items in the open frame's memory are referenced
+ * without copying either way. Begin-frame and resize-frame records are only
+ * valid as the last record, so a stream written into frame memory can end by
+ * opening or regrowing the frame whose memory holds the next stream.
+ */
+typedef struct engine_native_frame_command_header {
+  uint32_t kind;
+  uint32_t size;
+} engine_native_frame_command_header_t;
+
+typedef struct engine_native_frame_command_begin_frame {
+  uint64_t requested_bytes;
+  uint64_t alignment;
+} engine_native_frame_command_begin_frame_t;
+
+/*
+ * draw_items and ui_items must stay valid until the record runs; normally they
+ * point into the open frame's memory. A null pointer means those items follow
+ * the payload inline instead, draw items first.
+ */
+typedef struct engine_native_frame_command_submit {
+  const engine_native_draw_item_t* draw_items;
+  const engine_native_ui_draw_item_t* ui_items;
+  uint32_t draw_item_count;
+  uint32_t ui_item_count;
+  uint8_t debug_view_mode;
+  uint8_t render_feature_flags;
+  uint8_t reserved0;
+  uint8_t reserved1;
+  uint32_t reserved2;
+} engine_native_frame_command_submit_t;
+
+/* Followed by item_count UI draw items or body writes. */
+typedef struct engine_native_frame_command_items {
+  uint32_t item_count;
+  uint32_t reserved0;
+} engine_native_frame_command_items_t;
+
+typedef struct engine_native_frame_command_physics_step {
+  double dt_seconds;
+} engine_native_frame_command_physics_step_t;
+
+typedef struct engine_native_frame_command_sync_to_world {
+  engine_native_body_read_t* reads;
+  uint32_t read_capacity;
+  uint32_t reserved0;
+} engine_native_frame_command_sync_to_world_t;
+
+typedef struct engine_native_frame_command_emitter_params {
+  uint64_t emitter_id;
+  engine_native_emitter_params_t params;
+} engine_native_frame_command_emitter_params_t;
+
+typedef struct engine_native_frame_command_results {
+  uint32_t executed_command_count;
+  uint32_t failed_command_index;
+  engine_native_status_t failed_status;
+  uint32_t physics_read_count;
+  void* frame_memory;
+  engine_native_net_events_t net_events;
+  engine_native_renderer_frame_stats_t frame_stats;
+  uint8_t has_frame_memory;
+  uint8_t has_net_events;
+  uint8_t has_frame_stats;
+  uint8_t reserved0;
+  uint32_t reserved1;
+} engine_native_frame_command_results_t;
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -378,6 +553,15 @@ ENGINE_NATIVE_API engine_native_status_t engine_get_net(
     engine_native_engine_t* engine,
     engine_native_net_t** out_net);
 
+ENGINE_NATIVE_API engine_native_status_t engine_execute_frame_commands(
+    engine_native_engine_t* engine,
+    const void* commands,
+    size_t command_bytes,
+    engine_native_frame_command_results_t* out_results);
+
+// The pak stays memory-mapped until the engine is destroyed. A mounted pak
+// must be replaced (written elsewhere and renamed over), never rewritten in
+// place: truncating a mapped file makes later reads past its new end fault.
 ENGINE_NATIVE_API engine_native_status_t content_mount_pak(
     engine_native_engine_t* engine,
     const char* pak_path);
@@ -393,6 +577,12 @@ ENGINE_NATIVE_API engine_native_status_t content_read_file(
     size_t buffer_size,
     size_t* out_size);
 
+ENGINE_NATIVE_API engine_native_status_t content_map_file(
+    engine_native_engine_t* engine,
+    const char* asset_path,
+    const void** out_data,
+    size_t* out_size);
+
 ENGINE_NATIVE_API engine_native_status_t content_mount_pak_view(
     engine_native_engine_t* engine,
     engine_native_string_view_t pak_path);
@@ -408,12 +598,173 @@ ENGINE_NATIVE_API engine_native_status_t content_read_file_view(
     size_t buffer_size,
     size_t* out_size);
 
+ENGINE_NATIVE_API engine_native_status_t content_map_file_view(
+    engine_native_engine_t* engine,
+    engine_native_string_view_t asset_path,
+    const void** out_data,
+    size_t* out_size);
+
+// Queues a read on the content I/O workers. Passing a NULL buffer with size 0
+// reads into a pooled buffer that content_free_read_result returns to the
+// pool; a caller buffer must stay valid until the read is polled or cancelled.
+ENGINE_NATIVE_API engine_native_status_t content_read_file_async(
+    engine_native_engine_t* engine,
+    const char* asset_path,
+    void* buffer,
+    size_t buffer_size,
+    uint64_t* out_request_id);
+
+ENGINE_NATIVE_API engine_native_status_t content_read_file_async_view(
+    engine_native_engine_t* engine,
+    engine_native_string_view_t asset_path,
+    void* buffer,
+    size_t buffer_size,
+    uint64_t* out_request_id);
+
+ENGINE_NATIVE_API engine_native_status_t content_poll_read(
+    engine_native_engine_t* engine,
+    uint64_t request_id,
+    engine_native_content_read_result_t* out_result,
+    uint8_t* out_is_ready);
+
+ENGINE_NATIVE_API engine_native_status_t content_free_read_result(
+    engine_native_engine_t* engine,
+    engine_native_content_read_result_t* result);
+
+// Drops a queued read, or waits for an in-flight one to finish so the caller
+// buffer is no longer referenced once this returns.
+ENGINE_NATIVE_API engine_native_status_t content_cancel_read(
+    engine_native_engine_t* engine,
+    uint64_t request_id);
+
+ENGINE_NATIVE_API engine_native_status_t content_get_read_stats(
+    engine_native_engine_t* engine,
+    engine_native_content_read_stats_t* out_stats);
+
+// Streaming requests wait until content_stream_update issues them. Lower
+// priority values go first, so a camera distance can be passed directly. Each
+// update issues up to the frame budget of stored bytes, at least one request,
+// ordered by pak offset. Results are polled with content_stream_poll and
+// released with content_free_read_result.
+ENGINE_NATIVE_API engine_native_status_t content_stream_request(
+    engine_native_engine_t* engine,
+    const char* asset_path,
+    float priority,
+    void* buffer,
+    size_t buffer_size,
+    uint64_t* out_request_id);
+
+ENGINE_NATIVE_API engine_native_status_t content_stream_request_view(
+    engine_native_engine_t* engine,
+    engine_native_string_view_t asset_path,
+    float priority,
+    void* buffer,
+    size_t buffer_size,
+    uint64_t* out_request_id);
+
+// Has no effect once the request has been issued.
+ENGINE_NATIVE_API engine_native_status_t content_stream_set_priority(
+    engine_native_engine_t* engine,
+    uint64_t request_id,
+    float priority);
+
+ENGINE_NATIVE_API engine_native_status_t content_stream_cancel(
+    engine_native_engine_t* engine,
+    uint64_t request_id);
+
+ENGINE_NATIVE_API engine_native_status_t content_stream_poll(
+    engine_native_engine_t* engine,
+    uint64_t request_id,
+    engine_native_content_read_result_t* out_result,
+    uint8_t* out_is_ready);
+
+// A budget of zero issues every pending request on the next update.
+ENGINE_NATIVE_API engine_native_status_t content_stream_set_frame_budget(
+    engine_native_engine_t* engine,
+    uint64_t budget_bytes);
+
+ENGINE_NATIVE_API engine_native_status_t content_stream_update(
+    engine_native_engine_t* engine);
+
+ENGINE_NATIVE_API engine_native_status_t content_stream_get_stats(
+    engine_native_engine_t* engine,
+    engine_native_content_stream_stats_t* out_stats);
+
+// Bounds the bytes content_read_file keeps cached. The cache is disabled at
+// the default budget of zero; pinned assets are kept regardless.
+ENGINE_NATIVE_API engine_native_status_t content_set_cache_budget(
+    engine_native_engine_t* engine,
+    uint64_t budget_bytes);
+
+// Pins one shared cached copy of an asset. Every acquire is matched by a
+// content_release_file with the returned pointer; empty assets return NULL.
+ENGINE_NATIVE_API engine_native_status_t content_acquire_file(
+    engine_native_engine_t* engine,
+    const char* asset_path,
+    const void** out_data,
+    size_t* out_size);
+
+ENGINE_NATIVE_API engine_native_status_t content_acquire_file_view(
+    engine_native_engine_t* engine,
+    engine_native_string_view_t asset_path,
+    const void** out_data,
+    size_t* out_size);
+
+ENGINE_NATIVE_API engine_native_status_t content_release_file(
+    engine_native_engine_t* engine,
+    const void* data);
+
+ENGINE_NATIVE_API engine_native_status_t content_get_cache_stats(
+    engine_native_engine_t* engine,
+    engine_native_content_cache_stats_t* out_stats);
+
+// Copies up to length bytes starting at offset_bytes of the asset. Reads past
+// the end are clamped and out_size receives the bytes copied; an offset past
+// the end is INVALID_ARGUMENT. Compressed pak entries decode only the chunks
+// the range touches.
+ENGINE_NATIVE_API engine_native_status_t content_read_file_range(
+    engine_native_engine_t* engine,
+    const char* asset_path,
+    uint64_t offset_bytes,
+    void* buffer,
+    size_t length,
+    size_t* out_size);
+
+ENGINE_NATIVE_API engine_native_status_t content_read_file_range_view(
+    engine_native_engine_t* engine,
+    engine_native_string_view_t asset_path,
+    uint64_t offset_bytes,
+    void* buffer,
+    size_t length,
+    size_t* out_size);
+
+// Reads a pak entry by asset key without normalizing or hashing a path. The
+// key is the 64-bit FNV-1a hash of the entry's asset key string; the newest
+// mounted pak carrying a key wins. Loose files have no keys and 0 is not a
+// valid key. Buffer rules match content_read_file.
+ENGINE_NATIVE_API engine_native_status_t content_read_by_key(
+    engine_native_engine_t* engine,
+    uint64_t asset_key,
+    void* buffer,
+    size_t buffer_size,
+    size_t* out_size);
+
 ENGINE_NATIVE_API engine_native_status_t renderer_begin_frame(
     engine_native_renderer_t* renderer,
     size_t requested_bytes,
     size_t alignment,
     void** out_frame_memory);
 
+// Regrows the open frame's memory without presenting it. Only valid before
+// anything has been submitted into the frame; the previous frame memory must
+// not be used afterwards. If the new memory cannot be acquired the frame is
+// abandoned unpresented.
+ENGINE_NATIVE_API engine_native_status_t renderer_resize_frame(
+    engine_native_renderer_t* renderer,
+    size_t requested_bytes,
+    size_t alignment,
+    void** out_frame_memory);
+
 ENGINE_NATIVE_API engine_native_status_t renderer_submit(
     engine_native_renderer_t* renderer,
     const engine_native_render_packet_t* packet);
@@ -461,6 +812,15 @@ ENGINE_NATIVE_API engine_native_status_t renderer_get_last_frame_stats(
     engine_native_renderer_t* renderer,
     engine_native_renderer_frame_stats_t* out_stats);
 
+ENGINE_NATIVE_API engine_native_status_t renderer_prewarm_pipelines(
+    engine_native_renderer_t* renderer,
+    const engine_native_pipeline_prewarm_item_t* items,
+    uint32_t item_count);
+
+ENGINE_NATIVE_API engine_native_status_t renderer_get_pipeline_prewarm_progress(
+    engine_native_renderer_t* renderer,
+    engine_native_pipeline_prewarm_progress_t* out_progress);
+
 ENGINE_NATIVE_API engine_native_status_t renderer_ui_reset(
     engine_native_renderer_t* renderer);
 
@@ -592,6 +952,12 @@ ENGINE_NATIVE_API engine_native_status_t engine_get_net_handle(
     engine_native_engine_handle_t engine,
     engine_native_net_handle_t* out_net);
 
+ENGINE_NATIVE_API engine_native_status_t engine_execute_frame_commands_handle(
+    engine_native_engine_handle_t engine,
+    const void* commands,
+    size_t command_bytes,
+    engine_native_frame_command_results_t* out_results);
+
 ENGINE_NATIVE_API engine_native_status_t content_mount_pak_handle(
     engine_native_engine_handle_t engine,
     const char* pak_path);
@@ -607,6 +973,12 @@ ENGINE_NATIVE_API engine_native_status_t content_read_file_handle(
     size_t buffer_size,
     size_t* out_size);
 
+ENGINE_NATIVE_API engine_native_status_t content_map_file_handle(
+    engine_native_engine_handle_t engine,
+    const char* asset_path,
+    const void** out_data,
+    size_t* out_size);
+
 ENGINE_NATIVE_API engine_native_status_t content_mount_pak_view_handle(
     engine_native_engine_handle_t engine,
     engine_native_string_view_t pak_path);
@@ -622,12 +994,145 @@ ENGINE_NATIVE_API engine_native_status_t content_read_file_view_handle(
     size_t buffer_size,
     size_t* out_size);
 
+ENGINE_NATIVE_API engine_native_status_t content_map_file_view_handle(
+    engine_native_engine_handle_t engine,
+    engine_native_string_view_t asset_path,
+    const void** out_data,
+    size_t* out_size);
+
+ENGINE_NATIVE_API engine_native_status_t content_read_file_async_handle(
+    engine_native_engine_handle_t engine,
+    const char* asset_path,
+    void* buffer,
+    size_t buffer_size,
+    uint64_t* out_request_id);
+
+ENGINE_NATIVE_API engine_native_status_t content_read_file_async_view_handle(
+    engine_native_engine_handle_t engine,
+    engine_native_string_view_t asset_path,
+    void* buffer,
+    size_t buffer_size,
+    uint64_t* out_request_id);
+
+ENGINE_NATIVE_API engine_native_status_t content_poll_read_handle(
+    engine_native_engine_handle_t engine,
+    uint64_t request_id,
+    engine_native_content_read_result_t* out_result,
+    uint8_t* out_is_ready);
+
+ENGINE_NATIVE_API engine_native_status_t content_free_read_result_handle(
+    engine_native_engine_handle_t engine,
+    engine_native_content_read_result_t* result);
+
+ENGINE_NATIVE_API engine_native_status_t content_cancel_read_handle(
+    engine_native_engine_handle_t engine,
+    uint64_t request_id);
+
+ENGINE_NATIVE_API engine_native_status_t content_get_read_stats_handle(
+    engine_native_engine_handle_t engine,
+    engine_native_content_read_stats_t* out_stats);
+
+ENGINE_NATIVE_API engine_native_status_t content_stream_request_handle(
+    engine_native_engine_handle_t engine,
+    const char* asset_path,
+    float priority,
+    void* buffer,
+    size_t buffer_size,
+    uint64_t* out_request_id);
+
+ENGINE_NATIVE_API engine_native_status_t content_stream_request_view_handle(
+    engine_native_engine_handle_t engine,
+    engine_native_string_view_t asset_path,
+    float priority,
+    void* buffer,
+    size_t buffer_size,
+    uint64_t* out_request_id);
+
+ENGINE_NATIVE_API engine_native_status_t content_stream_set_priority_handle(
+    engine_native_engine_handle_t engine,
+    uint64_t request_id,
+    float priority);
+
+ENGINE_NATIVE_API engine_native_status_t content_stream_cancel_handle(
+    engine_native_engine_handle_t engine,
+    uint64_t request_id);
+
+ENGINE_NATIVE_API engine_native_status_t content_stream_poll_handle(
+    engine_native_engine_handle_t engine,
+    uint64_t request_id,
+    engine_native_content_read_result_t* out_result,
+    uint8_t* out_is_ready);
+
+ENGINE_NATIVE_API engine_native_status_t content_stream_set_frame_budget_handle(
+    engine_native_engine_handle_t engine,
+    uint64_t budget_bytes);
+
+ENGINE_NATIVE_API engine_native_status_t content_stream_update_handle(
+    engine_native_engine_handle_t engine);
+
+ENGINE_NATIVE_API engine_native_status_t content_stream_get_stats_handle(
+    engine_native_engine_handle_t engine,
+    engine_native_content_stream_stats_t* out_stats);
+
+ENGINE_NATIVE_API engine_native_status_t content_set_cache_budget_handle(
+    engine_native_engine_handle_t engine,
+    uint64_t budget_bytes);
+
+ENGINE_NATIVE_API engine_native_status_t content_acquire_file_handle(
+    engine_native_engine_handle_t engine,
+    const char* asset_path,
+    const void** out_data,
+    size_t* out_size);
+
+ENGINE_NATIVE_API engine_native_status_t content_acquire_file_view_handle(
+    engine_native_engine_handle_t engine,
+    engine_native_string_view_t asset_path,
+    const void** out_data,
+    size_t* out_size);
+
+ENGINE_NATIVE_API engine_native_status_t content_release_file_handle(
+    engine_native_engine_handle_t engine,
+    const void* data);
+
+ENGINE_NATIVE_API engine_native_status_t content_get_cache_stats_handle(
+    engine_native_engine_handle_t engine,
+    engine_native_content_cache_stats_t* out_stats);
+
+ENGINE_NATIVE_API engine_native_status_t content_read_file_range_handle(
+    engine_native_engine_handle_t engine,
+    const char* asset_path,
+    uint64_t offset_bytes,
+    void* buffer,
+    size_t length,
+    size_t* out_size);
+
+ENGINE_NATIVE_API engine_native_status_t content_read_file_range_view_handle(
+    engine_native_engine_handle_t engine,
+    engine_native_string_view_t asset_path,
+    uint64_t offset_bytes,
+    void* buffer,
+    size_t length,
+    size_t* out_size);
+
+ENGINE_NATIVE_API engine_native_status_t content_read_by_key_handle(
+    engine_native_engine_handle_t engine,
+    uint64_t asset_key,
+    void* buffer,
+    size_t buffer_size,
+    size_t* out_size);
+
 ENGINE_NATIVE_API engine_native_status_t renderer_begin_frame_handle(
     engine_native_renderer_handle_t renderer,
     size_t requested_bytes,
     size_t alignment,
     void** out_frame_memory);
 
+ENGINE_NATIVE_API engine_native_status_t renderer_resize_frame_handle(
+    engine_native_renderer_handle_t renderer,
+    size_t requested_bytes,
+    size_t alignment,
+    void** out_frame_memory);
+
 ENGINE_NATIVE_API engine_native_status_t renderer_submit_handle(
     engine_native_renderer_handle_t renderer,
     const engine_native_render_packet_t* packet);
@@ -675,6 +1180,15 @@ ENGINE_NATIVE_API engine_native_status_t renderer_get_last_frame_stats_handle(
     engine_native_renderer_handle_t renderer,
     engine_native_renderer_frame_stats_t* out_stats);
 
+ENGINE_NATIVE_API engine_native_status_t renderer_prewarm_pipelines_handle(
+    engine_native_renderer_handle_t renderer,
+    const engine_native_pipeline_prewarm_item_t* items,
+    uint32_t item_count);
+
+ENGINE_NATIVE_API engine_native_status_t renderer_get_pipeline_prewarm_progress_handle(
+    engine_native_renderer_handle_t renderer,
+    engine_native_pipeline_prewarm_progress_t* out_progress);
+
 ENGINE_NATIVE_API engine_native_status_t renderer_ui_reset_handle(
     engine_native_renderer_handle_t renderer);
 
@@ -2,6 +2,8 @@
 
 #include <cstring>
 #include <string>
+#include <string_view>
+#include <utility>
 
 namespace {
 
@@ -28,6 +30,36 @@ engine_native_status_t CopyStringFromView(engine_native_string_view_t view,
   return ENGINE_NATIVE_STATUS_OK;
 }
 
+// Borrows the caller's bytes for calls that finish before returning.
+engine_native_status_t BorrowStringFromView(engine_native_string_view_t view,
+                                            std::string_view* out_value) {
+  if (view.data == nullptr) {
+    if (view.length != 0u) {
+      return ENGINE_NATIVE_STATUS_INVALID_ARGUMENT;
+    }
+
+    *out_value = std::string_view();
+    return ENGINE_NATIVE_STATUS_OK;
+  }
+
+  if (std::memchr(view.data, '\0', view.length) != nullptr) {
+    return ENGINE_NATIVE_STATUS_INVALID_ARGUMENT;
+  }
+
+  *out_value = std::string_view(view.data, view.length);
+  return ENGINE_NATIVE_STATUS_OK;
+}
+
+engine_native_status_t BorrowStringFromCstr(const char* value,
+                                            std::string_view* out_value) {
+  if (value == nullptr) {
+    return ENGINE_NATIVE_STATUS_INVALID_ARGUMENT;
+  }
+
+  *out_value = std::string_view(value);
+  return ENGINE_NATIVE_STATUS_OK;
+}
+
 engine_native_status_t CopyStringFromCstr(const char* value, std::string* out_value) {
   if (value == nullptr) {
     return ENGINE_NATIVE_STATUS_INVALID_ARGUMENT;
@@ -85,9 +117,9 @@ engine_native_status_t content_read_file(engine_native_engine_t* engine,
     return ENGINE_NATIVE_STATUS_INVALID_ARGUMENT;
   }
 
-  std::string asset_path_value;
+  std::string_view asset_path_value;
   const engine_native_status_t status =
-      CopyStringFromCstr(asset_path, &asset_path_value);
+      BorrowStringFromCstr(asset_path, &asset_path_value);
   if (status != ENGINE_NATIVE_STATUS_OK) {
     return status;
   }
@@ -96,6 +128,24 @@ engine_native_status_t content_read_file(engine_native_engine_t* engine,
                                         buffer_size, out_size);
 }
 
+engine_native_status_t content_map_file(engine_native_engine_t* engine,
+                                        const char* asset_path,
+                                        const void** out_data,
+                                        size_t* out_size) {
+  if (engine == nullptr) {
+    return ENGINE_NATIVE_STATUS_INVALID_ARGUMENT;
+  }
+
+  std::string_view asset_path_value;
+  const engine_native_status_t status =
+      BorrowStringFromCstr(asset_path, &asset_path_value);
+  if (status != ENGINE_NATIVE_STATUS_OK) {
+    return status;
+  }
+
+  return engine->state.content.MapFile(asset_path_value, out_data, out_size);
+}
+
 engine_native_status_t content_mount_pak_view(
     engine_native_engine_t* engine,
     engine_native_string_view_t pak_path) {
@@ -140,9 +190,9 @@ engine_native_status_t content_read_file_view(
     return ENGINE_NATIVE_STATUS_INVALID_ARGUMENT;
   }
 
-  std::string asset_path_value;
+  std::string_view asset_path_value;
   const engine_native_status_t status =
-      CopyStringFromView(asset_path, &asset_path_value);
+      BorrowStringFromView(asset_path, &asset_path_value);
   if (status != ENGINE_NATIVE_STATUS_OK) {
     return status;
   }
@@ -151,4 +201,332 @@ engine_native_status_t content_read_file_view(
                                         out_size);
 }
 
+engine_native_status_t content_map_file_view(
+    engine_native_engine_t* engine,
+    engine_native_string_view_t asset_path,
+    const void** out_data,
+    size_t* out_size) {
+  if (engine == nullptr) {
+    return ENGINE_NATIVE_STATUS_INVALID_ARGUMENT;
+  }
+
+  std::string_view asset_path_value;
+  const engine_native_status_t status =
+      BorrowStringFromView(asset_path, &asset_path_value);
+  if (status != ENGINE_NATIVE_STATUS_OK) {
+    return status;
+  }
+
+  return engine->state.content.MapFile(asset_path_value, out_data, out_size);
+}
+
+engine_native_status_t content_read_file_async(engine_native_engine_t* engine,
+                                               const char* asset_path,
+                                               void* buffer,
+                                               size_t buffer_size,
+                                               uint64_t* out_request_id) {
+  if (engine == nullptr) {
+    return ENGINE_NATIVE_STATUS_INVALID_ARGUMENT;
+  }
+
+  std::string asset_path_value;
+  const engine_native_status_t status =
+      CopyStringFromCstr(asset_path, &asset_path_value);
+  if (status != ENGINE_NATIVE_STATUS_OK) {
+    return status;
+  }
+
+  return engine->state.content_reads.Submit(std::move(asset_path_value), buffer,
+                                            buffer_size, out_request_id);
+}
+
+engine_native_status_t content_read_file_async_view(
+    engine_native_engine_t* engine,
+    engine_native_string_view_t asset_path,
+    void* buffer,
+    size_t buffer_size,
+    uint64_t* out_request_id) {
+  if (engine == nullptr) {
+    return ENGINE_NATIVE_STATUS_INVALID_ARGUMENT;
+  }
+
+  std::string asset_path_value;
+  const engine_native_status_t status =
+      CopyStringFromView(asset_path, &asset_path_value);
+  if (status != ENGINE_NATIVE_STATUS_OK) {
+    return status;
+  }
+
+  return engine->state.content_reads.Submit(std::move(asset_path_value), buffer,
+                                            buffer_size, out_request_id);
+}
+
+engine_native_status_t content_poll_read(
+    engine_native_engine_t* engine,
+    uint64_t request_id,
+    engine_native_content_read_result_t* out_result,
+    uint8_t* out_is_ready) {
+  if (engine == nullptr) {
+    return ENGINE_NATIVE_STATUS_INVALID_ARGUMENT;
+  }
+
+  return engine->state.content_reads.Poll(request_id, out_result, out_is_ready);
+}
+
+engine_native_status_t content_free_read_result(
+    engine_native_engine_t* engine,
+    engine_native_content_read_result_t* result) {
+  if (engine == nullptr) {
+    return ENGINE_NATIVE_STATUS_INVALID_ARGUMENT;
+  }
+
+  return engine->state.content_reads.FreeResult(result);
+}
+
+engine_native_status_t content_cancel_read(engine_native_engine_t* engine,
+                                           uint64_t request_id) {
+  if (engine == nullptr) {
+    return ENGINE_NATIVE_STATUS_INVALID_ARGUMENT;
+  }
+
+  return engine->state.content_reads.Cancel(request_id);
+}
+
+engine_native_status_t content_get_read_stats(
+    engine_native_engine_t* engine,
+    engine_native_content_read_stats_t* out_stats) {
+  if (engine == nullptr) {
+    return ENGINE_NATIVE_STATUS_INVALID_ARGUMENT;
+  }
+
+  return engine->state.content_reads.GetStats(out_stats);
+}
+
+engine_native_status_t content_stream_request(engine_native_engine_t* engine,
+                                              const char* asset_path,
+                                              float priority,
+                                              void* buffer,
+                                              size_t buffer_size,
+                                              uint64_t* out_request_id) {
+  if (engine == nullptr) {
+    return ENGINE_NATIVE_STATUS_INVALID_ARGUMENT;
+  }
+
+  std::string asset_path_value;
+  const engine_native_status_t status =
+      CopyStringFromCstr(asset_path, &asset_path_value);
+  if (status != ENGINE_NATIVE_STATUS_OK) {
+    return status;
+  }
+
+  return engine->state.content_streaming.Request(
+      std::move(asset_path_value), priority, buffer, buffer_size,
+      out_request_id);
+}
+
+engine_native_status_t content_stream_request_view(
+    engine_native_engine_t* engine,
+    engine_native_string_view_t asset_path,
+    float priority,
+    void* buffer,
+    size_t buffer_size,
+    uint64_t* out_request_id) {
+  if (engine == nullptr) {
+    return ENGINE_NATIVE_STATUS_INVALID_ARGUMENT;
+  }
+
+  std::string asset_path_value;
+  const engine_native_status_t status =
+      CopyStringFromView(asset_path, &asset_path_value);
+  if (status != ENGINE_NATIVE_STATUS_OK) {
+    return status;
+  }
+
+  return engine->state.content_streaming.Request(
+      std::move(asset_path_value), priority, buffer, buffer_size,
+      out_request_id);
+}
+
+engine_native_status_t content_stream_set_priority(
+    engine_native_engine_t* engine,
+    uint64_t request_id,
+    float priority) {
+  if (engine == nullptr) {
+    return ENGINE_NATIVE_STATUS_INVALID_ARGUMENT;
+  }
+
+  return engine->state.content_streaming.SetPriority(request_id, priority);
+}
+
+engine_native_status_t content_stream_cancel(engine_native_engine_t* engine,
+                                             uint64_t request_id) {
+  if (engine == nullptr) {
+    return ENGINE_NATIVE_STATUS_INVALID_ARGUMENT;
+  }
+
+  return engine->state.content_streaming.Cancel(request_id);
+}
+
+engine_native_status_t content_stream_poll(
+    engine_native_engine_t* engine,
+    uint64_t request_id,
+    engine_native_content_read_result_t* out_result,
+    uint8_t* out_is_ready) {
+  if (engine == nullptr) {
+    return ENGINE_NATIVE_STATUS_INVALID_ARGUMENT;
+  }
+
+  return engine->state.content_streaming.Poll(request_id, out_result,
+                                              out_is_ready);
+}
+
+engine_native_status_t content_stream_set_frame_budget(
+    engine_native_engine_t* engine,
+    uint64_t budget_bytes) {
+  if (engine == nullptr) {
+    return ENGINE_NATIVE_STATUS_INVALID_ARGUMENT;
+  }
+
+  return engine->state.content_streaming.SetFrameBudget(budget_bytes);
+}
+
+engine_native_status_t content_stream_update(engine_native_engine_t* engine) {
+  if (engine == nullptr) {
+    return ENGINE_NATIVE_STATUS_INVALID_ARGUMENT;
+  }
+
+  return engine->state.content_streaming.Update();
+}
+
+engine_native_status_t content_stream_get_stats(
+    engine_native_engine_t* engine,
+    engine_native_content_stream_stats_t* out_stats) {
+  if (engine == nullptr) {
+    return ENGINE_NATIVE_STATUS_INVALID_ARGUMENT;
+  }
+
+  return engine->state.content_streaming.GetStats(out_stats);
+}
+
+engine_native_status_t content_set_cache_budget(engine_native_engine_t* engine,
+                                                uint64_t budget_bytes) {
+  if (engine == nullptr) {
+    return ENGINE_NATIVE_STATUS_INVALID_ARGUMENT;
+  }
+
+  return engine->state.content.SetCacheBudget(budget_bytes);
+}
+
+engine_native_status_t content_acquire_file(engine_native_engine_t* engine,
+                                            const char* asset_path,
+                                            const void** out_data,
+                                            size_t* out_size) {
+  if (engine == nullptr) {
+    return ENGINE_NATIVE_STATUS_INVALID_ARGUMENT;
+  }
+
+  std::string asset_path_value;
+  const engine_native_status_t status =
+      CopyStringFromCstr(asset_path, &asset_path_value);
+  if (status != ENGINE_NATIVE_STATUS_OK) {
+    return status;
+  }
+
+  return engine->state.content.AcquireFile(asset_path_value, out_data, out_size);
+}
+
+engine_native_status_t content_acquire_file_view(
+    engine_native_engine_t* engine,
+    engine_native_string_view_t asset_path,
+    const void** out_data,
+    size_t* out_size) {
+  if (engine == nullptr) {
+    return ENGINE_NATIVE_STATUS_INVALID_ARGUMENT;
+  }
+
+  std::string asset_path_value;
+  const engine_native_status_t status =
+      CopyStringFromView(asset_path, &asset_path_value);
+  if (status != ENGINE_NATIVE_STATUS_OK) {
+    return status;
+  }
+
+  return engine->state.content.AcquireFile(asset_path_value, out_data, out_size);
+}
+
+engine_native_status_t content_release_file(engine_native_engine_t* engine,
+                                            const void* data) {
+  if (engine == nullptr) {
+    return ENGINE_NATIVE_STATUS_INVALID_ARGUMENT;
+  }
+
+  return engine->state.content.ReleaseFile(data);
+}
+
+engine_native_status_t content_get_cache_stats(
+    engine_native_engine_t* engine,
+    engine_native_content_cache_stats_t* out_stats) {
+  if (engine == nullptr) {
+    return ENGINE_NATIVE_STATUS_INVALID_ARGUMENT;
+  }
+
+  return engine->state.content.GetCacheStats(out_stats);
+}
+
+engine_native_status_t content_read_file_range(engine_native_engine_t* engine,
+                                               const char* asset_path,
+                                               uint64_t offset_bytes,
+                                               void* buffer,
+                                               size_t length,
+                                               size_t* out_size) {
+  if (engine == nullptr) {
+    return ENGINE_NATIVE_STATUS_INVALID_ARGUMENT;
+  }
+
+  std::string_view asset_path_value;
+  const engine_native_status_t status =
+      BorrowStringFromCstr(asset_path, &asset_path_value);
+  if (status != ENGINE_NATIVE_STATUS_OK) {
+    return status;
+  }
+
+  return engine->state.content.ReadFileRange(asset_path_value, offset_bytes,
+                                             buffer, length, out_size);
+}
+
+engine_native_status_t content_read_file_range_view(
+    engine_native_engine_t* engine,
+    engine_native_string_view_t asset_path,
+    uint64_t offset_bytes,
+    void* buffer,
+    size_t length,
+    size_t* out_size) {
+  if (engine == nullptr) {
+    return ENGINE_NATIVE_STATUS_INVALID_ARGUMENT;
+  }
+
+  std::string_view asset_path_value;
+  const engine_native_status_t status =
+      BorrowStringFromView(asset_path, &asset_path_value);
+  if (status != ENGINE_NATIVE_STATUS_OK) {
+    return status;
+  }
+
+  return engine->state.content.ReadFileRange(asset_path_value, offset_bytes,
+                                             buffer, length, out_size);
+}
+
+engine_native_status_t content_read_by_key(engine_native_engine_t* engine,
+                                           uint64_t asset_key,
+                                           void* buffer,
+                                           size_t buffer_size,
+                                           size_t* out_size) {
+  if (engine == nullptr) {
+    return ENGINE_NATIVE_STATUS_INVALID_ARGUMENT;
+  }
+
+  return engine->state.content.ReadByKey(asset_key, buffer, buffer_size,
+                                         out_size);
+}
+
 }  // extern "C"
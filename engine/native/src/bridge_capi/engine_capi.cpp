@@ -1,5 +1,6 @@
 #include "bridge_capi/bridge_state.h"
 #include "bridge_capi/handle_registry.h"
+#include "core/frame_command_executor.h"
 
 #include <new>
 
@@ -61,7 +62,15 @@ engine_native_status_t engine_pump_events(engine_native_engine_t* engine,
     return ENGINE_NATIVE_STATUS_INVALID_ARGUMENT;
   }
 
-  return engine->state.platform.PumpEvents(out_input, out_events);
+  const engine_native_status_t status =
+      engine->state.platform.PumpEvents(out_input, out_events);
+  if (status != ENGINE_NATIVE_STATUS_OK) {
+    return status;
+  }
+
+  engine->state.renderer.SetRenderTargetExtent(out_events->width,
+                                               out_events->height);
+  return ENGINE_NATIVE_STATUS_OK;
 }
 
 engine_native_status_t engine_get_renderer(engine_native_engine_t* engine,
@@ -104,4 +113,17 @@ engine_native_status_t engine_get_net(engine_native_engine_t* engine,
   return ENGINE_NATIVE_STATUS_OK;
 }
 
+engine_native_status_t engine_execute_frame_commands(
+    engine_native_engine_t* engine,
+    const void* commands,
+    size_t command_bytes,
+    engine_native_frame_command_results_t* out_results) {
+  if (engine == nullptr || out_results == nullptr) {
+    return ENGINE_NATIVE_STATUS_INVALID_ARGUMENT;
+  }
+
+  return dff::native::ExecuteFrameCommands(&engine->state, commands,
+                                           command_bytes, out_results);
+}
+
 }  // extern "C"
@@ -162,6 +162,22 @@ engine_native_status_t engine_get_net_handle(
   return dff::native::bridge::RegisterNetHandle(net, raw_engine, false, out_net);
 }
 
+engine_native_status_t engine_execute_frame_commands_handle(
+    engine_native_engine_handle_t engine,
+    const void* commands,
+    size_t command_bytes,
+    engine_native_frame_command_results_t* out_results) {
+  engine_native_engine_t* raw_engine = nullptr;
+  const engine_native_status_t resolve_status =
+      ResolveEngine(engine, &raw_engine);
+  if (resolve_status != ENGINE_NATIVE_STATUS_OK) {
+    return resolve_status;
+  }
+
+  return engine_execute_frame_commands(raw_engine, commands, command_bytes,
+                                       out_results);
+}
+
 engine_native_status_t content_mount_pak_handle(
     engine_native_engine_handle_t engine,
     const char* pak_path) {
@@ -217,6 +233,25 @@ engine_native_status_t content_read_file_handle(
                                 out_size);
 }
 
+engine_native_status_t content_map_file_handle(
+    engine_native_engine_handle_t engine,
+    const char* asset_path,
+    const void** out_data,
+    size_t* out_size) {
+  engine_native_engine_t* raw_engine = nullptr;
+  const engine_native_status_t resolve_status =
+      ResolveEngine(engine, &raw_engine);
+  if (resolve_status != ENGINE_NATIVE_STATUS_OK) {
+    return resolve_status;
+  }
+
+  const engine_native_string_view_t asset_path_view{
+      .data = asset_path,
+      .length = asset_path == nullptr ? 0u : std::strlen(asset_path),
+  };
+  return content_map_file_view(raw_engine, asset_path_view, out_data, out_size);
+}
+
 engine_native_status_t content_mount_pak_view_handle(
     engine_native_engine_handle_t engine,
     engine_native_string_view_t pak_path) {
@@ -260,4 +295,362 @@ engine_native_status_t content_read_file_view_handle(
                                 out_size);
 }
 
+engine_native_status_t content_map_file_view_handle(
+    engine_native_engine_handle_t engine,
+    engine_native_string_view_t asset_path,
+    const void** out_data,
+    size_t* out_size) {
+  engine_native_engine_t* raw_engine = nullptr;
+  const engine_native_status_t resolve_status =
+      ResolveEngine(engine, &raw_engine);
+  if (resolve_status != ENGINE_NATIVE_STATUS_OK) {
+    return resolve_status;
+  }
+
+  return content_map_file_view(raw_engine, asset_path, out_data, out_size);
+}
+
+engine_native_status_t content_read_file_async_handle(
+    engine_native_engine_handle_t engine,
+    const char* asset_path,
+    void* buffer,
+    size_t buffer_size,
+    uint64_t* out_request_id) {
+  engine_native_engine_t* raw_engine = nullptr;
+  const engine_native_status_t resolve_status =
+      ResolveEngine(engine, &raw_engine);
+  if (resolve_status != ENGINE_NATIVE_STATUS_OK) {
+    return resolve_status;
+  }
+
+  const engine_native_string_view_t asset_path_view{
+      .data = asset_path,
+      .length = asset_path == nullptr ? 0u : std::strlen(asset_path),
+  };
+  return content_read_file_async_view(raw_engine, asset_path_view, buffer,
+                                      buffer_size, out_request_id);
+}
+
+engine_native_status_t content_read_file_async_view_handle(
+    engine_native_engine_handle_t engine,
+    engine_native_string_view_t asset_path,
+    void* buffer,
+    size_t buffer_size,
+    uint64_t* out_request_id) {
+  engine_native_engine_t* raw_engine = nullptr;
+  const engine_native_status_t resolve_status =
+      ResolveEngine(engine, &raw_engine);
+  if (resolve_status != ENGINE_NATIVE_STATUS_OK) {
+    return resolve_status;
+  }
+
+  return content_read_file_async_view(raw_engine, asset_path, buffer,
+                                      buffer_size, out_request_id);
+}
+
+engine_native_status_t content_poll_read_handle(
+    engine_native_engine_handle_t engine,
+    uint64_t request_id,
+    engine_native_content_read_result_t* out_result,
+    uint8_t* out_is_ready) {
+  engine_native_engine_t* raw_engine = nullptr;
+  const engine_native_status_t resolve_status =
+      ResolveEngine(engine, &raw_engine);
+  if (resolve_status != ENGINE_NATIVE_STATUS_OK) {
+    return resolve_status;
+  }
+
+  return content_poll_read(raw_engine, request_id, out_result, out_is_ready);
+}
+
+engine_native_status_t content_free_read_result_handle(
+    engine_native_engine_handle_t engine,
+    engine_native_content_read_result_t* result) {
+  engine_native_engine_t* raw_engine = nullptr;
+  const engine_native_status_t resolve_status =
+      ResolveEngine(engine, &raw_engine);
+  if (resolve_status != ENGINE_NATIVE_STATUS_OK) {
+    return resolve_status;
+  }
+
+  return content_free_read_result(raw_engine, result);
+}
+
+engine_native_status_t content_cancel_read_handle(
+    engine_native_engine_handle_t engine,
+    uint64_t request_id) {
+  engine_native_engine_t* raw_engine = nullptr;
+  const engine_native_status_t resolve_status =
+      ResolveEngine(engine, &raw_engine);
+  if (resolve_status != ENGINE_NATIVE_STATUS_OK) {
+    return resolve_status;
+  }
+
+  return content_cancel_read(raw_engine, request_id);
+}
+
+engine_native_status_t content_get_read_stats_handle(
+    engine_native_engine_handle_t engine,
+    engine_native_content_read_stats_t* out_stats) {
+  engine_native_engine_t* raw_engine = nullptr;
+  const engine_native_status_t resolve_status =
+      ResolveEngine(engine, &raw_engine);
+  if (resolve_status != ENGINE_NATIVE_STATUS_OK) {
+    return resolve_status;
+  }
+
+  return content_get_read_stats(raw_engine, out_stats);
+}
+
+engine_native_status_t content_stream_request_handle(
+    engine_native_engine_handle_t engine,
+    const char* asset_path,
+    float priority,
+    void* buffer,
+    size_t buffer_size,
+    uint64_t* out_request_id) {
+  engine_native_engine_t* raw_engine = nullptr;
+  const engine_native_status_t resolve_status =
+      ResolveEngine(engine, &raw_engine);
+  if (resolve_status != ENGINE_NATIVE_STATUS_OK) {
+    return resolve_status;
+  }
+
+  const engine_native_string_view_t asset_path_view{
+      .data = asset_path,
+      .length = asset_path == nullptr ? 0u : std::strlen(asset_path),
+  };
+  return content_stream_request_view(raw_engine, asset_path_view, priority,
+                                     buffer, buffer_size, out_request_id);
+}
+
+engine_native_status_t content_stream_request_view_handle(
+    engine_native_engine_handle_t engine,
+    engine_native_string_view_t asset_path,
+    float priority,
+    void* buffer,
+    size_t buffer_size,
+    uint64_t* out_request_id) {
+  engine_native_engine_t* raw_engine = nullptr;
+  const engine_native_status_t resolve_status =
+      ResolveEngine(engine, &raw_engine);
+  if (resolve_status != ENGINE_NATIVE_STATUS_OK) {
+    return resolve_status;
+  }
+
+  return content_stream_request_view(raw_engine, asset_path, priority, buffer,
+                                     buffer_size, out_request_id);
+}
+
+engine_native_status_t content_stream_set_priority_handle(
+    engine_native_engine_handle_t engine,
+    uint64_t request_id,
+    float priority) {
+  engine_native_engine_t* raw_engine = nullptr;
+  const engine_native_status_t resolve_status =
+      ResolveEngine(engine, &raw_engine);
+  if (resolve_status != ENGINE_NATIVE_STATUS_OK) {
+    return resolve_status;
+  }
+
+  return content_stream_set_priority(raw_engine, request_id, priority);
+}
+
+engine_native_status_t content_stream_cancel_handle(
+    engine_native_engine_handle_t engine,
+    uint64_t request_id) {
+  engine_native_engine_t* raw_engine = nullptr;
+  const engine_native_status_t resolve_status =
+      ResolveEngine(engine, &raw_engine);
+  if (resolve_status != ENGINE_NATIVE_STATUS_OK) {
+    return resolve_status;
+  }
+
+  return content_stream_cancel(raw_engine, request_id);
+}
+
+engine_native_status_t content_stream_poll_handle(
+    engine_native_engine_handle_t engine,
+    uint64_t request_id,
+    engine_native_content_read_result_t* out_result,
+    uint8_t* out_is_ready) {
+  engine_native_engine_t* raw_engine = nullptr;
+  const engine_native_status_t resolve_status =
+      ResolveEngine(engine, &raw_engine);
+  if (resolve_status != ENGINE_NATIVE_STATUS_OK) {
+    return resolve_status;
+  }
+
+  return content_stream_poll(raw_engine, request_id, out_result, out_is_ready);
+}
+
+engine_native_status_t content_stream_set_frame_budget_handle(
+    engine_native_engine_handle_t engine,
+    uint64_t budget_bytes) {
+  engine_native_engine_t* raw_engine = nullptr;
+  const engine_native_status_t resolve_status =
+      ResolveEngine(engine, &raw_engine);
+  if (resolve_status != ENGINE_NATIVE_STATUS_OK) {
+    return resolve_status;
+  }
+
+  return content_stream_set_frame_budget(raw_engine, budget_bytes);
+}
+
+engine_native_status_t content_stream_update_handle(
+    engine_native_engine_handle_t engine) {
+  engine_native_engine_t* raw_engine = nullptr;
+  const engine_native_status_t resolve_status =
+      ResolveEngine(engine, &raw_engine);
+  if (resolve_status != ENGINE_NATIVE_STATUS_OK) {
+    return resolve_status;
+  }
+
+  return content_stream_update(raw_engine);
+}
+
+engine_native_status_t content_stream_get_stats_handle(
+    engine_native_engine_handle_t engine,
+    engine_native_content_stream_stats_t* out_stats) {
+  engine_native_engine_t* raw_engine = nullptr;
+  const engine_native_status_t resolve_status =
+      ResolveEngine(engine, &raw_engine);
+  if (resolve_status != ENGINE_NATIVE_STATUS_OK) {
+    return resolve_status;
+  }
+
+  return content_stream_get_stats(raw_engine, out_stats);
+}
+
+engine_native_status_t content_set_cache_budget_handle(
+    engine_native_engine_handle_t engine,
+    uint64_t budget_bytes) {
+  engine_native_engine_t* raw_engine = nullptr;
+  const engine_native_status_t resolve_status =
+      ResolveEngine(engine, &raw_engine);
+  if (resolve_status != ENGINE_NATIVE_STATUS_OK) {
+    return resolve_status;
+  }
+
+  return content_set_cache_budget(raw_engine, budget_bytes);
+}
+
+engine_native_status_t content_acquire_file_handle(
+    engine_native_engine_handle_t engine,
+    const char* asset_path,
+    const void** out_data,
+    size_t* out_size) {
+  engine_native_engine_t* raw_engine = nullptr;
+  const engine_native_status_t resolve_status =
+      ResolveEngine(engine, &raw_engine);
+  if (resolve_status != ENGINE_NATIVE_STATUS_OK) {
+    return resolve_status;
+  }
+
+  const engine_native_string_view_t asset_path_view{
+      .data = asset_path,
+      .length = asset_path == nullptr ? 0u : std::strlen(asset_path),
+  };
+  return content_acquire_file_view(raw_engine, asset_path_view, out_data,
+                                   out_size);
+}
+
+engine_native_status_t content_acquire_file_view_handle(
+    engine_native_engine_handle_t engine,
+    engine_native_string_view_t asset_path,
+    const void** out_data,
+    size_t* out_size) {
+  engine_native_engine_t* raw_engine = nullptr;
+  const engine_native_status_t resolve_status =
+      ResolveEngine(engine, &raw_engine);
+  if (resolve_status != ENGINE_NATIVE_STATUS_OK) {
+    return resolve_status;
+  }
+
+  return content_acquire_file_view(raw_engine, asset_path, out_data, out_size);
+}
+
+engine_native_status_t content_release_file_handle(
+    engine_native_engine_handle_t engine,
+    const void* data) {
+  engine_native_engine_t* raw_engine = nullptr;
+  const engine_native_status_t resolve_status =
+      ResolveEngine(engine, &raw_engine);
+  if (resolve_status != ENGINE_NATIVE_STATUS_OK) {
+    return resolve_status;
+  }
+
+  return content_release_file(raw_engine, data);
+}
+
+engine_native_status_t content_get_cache_stats_handle(
+    engine_native_engine_handle_t engine,
+    engine_native_content_cache_stats_t* out_stats) {
+  engine_native_engine_t* raw_engine = nullptr;
+  const engine_native_status_t resolve_status =
+      ResolveEngine(engine, &raw_engine);
+  if (resolve_status != ENGINE_NATIVE_STATUS_OK) {
+    return resolve_status;
+  }
+
+  return content_get_cache_stats(raw_engine, out_stats);
+}
+
+engine_native_status_t content_read_file_range_handle(
+    engine_native_engine_handle_t engine,
+    const char* asset_path,
+    uint64_t offset_bytes,
+    void* buffer,
+    size_t length,
+    size_t* out_size) {
+  engine_native_engine_t* raw_engine = nullptr;
+  const engine_native_status_t resolve_status =
+      ResolveEngine(engine, &raw_engine);
+  if (resolve_status != ENGINE_NATIVE_STATUS_OK) {
+    return resolve_status;
+  }
+
+  const engine_native_string_view_t asset_path_view{
+      .data = asset_path,
+      .length = asset_path == nullptr ? 0u : std::strlen(asset_path),
+  };
+  return content_read_file_range_view(raw_engine, asset_path_view, offset_bytes,
+                                      buffer, length, out_size);
+}
+
+engine_native_status_t content_read_file_range_view_handle(
+    engine_native_engine_handle_t engine,
+    engine_native_string_view_t asset_path,
+    uint64_t offset_bytes,
+    void* buffer,
+    size_t length,
+    size_t* out_size) {
+  engine_native_engine_t* raw_engine = nullptr;
+  const engine_native_status_t resolve_status =
+      ResolveEngine(engine, &raw_engine);
+  if (resolve_status != ENGINE_NATIVE_STATUS_OK) {
+    return resolve_status;
+  }
+
+  return content_read_file_range_view(raw_engine, asset_path, offset_bytes,
+                                      buffer, length, out_size);
+}
+
+engine_native_status_t content_read_by_key_handle(
+    engine_native_engine_handle_t engine,
+    uint64_t asset_key,
+    void* buffer,
+    size_t buffer_size,
+    size_t* out_size) {
+  engine_native_engine_t* raw_engine = nullptr;
+  const engine_native_status_t resolve_status =
+      ResolveEngine(engine, &raw_engine);
+  if (resolve_status != ENGINE_NATIVE_STATUS_OK) {
+    return resolve_status;
+  }
+
+  return content_read_by_key(raw_engine, asset_key, buffer, buffer_size,
+                             out_size);
+}
+
 }  // extern "C"
@@ -27,6 +27,22 @@ engine_native_status_t renderer_begin_frame_handle(
   return renderer_begin_frame(raw_renderer, requested_bytes, alignment, out_frame_memory);
 }
 
+engine_native_status_t renderer_resize_frame_handle(
+    engine_native_renderer_handle_t renderer,
+    size_t requested_bytes,
+    size_t alignment,
+    void** out_frame_memory) {
+  engine_native_renderer_t* raw_renderer = nullptr;
+  const engine_native_status_t resolve_status =
+      ResolveRenderer(renderer, &raw_renderer);
+  if (resolve_status != ENGINE_NATIVE_STATUS_OK) {
+    return resolve_status;
+  }
+
+  return renderer_resize_frame(raw_renderer, requested_bytes, alignment,
+                               out_frame_memory);
+}
+
 engine_native_status_t renderer_submit_handle(
     engine_native_renderer_handle_t renderer,
     const engine_native_render_packet_t* packet) {
@@ -163,6 +179,33 @@ engine_native_status_t renderer_get_last_frame_stats_handle(
   return renderer_get_last_frame_stats(raw_renderer, out_stats);
 }
 
+engine_native_status_t renderer_prewarm_pipelines_handle(
+    engine_native_renderer_handle_t renderer,
+    const engine_native_pipeline_prewarm_item_t* items,
+    uint32_t item_count) {
+  engine_native_renderer_t* raw_renderer = nullptr;
+  const engine_native_status_t resolve_status =
+      ResolveRenderer(renderer, &raw_renderer);
+  if (resolve_status != ENGINE_NATIVE_STATUS_OK) {
+    return resolve_status;
+  }
+
+  return renderer_prewarm_pipelines(raw_renderer, items, item_count);
+}
+
+engine_native_status_t renderer_get_pipeline_prewarm_progress_handle(
+    engine_native_renderer_handle_t renderer,
+    engine_native_pipeline_prewarm_progress_t* out_progress) {
+  engine_native_renderer_t* raw_renderer = nullptr;
+  const engine_native_status_t resolve_status =
+      ResolveRenderer(renderer, &raw_renderer);
+  if (resolve_status != ENGINE_NATIVE_STATUS_OK) {
+    return resolve_status;
+  }
+
+  return renderer_get_pipeline_prewarm_progress(raw_renderer, out_progress);
+}
+
 engine_native_status_t renderer_ui_reset_handle(
     engine_native_renderer_handle_t renderer) {
   engine_native_renderer_t* raw_renderer = nullptr;
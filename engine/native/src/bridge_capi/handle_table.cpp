@@ -0,0 +1,220 @@
+#include "bridge_capi/handle_table.h"
+
+#include <algorithm>
+#include <new>
+
+namespace dff::native::bridge {
+namespace {
+
+constexpr uint64_t kHandleIndexMask = 0xFFFFFFFFull;
+
+uint64_t Encode(uint32_t index, uint32_t generation) {
+  const uint64_t encoded_index = static_cast<uint64_t>(index) + 1u;
+  return (static_cast<uint64_t>(generation) << 32u) | encoded_index;
+}
+
+}  // namespace
+
+HandleTable::HandleTable() {
+  for (std::atomic<Chunk*>& chunk : chunks_) {
+    chunk.store(nullptr, std::memory_order_relaxed);
+  }
+}
+
+HandleTable::~HandleTable() {
+  for (std::atomic<Chunk*>& chunk : chunks_) {
+    delete chunk.load(std::memory_order_relaxed);
+  }
+}
+
+engine_native_status_t HandleTable::GetOrCreate(void* object,
+                                                engine_native_engine_t* owner,
+                                                bool owns_state,
+                                                uint64_t* out_handle) {
+  if (object == nullptr || out_handle == nullptr) {
+    return ENGINE_NATIVE_STATUS_INVALID_ARGUMENT;
+  }
+
+  *out_handle = ENGINE_NATIVE_INVALID_HANDLE;
+  std::lock_guard<std::mutex> guard(mutex_);
+
+  const auto existing = index_by_object_.find(object);
+  if (existing != index_by_object_.end()) {
+    *out_handle = Encode(existing->second, EntryAt(existing->second).generation);
+    return ENGINE_NATIVE_STATUS_OK;
+  }
+
+  try {
+    if (free_indices_.empty()) {
+      if (chunk_count_ >= kMaxChunks) {
+        return ENGINE_NATIVE_STATUS_OUT_OF_MEMORY;
+      }
+
+      const size_t slot_count = static_cast<size_t>(chunk_count_ + 1u)
+                                << kChunkShift;
+      if (free_indices_.capacity() < slot_count) {
+        free_indices_.reserve(std::max(slot_count, free_indices_.capacity() * 2u));
+      }
+      Chunk* chunk = new Chunk();
+      chunks_[chunk_count_].store(chunk, std::memory_order_release);
+      const uint32_t chunk_base = chunk_count_ << kChunkShift;
+      ++chunk_count_;
+      for (uint32_t offset = kChunkSize; offset > 0u; --offset) {
+        free_indices_.push_back(chunk_base + offset - 1u);
+      }
+    }
+
+    const uint32_t index = free_indices_.back();
+    index_by_object_.emplace(object, index);
+    try {
+      if (owner != nullptr) {
+        indices_by_owner_.emplace(owner, index);
+      }
+    } catch (...) {
+      index_by_object_.erase(object);
+      throw;
+    }
+    free_indices_.pop_back();
+
+    Entry& entry = EntryAt(index);
+    entry.object.store(object, std::memory_order_relaxed);
+    entry.owner.store(owner, std::memory_order_relaxed);
+    entry.owns_state.store(owns_state ? 1u : 0u, std::memory_order_relaxed);
+    entry.sequence.store(entry.generation, std::memory_order_release);
+    *out_handle = Encode(index, entry.generation);
+    return ENGINE_NATIVE_STATUS_OK;
+  } catch (const std::bad_alloc&) {
+    return ENGINE_NATIVE_STATUS_OUT_OF_MEMORY;
+  }
+}
+
+engine_native_status_t HandleTable::Resolve(uint64_t handle,
+                                            void** out_object,
+                                            engine_native_engine_t** out_owner,
+                                            bool* out_owns_state) const {
+  if (out_object == nullptr) {
+    return ENGINE_NATIVE_STATUS_INVALID_ARGUMENT;
+  }
+
+  *out_object = nullptr;
+  if (out_owner != nullptr) {
+    *out_owner = nullptr;
+  }
+  if (out_owns_state != nullptr) {
+    *out_owns_state = false;
+  }
+
+  if (handle == ENGINE_NATIVE_INVALID_HANDLE) {
+    return ENGINE_NATIVE_STATUS_INVALID_ARGUMENT;
+  }
+
+  const uint32_t encoded_index = static_cast<uint32_t>(handle & kHandleIndexMask);
+  const uint32_t generation = static_cast<uint32_t>(handle >> 32u);
+  if (encoded_index == 0u || generation == 0u) {
+    return ENGINE_NATIVE_STATUS_INVALID_ARGUMENT;
+  }
+
+  const uint32_t index = encoded_index - 1u;
+  if ((index >> kChunkShift) >= kMaxChunks) {
+    return ENGINE_NATIVE_STATUS_NOT_FOUND;
+  }
+
+  const Chunk* chunk =
+      chunks_[index >> kChunkShift].load(std::memory_order_acquire);
+  if (chunk == nullptr) {
+    return ENGINE_NATIVE_STATUS_NOT_FOUND;
+  }
+
+  const Entry& entry = chunk->entries[index & (kChunkSize - 1u)];
+  if (entry.sequence.load(std::memory_order_acquire) != generation) {
+    return ENGINE_NATIVE_STATUS_NOT_FOUND;
+  }
+
+  void* object = entry.object.load(std::memory_order_relaxed);
+  engine_native_engine_t* owner = entry.owner.load(std::memory_order_relaxed);
+  const uint8_t owns_state = entry.owns_state.load(std::memory_order_relaxed);
+  std::atomic_thread_fence(std::memory_order_acquire);
+  if (entry.sequence.load(std::memory_order_relaxed) != generation ||
+      object == nullptr) {
+    return ENGINE_NATIVE_STATUS_NOT_FOUND;
+  }
+
+  *out_object = object;
+  if (out_owner != nullptr) {
+    *out_owner = owner;
+  }
+  if (out_owns_state != nullptr) {
+    *out_owns_state = owns_state != 0u;
+  }
+
+  return ENGINE_NATIVE_STATUS_OK;
+}
+
+void HandleTable::RemoveByObject(void* object) {
+  if (object == nullptr) {
+    return;
+  }
+
+  std::lock_guard<std::mutex> guard(mutex_);
+  const auto existing = index_by_object_.find(object);
+  if (existing == index_by_object_.end()) {
+    return;
+  }
+
+  const uint32_t index = existing->second;
+  engine_native_engine_t* owner =
+      EntryAt(index).owner.load(std::memory_order_relaxed);
+  if (owner != nullptr) {
+    auto [begin, end] = indices_by_owner_.equal_range(owner);
+    for (auto it = begin; it != end; ++it) {
+      if (it->second == index) {
+        indices_by_owner_.erase(it);
+        break;
+      }
+    }
+  }
+
+  index_by_object_.erase(existing);
+  Invalidate(index);
+}
+
+void HandleTable::RemoveByOwner(engine_native_engine_t* owner) {
+  if (owner == nullptr) {
+    return;
+  }
+
+  std::lock_guard<std::mutex> guard(mutex_);
+  auto [begin, end] = indices_by_owner_.equal_range(owner);
+  for (auto it = begin; it != end; ++it) {
+    index_by_object_.erase(EntryAt(it->second).object.load(std::memory_order_relaxed));
+    Invalidate(it->second);
+  }
+  indices_by_owner_.erase(owner);
+}
+
+size_t HandleTable::live_count() const {
+  std::lock_guard<std::mutex> guard(mutex_);
+  return index_by_object_.size();
+}
+
+HandleTable::Entry& HandleTable::EntryAt(uint32_t index) {
+  return chunks_[index >> kChunkShift]
+      .load(std::memory_order_relaxed)
+      ->entries[index & (kChunkSize - 1u)];
+}
+
+void HandleTable::Invalidate(uint32_t index) {
+  Entry& entry = EntryAt(index);
+  entry.sequence.store(0u, std::memory_order_relaxed);
+  std::atomic_thread_fence(std::memory_order_release);
+  entry.object.store(nullptr, std::memory_order_relaxed);
+  entry.owner.store(nullptr, std::memory_order_relaxed);
+  entry.owns_state.store(0u, std::memory_order_relaxed);
+  ++entry.generation;
+  if (entry.generation == 0u) {
+    entry.generation = 1u;
+  }
+  free_indices_.push_back(index);
+}
+
+}  // namespace dff::native::bridge
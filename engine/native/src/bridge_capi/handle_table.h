@@ -0,0 +1,73 @@
+#ifndef DFF_ENGINE_NATIVE_HANDLE_TABLE_H
+#define DFF_ENGINE_NATIVE_HANDLE_TABLE_H
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#include "engine_native.h"
+
+namespace dff::native::bridge {
+
+// Maps C API handles to bridge objects. Resolve is lock-free: each entry is
+// guarded by a sequence word that holds the live generation, and a reader
+// accepts the fields only if the word matches the handle before and after
+// they are read. Registration and removal are serialized by a mutex and use
+// hash indexes instead of scanning the entries.
+class HandleTable {
+ public:
+  static constexpr uint32_t kChunkShift = 8u;
+  static constexpr uint32_t kChunkSize = 1u << kChunkShift;
+  static constexpr uint32_t kMaxChunks = 1024u;
+
+  HandleTable();
+  ~HandleTable();
+
+  HandleTable(const HandleTable&) = delete;
+  HandleTable& operator=(const HandleTable&) = delete;
+
+  engine_native_status_t GetOrCreate(void* object,
+                                     engine_native_engine_t* owner,
+                                     bool owns_state,
+                                     uint64_t* out_handle);
+
+  engine_native_status_t Resolve(uint64_t handle,
+                                 void** out_object,
+                                 engine_native_engine_t** out_owner,
+                                 bool* out_owns_state) const;
+
+  void RemoveByObject(void* object);
+  void RemoveByOwner(engine_native_engine_t* owner);
+
+  size_t live_count() const;
+
+ private:
+  struct Entry {
+    std::atomic<uint32_t> sequence{0u};
+    std::atomic<void*> object{nullptr};
+    std::atomic<engine_native_engine_t*> owner{nullptr};
+    std::atomic<uint8_t> owns_state{0u};
+    uint32_t generation = 1u;
+  };
+
+  struct Chunk {
+    Entry entries[kChunkSize];
+  };
+
+  Entry& EntryAt(uint32_t index);
+  void Invalidate(uint32_t index);
+
+  mutable std::mutex mutex_;
+  std::array<std::atomic<Chunk*>, kMaxChunks> chunks_;
+  uint32_t chunk_count_ = 0u;
+  std::vector<uint32_t> free_indices_;
+  std::unordered_map<void*, uint32_t> index_by_object_;
+  std::unordered_multimap<engine_native_engine_t*, uint32_t> indices_by_owner_;
+};
+
+}  // namespace dff::native::bridge
+
+#endif
@@ -29,6 +29,18 @@ engine_native_status_t renderer_begin_frame(engine_native_renderer_t* renderer,
   return renderer->state->BeginFrame(requested_bytes, alignment, out_frame_memory);
 }
 
+engine_native_status_t renderer_resize_frame(engine_native_renderer_t* renderer,
+                                             size_t requested_bytes,
+                                             size_t alignment,
+                                             void** out_frame_memory) {
+  const engine_native_status_t status = ValidateRenderer(renderer);
+  if (status != ENGINE_NATIVE_STATUS_OK) {
+    return status;
+  }
+
+  return renderer->state->ResizeFrame(requested_bytes, alignment, out_frame_memory);
+}
+
 engine_native_status_t renderer_submit(engine_native_renderer_t* renderer,
                                        const engine_native_render_packet_t* packet) {
   const engine_native_status_t status = ValidateRenderer(renderer);
@@ -70,6 +82,29 @@ engine_native_status_t renderer_present_with_stats(
   return renderer->state->GetLastFrameStats(out_stats);
 }
 
+engine_native_status_t renderer_prewarm_pipelines(
+    engine_native_renderer_t* renderer,
+    const engine_native_pipeline_prewarm_item_t* items,
+    uint32_t item_count) {
+  const engine_native_status_t status = ValidateRenderer(renderer);
+  if (status != ENGINE_NATIVE_STATUS_OK) {
+    return status;
+  }
+
+  return renderer->state->PrewarmPipelines(items, item_count);
+}
+
+engine_native_status_t renderer_get_pipeline_prewarm_progress(
+    engine_native_renderer_t* renderer,
+    engine_native_pipeline_prewarm_progress_t* out_progress) {
+  const engine_native_status_t status = ValidateRenderer(renderer);
+  if (status != ENGINE_NATIVE_STATUS_OK) {
+    return status;
+  }
+
+  return renderer->state->GetPipelinePrewarmProgress(out_progress);
+}
+
 engine_native_status_t renderer_create_mesh_from_blob(
     engine_native_renderer_t* renderer,
     const void* data,
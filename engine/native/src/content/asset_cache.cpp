@@ -0,0 +1,248 @@
+#include "content/asset_cache.h"
+
+#include <cstring>
+#include <iterator>
+#include <new>
+#include <utility>
+
+namespace dff::native::content {
+
+void AssetCache::SetBudget(uint64_t budget_bytes) {
+  std::lock_guard<std::mutex> guard(mutex_);
+  budget_bytes_ = budget_bytes;
+  EvictToBudget();
+}
+
+uint64_t AssetCache::budget() const {
+  std::lock_guard<std::mutex> guard(mutex_);
+  return budget_bytes_;
+}
+
+engine_native_status_t AssetCache::Read(std::string_view normalized_path,
+                                        uint64_t generation,
+                                        void* buffer,
+                                        size_t buffer_size,
+                                        size_t* out_size) {
+  if (out_size == nullptr || (buffer == nullptr && buffer_size != 0u)) {
+    return ENGINE_NATIVE_STATUS_INVALID_ARGUMENT;
+  }
+
+  std::lock_guard<std::mutex> guard(mutex_);
+  const auto it = FindCurrent(normalized_path, generation);
+  if (it == entries_.end()) {
+    ++miss_count_;
+    return ENGINE_NATIVE_STATUS_NOT_FOUND;
+  }
+
+  ++hit_count_;
+  *out_size = it->size;
+  if (buffer == nullptr) {
+    return ENGINE_NATIVE_STATUS_OK;
+  }
+  if (buffer_size < it->size) {
+    return ENGINE_NATIVE_STATUS_INVALID_ARGUMENT;
+  }
+
+  std::memcpy(buffer, it->bytes.get(), it->size);
+  return ENGINE_NATIVE_STATUS_OK;
+}
+
+void AssetCache::Insert(std::string_view normalized_path,
+                        uint64_t generation,
+                        const void* data,
+                        size_t size) {
+  if (data == nullptr || size == 0u) {
+    return;
+  }
+
+  {
+    std::lock_guard<std::mutex> guard(mutex_);
+    if (size > budget_bytes_ ||
+        FindCurrent(normalized_path, generation) != entries_.end()) {
+      return;
+    }
+  }
+
+  std::unique_ptr<uint8_t[]> bytes(new (std::nothrow) uint8_t[size]);
+  if (bytes == nullptr) {
+    return;
+  }
+  std::memcpy(bytes.get(), data, size);
+
+  std::lock_guard<std::mutex> guard(mutex_);
+  if (FindCurrent(normalized_path, generation) != entries_.end()) {
+    return;
+  }
+
+  static_cast<void>(
+      Emplace(normalized_path, generation, std::move(bytes), size));
+  EvictToBudget();
+}
+
+bool AssetCache::Acquire(std::string_view normalized_path,
+                         uint64_t generation,
+                         const void** out_data,
+                         size_t* out_size) {
+  std::lock_guard<std::mutex> guard(mutex_);
+  const auto it = FindCurrent(normalized_path, generation);
+  if (it == entries_.end() || !Pin(it)) {
+    ++miss_count_;
+    return false;
+  }
+
+  ++hit_count_;
+  *out_data = it->bytes.get();
+  *out_size = it->size;
+  return true;
+}
+
+engine_native_status_t AssetCache::InsertPinned(
+    std::string_view normalized_path,
+    uint64_t generation,
+    std::unique_ptr<uint8_t[]> bytes,
+    size_t size,
+    const void** out_data) {
+  if (bytes == nullptr || size == 0u || out_data == nullptr) {
+    return ENGINE_NATIVE_STATUS_INVALID_ARGUMENT;
+  }
+
+  std::lock_guard<std::mutex> guard(mutex_);
+  auto it = FindCurrent(normalized_path, generation);
+  if (it == entries_.end()) {
+    it = Emplace(normalized_path, generation, std::move(bytes), size);
+  }
+  if (it == entries_.end() || !Pin(it)) {
+    return ENGINE_NATIVE_STATUS_OUT_OF_MEMORY;
+  }
+
+  *out_data = it->bytes.get();
+  EvictToBudget();
+  return ENGINE_NATIVE_STATUS_OK;
+}
+
+engine_native_status_t AssetCache::Release(const void* data) {
+  if (data == nullptr) {
+    return ENGINE_NATIVE_STATUS_OK;
+  }
+
+  std::lock_guard<std::mutex> guard(mutex_);
+  const auto pinned = pinned_.find(static_cast<const uint8_t*>(data));
+  if (pinned == pinned_.end()) {
+    return ENGINE_NATIVE_STATUS_NOT_FOUND;
+  }
+
+  const auto it = pinned->second;
+  if (--it->pins > 0u) {
+    return ENGINE_NATIVE_STATUS_OK;
+  }
+
+  pinned_.erase(pinned);
+  pinned_bytes_ -= it->size;
+  if (it->detached) {
+    resident_bytes_ -= it->size;
+    detached_.erase(it);
+  }
+  EvictToBudget();
+  return ENGINE_NATIVE_STATUS_OK;
+}
+
+void AssetCache::GetStats(engine_native_content_cache_stats_t* out_stats) const {
+  std::lock_guard<std::mutex> guard(mutex_);
+  *out_stats = engine_native_content_cache_stats_t{};
+  out_stats->entry_count = static_cast<uint32_t>(entries_.size() + detached_.size());
+  out_stats->pinned_entry_count = static_cast<uint32_t>(pinned_.size());
+  out_stats->budget_bytes = budget_bytes_;
+  out_stats->resident_bytes = resident_bytes_;
+  out_stats->pinned_bytes = pinned_bytes_;
+  out_stats->hit_count = hit_count_;
+  out_stats->miss_count = miss_count_;
+  out_stats->insert_count = insert_count_;
+  out_stats->eviction_count = eviction_count_;
+}
+
+AssetCache::EntryList::iterator AssetCache::FindCurrent(
+    std::string_view normalized_path,
+    uint64_t generation) {
+  const auto found = index_.find(normalized_path);
+  if (found == index_.end()) {
+    return entries_.end();
+  }
+
+  const auto it = found->second;
+  if (it->generation != generation) {
+    Remove(it);
+    return entries_.end();
+  }
+
+  entries_.splice(entries_.begin(), entries_, it);
+  return it;
+}
+
+AssetCache::EntryList::iterator AssetCache::Emplace(
+    std::string_view normalized_path,
+    uint64_t generation,
+    std::unique_ptr<uint8_t[]> bytes,
+    size_t size) {
+  try {
+    entries_.emplace_front();
+    Entry& entry = entries_.front();
+    entry.path.assign(normalized_path);
+    entry.generation = generation;
+    index_.emplace(std::string_view(entry.path), entries_.begin());
+  } catch (const std::bad_alloc&) {
+    if (!entries_.empty() && entries_.front().bytes == nullptr) {
+      index_.erase(std::string_view(entries_.front().path));
+      entries_.pop_front();
+    }
+    return entries_.end();
+  }
+
+  entries_.front().bytes = std::move(bytes);
+  entries_.front().size = size;
+  resident_bytes_ += size;
+  ++insert_count_;
+  return entries_.begin();
+}
+
+bool AssetCache::Pin(EntryList::iterator it) {
+  if (it->pins == 0u) {
+    try {
+      pinned_.emplace(it->bytes.get(), it);
+    } catch (const std::bad_alloc&) {
+      return false;
+    }
+    pinned_bytes_ += it->size;
+  }
+
+  ++it->pins;
+  return true;
+}
+
+void AssetCache::Remove(EntryList::iterator it) {
+  index_.erase(std::string_view(it->path));
+  if (it->pins > 0u) {
+    it->detached = true;
+    detached_.splice(detached_.end(), entries_, it);
+    return;
+  }
+
+  resident_bytes_ -= it->size;
+  entries_.erase(it);
+}
+
+void AssetCache::EvictToBudget() {
+  for (auto it = entries_.end();
+       it != entries_.begin() && resident_bytes_ - pinned_bytes_ > 0u &&
+       resident_bytes_ > budget_bytes_;) {
+    const auto victim = std::prev(it);
+    if (victim->pins > 0u) {
+      it = victim;
+      continue;
+    }
+
+    Remove(victim);
+    ++eviction_count_;
+  }
+}
+
+}  // namespace dff::native::content
@@ -0,0 +1,98 @@
+#ifndef DFF_ENGINE_NATIVE_CONTENT_ASSET_CACHE_H
+#define DFF_ENGINE_NATIVE_CONTENT_ASSET_CACHE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+#include "engine_native.h"
+
+namespace dff::native::content {
+
+// LRU cache of asset bytes keyed by normalized path and the mount generation
+// the bytes were resolved under. Acquired entries are pinned and shared by
+// every consumer until the last release; pinned bytes may exceed the budget,
+// everything else is evicted least recently used first. An entry replaced by
+// a newer generation while pinned is detached and freed on its last release.
+class AssetCache {
+ public:
+  void SetBudget(uint64_t budget_bytes);
+  uint64_t budget() const;
+
+  // Copies a cached asset out. Returns NOT_FOUND on a miss; a null buffer with
+  // zero size only reports the size.
+  engine_native_status_t Read(std::string_view normalized_path,
+                              uint64_t generation,
+                              void* buffer,
+                              size_t buffer_size,
+                              size_t* out_size);
+
+  // Caches a copy of bytes that were just read. Best effort: allocation
+  // failures and assets larger than the budget are simply not cached.
+  void Insert(std::string_view normalized_path,
+              uint64_t generation,
+              const void* data,
+              size_t size);
+
+  // Pins a cached asset on a hit. Returns false on a miss.
+  bool Acquire(std::string_view normalized_path,
+               uint64_t generation,
+               const void** out_data,
+               size_t* out_size);
+
+  // Takes ownership of freshly read bytes and pins them. When another reader
+  // cached the same asset first, that copy is pinned instead.
+  engine_native_status_t InsertPinned(std::string_view normalized_path,
+                                      uint64_t generation,
+                                      std::unique_ptr<uint8_t[]> bytes,
+                                      size_t size,
+                                      const void** out_data);
+
+  engine_native_status_t Release(const void* data);
+
+  void GetStats(engine_native_content_cache_stats_t* out_stats) const;
+
+ private:
+  struct Entry {
+    std::string path;
+    uint64_t generation = 0u;
+    std::unique_ptr<uint8_t[]> bytes;
+    size_t size = 0u;
+    uint32_t pins = 0u;
+    bool detached = false;
+  };
+
+  using EntryList = std::list<Entry>;
+
+  EntryList::iterator FindCurrent(std::string_view normalized_path,
+                                  uint64_t generation);
+  EntryList::iterator Emplace(std::string_view normalized_path,
+                              uint64_t generation,
+                              std::unique_ptr<uint8_t[]> bytes,
+                              size_t size);
+  bool Pin(EntryList::iterator it);
+  void Remove(EntryList::iterator it);
+  void EvictToBudget();
+
+  mutable std::mutex mutex_;
+  uint64_t budget_bytes_ = 0u;
+  EntryList entries_;
+  EntryList detached_;
+  std::unordered_map<std::string_view, EntryList::iterator> index_;
+  std::unordered_map<const uint8_t*, EntryList::iterator> pinned_;
+  uint64_t resident_bytes_ = 0u;
+  uint64_t pinned_bytes_ = 0u;
+  uint64_t hit_count_ = 0u;
+  uint64_t miss_count_ = 0u;
+  uint64_t insert_count_ = 0u;
+  uint64_t eviction_count_ = 0u;
+};
+
+}  // namespace dff::native::content
+
+#endif
@@ -0,0 +1,58 @@
+#include "content/asset_path.h"
+
+#include <cstring>
+#include <new>
+
+namespace dff::native::content {
+
+engine_native_status_t NormalizedAssetPath::Assign(std::string_view input_path) {
+  data_ = nullptr;
+  length_ = 0u;
+  if (input_path.empty() || input_path.front() == '/' ||
+      input_path.front() == '\\') {
+    return ENGINE_NATIVE_STATUS_INVALID_ARGUMENT;
+  }
+
+  char* output = inline_;
+  if (input_path.size() > kInlineCapacity) {
+    heap_.reset(new (std::nothrow) char[input_path.size()]);
+    if (heap_ == nullptr) {
+      return ENGINE_NATIVE_STATUS_OUT_OF_MEMORY;
+    }
+    output = heap_.get();
+  }
+
+  size_t length = 0u;
+  size_t begin = 0u;
+  while (begin < input_path.size()) {
+    size_t end = begin;
+    while (end < input_path.size() && input_path[end] != '/' &&
+           input_path[end] != '\\') {
+      ++end;
+    }
+
+    const std::string_view segment = input_path.substr(begin, end - begin);
+    if (segment == "." || segment == "..") {
+      return ENGINE_NATIVE_STATUS_INVALID_ARGUMENT;
+    }
+    if (!segment.empty()) {
+      if (length > 0u) {
+        output[length++] = '/';
+      }
+      std::memcpy(output + length, segment.data(), segment.size());
+      length += segment.size();
+    }
+
+    begin = end + 1u;
+  }
+
+  if (length == 0u) {
+    return ENGINE_NATIVE_STATUS_INVALID_ARGUMENT;
+  }
+
+  data_ = output;
+  length_ = length;
+  return ENGINE_NATIVE_STATUS_OK;
+}
+
+}  // namespace dff::native::content
@@ -0,0 +1,37 @@
+#ifndef DFF_ENGINE_NATIVE_CONTENT_ASSET_PATH_H
+#define DFF_ENGINE_NATIVE_CONTENT_ASSET_PATH_H
+
+#include <cstddef>
+#include <memory>
+#include <string_view>
+
+#include "engine_native.h"
+
+namespace dff::native::content {
+
+// Asset path in canonical form: backslashes become slashes and empty segments
+// are dropped, while rooted paths and "." or ".." segments are rejected. Paths
+// up to kInlineCapacity bytes normalize in place without allocating.
+class NormalizedAssetPath {
+ public:
+  static constexpr size_t kInlineCapacity = 256u;
+
+  NormalizedAssetPath() = default;
+
+  NormalizedAssetPath(const NormalizedAssetPath&) = delete;
+  NormalizedAssetPath& operator=(const NormalizedAssetPath&) = delete;
+
+  engine_native_status_t Assign(std::string_view input_path);
+
+  std::string_view view() const { return std::string_view(data_, length_); }
+
+ private:
+  char inline_[kInlineCapacity];
+  std::unique_ptr<char[]> heap_;
+  const char* data_ = nullptr;
+  size_t length_ = 0u;
+};
+
+}  // namespace dff::native::content
+
+#endif
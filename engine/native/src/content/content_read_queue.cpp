@@ -0,0 +1,330 @@
+#include "content/content_read_queue.h"
+
+#include <algorithm>
+#include <chrono>
+#include <new>
+#include <system_error>
+#include <utility>
+
+namespace dff::native::content {
+
+namespace {
+
+uint64_t NowNs() {
+  return static_cast<uint64_t>(
+      std::chrono::duration_cast<std::chrono::nanoseconds>(
+          std::chrono::steady_clock::now().time_since_epoch())
+          .count());
+}
+
+}  // namespace
+
+ContentReadQueue::ContentReadQueue(const ContentRuntime& runtime,
+                                   size_t worker_count)
+    : runtime_(runtime),
+      worker_count_(std::clamp<size_t>(worker_count, 1u, kMaxWorkerCount)) {}
+
+ContentReadQueue::~ContentReadQueue() {
+  {
+    std::lock_guard<std::mutex> guard(mutex_);
+    stopping_ = true;
+  }
+  work_cv_.notify_all();
+
+  for (std::thread& worker : workers_) {
+    worker.join();
+  }
+}
+
+engine_native_status_t ContentReadQueue::Submit(std::string asset_path,
+                                                void* buffer,
+                                                size_t buffer_size,
+                                                uint64_t* out_request_id) {
+  if (out_request_id == nullptr) {
+    return ENGINE_NATIVE_STATUS_INVALID_ARGUMENT;
+  }
+
+  *out_request_id = 0u;
+  if (asset_path.empty() || (buffer == nullptr && buffer_size != 0u)) {
+    return ENGINE_NATIVE_STATUS_INVALID_ARGUMENT;
+  }
+
+  ReadRequest request;
+  request.asset_path = std::move(asset_path);
+  request.buffer = buffer;
+  request.buffer_size = buffer_size;
+  request.pooled = buffer == nullptr;
+  request.submit_ns = NowNs();
+
+  {
+    std::lock_guard<std::mutex> guard(mutex_);
+    const engine_native_status_t start_status = StartWorkers();
+    if (start_status != ENGINE_NATIVE_STATUS_OK) {
+      return start_status;
+    }
+
+    const uint64_t request_id = next_request_id_;
+    try {
+      requests_.emplace(request_id, std::move(request));
+      queue_.push_back(request_id);
+    } catch (const std::bad_alloc&) {
+      requests_.erase(request_id);
+      return ENGINE_NATIVE_STATUS_OUT_OF_MEMORY;
+    }
+
+    ++next_request_id_;
+    ++submitted_count_;
+    max_queue_depth_ = std::max(max_queue_depth_, queue_.size());
+    *out_request_id = request_id;
+  }
+  work_cv_.notify_one();
+  return ENGINE_NATIVE_STATUS_OK;
+}
+
+engine_native_status_t ContentReadQueue::Poll(
+    uint64_t request_id,
+    engine_native_content_read_result_t* out_result,
+    uint8_t* out_is_ready) {
+  if (request_id == 0u || out_result == nullptr || out_is_ready == nullptr) {
+    return ENGINE_NATIVE_STATUS_INVALID_ARGUMENT;
+  }
+
+  *out_result = engine_native_content_read_result_t{};
+  *out_is_ready = 0u;
+
+  std::lock_guard<std::mutex> guard(mutex_);
+  auto it = requests_.find(request_id);
+  if (it == requests_.end()) {
+    return ENGINE_NATIVE_STATUS_NOT_FOUND;
+  }
+
+  ReadRequest& request = it->second;
+  if (request.state != ReadState::kComplete) {
+    return ENGINE_NATIVE_STATUS_OK;
+  }
+
+  const uint8_t* data = nullptr;
+  if (request.status == ENGINE_NATIVE_STATUS_OK) {
+    data = request.pooled ? request.pooled_buffer.bytes.get()
+                          : static_cast<const uint8_t*>(request.buffer);
+  }
+  if (request.pooled && data != nullptr) {
+    try {
+      outstanding_buffers_.emplace(data, std::move(request.pooled_buffer));
+    } catch (const std::bad_alloc&) {
+      return ENGINE_NATIVE_STATUS_OUT_OF_MEMORY;
+    }
+  }
+
+  out_result->status = request.status;
+  out_result->data = data;
+  out_result->size = request.size;
+  *out_is_ready = 1u;
+  requests_.erase(it);
+  return ENGINE_NATIVE_STATUS_OK;
+}
+
+engine_native_status_t ContentReadQueue::FreeResult(
+    engine_native_content_read_result_t* result) {
+  if (result == nullptr) {
+    return ENGINE_NATIVE_STATUS_INVALID_ARGUMENT;
+  }
+
+  if (result->data != nullptr) {
+    std::lock_guard<std::mutex> guard(mutex_);
+    auto it = outstanding_buffers_.find(result->data);
+    if (it != outstanding_buffers_.end()) {
+      PooledBuffer buffer = std::move(it->second);
+      outstanding_buffers_.erase(it);
+      ReleasePooledBuffer(std::move(buffer));
+    }
+  }
+
+  *result = engine_native_content_read_result_t{};
+  return ENGINE_NATIVE_STATUS_OK;
+}
+
+engine_native_status_t ContentReadQueue::Cancel(uint64_t request_id) {
+  if (request_id == 0u) {
+    return ENGINE_NATIVE_STATUS_INVALID_ARGUMENT;
+  }
+
+  std::unique_lock<std::mutex> lock(mutex_);
+  auto it = requests_.find(request_id);
+  if (it == requests_.end()) {
+    return ENGINE_NATIVE_STATUS_NOT_FOUND;
+  }
+
+  if (it->second.state == ReadState::kQueued) {
+    queue_.erase(std::find(queue_.begin(), queue_.end(), request_id));
+  } else if (it->second.state == ReadState::kInFlight) {
+    done_cv_.wait(lock, [this, request_id] {
+      const auto found = requests_.find(request_id);
+      return found == requests_.end() ||
+             found->second.state == ReadState::kComplete;
+    });
+    it = requests_.find(request_id);
+    if (it == requests_.end()) {
+      return ENGINE_NATIVE_STATUS_NOT_FOUND;
+    }
+  }
+
+  ReleasePooledBuffer(std::move(it->second.pooled_buffer));
+  requests_.erase(it);
+  ++cancelled_count_;
+  return ENGINE_NATIVE_STATUS_OK;
+}
+
+engine_native_status_t ContentReadQueue::GetStats(
+    engine_native_content_read_stats_t* out_stats) const {
+  if (out_stats == nullptr) {
+    return ENGINE_NATIVE_STATUS_INVALID_ARGUMENT;
+  }
+
+  std::lock_guard<std::mutex> guard(mutex_);
+  *out_stats = engine_native_content_read_stats_t{};
+  out_stats->queued_count = static_cast<uint32_t>(queue_.size());
+  out_stats->in_flight_count = static_cast<uint32_t>(in_flight_count_);
+  out_stats->worker_count = static_cast<uint32_t>(workers_.size());
+  out_stats->max_queue_depth = static_cast<uint32_t>(max_queue_depth_);
+  out_stats->submitted_count = submitted_count_;
+  out_stats->completed_count = completed_count_;
+  out_stats->cancelled_count = cancelled_count_;
+  out_stats->failed_count = failed_count_;
+  out_stats->total_latency_ns = total_latency_ns_;
+  out_stats->max_latency_ns = max_latency_ns_;
+  out_stats->pooled_buffer_bytes = free_buffer_bytes_;
+  return ENGINE_NATIVE_STATUS_OK;
+}
+
+engine_native_status_t ContentReadQueue::StartWorkers() {
+  if (!workers_.empty()) {
+    return ENGINE_NATIVE_STATUS_OK;
+  }
+
+  try {
+    workers_.reserve(worker_count_);
+    for (size_t i = 0u; i < worker_count_; ++i) {
+      workers_.emplace_back(&ContentReadQueue::WorkerLoop, this);
+    }
+  } catch (const std::system_error&) {
+    return workers_.empty() ? ENGINE_NATIVE_STATUS_INTERNAL_ERROR
+                            : ENGINE_NATIVE_STATUS_OK;
+  } catch (const std::bad_alloc&) {
+    return workers_.empty() ? ENGINE_NATIVE_STATUS_OUT_OF_MEMORY
+                            : ENGINE_NATIVE_STATUS_OK;
+  }
+
+  return ENGINE_NATIVE_STATUS_OK;
+}
+
+void ContentReadQueue::WorkerLoop() {
+  for (;;) {
+    ReadRequest* request = nullptr;
+    {
+      std::unique_lock<std::mutex> lock(mutex_);
+      work_cv_.wait(lock, [this] { return stopping_ || !queue_.empty(); });
+      if (stopping_) {
+        return;
+      }
+
+      request = &requests_.at(queue_.front());
+      queue_.pop_front();
+      request->state = ReadState::kInFlight;
+      ++in_flight_count_;
+    }
+
+    ExecuteRead(request);
+
+    {
+      std::lock_guard<std::mutex> guard(mutex_);
+      const uint64_t latency_ns = NowNs() - request->submit_ns;
+      request->state = ReadState::kComplete;
+      --in_flight_count_;
+      ++completed_count_;
+      if (request->status != ENGINE_NATIVE_STATUS_OK) {
+        ++failed_count_;
+      }
+      total_latency_ns_ += latency_ns;
+      max_latency_ns_ = std::max(max_latency_ns_, latency_ns);
+    }
+    done_cv_.notify_all();
+  }
+}
+
+void ContentReadQueue::ExecuteRead(ReadRequest* request) {
+  if (!request->pooled) {
+    request->status = runtime_.ReadFile(request->asset_path, request->buffer,
+                                        request->buffer_size, &request->size);
+    return;
+  }
+
+  size_t size = 0u;
+  request->status = runtime_.ReadFile(request->asset_path, nullptr, 0u, &size);
+  if (request->status != ENGINE_NATIVE_STATUS_OK || size == 0u) {
+    return;
+  }
+
+  PooledBuffer buffer;
+  request->status = AcquirePooledBuffer(size, &buffer);
+  if (request->status != ENGINE_NATIVE_STATUS_OK) {
+    return;
+  }
+
+  request->status = runtime_.ReadFile(request->asset_path, buffer.bytes.get(),
+                                      size, &request->size);
+  if (request->status != ENGINE_NATIVE_STATUS_OK) {
+    std::lock_guard<std::mutex> guard(mutex_);
+    ReleasePooledBuffer(std::move(buffer));
+    return;
+  }
+
+  request->pooled_buffer = std::move(buffer);
+}
+
+engine_native_status_t ContentReadQueue::AcquirePooledBuffer(
+    size_t size,
+    PooledBuffer* out_buffer) {
+  {
+    std::lock_guard<std::mutex> guard(mutex_);
+    auto best = free_buffers_.end();
+    for (auto it = free_buffers_.begin(); it != free_buffers_.end(); ++it) {
+      if (it->capacity >= size &&
+          (best == free_buffers_.end() || it->capacity < best->capacity)) {
+        best = it;
+      }
+    }
+
+    if (best != free_buffers_.end()) {
+      free_buffer_bytes_ -= best->capacity;
+      *out_buffer = std::move(*best);
+      *best = std::move(free_buffers_.back());
+      free_buffers_.pop_back();
+      return ENGINE_NATIVE_STATUS_OK;
+    }
+  }
+
+  out_buffer->bytes.reset(new (std::nothrow) uint8_t[size]);
+  if (out_buffer->bytes == nullptr) {
+    return ENGINE_NATIVE_STATUS_OUT_OF_MEMORY;
+  }
+
+  out_buffer->capacity = size;
+  return ENGINE_NATIVE_STATUS_OK;
+}
+
+void ContentReadQueue::ReleasePooledBuffer(PooledBuffer buffer) {
+  if (buffer.bytes == nullptr || free_buffers_.size() >= kMaxPooledBuffers ||
+      buffer.capacity > kMaxPooledBytes - free_buffer_bytes_) {
+    return;
+  }
+
+  try {
+    free_buffers_.push_back(std::move(buffer));
+  } catch (const std::bad_alloc&) {
+    return;
+  }
+  free_buffer_bytes_ += free_buffers_.back().capacity;
+}
+
+}  // namespace dff::native::content
@@ -0,0 +1,112 @@
+#ifndef DFF_ENGINE_NATIVE_CONTENT_READ_QUEUE_H
+#define DFF_ENGINE_NATIVE_CONTENT_READ_QUEUE_H
+
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include "content/content_runtime.h"
+#include "engine_native.h"
+
+namespace dff::native::content {
+
+// Services ContentRuntime reads on a small pool of I/O workers. Requests are
+// started in submission order and completed reads stay parked until polled.
+class ContentReadQueue {
+ public:
+  static constexpr size_t kMaxWorkerCount = 4u;
+  static constexpr size_t kDefaultWorkerCount = 2u;
+  static constexpr size_t kMaxPooledBuffers = 16u;
+  static constexpr size_t kMaxPooledBytes = size_t{64} << 20u;
+
+  explicit ContentReadQueue(const ContentRuntime& runtime,
+                            size_t worker_count = kDefaultWorkerCount);
+  ~ContentReadQueue();
+
+  ContentReadQueue(const ContentReadQueue&) = delete;
+  ContentReadQueue& operator=(const ContentReadQueue&) = delete;
+
+  // A null buffer with zero size reads into a pooled buffer owned by the
+  // queue until FreeResult hands it back.
+  engine_native_status_t Submit(std::string asset_path,
+                                void* buffer,
+                                size_t buffer_size,
+                                uint64_t* out_request_id);
+
+  engine_native_status_t Poll(uint64_t request_id,
+                              engine_native_content_read_result_t* out_result,
+                              uint8_t* out_is_ready);
+
+  engine_native_status_t FreeResult(engine_native_content_read_result_t* result);
+
+  engine_native_status_t Cancel(uint64_t request_id);
+
+  engine_native_status_t GetStats(
+      engine_native_content_read_stats_t* out_stats) const;
+
+  size_t worker_count() const { return worker_count_; }
+  size_t started_worker_count() const { return workers_.size(); }
+
+ private:
+  enum class ReadState : uint8_t {
+    kQueued,
+    kInFlight,
+    kComplete,
+  };
+
+  struct PooledBuffer {
+    std::unique_ptr<uint8_t[]> bytes;
+    size_t capacity = 0u;
+  };
+
+  struct ReadRequest {
+    std::string asset_path;
+    void* buffer = nullptr;
+    size_t buffer_size = 0u;
+    bool pooled = false;
+    ReadState state = ReadState::kQueued;
+    engine_native_status_t status = ENGINE_NATIVE_STATUS_OK;
+    size_t size = 0u;
+    PooledBuffer pooled_buffer;
+    uint64_t submit_ns = 0u;
+  };
+
+  engine_native_status_t StartWorkers();
+  void WorkerLoop();
+  void ExecuteRead(ReadRequest* request);
+  engine_native_status_t AcquirePooledBuffer(size_t size, PooledBuffer* out_buffer);
+  void ReleasePooledBuffer(PooledBuffer buffer);
+
+  const ContentRuntime& runtime_;
+  size_t worker_count_ = 0u;
+  std::vector<std::thread> workers_;
+  mutable std::mutex mutex_;
+  std::condition_variable work_cv_;
+  std::condition_variable done_cv_;
+  std::deque<uint64_t> queue_;
+  std::unordered_map<uint64_t, ReadRequest> requests_;
+  std::unordered_map<const uint8_t*, PooledBuffer> outstanding_buffers_;
+  std::vector<PooledBuffer> free_buffers_;
+  size_t free_buffer_bytes_ = 0u;
+  uint64_t next_request_id_ = 1u;
+  size_t in_flight_count_ = 0u;
+  bool stopping_ = false;
+  size_t max_queue_depth_ = 0u;
+  uint64_t submitted_count_ = 0u;
+  uint64_t completed_count_ = 0u;
+  uint64_t cancelled_count_ = 0u;
+  uint64_t failed_count_ = 0u;
+  uint64_t total_latency_ns_ = 0u;
+  uint64_t max_latency_ns_ = 0u;
+};
+
+}  // namespace dff::native::content
+
+#endif
@@ -2,56 +2,22 @@
 
 #include <algorithm>
 #include <cstdint>
+#include <cstring>
 #include <fstream>
-#include <sstream>
+#include <limits>
+#include <mutex>
+#include <new>
 #include <string>
+#include <system_error>
+#include <utility>
 #include <vector>
 
+#include "content/asset_path.h"
+
 namespace dff::native::content {
 
 namespace {
 
-engine_native_status_t NormalizeAssetPath(const std::string& input_path,
-                                          std::string* out_normalized_path) {
-  if (out_normalized_path == nullptr || input_path.empty()) {
-    return ENGINE_NATIVE_STATUS_INVALID_ARGUMENT;
-  }
-
-  std::string normalized = input_path;
-  std::replace(normalized.begin(), normalized.end(), '\\', '/');
-  if (!normalized.empty() && normalized.front() == '/') {
-    return ENGINE_NATIVE_STATUS_INVALID_ARGUMENT;
-  }
-
-  std::stringstream stream(normalized);
-  std::string segment;
-  std::vector<std::string> segments;
-  while (std::getline(stream, segment, '/')) {
-    if (segment.empty()) {
-      continue;
-    }
-    if (segment == "." || segment == "..") {
-      return ENGINE_NATIVE_STATUS_INVALID_ARGUMENT;
-    }
-    segments.push_back(segment);
-  }
-
-  if (segments.empty()) {
-    return ENGINE_NATIVE_STATUS_INVALID_ARGUMENT;
-  }
-
-  std::ostringstream out;
-  for (size_t i = 0u; i < segments.size(); ++i) {
-    if (i > 0u) {
-      out << '/';
-    }
-    out << segments[i];
-  }
-
-  *out_normalized_path = out.str();
-  return ENGINE_NATIVE_STATUS_OK;
-}
-
 engine_native_status_t ReadBytesFromFile(const std::filesystem::path& full_path,
                                          void* buffer,
                                          size_t buffer_size,
@@ -99,6 +65,45 @@ engine_native_status_t ReadBytesFromFile(const std::filesystem::path& full_path,
   return ENGINE_NATIVE_STATUS_OK;
 }
 
+engine_native_status_t ReadBytesRangeFromFile(
+    const std::filesystem::path& full_path,
+    uint64_t offset_bytes,
+    void* buffer,
+    size_t length,
+    size_t* out_size) {
+  *out_size = 0u;
+
+  std::ifstream stream(full_path, std::ios::binary | std::ios::ate);
+  if (!stream.is_open()) {
+    return ENGINE_NATIVE_STATUS_NOT_FOUND;
+  }
+
+  const std::streamsize size = stream.tellg();
+  if (size < 0) {
+    return ENGINE_NATIVE_STATUS_INTERNAL_ERROR;
+  }
+
+  const uint64_t file_size = static_cast<uint64_t>(size);
+  if (offset_bytes > file_size) {
+    return ENGINE_NATIVE_STATUS_INVALID_ARGUMENT;
+  }
+
+  const size_t range_size = static_cast<size_t>(
+      std::min<uint64_t>(length, file_size - offset_bytes));
+  if (range_size == 0u) {
+    return ENGINE_NATIVE_STATUS_OK;
+  }
+
+  stream.seekg(static_cast<std::streamoff>(offset_bytes), std::ios::beg);
+  stream.read(static_cast<char*>(buffer), static_cast<std::streamsize>(range_size));
+  if (stream.gcount() != static_cast<std::streamsize>(range_size)) {
+    return ENGINE_NATIVE_STATUS_INTERNAL_ERROR;
+  }
+
+  *out_size = range_size;
+  return ENGINE_NATIVE_STATUS_OK;
+}
+
 }  // namespace
 
 engine_native_status_t ContentRuntime::MountPak(const std::string& pak_path) {
@@ -113,16 +118,45 @@ engine_native_status_t ContentRuntime::MountPak(const std::string& pak_path) {
     return ENGINE_NATIVE_STATUS_NOT_FOUND;
   }
 
-  std::unordered_map<std::string, PakAssetEntry> entry_by_asset;
-  engine_native_status_t status = ReadPakIndex(absolute_pak_path, &entry_by_asset);
+  PakMount mount;
+  engine_native_status_t status = mount.mapping.Open(absolute_pak_path);
   if (status != ENGINE_NATIVE_STATUS_OK) {
     return status;
   }
 
-  PakMount mount;
+  status = mount.index.Load(mount.mapping.data(), mount.mapping.size());
+  if (status != ENGINE_NATIVE_STATUS_OK) {
+    return status;
+  }
+
+  std::unique_lock<std::shared_mutex> lock(mutex_);
+  status = vfs_index_.Reserve(mount.index.entry_count(),
+                              mount.index.entry_count());
+  if (status != ENGINE_NATIVE_STATUS_OK) {
+    return status;
+  }
+
+  const uint32_t mount_index = static_cast<uint32_t>(pak_mounts_.size());
   mount.pak_path = absolute_pak_path;
-  mount.entry_by_asset = std::move(entry_by_asset);
-  pak_mounts_.push_back(std::move(mount));
+  try {
+    pak_mounts_.push_back(std::move(mount));
+  } catch (const std::bad_alloc&) {
+    return ENGINE_NATIVE_STATUS_OUT_OF_MEMORY;
+  }
+
+  status = pak_mounts_.back().index.ForEachEntry(
+      [this, mount_index](std::string_view path, uint64_t path_hash,
+                          const PakAssetEntry& entry) {
+        const VfsEntry vfs_entry{VfsSource::kPak, mount_index, entry};
+        vfs_index_.Insert(path, path_hash, vfs_entry);
+        vfs_index_.InsertKey(entry.asset_key, vfs_entry);
+      });
+  if (status != ENGINE_NATIVE_STATUS_OK) {
+    pak_mounts_.pop_back();
+    return status;
+  }
+
+  ++mount_generation_;
   return ENGINE_NATIVE_STATUS_OK;
 }
 
@@ -139,40 +173,379 @@ engine_native_status_t ContentRuntime::MountDirectory(
     return ENGINE_NATIVE_STATUS_NOT_FOUND;
   }
 
-  directory_mounts_.push_back(absolute_path);
+  DirectoryMount mount;
+  mount.root = absolute_path;
+  std::vector<std::pair<size_t, size_t>> spans;
+  try {
+    std::string scanned;
+    std::error_code error;
+    std::filesystem::recursive_directory_iterator it(
+        absolute_path,
+        std::filesystem::directory_options::skip_permission_denied, error);
+    for (; !error && it != std::filesystem::recursive_directory_iterator();
+         it.increment(error)) {
+      if (!it->is_regular_file(error)) {
+        continue;
+      }
+
+      const std::string relative_path =
+          it->path().lexically_relative(absolute_path).generic_string();
+      if (relative_path.empty() ||
+          relative_path.size() > std::numeric_limits<uint32_t>::max()) {
+        continue;
+      }
+
+      spans.emplace_back(scanned.size(), relative_path.size());
+      scanned += relative_path;
+    }
+
+    mount.scanned_paths = std::make_unique<char[]>(scanned.size() + 1u);
+    std::memcpy(mount.scanned_paths.get(), scanned.data(), scanned.size());
+  } catch (const std::bad_alloc&) {
+    return ENGINE_NATIVE_STATUS_OUT_OF_MEMORY;
+  }
+
+  std::unique_lock<std::shared_mutex> lock(mutex_);
+  try {
+    directory_mounts_.reserve(directory_mounts_.size() + 1u);
+  } catch (const std::bad_alloc&) {
+    return ENGINE_NATIVE_STATUS_OUT_OF_MEMORY;
+  }
+
+  const engine_native_status_t status = vfs_index_.Reserve(spans.size());
+  if (status != ENGINE_NATIVE_STATUS_OK) {
+    return status;
+  }
+
+  const uint32_t mount_index = static_cast<uint32_t>(directory_mounts_.size());
+  directory_mounts_.push_back(std::move(mount));
+  const char* scanned_paths = directory_mounts_.back().scanned_paths.get();
+  for (const auto& [offset, length] : spans) {
+    const std::string_view path(scanned_paths + offset, length);
+    vfs_index_.Insert(path, HashPakPath(path),
+                      VfsEntry{VfsSource::kDirectory, mount_index, {}});
+  }
+
+  ++mount_generation_;
   return ENGINE_NATIVE_STATUS_OK;
 }
 
-engine_native_status_t ContentRuntime::ReadFile(const std::string& asset_path,
+engine_native_status_t ContentRuntime::ReadFile(std::string_view asset_path,
                                                 void* buffer,
                                                 size_t buffer_size,
                                                 size_t* out_size) const {
-  std::string normalized_asset_path;
-  engine_native_status_t status =
-      NormalizeAssetPath(asset_path, &normalized_asset_path);
+  NormalizedAssetPath normalized_path;
+  engine_native_status_t status = normalized_path.Assign(asset_path);
   if (status != ENGINE_NATIVE_STATUS_OK) {
     return status;
   }
+  const std::string_view normalized_asset_path = normalized_path.view();
   if (out_size == nullptr) {
     return ENGINE_NATIVE_STATUS_INVALID_ARGUMENT;
   }
 
-  for (auto mount_it = pak_mounts_.rbegin(); mount_it != pak_mounts_.rend();
-       ++mount_it) {
-    const auto entry_it = mount_it->entry_by_asset.find(normalized_asset_path);
-    if (entry_it == mount_it->entry_by_asset.end()) {
-      continue;
+  std::shared_lock<std::shared_mutex> lock(mutex_);
+  const bool cache_enabled = cache_.budget() != 0u;
+  if (cache_enabled) {
+    status = cache_.Read(normalized_asset_path, mount_generation_, buffer,
+                         buffer_size, out_size);
+    if (status != ENGINE_NATIVE_STATUS_NOT_FOUND) {
+      return status;
+    }
+  }
+
+  bool cacheable = false;
+  status = ReadResolved(normalized_asset_path, buffer, buffer_size, out_size,
+                        &cacheable);
+  if (cache_enabled && cacheable && status == ENGINE_NATIVE_STATUS_OK &&
+      buffer != nullptr) {
+    cache_.Insert(normalized_asset_path, mount_generation_, buffer, *out_size);
+  }
+
+  return status;
+}
+
+engine_native_status_t ContentRuntime::ReadByKey(uint64_t asset_key,
+                                                 void* buffer,
+                                                 size_t buffer_size,
+                                                 size_t* out_size) const {
+  if (asset_key == 0u || out_size == nullptr) {
+    return ENGINE_NATIVE_STATUS_INVALID_ARGUMENT;
+  }
+
+  std::shared_lock<std::shared_mutex> lock(mutex_);
+  const VfsEntry* entry = vfs_index_.FindKey(asset_key);
+  if (entry == nullptr) {
+    *out_size = 0u;
+    return ENGINE_NATIVE_STATUS_NOT_FOUND;
+  }
+
+  const PakMount& mount = pak_mounts_[entry->mount_index];
+  return ReadPakAssetBytes(mount.mapping.data(), mount.mapping.size(),
+                           entry->pak_entry, buffer, buffer_size, out_size);
+}
+
+engine_native_status_t ContentRuntime::ReadFileRange(
+    std::string_view asset_path,
+    uint64_t offset_bytes,
+    void* buffer,
+    size_t length,
+    size_t* out_size) const {
+  if (out_size == nullptr || (buffer == nullptr && length != 0u)) {
+    return ENGINE_NATIVE_STATUS_INVALID_ARGUMENT;
+  }
+
+  *out_size = 0u;
+
+  NormalizedAssetPath normalized_path;
+  engine_native_status_t status = normalized_path.Assign(asset_path);
+  if (status != ENGINE_NATIVE_STATUS_OK) {
+    return status;
+  }
+  const std::string_view normalized_asset_path = normalized_path.view();
+
+  std::shared_lock<std::shared_mutex> lock(mutex_);
+  const VfsEntry* entry = vfs_index_.Find(normalized_asset_path);
+  if (entry != nullptr && entry->source == VfsSource::kPak) {
+    const PakMount& mount = pak_mounts_[entry->mount_index];
+    return ReadPakAssetRange(mount.mapping.data(), mount.mapping.size(),
+                             entry->pak_entry, offset_bytes, buffer, length,
+                             out_size);
+  }
+
+  if (entry != nullptr) {
+    status = ReadBytesRangeFromFile(
+        directory_mounts_[entry->mount_index].root /
+            std::filesystem::path(normalized_asset_path),
+        offset_bytes, buffer, length, out_size);
+    if (status != ENGINE_NATIVE_STATUS_NOT_FOUND) {
+      return status;
+    }
+  }
+
+  for (auto mount_it = directory_mounts_.rbegin();
+       mount_it != directory_mounts_.rend(); ++mount_it) {
+    status = ReadBytesRangeFromFile(
+        mount_it->root / std::filesystem::path(normalized_asset_path),
+        offset_bytes, buffer, length, out_size);
+    if (status != ENGINE_NATIVE_STATUS_NOT_FOUND) {
+      return status;
+    }
+  }
+
+  return ENGINE_NATIVE_STATUS_NOT_FOUND;
+}
+
+engine_native_status_t ContentRuntime::MapFile(std::string_view asset_path,
+                                               const void** out_data,
+                                               size_t* out_size) const {
+  if (out_data == nullptr || out_size == nullptr) {
+    return ENGINE_NATIVE_STATUS_INVALID_ARGUMENT;
+  }
+
+  *out_data = nullptr;
+  *out_size = 0u;
+
+  NormalizedAssetPath normalized_path;
+  engine_native_status_t status = normalized_path.Assign(asset_path);
+  if (status != ENGINE_NATIVE_STATUS_OK) {
+    return status;
+  }
+  const std::string_view normalized_asset_path = normalized_path.view();
+
+  std::shared_lock<std::shared_mutex> lock(mutex_);
+  const VfsEntry* entry = vfs_index_.Find(normalized_asset_path);
+  if (entry != nullptr && entry->source == VfsSource::kPak) {
+    const PakMount& mount = pak_mounts_[entry->mount_index];
+    return MapPakAsset(mount.mapping.data(), mount.mapping.size(),
+                       entry->pak_entry, out_data, out_size);
+  }
+
+  if (entry != nullptr) {
+    return ENGINE_NATIVE_STATUS_INVALID_STATE;
+  }
+
+  for (auto mount_it = directory_mounts_.rbegin();
+       mount_it != directory_mounts_.rend(); ++mount_it) {
+    std::error_code error;
+    if (std::filesystem::is_regular_file(
+            mount_it->root / std::filesystem::path(normalized_asset_path),
+            error)) {
+      return ENGINE_NATIVE_STATUS_INVALID_STATE;
+    }
+  }
+
+  return ENGINE_NATIVE_STATUS_NOT_FOUND;
+}
+
+engine_native_status_t ContentRuntime::Locate(
+    const std::string& asset_path,
+    ContentLocation* out_location) const {
+  if (out_location == nullptr) {
+    return ENGINE_NATIVE_STATUS_INVALID_ARGUMENT;
+  }
+
+  *out_location = ContentLocation{};
+
+  NormalizedAssetPath normalized_path;
+  const engine_native_status_t status = normalized_path.Assign(asset_path);
+  if (status != ENGINE_NATIVE_STATUS_OK) {
+    return status;
+  }
+  const std::string_view normalized_asset_path = normalized_path.view();
+
+  std::shared_lock<std::shared_mutex> lock(mutex_);
+  const VfsEntry* entry = vfs_index_.Find(normalized_asset_path);
+  if (entry != nullptr && entry->source == VfsSource::kPak) {
+    out_location->source = VfsSource::kPak;
+    out_location->mount_index = entry->mount_index;
+    out_location->offset_bytes = entry->pak_entry.offset_bytes;
+    out_location->stored_size_bytes = entry->pak_entry.size_bytes;
+    out_location->size_bytes = entry->pak_entry.codec == PakCodec::kStored
+                                   ? entry->pak_entry.size_bytes
+                                   : entry->pak_entry.uncompressed_size_bytes;
+    return ENGINE_NATIVE_STATUS_OK;
+  }
+
+  const auto locate_loose = [&](uint32_t mount_index) {
+    std::error_code error;
+    const uint64_t size = std::filesystem::file_size(
+        directory_mounts_[mount_index].root /
+            std::filesystem::path(normalized_asset_path),
+        error);
+    if (error) {
+      return false;
+    }
+
+    out_location->source = VfsSource::kDirectory;
+    out_location->mount_index = mount_index;
+    out_location->stored_size_bytes = size;
+    out_location->size_bytes = size;
+    return true;
+  };
+
+  if (entry != nullptr && locate_loose(entry->mount_index)) {
+    return ENGINE_NATIVE_STATUS_OK;
+  }
+
+  for (size_t i = directory_mounts_.size(); i > 0u; --i) {
+    if (locate_loose(static_cast<uint32_t>(i - 1u))) {
+      return ENGINE_NATIVE_STATUS_OK;
     }
+  }
 
-    return ReadPakAssetBytes(mount_it->pak_path, entry_it->second, buffer,
-                             buffer_size, out_size);
+  return ENGINE_NATIVE_STATUS_NOT_FOUND;
+}
+
+engine_native_status_t ContentRuntime::SetCacheBudget(uint64_t budget_bytes) {
+  cache_.SetBudget(budget_bytes);
+  return ENGINE_NATIVE_STATUS_OK;
+}
+
+engine_native_status_t ContentRuntime::AcquireFile(const std::string& asset_path,
+                                                   const void** out_data,
+                                                   size_t* out_size) const {
+  if (out_data == nullptr || out_size == nullptr) {
+    return ENGINE_NATIVE_STATUS_INVALID_ARGUMENT;
   }
 
+  *out_data = nullptr;
+  *out_size = 0u;
+
+  NormalizedAssetPath normalized_path;
+  engine_native_status_t status = normalized_path.Assign(asset_path);
+  if (status != ENGINE_NATIVE_STATUS_OK) {
+    return status;
+  }
+  const std::string_view normalized_asset_path = normalized_path.view();
+
+  std::shared_lock<std::shared_mutex> lock(mutex_);
+  if (cache_.Acquire(normalized_asset_path, mount_generation_, out_data,
+                     out_size)) {
+    return ENGINE_NATIVE_STATUS_OK;
+  }
+
+  size_t size = 0u;
+  bool cacheable = false;
+  status = ReadResolved(normalized_asset_path, nullptr, 0u, &size, &cacheable);
+  if (status != ENGINE_NATIVE_STATUS_OK || size == 0u) {
+    return status;
+  }
+
+  std::unique_ptr<uint8_t[]> bytes(new (std::nothrow) uint8_t[size]);
+  if (bytes == nullptr) {
+    return ENGINE_NATIVE_STATUS_OUT_OF_MEMORY;
+  }
+
+  status = ReadResolved(normalized_asset_path, bytes.get(), size, &size,
+                        &cacheable);
+  if (status != ENGINE_NATIVE_STATUS_OK) {
+    return status;
+  }
+
+  status = cache_.InsertPinned(normalized_asset_path, mount_generation_,
+                               std::move(bytes), size, out_data);
+  if (status == ENGINE_NATIVE_STATUS_OK) {
+    *out_size = size;
+  }
+  return status;
+}
+
+engine_native_status_t ContentRuntime::ReleaseFile(const void* data) const {
+  return cache_.Release(data);
+}
+
+engine_native_status_t ContentRuntime::GetCacheStats(
+    engine_native_content_cache_stats_t* out_stats) const {
+  if (out_stats == nullptr) {
+    return ENGINE_NATIVE_STATUS_INVALID_ARGUMENT;
+  }
+
+  cache_.GetStats(out_stats);
+  return ENGINE_NATIVE_STATUS_OK;
+}
+
+engine_native_status_t ContentRuntime::ReadResolved(
+    std::string_view normalized_asset_path,
+    void* buffer,
+    size_t buffer_size,
+    size_t* out_size,
+    bool* out_cacheable) const {
+  *out_cacheable = true;
+  const VfsEntry* entry = vfs_index_.Find(normalized_asset_path);
+  if (entry != nullptr && entry->source == VfsSource::kPak) {
+    const PakMount& mount = pak_mounts_[entry->mount_index];
+    *out_cacheable = entry->pak_entry.codec != PakCodec::kStored;
+    return ReadPakAssetBytes(mount.mapping.data(), mount.mapping.size(),
+                             entry->pak_entry, buffer, buffer_size, out_size);
+  }
+
+  if (entry != nullptr) {
+    const std::filesystem::path full_path =
+        directory_mounts_[entry->mount_index].root /
+        std::filesystem::path(normalized_asset_path);
+    const engine_native_status_t status =
+        ReadBytesFromFile(full_path, buffer, buffer_size, out_size);
+    if (status == ENGINE_NATIVE_STATUS_OK ||
+        status == ENGINE_NATIVE_STATUS_INVALID_ARGUMENT) {
+      return status;
+    }
+  }
+
+  return ReadLooseFile(normalized_asset_path, buffer, buffer_size, out_size);
+}
+
+engine_native_status_t ContentRuntime::ReadLooseFile(
+    std::string_view normalized_asset_path,
+    void* buffer,
+    size_t buffer_size,
+    size_t* out_size) const {
   for (auto mount_it = directory_mounts_.rbegin();
        mount_it != directory_mounts_.rend(); ++mount_it) {
     const std::filesystem::path full_path =
-        *mount_it / std::filesystem::path(normalized_asset_path);
-    status = ReadBytesFromFile(full_path, buffer, buffer_size, out_size);
+        mount_it->root / std::filesystem::path(normalized_asset_path);
+    const engine_native_status_t status =
+        ReadBytesFromFile(full_path, buffer, buffer_size, out_size);
     if (status == ENGINE_NATIVE_STATUS_OK ||
         status == ENGINE_NATIVE_STATUS_INVALID_ARGUMENT) {
       return status;
@@ -5,37 +5,120 @@
 #include <cstdint>
 
 #include <filesystem>
+#include <memory>
+#include <shared_mutex>
 #include <string>
-#include <unordered_map>
+#include <string_view>
 #include <vector>
 
+#include "content/asset_cache.h"
+#include "content/mapped_file.h"
 #include "content/pak_index.h"
+#include "content/vfs_index.h"
 #include "engine_native.h"
 
 namespace dff::native::content {
 
+// Where an asset's bytes live on disk. Loose files report offset zero and
+// their file size for both sizes.
+struct ContentLocation {
+  VfsSource source = VfsSource::kPak;
+  uint32_t mount_index = 0u;
+  uint64_t offset_bytes = 0u;
+  uint64_t stored_size_bytes = 0u;
+  uint64_t size_bytes = 0u;
+};
+
+// Reads and maps may run concurrently with each other and with mounts; a
+// mount only blocks readers while it publishes its entries.
 class ContentRuntime {
  public:
   engine_native_status_t MountPak(const std::string& pak_path);
 
   engine_native_status_t MountDirectory(const std::string& directory_path);
 
-  engine_native_status_t ReadFile(const std::string& asset_path,
+  engine_native_status_t ReadFile(std::string_view asset_path,
                                   void* buffer,
                                   size_t buffer_size,
                                   size_t* out_size) const;
 
+  // Reads a pak entry by the HashAssetKey of its asset key. Skips path
+  // normalization and the cache; loose files have no keys.
+  engine_native_status_t ReadByKey(uint64_t asset_key,
+                                   void* buffer,
+                                   size_t buffer_size,
+                                   size_t* out_size) const;
+
+  // Copies up to length bytes from offset_bytes; reads past the end are
+  // clamped. Range reads bypass the cache.
+  engine_native_status_t ReadFileRange(std::string_view asset_path,
+                                       uint64_t offset_bytes,
+                                       void* buffer,
+                                       size_t length,
+                                       size_t* out_size) const;
+
+  // Returns a pointer into a mounted pak's mapping, valid for the lifetime of
+  // the runtime. Loose files and compressed pak entries are not mappable and
+  // report INVALID_STATE so callers fall back to ReadFile.
+  engine_native_status_t MapFile(std::string_view asset_path,
+                                 const void** out_data,
+                                 size_t* out_size) const;
+
+  engine_native_status_t Locate(const std::string& asset_path,
+                                ContentLocation* out_location) const;
+
+  // ReadFile keeps up to this many bytes of loose files and compressed pak
+  // entries cached; stored pak entries are already served from the mapping.
+  engine_native_status_t SetCacheBudget(uint64_t budget_bytes);
+
+  // Pins a shared cached copy of the asset until ReleaseFile. Mounting bumps
+  // the mount generation, so later acquires resolve against the new mounts
+  // while earlier copies stay valid until released.
+  engine_native_status_t AcquireFile(const std::string& asset_path,
+                                     const void** out_data,
+                                     size_t* out_size) const;
+
+  engine_native_status_t ReleaseFile(const void* data) const;
+
+  engine_native_status_t GetCacheStats(
+      engine_native_content_cache_stats_t* out_stats) const;
+
   size_t pak_mount_count() const { return pak_mounts_.size(); }
   size_t directory_mount_count() const { return directory_mounts_.size(); }
+  size_t indexed_path_count() const { return vfs_index_.size(); }
+  size_t indexed_key_count() const { return vfs_index_.key_count(); }
 
  private:
   struct PakMount {
     std::filesystem::path pak_path;
-    std::unordered_map<std::string, PakAssetEntry> entry_by_asset;
+    MappedFile mapping;
+    PakIndex index;
   };
 
+  // Loose files found when the directory was mounted. Files created or
+  // removed afterwards are still resolved by probing the mount roots.
+  struct DirectoryMount {
+    std::filesystem::path root;
+    std::unique_ptr<char[]> scanned_paths;
+  };
+
+  engine_native_status_t ReadResolved(std::string_view normalized_asset_path,
+                                      void* buffer,
+                                      size_t buffer_size,
+                                      size_t* out_size,
+                                      bool* out_cacheable) const;
+
+  engine_native_status_t ReadLooseFile(std::string_view normalized_asset_path,
+                                       void* buffer,
+                                       size_t buffer_size,
+                                       size_t* out_size) const;
+
+  mutable std::shared_mutex mutex_;
   std::vector<PakMount> pak_mounts_;
-  std::vector<std::filesystem::path> directory_mounts_;
+  std::vector<DirectoryMount> directory_mounts_;
+  VfsIndex vfs_index_;
+  uint64_t mount_generation_ = 0u;
+  mutable AssetCache cache_;
 };
 
 }  // namespace dff::native::content
@@ -0,0 +1,276 @@
+#include "content/lz4_block.h"
+
+#include <cstring>
+
+namespace dff::native::content {
+
+namespace {
+
+constexpr size_t kMinMatch = 4u;
+constexpr size_t kLastLiterals = 5u;
+constexpr size_t kMatchFindLimit = 12u;
+constexpr size_t kMaxOffset = 65535u;
+constexpr uint32_t kHashBits = 12u;
+constexpr uint32_t kSkipTrigger = 6u;
+
+uint32_t Load32(const uint8_t* bytes) {
+  uint32_t value;
+  std::memcpy(&value, bytes, sizeof(value));
+  return value;
+}
+
+uint32_t HashSequence(uint32_t sequence) {
+  return (sequence * 2654435761u) >> (32u - kHashBits);
+}
+
+bool WriteLengthExtension(uint8_t** cursor, const uint8_t* end, size_t length) {
+  uint8_t* op = *cursor;
+  while (length >= 255u) {
+    if (op == end) {
+      return false;
+    }
+    *op++ = 255u;
+    length -= 255u;
+  }
+  if (op == end) {
+    return false;
+  }
+
+  *op++ = static_cast<uint8_t>(length);
+  *cursor = op;
+  return true;
+}
+
+bool WriteSequence(uint8_t** cursor,
+                   const uint8_t* end,
+                   const uint8_t* literals,
+                   size_t literal_length,
+                   size_t offset,
+                   size_t match_length) {
+  uint8_t* op = *cursor;
+  if (op == end) {
+    return false;
+  }
+
+  uint8_t* token = op++;
+  *token = static_cast<uint8_t>((literal_length < 15u ? literal_length : 15u) << 4u);
+  if (literal_length >= 15u && !WriteLengthExtension(&op, end, literal_length - 15u)) {
+    return false;
+  }
+  if (literal_length > static_cast<size_t>(end - op)) {
+    return false;
+  }
+  if (literal_length != 0u) {
+    std::memcpy(op, literals, literal_length);
+  }
+  op += literal_length;
+
+  if (match_length != 0u) {
+    if (end - op < 2) {
+      return false;
+    }
+    *op++ = static_cast<uint8_t>(offset & 0xFFu);
+    *op++ = static_cast<uint8_t>(offset >> 8u);
+
+    const size_t encoded_match = match_length - kMinMatch;
+    *token |= static_cast<uint8_t>(encoded_match < 15u ? encoded_match : 15u);
+    if (encoded_match >= 15u &&
+        !WriteLengthExtension(&op, end, encoded_match - 15u)) {
+      return false;
+    }
+  }
+
+  *cursor = op;
+  return true;
+}
+
+bool ReadLengthExtension(const uint8_t** cursor,
+                         const uint8_t* end,
+                         size_t* length) {
+  const uint8_t* ip = *cursor;
+  uint8_t byte = 0u;
+  do {
+    if (ip == end) {
+      return false;
+    }
+    byte = *ip++;
+    *length += byte;
+  } while (byte == 255u);
+
+  *cursor = ip;
+  return true;
+}
+
+// Copies an overlapping match in 8-byte steps, writing up to 7 bytes past the
+// match when there is room. Offsets below 8 first spread the pattern so the
+// source trails the destination by at least 8 bytes, as the reference decoder
+// does.
+void CopyMatch(uint8_t* op, const uint8_t* op_end, size_t offset, size_t length) {
+  static constexpr uint32_t kSpreadIncrement[8] = {0u, 1u, 2u, 1u, 0u, 4u, 4u, 4u};
+  static constexpr int32_t kSpreadDecrement[8] = {0, 0, 0, -1, -4, 1, 2, 3};
+
+  uint8_t* const end = op + length;
+  const uint8_t* match = op - offset;
+  if (op_end - end < 8) {
+    while (op < end) {
+      *op++ = *match++;
+    }
+    return;
+  }
+
+  if (offset < 8u) {
+    op[0] = match[0];
+    op[1] = match[1];
+    op[2] = match[2];
+    op[3] = match[3];
+    match += kSpreadIncrement[offset];
+    std::memcpy(op + 4, match, 4u);
+    match -= kSpreadDecrement[offset];
+    op += 8;
+  }
+
+  while (op < end) {
+    std::memcpy(op, match, 8u);
+    op += 8;
+    match += 8;
+  }
+}
+
+}  // namespace
+
+size_t Lz4CompressBound(size_t source_size) {
+  return source_size + source_size / 255u + 16u;
+}
+
+size_t Lz4CompressBlock(const uint8_t* source,
+                        size_t source_size,
+                        uint8_t* destination,
+                        size_t destination_capacity) {
+  if ((source == nullptr && source_size != 0u) || destination == nullptr) {
+    return 0u;
+  }
+
+  uint8_t* op = destination;
+  const uint8_t* const op_end = destination + destination_capacity;
+  size_t anchor = 0u;
+  if (source_size > kMatchFindLimit) {
+    uint32_t table[size_t{1} << kHashBits] = {};
+    const size_t match_start_limit = source_size - kMatchFindLimit;
+    const size_t match_end_limit = source_size - kLastLiterals;
+    size_t ip = 0u;
+    size_t search_count = 0u;
+    while (ip < match_start_limit) {
+      const uint32_t sequence = Load32(source + ip);
+      const uint32_t hash = HashSequence(sequence);
+      const size_t candidate = table[hash];
+      table[hash] = static_cast<uint32_t>(ip);
+      if (candidate >= ip || ip - candidate > kMaxOffset ||
+          Load32(source + candidate) != sequence) {
+        ip += 1u + (search_count++ >> kSkipTrigger);
+        continue;
+      }
+
+      size_t match_end = ip + kMinMatch;
+      while (match_end < match_end_limit &&
+             source[match_end] == source[candidate + (match_end - ip)]) {
+        ++match_end;
+      }
+
+      if (!WriteSequence(&op, op_end, source + anchor, ip - anchor,
+                         ip - candidate, match_end - ip)) {
+        return 0u;
+      }
+
+      ip = match_end;
+      anchor = ip;
+      search_count = 0u;
+      if (ip - 2u < match_start_limit) {
+        table[HashSequence(Load32(source + ip - 2u))] =
+            static_cast<uint32_t>(ip - 2u);
+      }
+    }
+  }
+
+  if (!WriteSequence(&op, op_end, source + anchor, source_size - anchor, 0u, 0u)) {
+    return 0u;
+  }
+
+  return static_cast<size_t>(op - destination);
+}
+
+bool Lz4DecompressBlock(const uint8_t* source,
+                        size_t source_size,
+                        uint8_t* destination,
+                        size_t destination_size) {
+  if (source == nullptr || source_size == 0u ||
+      (destination == nullptr && destination_size != 0u)) {
+    return false;
+  }
+
+  const uint8_t* ip = source;
+  const uint8_t* const ip_end = source + source_size;
+  uint8_t* op = destination;
+  uint8_t* const op_end = destination + destination_size;
+  while (ip < ip_end) {
+    const uint32_t token = *ip++;
+    size_t literal_length = token >> 4u;
+    if (literal_length < 15u && ip_end - ip >= 18 && op_end - op >= 32) {
+      std::memcpy(op, ip, 16u);
+      ip += literal_length;
+      op += literal_length;
+    } else {
+      if (literal_length == 15u &&
+          !ReadLengthExtension(&ip, ip_end, &literal_length)) {
+        return false;
+      }
+      if (literal_length > static_cast<size_t>(ip_end - ip) ||
+          literal_length > static_cast<size_t>(op_end - op)) {
+        return false;
+      }
+      if (literal_length != 0u) {
+        std::memcpy(op, ip, literal_length);
+      }
+      ip += literal_length;
+      op += literal_length;
+
+      if (ip == ip_end) {
+        return op == op_end;
+      }
+    }
+
+    if (ip_end - ip < 2) {
+      return false;
+    }
+    const size_t offset =
+        static_cast<size_t>(ip[0]) | (static_cast<size_t>(ip[1]) << 8u);
+    ip += 2;
+    if (offset == 0u || offset > static_cast<size_t>(op - destination)) {
+      return false;
+    }
+
+    size_t match_length = token & 15u;
+    if (match_length < 15u && offset >= 8u && op_end - op >= 18) {
+      const uint8_t* match = op - offset;
+      std::memcpy(op, match, 8u);
+      std::memcpy(op + 8, match + 8, 8u);
+      std::memcpy(op + 16, match + 16, 2u);
+      op += match_length + kMinMatch;
+      continue;
+    }
+
+    if (match_length == 15u && !ReadLengthExtension(&ip, ip_end, &match_length)) {
+      return false;
+    }
+    match_length += kMinMatch;
+    if (match_length > static_cast<size_t>(op_end - op)) {
+      return false;
+    }
+
+    CopyMatch(op, op_end, offset, match_length);
+    op += match_length;
+  }
+
+  return false;
+}
+
+}  // namespace dff::native::content
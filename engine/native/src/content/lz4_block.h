@@ -0,0 +1,28 @@
+#ifndef DFF_ENGINE_NATIVE_CONTENT_LZ4_BLOCK_H
+#define DFF_ENGINE_NATIVE_CONTENT_LZ4_BLOCK_H
+
+#include <cstddef>
+#include <cstdint>
+
+namespace dff::native::content {
+
+size_t Lz4CompressBound(size_t source_size);
+
+// Greedy LZ4 block compressor used by tooling and tests. Returns the number of
+// bytes written, or 0 when the output does not fit in destination_capacity.
+size_t Lz4CompressBlock(const uint8_t* source,
+                        size_t source_size,
+                        uint8_t* destination,
+                        size_t destination_capacity);
+
+// Decodes one LZ4 block. Malformed input is rejected without reading or
+// writing out of bounds, and the block must decode to exactly
+// destination_size bytes.
+bool Lz4DecompressBlock(const uint8_t* source,
+                        size_t source_size,
+                        uint8_t* destination,
+                        size_t destination_size);
+
+}  // namespace dff::native::content
+
+#endif
@@ -0,0 +1,157 @@
+#include "content/mapped_file.h"
+
+#include <limits>
+#include <utility>
+
+#if defined(_WIN32)
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace dff::native::content {
+
+MappedFile::~MappedFile() { Close(); }
+
+MappedFile::MappedFile(MappedFile&& other) noexcept { *this = std::move(other); }
+
+MappedFile& MappedFile::operator=(MappedFile&& other) noexcept {
+  if (this == &other) {
+    return *this;
+  }
+
+  Close();
+  data_ = std::exchange(other.data_, nullptr);
+  size_ = std::exchange(other.size_, 0u);
+  is_open_ = std::exchange(other.is_open_, false);
+#if defined(_WIN32)
+  file_handle_ = std::exchange(other.file_handle_, nullptr);
+  mapping_handle_ = std::exchange(other.mapping_handle_, nullptr);
+#endif
+  return *this;
+}
+
+#if defined(_WIN32)
+
+engine_native_status_t MappedFile::Open(const std::filesystem::path& path) {
+  Close();
+
+  HANDLE file = ::CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ,
+                              nullptr, OPEN_EXISTING,
+                              FILE_ATTRIBUTE_NORMAL | FILE_FLAG_RANDOM_ACCESS,
+                              nullptr);
+  if (file == INVALID_HANDLE_VALUE) {
+    return ENGINE_NATIVE_STATUS_NOT_FOUND;
+  }
+
+  LARGE_INTEGER file_size{};
+  if (!::GetFileSizeEx(file, &file_size) || file_size.QuadPart < 0 ||
+      static_cast<uint64_t>(file_size.QuadPart) >
+          std::numeric_limits<size_t>::max()) {
+    ::CloseHandle(file);
+    return ENGINE_NATIVE_STATUS_INTERNAL_ERROR;
+  }
+
+  if (file_size.QuadPart == 0) {
+    file_handle_ = file;
+    is_open_ = true;
+    return ENGINE_NATIVE_STATUS_OK;
+  }
+
+  HANDLE mapping =
+      ::CreateFileMappingW(file, nullptr, PAGE_READONLY, 0u, 0u, nullptr);
+  if (mapping == nullptr) {
+    ::CloseHandle(file);
+    return ENGINE_NATIVE_STATUS_INTERNAL_ERROR;
+  }
+
+  void* view = ::MapViewOfFile(mapping, FILE_MAP_READ, 0u, 0u, 0u);
+  if (view == nullptr) {
+    ::CloseHandle(mapping);
+    ::CloseHandle(file);
+    return ENGINE_NATIVE_STATUS_INTERNAL_ERROR;
+  }
+
+  file_handle_ = file;
+  mapping_handle_ = mapping;
+  data_ = static_cast<const uint8_t*>(view);
+  size_ = static_cast<size_t>(file_size.QuadPart);
+  is_open_ = true;
+  return ENGINE_NATIVE_STATUS_OK;
+}
+
+void MappedFile::Close() {
+  if (data_ != nullptr) {
+    ::UnmapViewOfFile(data_);
+  }
+  if (mapping_handle_ != nullptr) {
+    ::CloseHandle(static_cast<HANDLE>(mapping_handle_));
+  }
+  if (file_handle_ != nullptr) {
+    ::CloseHandle(static_cast<HANDLE>(file_handle_));
+  }
+
+  data_ = nullptr;
+  size_ = 0u;
+  is_open_ = false;
+  file_handle_ = nullptr;
+  mapping_handle_ = nullptr;
+}
+
+#else
+
+engine_native_status_t MappedFile::Open(const std::filesystem::path& path) {
+  Close();
+
+  const int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+  if (fd < 0) {
+    return ENGINE_NATIVE_STATUS_NOT_FOUND;
+  }
+
+  struct stat file_stat {};
+  if (::fstat(fd, &file_stat) != 0 || !S_ISREG(file_stat.st_mode) ||
+      file_stat.st_size < 0 ||
+      static_cast<uint64_t>(file_stat.st_size) >
+          std::numeric_limits<size_t>::max()) {
+    ::close(fd);
+    return ENGINE_NATIVE_STATUS_INTERNAL_ERROR;
+  }
+
+  const size_t file_size = static_cast<size_t>(file_stat.st_size);
+  if (file_size == 0u) {
+    ::close(fd);
+    is_open_ = true;
+    return ENGINE_NATIVE_STATUS_OK;
+  }
+
+  void* view = ::mmap(nullptr, file_size, PROT_READ, MAP_PRIVATE, fd, 0);
+  ::close(fd);
+  if (view == MAP_FAILED) {
+    return ENGINE_NATIVE_STATUS_INTERNAL_ERROR;
+  }
+
+  data_ = static_cast<const uint8_t*>(view);
+  size_ = file_size;
+  is_open_ = true;
+  return ENGINE_NATIVE_STATUS_OK;
+}
+
+void MappedFile::Close() {
+  if (data_ != nullptr) {
+    ::munmap(const_cast<uint8_t*>(data_), size_);
+  }
+
+  data_ = nullptr;
+  size_ = 0u;
+  is_open_ = false;
+}
+
+#endif
+
+}  // namespace dff::native::content
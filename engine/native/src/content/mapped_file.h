@@ -0,0 +1,47 @@
+#ifndef DFF_ENGINE_NATIVE_CONTENT_MAPPED_FILE_H
+#define DFF_ENGINE_NATIVE_CONTENT_MAPPED_FILE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+
+#include "engine_native.h"
+
+namespace dff::native::content {
+
+// Read-only view of a whole file. The mapping stays valid until the object is
+// destroyed or reassigned; moving transfers it without changing the address.
+// The file must not be truncated while mapped: replacing it by rename keeps
+// the mapped inode alive, but shrinking it in place faults later reads.
+class MappedFile {
+ public:
+  MappedFile() = default;
+  ~MappedFile();
+
+  MappedFile(const MappedFile&) = delete;
+  MappedFile& operator=(const MappedFile&) = delete;
+
+  MappedFile(MappedFile&& other) noexcept;
+  MappedFile& operator=(MappedFile&& other) noexcept;
+
+  engine_native_status_t Open(const std::filesystem::path& path);
+
+  void Close();
+
+  const uint8_t* data() const { return data_; }
+  size_t size() const { return size_; }
+  bool is_open() const { return is_open_; }
+
+ private:
+  const uint8_t* data_ = nullptr;
+  size_t size_ = 0u;
+  bool is_open_ = false;
+#if defined(_WIN32)
+  void* file_handle_ = nullptr;
+  void* mapping_handle_ = nullptr;
+#endif
+};
+
+}  // namespace dff::native::content
+
+#endif
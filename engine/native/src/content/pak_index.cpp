@@ -2,74 +2,76 @@
 
 #include <algorithm>
 #include <cstdint>
-#include <fstream>
+#include <cstring>
 #include <limits>
-#include <sstream>
+#include <memory>
+#include <new>
 #include <string>
-#include <vector>
+#include <string_view>
+
+#include "content/asset_path.h"
+#include "content/lz4_block.h"
 
 namespace dff::native::content {
 
 namespace {
 
 constexpr uint32_t kPakMagic = 0x50464644u;  // DFFP
-constexpr uint32_t kPakVersion = 3u;
+constexpr uint32_t kPakVersionLegacy = PakIndex::kLegacyVersion;
+constexpr uint32_t kPakVersionUncompressed = 4u;
+constexpr uint32_t kPakVersion = 5u;
+constexpr size_t kPakHeaderSize = 64u;
+constexpr uint32_t kPakMaxBucketBits = 30u;
+constexpr size_t kPakTocEntrySizeUncompressed = 56u;
+constexpr size_t kPakTocEntrySize = 72u;
+constexpr uint32_t kPakMaxChunkSize = 1u << 24u;
+constexpr uint32_t kPakChunkStoredBit = 0x80000000u;
+// Each record ends with (offset, length) string refs for the path, kind,
+// compiled path and asset key.
+constexpr size_t kPakPathRefOffset = 32u;
+constexpr size_t kPakAssetKeyRefOffset = 8u;
+constexpr uint64_t kFnvOffsetBasis = 14695981039346656037ull;
+constexpr uint64_t kFnvPrime = 1099511628211ull;
+
+template <typename T>
+T LoadUnaligned(const uint8_t* bytes) {
+  T value;
+  std::memcpy(&value, bytes, sizeof(T));
+  return value;
+}
 
-engine_native_status_t NormalizeAssetPath(const std::string& input_path,
-                                          std::string* out_normalized_path) {
-  if (out_normalized_path == nullptr || input_path.empty()) {
-    return ENGINE_NATIVE_STATUS_INVALID_ARGUMENT;
-  }
+struct PakByteReader {
+  const uint8_t* data = nullptr;
+  size_t size = 0u;
+  size_t offset = 0u;
 
-  std::string normalized = input_path;
-  std::replace(normalized.begin(), normalized.end(), '\\', '/');
-  if (!normalized.empty() && normalized.front() == '/') {
-    return ENGINE_NATIVE_STATUS_INVALID_ARGUMENT;
-  }
-
-  std::stringstream stream(normalized);
-  std::string segment;
-  std::vector<std::string> segments;
-  while (std::getline(stream, segment, '/')) {
-    if (segment.empty()) {
-      continue;
-    }
-    if (segment == "." || segment == "..") {
-      return ENGINE_NATIVE_STATUS_INVALID_ARGUMENT;
+  bool Read(void* out, size_t count) {
+    if (count > size - offset) {
+      return false;
     }
-    segments.push_back(segment);
-  }
 
-  if (segments.empty()) {
-    return ENGINE_NATIVE_STATUS_INVALID_ARGUMENT;
-  }
-
-  std::ostringstream out;
-  for (size_t i = 0u; i < segments.size(); ++i) {
-    if (i > 0u) {
-      out << '/';
+    if (count > 0u) {
+      std::memcpy(out, data + offset, count);
     }
-    out << segments[i];
+    offset += count;
+    return true;
   }
+};
 
-  *out_normalized_path = out.str();
-  return ENGINE_NATIVE_STATUS_OK;
-}
-
-engine_native_status_t Read7BitEncodedInt(std::istream* stream, uint32_t* out_value) {
-  if (stream == nullptr || out_value == nullptr) {
+engine_native_status_t Read7BitEncodedInt(PakByteReader* reader,
+                                          uint32_t* out_value) {
+  if (reader == nullptr || out_value == nullptr) {
     return ENGINE_NATIVE_STATUS_INVALID_ARGUMENT;
   }
 
   uint32_t result = 0u;
   uint32_t shift = 0u;
   for (uint32_t i = 0u; i < 5u; ++i) {
-    const int raw = stream->get();
-    if (raw == EOF) {
+    uint8_t byte = 0u;
+    if (!reader->Read(&byte, sizeof(byte))) {
       return ENGINE_NATIVE_STATUS_INTERNAL_ERROR;
     }
 
-    const uint8_t byte = static_cast<uint8_t>(raw);
     result |= static_cast<uint32_t>(byte & 0x7Fu) << shift;
     if ((byte & 0x80u) == 0u) {
       *out_value = result;
@@ -82,47 +84,76 @@ engine_native_status_t Read7BitEncodedInt(std::istream* stream, uint32_t* out_va
   return ENGINE_NATIVE_STATUS_INTERNAL_ERROR;
 }
 
-engine_native_status_t ReadUtf8String(std::istream* stream, std::string* out_value) {
-  if (stream == nullptr || out_value == nullptr) {
+engine_native_status_t ReadUtf8String(PakByteReader* reader,
+                                      std::string* out_value) {
+  if (reader == nullptr || out_value == nullptr) {
     return ENGINE_NATIVE_STATUS_INVALID_ARGUMENT;
   }
 
   uint32_t byte_count = 0u;
-  engine_native_status_t status = Read7BitEncodedInt(stream, &byte_count);
+  engine_native_status_t status = Read7BitEncodedInt(reader, &byte_count);
   if (status != ENGINE_NATIVE_STATUS_OK) {
     return status;
   }
 
-  if (byte_count > static_cast<uint32_t>(std::numeric_limits<int32_t>::max())) {
+  if (byte_count > static_cast<uint32_t>(std::numeric_limits<int32_t>::max()) ||
+      byte_count > reader->size - reader->offset) {
     return ENGINE_NATIVE_STATUS_INTERNAL_ERROR;
   }
 
-  std::string buffer;
-  buffer.resize(static_cast<size_t>(byte_count));
-  if (byte_count > 0u) {
-    stream->read(buffer.data(), static_cast<std::streamsize>(byte_count));
-    if (stream->gcount() != static_cast<std::streamsize>(byte_count)) {
+  out_value->assign(reinterpret_cast<const char*>(reader->data + reader->offset),
+                    static_cast<size_t>(byte_count));
+  reader->offset += byte_count;
+  return ENGINE_NATIVE_STATUS_OK;
+}
+
+bool EntryFitsPak(const PakAssetEntry& entry, size_t pak_size) {
+  if (entry.size_bytes == 0u) {
+    return true;
+  }
+
+  const uint64_t file_size = static_cast<uint64_t>(pak_size);
+  return entry.offset_bytes <= file_size &&
+         entry.size_bytes <= file_size - entry.offset_bytes;
+}
+
+bool ChunkedEntryFitsPak(const uint8_t* pak_bytes,
+                         size_t pak_size,
+                         const PakAssetEntry& entry) {
+  return entry.codec == PakCodec::kLz4Chunked && entry.chunk_size_bytes != 0u &&
+         entry.chunk_size_bytes <= kPakMaxChunkSize &&
+         EntryFitsPak(entry, pak_size) &&
+         PakAssetChunkCount(entry) <= entry.size_bytes / sizeof(uint32_t) &&
+         (pak_bytes != nullptr || entry.size_bytes == 0u);
+}
+
+engine_native_status_t DecodePakChunk(const uint8_t* source,
+                                      uint32_t descriptor,
+                                      uint8_t* output,
+                                      size_t output_size) {
+  const uint32_t stored_size = descriptor & ~kPakChunkStoredBit;
+  if ((descriptor & kPakChunkStoredBit) != 0u) {
+    if (stored_size != output_size) {
       return ENGINE_NATIVE_STATUS_INTERNAL_ERROR;
     }
+    std::memcpy(output, source, output_size);
+    return ENGINE_NATIVE_STATUS_OK;
   }
 
-  *out_value = std::move(buffer);
-  return ENGINE_NATIVE_STATUS_OK;
+  return Lz4DecompressBlock(source, stored_size, output, output_size)
+             ? ENGINE_NATIVE_STATUS_OK
+             : ENGINE_NATIVE_STATUS_INTERNAL_ERROR;
 }
 
-}  // namespace
-
-engine_native_status_t ReadPakIndex(
-    const std::filesystem::path& pak_path,
+engine_native_status_t ReadLegacyPakIndex(
+    const uint8_t* pak_bytes,
+    size_t pak_size,
     std::unordered_map<std::string, PakAssetEntry>* out_entries) {
-  if (out_entries == nullptr) {
+  if (out_entries == nullptr || (pak_bytes == nullptr && pak_size != 0u)) {
     return ENGINE_NATIVE_STATUS_INVALID_ARGUMENT;
   }
 
-  std::ifstream stream(pak_path, std::ios::binary);
-  if (!stream.is_open()) {
-    return ENGINE_NATIVE_STATUS_NOT_FOUND;
-  }
+  PakByteReader reader{pak_bytes, pak_size, 0u};
 
   uint32_t magic = 0u;
   uint32_t version = 0u;
@@ -130,90 +161,282 @@ engine_native_status_t ReadPakIndex(
   uint32_t reserved = 0u;
   int64_t created_at_ticks = 0;
 
-  stream.read(reinterpret_cast<char*>(&magic), sizeof(magic));
-  stream.read(reinterpret_cast<char*>(&version), sizeof(version));
-  stream.read(reinterpret_cast<char*>(&entry_count), sizeof(entry_count));
-  stream.read(reinterpret_cast<char*>(&reserved), sizeof(reserved));
-  stream.read(reinterpret_cast<char*>(&created_at_ticks), sizeof(created_at_ticks));
-  if (!stream.good()) {
+  if (!reader.Read(&magic, sizeof(magic)) ||
+      !reader.Read(&version, sizeof(version)) ||
+      !reader.Read(&entry_count, sizeof(entry_count)) ||
+      !reader.Read(&reserved, sizeof(reserved)) ||
+      !reader.Read(&created_at_ticks, sizeof(created_at_ticks))) {
     return ENGINE_NATIVE_STATUS_INTERNAL_ERROR;
   }
 
-  if (magic != kPakMagic || version != kPakVersion || entry_count < 0) {
+  if (magic != kPakMagic || version != kPakVersionLegacy || entry_count < 0) {
     return ENGINE_NATIVE_STATUS_INTERNAL_ERROR;
   }
 
   out_entries->clear();
   out_entries->reserve(static_cast<size_t>(entry_count));
 
+  std::string raw_asset_path;
+  std::string raw_kind;
+  std::string raw_compiled_path;
+  std::string raw_asset_key;
   for (int32_t i = 0; i < entry_count; ++i) {
-    std::string raw_asset_path;
-    std::string raw_kind;
-    std::string raw_compiled_path;
-    std::string raw_asset_key;
     int64_t offset_bytes = 0;
     int64_t size_bytes = 0;
 
-    engine_native_status_t status = ReadUtf8String(&stream, &raw_asset_path);
+    engine_native_status_t status = ReadUtf8String(&reader, &raw_asset_path);
     if (status != ENGINE_NATIVE_STATUS_OK) {
       return status;
     }
 
-    status = ReadUtf8String(&stream, &raw_kind);
+    status = ReadUtf8String(&reader, &raw_kind);
     if (status != ENGINE_NATIVE_STATUS_OK) {
       return status;
     }
 
-    status = ReadUtf8String(&stream, &raw_compiled_path);
+    status = ReadUtf8String(&reader, &raw_compiled_path);
     if (status != ENGINE_NATIVE_STATUS_OK) {
       return status;
     }
 
-    status = ReadUtf8String(&stream, &raw_asset_key);
+    status = ReadUtf8String(&reader, &raw_asset_key);
     if (status != ENGINE_NATIVE_STATUS_OK) {
       return status;
     }
 
-    stream.read(reinterpret_cast<char*>(&offset_bytes), sizeof(offset_bytes));
-    stream.read(reinterpret_cast<char*>(&size_bytes), sizeof(size_bytes));
-    if (!stream.good() || offset_bytes < 0 || size_bytes < 0) {
+    if (!reader.Read(&offset_bytes, sizeof(offset_bytes)) ||
+        !reader.Read(&size_bytes, sizeof(size_bytes)) || offset_bytes < 0 ||
+        size_bytes < 0) {
       return ENGINE_NATIVE_STATUS_INTERNAL_ERROR;
     }
 
-    std::string normalized_asset_path;
-    status = NormalizeAssetPath(raw_asset_path, &normalized_asset_path);
+    PakAssetEntry entry;
+    entry.offset_bytes = static_cast<uint64_t>(offset_bytes);
+    entry.size_bytes = static_cast<uint64_t>(size_bytes);
+    entry.uncompressed_size_bytes = entry.size_bytes;
+    if (!EntryFitsPak(entry, pak_size)) {
+      return ENGINE_NATIVE_STATUS_INTERNAL_ERROR;
+    }
+
+    entry.asset_key = HashAssetKey(raw_asset_key);
+
+    NormalizedAssetPath normalized_asset_path;
+    status = normalized_asset_path.Assign(raw_asset_path);
     if (status != ENGINE_NATIVE_STATUS_OK) {
       return status;
     }
 
-    (*out_entries)[normalized_asset_path] = PakAssetEntry{
-        static_cast<uint64_t>(offset_bytes),
-        static_cast<uint64_t>(size_bytes)};
+    (*out_entries)[std::string(normalized_asset_path.view())] = entry;
+  }
+
+  return ENGINE_NATIVE_STATUS_OK;
+}
+
+}  // namespace
+
+uint64_t HashPakPath(std::string_view normalized_asset_path) {
+  uint64_t hash = kFnvOffsetBasis;
+  for (const char c : normalized_asset_path) {
+    hash ^= static_cast<uint8_t>(c);
+    hash *= kFnvPrime;
   }
 
-  stream.seekg(0, std::ios::end);
-  const std::streamoff file_size_stream = stream.tellg();
-  if (file_size_stream < 0) {
+  return hash;
+}
+
+uint64_t HashAssetKey(std::string_view asset_key) {
+  return asset_key.empty() ? 0u : HashPakPath(asset_key);
+}
+
+engine_native_status_t PakIndex::Load(const uint8_t* pak_bytes,
+                                      size_t pak_size) {
+  if (pak_bytes == nullptr && pak_size != 0u) {
+    return ENGINE_NATIVE_STATUS_INVALID_ARGUMENT;
+  }
+
+  *this = PakIndex{};
+  if (pak_size < sizeof(uint32_t) * 2u ||
+      LoadUnaligned<uint32_t>(pak_bytes) != kPakMagic) {
     return ENGINE_NATIVE_STATUS_INTERNAL_ERROR;
   }
-  const uint64_t file_size = static_cast<uint64_t>(file_size_stream);
 
-  for (const auto& pair : *out_entries) {
-    const PakAssetEntry& entry = pair.second;
-    if (entry.size_bytes == 0u) {
+  const uint32_t version = LoadUnaligned<uint32_t>(pak_bytes + 4u);
+  if (version == kPakVersionLegacy) {
+    const engine_native_status_t status =
+        ReadLegacyPakIndex(pak_bytes, pak_size, &legacy_entries_);
+    if (status != ENGINE_NATIVE_STATUS_OK) {
+      legacy_entries_.clear();
+      return status;
+    }
+
+    version_ = version;
+    entry_count_ = legacy_entries_.size();
+    return ENGINE_NATIVE_STATUS_OK;
+  }
+
+  if ((version != kPakVersion && version != kPakVersionUncompressed) ||
+      pak_size < kPakHeaderSize) {
+    return ENGINE_NATIVE_STATUS_INTERNAL_ERROR;
+  }
+
+  const size_t record_size = version == kPakVersion
+                                 ? kPakTocEntrySize
+                                 : kPakTocEntrySizeUncompressed;
+  const int32_t entry_count = LoadUnaligned<int32_t>(pak_bytes + 8u);
+  const uint64_t toc_offset = LoadUnaligned<uint64_t>(pak_bytes + 24u);
+  const uint64_t strings_offset = LoadUnaligned<uint64_t>(pak_bytes + 32u);
+  const uint64_t strings_size = LoadUnaligned<uint64_t>(pak_bytes + 40u);
+  const uint64_t buckets_offset = LoadUnaligned<uint64_t>(pak_bytes + 48u);
+  const uint32_t bucket_bits = LoadUnaligned<uint32_t>(pak_bytes + 56u);
+  const uint64_t file_size = static_cast<uint64_t>(pak_size);
+  if (entry_count < 0 || bucket_bits > kPakMaxBucketBits ||
+      toc_offset > file_size ||
+      static_cast<uint64_t>(entry_count) >
+          (file_size - toc_offset) / record_size ||
+      strings_offset > file_size || strings_size > file_size - strings_offset) {
+    return ENGINE_NATIVE_STATUS_INTERNAL_ERROR;
+  }
+
+  const uint64_t bucket_bound_count = (uint64_t{1} << bucket_bits) + 1u;
+  if (buckets_offset > file_size ||
+      bucket_bound_count > (file_size - buckets_offset) / sizeof(uint32_t)) {
+    return ENGINE_NATIVE_STATUS_INTERNAL_ERROR;
+  }
+
+  toc_ = pak_bytes + toc_offset;
+  strings_ = pak_bytes + strings_offset;
+  buckets_ = pak_bytes + buckets_offset;
+  record_size_ = record_size;
+  strings_size_ = static_cast<size_t>(strings_size);
+  entry_count_ = static_cast<size_t>(entry_count);
+  bucket_bits_ = bucket_bits;
+  version_ = version;
+  return ENGINE_NATIVE_STATUS_OK;
+}
+
+bool PakIndex::Find(std::string_view normalized_asset_path,
+                    PakAssetEntry* out_entry) const {
+  if (out_entry == nullptr) {
+    return false;
+  }
+
+  if (version_ == kPakVersionLegacy) {
+    const auto it = legacy_entries_.find(std::string(normalized_asset_path));
+    if (it == legacy_entries_.end()) {
+      return false;
+    }
+
+    *out_entry = it->second;
+    return true;
+  }
+
+  const uint64_t hash = HashPakPath(normalized_asset_path);
+  const size_t bucket =
+      bucket_bits_ == 0u ? 0u : static_cast<size_t>(hash >> (64u - bucket_bits_));
+  const size_t first = LoadUnaligned<uint32_t>(buckets_ + bucket * 4u);
+  const size_t last = std::min<size_t>(
+      LoadUnaligned<uint32_t>(buckets_ + (bucket + 1u) * 4u), entry_count_);
+
+  for (size_t i = first; i < last; ++i) {
+    const uint8_t* record = toc_ + i * record_size_;
+    const uint64_t record_hash = LoadUnaligned<uint64_t>(record);
+    if (record_hash > hash) {
+      break;
+    }
+    if (record_hash != hash) {
       continue;
     }
 
-    if (entry.offset_bytes > file_size ||
-        entry.size_bytes > file_size - entry.offset_bytes) {
-      return ENGINE_NATIVE_STATUS_INTERNAL_ERROR;
+    std::string_view path;
+    if (!StringAt(record + record_size_ - kPakPathRefOffset, &path) ||
+        path != normalized_asset_path) {
+      continue;
     }
+
+    return ReadRecordEntry(record, out_entry);
   }
 
+  return false;
+}
+
+bool PakIndex::StringAt(const uint8_t* string_ref,
+                        std::string_view* out_value) const {
+  const uint32_t offset = LoadUnaligned<uint32_t>(string_ref);
+  const uint32_t length = LoadUnaligned<uint32_t>(string_ref + 4u);
+  if (offset > strings_size_ || length > strings_size_ - offset) {
+    return false;
+  }
+
+  *out_value =
+      std::string_view(reinterpret_cast<const char*>(strings_ + offset), length);
+  return true;
+}
+
+bool PakIndex::ReadRecordEntry(const uint8_t* record,
+                               PakAssetEntry* out_entry) const {
+  *out_entry = PakAssetEntry{};
+  out_entry->offset_bytes = LoadUnaligned<uint64_t>(record + 8u);
+  out_entry->size_bytes = LoadUnaligned<uint64_t>(record + 16u);
+  out_entry->uncompressed_size_bytes = out_entry->size_bytes;
+  if (version_ == kPakVersion) {
+    out_entry->uncompressed_size_bytes = LoadUnaligned<uint64_t>(record + 24u);
+    out_entry->codec = static_cast<PakCodec>(LoadUnaligned<uint32_t>(record + 32u));
+    out_entry->chunk_size_bytes = LoadUnaligned<uint32_t>(record + 36u);
+  }
+
+  std::string_view asset_key;
+  if (!StringAt(record + record_size_ - kPakAssetKeyRefOffset, &asset_key)) {
+    return false;
+  }
+  out_entry->asset_key = HashAssetKey(asset_key);
+  return true;
+}
+
+bool PakIndex::RecordAt(size_t index,
+                        std::string_view* out_path,
+                        uint64_t* out_hash,
+                        PakAssetEntry* out_entry) const {
+  const uint8_t* record = toc_ + index * record_size_;
+  if (!StringAt(record + record_size_ - kPakPathRefOffset, out_path)) {
+    return false;
+  }
+
+  *out_hash = LoadUnaligned<uint64_t>(record);
+  return ReadRecordEntry(record, out_entry);
+}
+
+engine_native_status_t MapPakAsset(const uint8_t* pak_bytes,
+                                   size_t pak_size,
+                                   const PakAssetEntry& entry,
+                                   const void** out_data,
+                                   size_t* out_size) {
+  if (out_data == nullptr || out_size == nullptr) {
+    return ENGINE_NATIVE_STATUS_INVALID_ARGUMENT;
+  }
+
+  *out_data = nullptr;
+  *out_size = 0u;
+  if (entry.codec != PakCodec::kStored) {
+    return entry.codec == PakCodec::kLz4Chunked
+               ? ENGINE_NATIVE_STATUS_INVALID_STATE
+               : ENGINE_NATIVE_STATUS_INTERNAL_ERROR;
+  }
+
+  if (!EntryFitsPak(entry, pak_size) ||
+      entry.uncompressed_size_bytes != entry.size_bytes ||
+      (pak_bytes == nullptr && entry.size_bytes != 0u)) {
+    return ENGINE_NATIVE_STATUS_INTERNAL_ERROR;
+  }
+
+  if (entry.size_bytes != 0u) {
+    *out_data = pak_bytes + entry.offset_bytes;
+  }
+  *out_size = static_cast<size_t>(entry.size_bytes);
   return ENGINE_NATIVE_STATUS_OK;
 }
 
-engine_native_status_t ReadPakAssetBytes(const std::filesystem::path& pak_path,
+engine_native_status_t ReadPakAssetBytes(const uint8_t* pak_bytes,
+                                         size_t pak_size,
                                          const PakAssetEntry& entry,
                                          void* buffer,
                                          size_t buffer_size,
@@ -222,46 +445,202 @@ engine_native_status_t ReadPakAssetBytes(const std::filesystem::path& pak_path,
     return ENGINE_NATIVE_STATUS_INVALID_ARGUMENT;
   }
 
-  *out_size = static_cast<size_t>(entry.size_bytes);
+  *out_size = 0u;
+  if (!EntryFitsPak(entry, pak_size) ||
+      entry.uncompressed_size_bytes > std::numeric_limits<size_t>::max()) {
+    return ENGINE_NATIVE_STATUS_INTERNAL_ERROR;
+  }
 
+  *out_size = static_cast<size_t>(entry.uncompressed_size_bytes);
   if (buffer == nullptr) {
-    if (buffer_size != 0u) {
-      return ENGINE_NATIVE_STATUS_INVALID_ARGUMENT;
-    }
+    return buffer_size == 0u ? ENGINE_NATIVE_STATUS_OK
+                             : ENGINE_NATIVE_STATUS_INVALID_ARGUMENT;
+  }
 
-    return ENGINE_NATIVE_STATUS_OK;
+  return DecodePakAssetChunks(pak_bytes, pak_size, entry, 0u,
+                              PakAssetChunkCount(entry), buffer, buffer_size);
+}
+
+uint64_t PakAssetChunkCount(const PakAssetEntry& entry) {
+  if (entry.codec != PakCodec::kLz4Chunked) {
+    return 1u;
+  }
+  if (entry.chunk_size_bytes == 0u) {
+    return 0u;
   }
 
-  if (buffer_size < static_cast<size_t>(entry.size_bytes)) {
+  return entry.uncompressed_size_bytes / entry.chunk_size_bytes +
+         (entry.uncompressed_size_bytes % entry.chunk_size_bytes != 0u ? 1u : 0u);
+}
+
+engine_native_status_t DecodePakAssetChunks(const uint8_t* pak_bytes,
+                                            size_t pak_size,
+                                            const PakAssetEntry& entry,
+                                            uint64_t first_chunk,
+                                            uint64_t chunk_count,
+                                            void* buffer,
+                                            size_t buffer_size) {
+  const uint64_t total_chunks = PakAssetChunkCount(entry);
+  if (first_chunk > total_chunks || chunk_count > total_chunks - first_chunk ||
+      (buffer == nullptr && entry.uncompressed_size_bytes != 0u)) {
     return ENGINE_NATIVE_STATUS_INVALID_ARGUMENT;
   }
+  if (buffer_size < entry.uncompressed_size_bytes) {
+    return ENGINE_NATIVE_STATUS_INVALID_ARGUMENT;
+  }
+
+  if (entry.codec == PakCodec::kStored) {
+    const void* asset_bytes = nullptr;
+    size_t asset_size = 0u;
+    const engine_native_status_t status =
+        MapPakAsset(pak_bytes, pak_size, entry, &asset_bytes, &asset_size);
+    if (status != ENGINE_NATIVE_STATUS_OK) {
+      return status;
+    }
 
-  std::ifstream stream(pak_path, std::ios::binary | std::ios::ate);
-  if (!stream.is_open()) {
-    return ENGINE_NATIVE_STATUS_NOT_FOUND;
+    if (chunk_count != 0u && asset_size != 0u) {
+      std::memcpy(buffer, asset_bytes, asset_size);
+    }
+    return ENGINE_NATIVE_STATUS_OK;
   }
 
-  const std::streamoff file_size_stream = stream.tellg();
-  if (file_size_stream < 0) {
+  if (!ChunkedEntryFitsPak(pak_bytes, pak_size, entry)) {
     return ENGINE_NATIVE_STATUS_INTERNAL_ERROR;
   }
-  const uint64_t file_size = static_cast<uint64_t>(file_size_stream);
-  if (entry.offset_bytes > file_size ||
-      entry.size_bytes > file_size - entry.offset_bytes) {
+
+  const uint8_t* chunk_table = pak_bytes + entry.offset_bytes;
+  const uint64_t data_size = entry.size_bytes - total_chunks * sizeof(uint32_t);
+  const uint8_t* data = chunk_table + total_chunks * sizeof(uint32_t);
+  uint64_t data_offset = 0u;
+  for (uint64_t chunk = 0u; chunk < first_chunk; ++chunk) {
+    data_offset += LoadUnaligned<uint32_t>(chunk_table + chunk * 4u) &
+                   ~kPakChunkStoredBit;
+  }
+
+  uint8_t* output = static_cast<uint8_t*>(buffer);
+  for (uint64_t chunk = first_chunk; chunk < first_chunk + chunk_count; ++chunk) {
+    const uint32_t descriptor = LoadUnaligned<uint32_t>(chunk_table + chunk * 4u);
+    const uint32_t stored_size = descriptor & ~kPakChunkStoredBit;
+    const uint64_t output_offset = chunk * entry.chunk_size_bytes;
+    const size_t output_size = static_cast<size_t>(std::min<uint64_t>(
+        entry.chunk_size_bytes, entry.uncompressed_size_bytes - output_offset));
+    if (data_offset > data_size || stored_size > data_size - data_offset) {
+      return ENGINE_NATIVE_STATUS_INTERNAL_ERROR;
+    }
+
+    const engine_native_status_t status = DecodePakChunk(
+        data + data_offset, descriptor, output + output_offset, output_size);
+    if (status != ENGINE_NATIVE_STATUS_OK) {
+      return status;
+    }
+
+    data_offset += stored_size;
+  }
+
+  return ENGINE_NATIVE_STATUS_OK;
+}
+
+engine_native_status_t ReadPakAssetRange(const uint8_t* pak_bytes,
+                                         size_t pak_size,
+                                         const PakAssetEntry& entry,
+                                         uint64_t offset_bytes,
+                                         void* buffer,
+                                         size_t length,
+                                         size_t* out_size) {
+  if (out_size == nullptr || (buffer == nullptr && length != 0u)) {
+    return ENGINE_NATIVE_STATUS_INVALID_ARGUMENT;
+  }
+
+  *out_size = 0u;
+  if (!EntryFitsPak(entry, pak_size)) {
     return ENGINE_NATIVE_STATUS_INTERNAL_ERROR;
   }
+  if (offset_bytes > entry.uncompressed_size_bytes) {
+    return ENGINE_NATIVE_STATUS_INVALID_ARGUMENT;
+  }
 
-  if (entry.size_bytes == 0u) {
+  const uint64_t range_size =
+      std::min<uint64_t>(length, entry.uncompressed_size_bytes - offset_bytes);
+  if (range_size == 0u) {
+    return ENGINE_NATIVE_STATUS_OK;
+  }
+
+  uint8_t* output = static_cast<uint8_t*>(buffer);
+  if (entry.codec == PakCodec::kStored) {
+    const void* asset_bytes = nullptr;
+    size_t asset_size = 0u;
+    const engine_native_status_t status =
+        MapPakAsset(pak_bytes, pak_size, entry, &asset_bytes, &asset_size);
+    if (status != ENGINE_NATIVE_STATUS_OK) {
+      return status;
+    }
+
+    std::memcpy(output, static_cast<const uint8_t*>(asset_bytes) + offset_bytes,
+                static_cast<size_t>(range_size));
+    *out_size = static_cast<size_t>(range_size);
     return ENGINE_NATIVE_STATUS_OK;
   }
 
-  stream.seekg(static_cast<std::streamoff>(entry.offset_bytes), std::ios::beg);
-  stream.read(static_cast<char*>(buffer),
-              static_cast<std::streamsize>(entry.size_bytes));
-  if (stream.gcount() != static_cast<std::streamsize>(entry.size_bytes)) {
+  if (!ChunkedEntryFitsPak(pak_bytes, pak_size, entry)) {
     return ENGINE_NATIVE_STATUS_INTERNAL_ERROR;
   }
 
+  const uint64_t total_chunks = PakAssetChunkCount(entry);
+  const uint8_t* chunk_table = pak_bytes + entry.offset_bytes;
+  const uint64_t data_size = entry.size_bytes - total_chunks * sizeof(uint32_t);
+  const uint8_t* data = chunk_table + total_chunks * sizeof(uint32_t);
+  const uint64_t range_end = offset_bytes + range_size;
+  const uint64_t first_chunk = offset_bytes / entry.chunk_size_bytes;
+  const uint64_t last_chunk = (range_end - 1u) / entry.chunk_size_bytes;
+  uint64_t data_offset = 0u;
+  for (uint64_t chunk = 0u; chunk < first_chunk; ++chunk) {
+    data_offset += LoadUnaligned<uint32_t>(chunk_table + chunk * 4u) &
+                   ~kPakChunkStoredBit;
+  }
+
+  // Chunks the range covers completely decode straight into the caller's
+  // buffer; only the partial chunks at either end go through scratch.
+  std::unique_ptr<uint8_t[]> scratch;
+  for (uint64_t chunk = first_chunk; chunk <= last_chunk; ++chunk) {
+    const uint32_t descriptor = LoadUnaligned<uint32_t>(chunk_table + chunk * 4u);
+    const uint32_t stored_size = descriptor & ~kPakChunkStoredBit;
+    const uint64_t chunk_begin = chunk * entry.chunk_size_bytes;
+    const size_t chunk_size = static_cast<size_t>(std::min<uint64_t>(
+        entry.chunk_size_bytes, entry.uncompressed_size_bytes - chunk_begin));
+    if (data_offset > data_size || stored_size > data_size - data_offset) {
+      return ENGINE_NATIVE_STATUS_INTERNAL_ERROR;
+    }
+
+    const uint64_t copy_begin = std::max(offset_bytes, chunk_begin);
+    const uint64_t copy_end = std::min(range_end, chunk_begin + chunk_size);
+    uint8_t* destination = output + (copy_begin - offset_bytes);
+    engine_native_status_t status = ENGINE_NATIVE_STATUS_OK;
+    if (copy_begin == chunk_begin && copy_end == chunk_begin + chunk_size) {
+      status = DecodePakChunk(data + data_offset, descriptor, destination,
+                              chunk_size);
+    } else {
+      if (scratch == nullptr) {
+        scratch.reset(new (std::nothrow) uint8_t[entry.chunk_size_bytes]);
+        if (scratch == nullptr) {
+          return ENGINE_NATIVE_STATUS_OUT_OF_MEMORY;
+        }
+      }
+
+      status = DecodePakChunk(data + data_offset, descriptor, scratch.get(),
+                              chunk_size);
+      if (status == ENGINE_NATIVE_STATUS_OK) {
+        std::memcpy(destination, scratch.get() + (copy_begin - chunk_begin),
+                    static_cast<size_t>(copy_end - copy_begin));
+      }
+    }
+    if (status != ENGINE_NATIVE_STATUS_OK) {
+      return status;
+    }
+
+    data_offset += stored_size;
+  }
+
+  *out_size = static_cast<size_t>(range_size);
   return ENGINE_NATIVE_STATUS_OK;
 }
 
@@ -4,29 +4,143 @@
 #include <cstddef>
 #include <cstdint>
 
-#include <filesystem>
 #include <string>
+#include <string_view>
 #include <unordered_map>
 
 #include "engine_native.h"
 
 namespace dff::native::content {
 
+enum class PakCodec : uint32_t {
+  kStored = 0u,
+  kLz4Chunked = 1u,
+};
+
+// size_bytes is the stored span in the pak. Compressed entries start with one
+// u32 per chunk holding its stored length, with the high bit set for chunks
+// kept raw, followed by the chunk data. Every chunk but the last decodes to
+// chunk_size_bytes. asset_key is HashAssetKey of the entry's asset key string.
 struct PakAssetEntry {
   uint64_t offset_bytes = 0u;
   uint64_t size_bytes = 0u;
+  uint64_t uncompressed_size_bytes = 0u;
+  PakCodec codec = PakCodec::kStored;
+  uint32_t chunk_size_bytes = 0u;
+  uint64_t asset_key = 0u;
+};
+
+uint64_t HashPakPath(std::string_view normalized_asset_path);
+
+// FNV-1a, as for paths. Entries without an asset key get 0.
+uint64_t HashAssetKey(std::string_view asset_key);
+
+// Lookup over a mapped pak. Version 4 and 5 paks are searched in place: a radix
+// bucket table over the hash-sorted table of contents narrows each lookup to a
+// handful of records, so loading only validates the header. Version 5 adds
+// per-entry compression to the record. Version 3 paks are still parsed into a
+// map.
+class PakIndex {
+ public:
+  static constexpr uint32_t kLegacyVersion = 3u;
+
+  engine_native_status_t Load(const uint8_t* pak_bytes, size_t pak_size);
+
+  bool Find(std::string_view normalized_asset_path,
+            PakAssetEntry* out_entry) const;
+
+  // Validates every record, then calls fn(path, path_hash, entry) for each.
+  // Paths point into the mapping or the legacy map and live as long as the
+  // index.
+  template <typename Fn>
+  engine_native_status_t ForEachEntry(Fn&& fn) const;
+
+  uint32_t version() const { return version_; }
+  size_t entry_count() const { return entry_count_; }
+
+ private:
+  const uint8_t* toc_ = nullptr;
+  const uint8_t* strings_ = nullptr;
+  const uint8_t* buckets_ = nullptr;
+  size_t record_size_ = 0u;
+  size_t strings_size_ = 0u;
+  size_t entry_count_ = 0u;
+  uint32_t bucket_bits_ = 0u;
+  uint32_t version_ = 0u;
+  std::unordered_map<std::string, PakAssetEntry> legacy_entries_;
+
+  bool StringAt(const uint8_t* string_ref, std::string_view* out_value) const;
+  bool ReadRecordEntry(const uint8_t* record, PakAssetEntry* out_entry) const;
+  bool RecordAt(size_t index,
+                std::string_view* out_path,
+                uint64_t* out_hash,
+                PakAssetEntry* out_entry) const;
 };
 
-engine_native_status_t ReadPakIndex(
-    const std::filesystem::path& pak_path,
-    std::unordered_map<std::string, PakAssetEntry>* out_entries);
+template <typename Fn>
+engine_native_status_t PakIndex::ForEachEntry(Fn&& fn) const {
+  if (version_ == kLegacyVersion) {
+    for (const auto& [path, entry] : legacy_entries_) {
+      fn(std::string_view(path), HashPakPath(path), entry);
+    }
+    return ENGINE_NATIVE_STATUS_OK;
+  }
+
+  std::string_view path;
+  uint64_t hash = 0u;
+  PakAssetEntry entry;
+  for (size_t i = 0u; i < entry_count_; ++i) {
+    if (!RecordAt(i, &path, &hash, &entry)) {
+      return ENGINE_NATIVE_STATUS_INTERNAL_ERROR;
+    }
+  }
+
+  for (size_t i = 0u; i < entry_count_; ++i) {
+    RecordAt(i, &path, &hash, &entry);
+    fn(path, hash, entry);
+  }
+  return ENGINE_NATIVE_STATUS_OK;
+}
+
+// Compressed entries are not mappable and report INVALID_STATE.
+engine_native_status_t MapPakAsset(const uint8_t* pak_bytes,
+                                   size_t pak_size,
+                                   const PakAssetEntry& entry,
+                                   const void** out_data,
+                                   size_t* out_size);
+
+// Reports the uncompressed size and decodes the whole entry into buffer.
+engine_native_status_t ReadPakAssetBytes(const uint8_t* pak_bytes,
+                                         size_t pak_size,
+                                         const PakAssetEntry& entry,
+                                         void* buffer,
+                                         size_t buffer_size,
+                                         size_t* out_size);
+
+// Stored entries count as a single chunk.
+uint64_t PakAssetChunkCount(const PakAssetEntry& entry);
+
+// Decodes chunks [first_chunk, first_chunk + chunk_count) into their place in
+// buffer, which must hold the whole uncompressed entry. Disjoint chunk ranges
+// touch disjoint bytes, so callers can decode a large entry on several threads.
+engine_native_status_t DecodePakAssetChunks(const uint8_t* pak_bytes,
+                                            size_t pak_size,
+                                            const PakAssetEntry& entry,
+                                            uint64_t first_chunk,
+                                            uint64_t chunk_count,
+                                            void* buffer,
+                                            size_t buffer_size);
 
-engine_native_status_t ReadPakAssetBytes(
-    const std::filesystem::path& pak_path,
-    const PakAssetEntry& entry,
-    void* buffer,
-    size_t buffer_size,
-    size_t* out_size);
+// Copies up to length bytes starting at offset_bytes of the uncompressed
+// entry. Reads past the end are clamped; out_size receives the bytes copied.
+// Compressed entries decode only the chunks the range touches.
+engine_native_status_t ReadPakAssetRange(const uint8_t* pak_bytes,
+                                         size_t pak_size,
+                                         const PakAssetEntry& entry,
+                                         uint64_t offset_bytes,
+                                         void* buffer,
+                                         size_t length,
+                                         size_t* out_size);
 
 }  // namespace dff::native::content
 
@@ -0,0 +1,300 @@
+#include "content/streaming_scheduler.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <new>
+#include <utility>
+
+namespace dff::native::content {
+
+namespace {
+
+uint64_t NowNs() {
+  return static_cast<uint64_t>(
+      std::chrono::duration_cast<std::chrono::nanoseconds>(
+          std::chrono::steady_clock::now().time_since_epoch())
+          .count());
+}
+
+}  // namespace
+
+StreamingScheduler::StreamingScheduler(const ContentRuntime& runtime,
+                                       ContentReadQueue& reads)
+    : runtime_(runtime), reads_(reads) {}
+
+engine_native_status_t StreamingScheduler::Request(std::string asset_path,
+                                                   float priority,
+                                                   void* buffer,
+                                                   size_t buffer_size,
+                                                   uint64_t* out_request_id) {
+  if (out_request_id == nullptr) {
+    return ENGINE_NATIVE_STATUS_INVALID_ARGUMENT;
+  }
+
+  *out_request_id = 0u;
+  if (asset_path.empty() || std::isnan(priority) ||
+      (buffer == nullptr && buffer_size != 0u)) {
+    return ENGINE_NATIVE_STATUS_INVALID_ARGUMENT;
+  }
+
+  StreamRequest request;
+  const engine_native_status_t status =
+      runtime_.Locate(asset_path, &request.location);
+  if (status != ENGINE_NATIVE_STATUS_OK) {
+    return status;
+  }
+
+  request.asset_path = std::move(asset_path);
+  request.buffer = buffer;
+  request.buffer_size = buffer_size;
+  request.priority = priority;
+
+  std::lock_guard<std::mutex> guard(mutex_);
+  const uint64_t request_id = next_request_id_;
+  request.sequence = request_id;
+  const uint64_t stored_size_bytes = request.location.stored_size_bytes;
+  try {
+    requests_.emplace(request_id, std::move(request));
+  } catch (const std::bad_alloc&) {
+    return ENGINE_NATIVE_STATUS_OUT_OF_MEMORY;
+  }
+
+  ++next_request_id_;
+  ++pending_count_;
+  pending_bytes_ += stored_size_bytes;
+  *out_request_id = request_id;
+  return ENGINE_NATIVE_STATUS_OK;
+}
+
+engine_native_status_t StreamingScheduler::SetPriority(uint64_t request_id,
+                                                       float priority) {
+  if (request_id == 0u || std::isnan(priority)) {
+    return ENGINE_NATIVE_STATUS_INVALID_ARGUMENT;
+  }
+
+  std::lock_guard<std::mutex> guard(mutex_);
+  auto it = requests_.find(request_id);
+  if (it == requests_.end()) {
+    return ENGINE_NATIVE_STATUS_NOT_FOUND;
+  }
+
+  if (it->second.read_id == 0u && it->second.priority != priority) {
+    it->second.priority = priority;
+    ++reprioritized_count_;
+  }
+  return ENGINE_NATIVE_STATUS_OK;
+}
+
+engine_native_status_t StreamingScheduler::Cancel(uint64_t request_id) {
+  if (request_id == 0u) {
+    return ENGINE_NATIVE_STATUS_INVALID_ARGUMENT;
+  }
+
+  uint64_t read_id = 0u;
+  {
+    std::lock_guard<std::mutex> guard(mutex_);
+    auto it = requests_.find(request_id);
+    if (it == requests_.end()) {
+      return ENGINE_NATIVE_STATUS_NOT_FOUND;
+    }
+
+    read_id = it->second.read_id;
+    if (read_id == 0u) {
+      --pending_count_;
+      pending_bytes_ -= it->second.location.stored_size_bytes;
+    }
+    requests_.erase(it);
+    ++cancelled_count_;
+  }
+
+  // Cancelling an issued read waits for an in-flight worker to finish with the
+  // caller's buffer, so it runs unlocked; the request is already gone, so
+  // Update and Poll never see it again.
+  if (read_id != 0u) {
+    const engine_native_status_t status = reads_.Cancel(read_id);
+    if (status != ENGINE_NATIVE_STATUS_OK &&
+        status != ENGINE_NATIVE_STATUS_NOT_FOUND) {
+      return status;
+    }
+  }
+  return ENGINE_NATIVE_STATUS_OK;
+}
+
+engine_native_status_t StreamingScheduler::Poll(
+    uint64_t request_id,
+    engine_native_content_read_result_t* out_result,
+    uint8_t* out_is_ready) {
+  if (request_id == 0u || out_result == nullptr || out_is_ready == nullptr) {
+    return ENGINE_NATIVE_STATUS_INVALID_ARGUMENT;
+  }
+
+  *out_result = engine_native_content_read_result_t{};
+  *out_is_ready = 0u;
+
+  std::lock_guard<std::mutex> guard(mutex_);
+  auto it = requests_.find(request_id);
+  if (it == requests_.end()) {
+    return ENGINE_NATIVE_STATUS_NOT_FOUND;
+  }
+
+  if (it->second.read_id == 0u) {
+    return ENGINE_NATIVE_STATUS_OK;
+  }
+
+  const engine_native_status_t status =
+      reads_.Poll(it->second.read_id, out_result, out_is_ready);
+  if (status == ENGINE_NATIVE_STATUS_NOT_FOUND) {
+    requests_.erase(it);
+    return status;
+  }
+  if (status != ENGINE_NATIVE_STATUS_OK || *out_is_ready == 0u) {
+    return status;
+  }
+
+  if (out_result->status == ENGINE_NATIVE_STATUS_OK) {
+    RecordCompletion(out_result->size);
+  }
+  ++completed_count_;
+  requests_.erase(it);
+  return ENGINE_NATIVE_STATUS_OK;
+}
+
+engine_native_status_t StreamingScheduler::SetFrameBudget(uint64_t budget_bytes) {
+  std::lock_guard<std::mutex> guard(mutex_);
+  frame_budget_bytes_ = budget_bytes;
+  return ENGINE_NATIVE_STATUS_OK;
+}
+
+engine_native_status_t StreamingScheduler::Update() {
+  std::lock_guard<std::mutex> guard(mutex_);
+  ++frame_count_;
+  last_frame_issued_count_ = 0u;
+  last_frame_issued_bytes_ = 0u;
+
+  const uint64_t now_ns = NowNs();
+  if (window_start_ns_ == 0u) {
+    window_start_ns_ = now_ns;
+  } else if (now_ns - window_start_ns_ >= kThroughputWindowNs) {
+    throughput_bytes_per_second_ = static_cast<uint64_t>(
+        static_cast<double>(window_bytes_) * 1e9 /
+        static_cast<double>(now_ns - window_start_ns_));
+    window_start_ns_ = now_ns;
+    window_bytes_ = 0u;
+  }
+
+  if (pending_count_ == 0u) {
+    return ENGINE_NATIVE_STATUS_OK;
+  }
+
+  scratch_ids_.clear();
+  try {
+    scratch_ids_.reserve(pending_count_);
+  } catch (const std::bad_alloc&) {
+    return ENGINE_NATIVE_STATUS_OUT_OF_MEMORY;
+  }
+  for (const auto& [request_id, request] : requests_) {
+    if (request.read_id == 0u) {
+      scratch_ids_.push_back(request_id);
+    }
+  }
+
+  std::sort(scratch_ids_.begin(), scratch_ids_.end(),
+            [this](uint64_t lhs, uint64_t rhs) {
+              const StreamRequest& a = requests_.at(lhs);
+              const StreamRequest& b = requests_.at(rhs);
+              if (a.priority != b.priority) {
+                return a.priority < b.priority;
+              }
+              return a.sequence < b.sequence;
+            });
+
+  size_t batch_count = 0u;
+  uint64_t batch_bytes = 0u;
+  for (const uint64_t request_id : scratch_ids_) {
+    const uint64_t bytes = requests_.at(request_id).location.stored_size_bytes;
+    if (batch_count > 0u && frame_budget_bytes_ != 0u &&
+        (batch_bytes >= frame_budget_bytes_ ||
+         bytes > frame_budget_bytes_ - batch_bytes)) {
+      break;
+    }
+    batch_bytes += bytes;
+    ++batch_count;
+  }
+  scratch_ids_.resize(batch_count);
+
+  std::sort(scratch_ids_.begin(), scratch_ids_.end(),
+            [this](uint64_t lhs, uint64_t rhs) {
+              const ContentLocation& a = requests_.at(lhs).location;
+              const ContentLocation& b = requests_.at(rhs).location;
+              if (a.source != b.source) {
+                return a.source < b.source;
+              }
+              if (a.mount_index != b.mount_index) {
+                return a.mount_index < b.mount_index;
+              }
+              if (a.offset_bytes != b.offset_bytes) {
+                return a.offset_bytes < b.offset_bytes;
+              }
+              return lhs < rhs;
+            });
+
+  for (const uint64_t request_id : scratch_ids_) {
+    StreamRequest& request = requests_.at(request_id);
+    std::string asset_path;
+    try {
+      asset_path = request.asset_path;
+    } catch (const std::bad_alloc&) {
+      return ENGINE_NATIVE_STATUS_OUT_OF_MEMORY;
+    }
+
+    const engine_native_status_t status =
+        reads_.Submit(std::move(asset_path), request.buffer,
+                      request.buffer_size, &request.read_id);
+    if (status != ENGINE_NATIVE_STATUS_OK) {
+      return status;
+    }
+
+    const uint64_t bytes = request.location.stored_size_bytes;
+    --pending_count_;
+    pending_bytes_ -= bytes;
+    ++last_frame_issued_count_;
+    last_frame_issued_bytes_ += bytes;
+    issued_bytes_ += bytes;
+  }
+
+  return ENGINE_NATIVE_STATUS_OK;
+}
+
+engine_native_status_t StreamingScheduler::GetStats(
+    engine_native_content_stream_stats_t* out_stats) const {
+  if (out_stats == nullptr) {
+    return ENGINE_NATIVE_STATUS_INVALID_ARGUMENT;
+  }
+
+  std::lock_guard<std::mutex> guard(mutex_);
+  *out_stats = engine_native_content_stream_stats_t{};
+  out_stats->pending_count = static_cast<uint32_t>(pending_count_);
+  out_stats->issued_count =
+      static_cast<uint32_t>(requests_.size() - pending_count_);
+  out_stats->last_frame_issued_count =
+      static_cast<uint32_t>(last_frame_issued_count_);
+  out_stats->pending_bytes = pending_bytes_;
+  out_stats->frame_budget_bytes = frame_budget_bytes_;
+  out_stats->last_frame_issued_bytes = last_frame_issued_bytes_;
+  out_stats->issued_bytes = issued_bytes_;
+  out_stats->completed_count = completed_count_;
+  out_stats->completed_bytes = completed_bytes_;
+  out_stats->cancelled_count = cancelled_count_;
+  out_stats->reprioritized_count = reprioritized_count_;
+  out_stats->frame_count = frame_count_;
+  out_stats->throughput_bytes_per_second = throughput_bytes_per_second_;
+  return ENGINE_NATIVE_STATUS_OK;
+}
+
+void StreamingScheduler::RecordCompletion(uint64_t bytes) {
+  completed_bytes_ += bytes;
+  window_bytes_ += bytes;
+}
+
+}  // namespace dff::native::content
@@ -0,0 +1,89 @@
+#ifndef DFF_ENGINE_NATIVE_CONTENT_STREAMING_SCHEDULER_H
+#define DFF_ENGINE_NATIVE_CONTENT_STREAMING_SCHEDULER_H
+
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "content/content_read_queue.h"
+#include "content/content_runtime.h"
+#include "engine_native.h"
+
+namespace dff::native::content {
+
+// Holds streaming requests until Update issues them to the read queue. Each
+// update takes pending requests in priority order until the frame budget of
+// stored bytes is spent, then submits that batch sorted by mount and offset so
+// the workers walk each pak front to back.
+class StreamingScheduler {
+ public:
+  static constexpr uint64_t kDefaultFrameBudgetBytes = uint64_t{16} << 20u;
+  static constexpr uint64_t kThroughputWindowNs = 250000000u;
+
+  StreamingScheduler(const ContentRuntime& runtime, ContentReadQueue& reads);
+
+  StreamingScheduler(const StreamingScheduler&) = delete;
+  StreamingScheduler& operator=(const StreamingScheduler&) = delete;
+
+  engine_native_status_t Request(std::string asset_path,
+                                 float priority,
+                                 void* buffer,
+                                 size_t buffer_size,
+                                 uint64_t* out_request_id);
+
+  engine_native_status_t SetPriority(uint64_t request_id, float priority);
+
+  engine_native_status_t Cancel(uint64_t request_id);
+
+  engine_native_status_t Poll(uint64_t request_id,
+                              engine_native_content_read_result_t* out_result,
+                              uint8_t* out_is_ready);
+
+  engine_native_status_t SetFrameBudget(uint64_t budget_bytes);
+
+  engine_native_status_t Update();
+
+  engine_native_status_t GetStats(
+      engine_native_content_stream_stats_t* out_stats) const;
+
+ private:
+  struct StreamRequest {
+    std::string asset_path;
+    void* buffer = nullptr;
+    size_t buffer_size = 0u;
+    float priority = 0.0f;
+    uint64_t sequence = 0u;
+    ContentLocation location;
+    uint64_t read_id = 0u;
+  };
+
+  void RecordCompletion(uint64_t bytes);
+
+  const ContentRuntime& runtime_;
+  ContentReadQueue& reads_;
+  mutable std::mutex mutex_;
+  std::unordered_map<uint64_t, StreamRequest> requests_;
+  std::vector<uint64_t> scratch_ids_;
+  uint64_t next_request_id_ = 1u;
+  uint64_t frame_budget_bytes_ = kDefaultFrameBudgetBytes;
+  size_t pending_count_ = 0u;
+  uint64_t pending_bytes_ = 0u;
+  size_t last_frame_issued_count_ = 0u;
+  uint64_t last_frame_issued_bytes_ = 0u;
+  uint64_t issued_bytes_ = 0u;
+  uint64_t completed_count_ = 0u;
+  uint64_t completed_bytes_ = 0u;
+  uint64_t cancelled_count_ = 0u;
+  uint64_t reprioritized_count_ = 0u;
+  uint64_t frame_count_ = 0u;
+  uint64_t window_start_ns_ = 0u;
+  uint64_t window_bytes_ = 0u;
+  uint64_t throughput_bytes_per_second_ = 0u;
+};
+
+}  // namespace dff::native::content
+
+#endif
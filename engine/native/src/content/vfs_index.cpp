@@ -0,0 +1,167 @@
+#include "content/vfs_index.h"
+
+#include <algorithm>
+#include <cstring>
+#include <new>
+#include <utility>
+
+namespace dff::native::content {
+
+namespace {
+
+constexpr size_t kMinSlotCount = 64u;
+
+size_t SlotCountFor(size_t entry_count) {
+  size_t slot_count = kMinSlotCount;
+  while (slot_count - slot_count / 4u < entry_count) {
+    slot_count *= 2u;
+  }
+
+  return slot_count;
+}
+
+}  // namespace
+
+engine_native_status_t VfsIndex::Reserve(size_t additional_entries,
+                                         size_t additional_keys) {
+  const size_t required = entries_.size() + additional_entries;
+  const size_t required_keys = key_entries_.size() + additional_keys;
+  try {
+    if (entries_.capacity() < required) {
+      entries_.reserve(std::max(required, entries_.capacity() * 2u));
+    }
+
+    const size_t slot_count = SlotCountFor(required);
+    if (slots_.size() < slot_count) {
+      std::vector<uint32_t> slots(slot_count, kEmptySlot);
+      Rehash(&slots);
+      slots_ = std::move(slots);
+    }
+
+    if (additional_keys != 0u) {
+      if (key_entries_.capacity() < required_keys) {
+        key_entries_.reserve(
+            std::max(required_keys, key_entries_.capacity() * 2u));
+      }
+
+      const size_t key_slot_count = SlotCountFor(required_keys);
+      if (key_slots_.size() < key_slot_count) {
+        std::vector<uint32_t> slots(key_slot_count, kEmptySlot);
+        RehashKeys(&slots);
+        key_slots_ = std::move(slots);
+      }
+    }
+  } catch (const std::bad_alloc&) {
+    return ENGINE_NATIVE_STATUS_OUT_OF_MEMORY;
+  }
+
+  return ENGINE_NATIVE_STATUS_OK;
+}
+
+void VfsIndex::Insert(std::string_view normalized_path,
+                      uint64_t path_hash,
+                      const VfsEntry& entry) {
+  const size_t slot = FindSlot(normalized_path, path_hash);
+  if (slots_[slot] != kEmptySlot) {
+    VfsEntry& existing = entries_[slots_[slot] - 1u].value;
+    if (existing.source == VfsSource::kPak &&
+        entry.source == VfsSource::kDirectory) {
+      return;
+    }
+
+    existing = entry;
+    return;
+  }
+
+  entries_.push_back(Entry{path_hash, normalized_path.data(),
+                           normalized_path.size(), entry});
+  slots_[slot] = static_cast<uint32_t>(entries_.size());
+}
+
+void VfsIndex::InsertKey(uint64_t asset_key, const VfsEntry& entry) {
+  if (asset_key == 0u) {
+    return;
+  }
+
+  const size_t slot = FindKeySlot(asset_key);
+  if (key_slots_[slot] != kEmptySlot) {
+    key_entries_[key_slots_[slot] - 1u].value = entry;
+    return;
+  }
+
+  key_entries_.push_back(KeyEntry{asset_key, entry});
+  key_slots_[slot] = static_cast<uint32_t>(key_entries_.size());
+}
+
+const VfsEntry* VfsIndex::Find(std::string_view normalized_path) const {
+  if (slots_.empty()) {
+    return nullptr;
+  }
+
+  const uint32_t index =
+      slots_[FindSlot(normalized_path, HashPakPath(normalized_path))];
+  return index == kEmptySlot ? nullptr : &entries_[index - 1u].value;
+}
+
+const VfsEntry* VfsIndex::FindKey(uint64_t asset_key) const {
+  if (key_slots_.empty() || asset_key == 0u) {
+    return nullptr;
+  }
+
+  const uint32_t index = key_slots_[FindKeySlot(asset_key)];
+  return index == kEmptySlot ? nullptr : &key_entries_[index - 1u].value;
+}
+
+size_t VfsIndex::FindSlot(std::string_view normalized_path,
+                          uint64_t path_hash) const {
+  const size_t mask = slots_.size() - 1u;
+  size_t slot = static_cast<size_t>(path_hash) & mask;
+  while (slots_[slot] != kEmptySlot) {
+    const Entry& candidate = entries_[slots_[slot] - 1u];
+    if (candidate.hash == path_hash &&
+        candidate.path_length == normalized_path.size() &&
+        std::memcmp(candidate.path, normalized_path.data(),
+                    normalized_path.size()) == 0) {
+      return slot;
+    }
+
+    slot = (slot + 1u) & mask;
+  }
+
+  return slot;
+}
+
+size_t VfsIndex::FindKeySlot(uint64_t asset_key) const {
+  const size_t mask = key_slots_.size() - 1u;
+  size_t slot = static_cast<size_t>(asset_key) & mask;
+  while (key_slots_[slot] != kEmptySlot &&
+         key_entries_[key_slots_[slot] - 1u].key != asset_key) {
+    slot = (slot + 1u) & mask;
+  }
+
+  return slot;
+}
+
+void VfsIndex::Rehash(std::vector<uint32_t>* slots) const {
+  const size_t mask = slots->size() - 1u;
+  for (size_t i = 0u; i < entries_.size(); ++i) {
+    size_t slot = static_cast<size_t>(entries_[i].hash) & mask;
+    while ((*slots)[slot] != kEmptySlot) {
+      slot = (slot + 1u) & mask;
+    }
+    (*slots)[slot] = static_cast<uint32_t>(i + 1u);
+  }
+}
+
+void VfsIndex::RehashKeys(std::vector<uint32_t>* slots) const {
+  const size_t mask = slots->size() - 1u;
+  for (size_t i = 0u; i < key_entries_.size(); ++i) {
+    size_t slot = static_cast<size_t>(key_entries_[i].key) & mask;
+    while ((*slots)[slot] != kEmptySlot) {
+      slot = (slot + 1u) & mask;
+    }
+    (*slots)[slot] = static_cast<uint32_t>(i + 1u);
+  }
+}
+
+}  // namespace dff::native::content
@@ -0,0 +1,78 @@
+#ifndef DFF_ENGINE_NATIVE_CONTENT_VFS_INDEX_H
+#define DFF_ENGINE_NATIVE_CONTENT_VFS_INDEX_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+#include "content/pak_index.h"
+#include "engine_native.h"
+
+namespace dff::native::content {
+
+enum class VfsSource : uint8_t {
+  kPak = 0u,
+  kDirectory = 1u,
+};
+
+struct VfsEntry {
+  VfsSource source = VfsSource::kPak;
+  uint32_t mount_index = 0u;
+  PakAssetEntry pak_entry;
+};
+
+// Merged path index over every mount. Paths are borrowed from storage owned by
+// the mounts. Pak entries take precedence over loose files and newer mounts of
+// the same kind replace older ones. Pak entries are also indexed by asset key,
+// where the newest mount carrying a key wins. Reserve does all allocation, so
+// inserting after a successful Reserve cannot fail and a mount is indexed all
+// or nothing.
+class VfsIndex {
+ public:
+  engine_native_status_t Reserve(size_t additional_entries,
+                                 size_t additional_keys = 0u);
+
+  void Insert(std::string_view normalized_path,
+              uint64_t path_hash,
+              const VfsEntry& entry);
+
+  // Key 0 means the entry has no asset key and is ignored.
+  void InsertKey(uint64_t asset_key, const VfsEntry& entry);
+
+  const VfsEntry* Find(std::string_view normalized_path) const;
+
+  const VfsEntry* FindKey(uint64_t asset_key) const;
+
+  size_t size() const { return entries_.size(); }
+  size_t key_count() const { return key_entries_.size(); }
+
+ private:
+  struct Entry {
+    uint64_t hash = 0u;
+    const char* path = nullptr;
+    size_t path_length = 0u;
+    VfsEntry value;
+  };
+
+  struct KeyEntry {
+    uint64_t key = 0u;
+    VfsEntry value;
+  };
+
+  static constexpr uint32_t kEmptySlot = 0u;
+
+  size_t FindSlot(std::string_view normalized_path, uint64_t path_hash) const;
+  size_t FindKeySlot(uint64_t asset_key) const;
+  void Rehash(std::vector<uint32_t>* slots) const;
+  void RehashKeys(std::vector<uint32_t>* slots) const;
+
+  std::vector<Entry> entries_;
+  std::vector<uint32_t> slots_;
+  std::vector<KeyEntry> key_entries_;
+  std::vector<uint32_t> key_slots_;
+};
+
+}  // namespace dff::native::content
+
+#endif
@@ -0,0 +1,223 @@
+#ifndef DFF_ENGINE_NATIVE_CONCURRENT_RESOURCE_TABLE_H
+#define DFF_ENGINE_NATIVE_CONCURRENT_RESOURCE_TABLE_H
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <limits>
+#include <mutex>
+#include <new>
+#include <utility>
+#include <vector>
+
+#include "core/resource_table.h"
+#include "engine_native.h"
+
+namespace dff::native {
+
+// Get is wait-free and may run on any thread: it checks the handle against a
+// generation published with release semantics after the value is built.
+// Insert and Remove are serialized by a writer mutex. Remove only unpublishes
+// the slot; the value is destroyed and the slot recycled by ReclaimRetired,
+// which the owner calls at a frame boundary once no reader can still hold a
+// pointer obtained before the removal.
+template <typename T>
+class ConcurrentResourceTable {
+ public:
+  static constexpr uint32_t kChunkShift = 10u;
+  static constexpr uint32_t kChunkSize = 1u << kChunkShift;
+  static constexpr uint32_t kMaxChunks = 4096u;
+
+  ConcurrentResourceTable() {
+    for (std::atomic<Chunk*>& chunk : chunks_) {
+      chunk.store(nullptr, std::memory_order_relaxed);
+    }
+  }
+
+  ~ConcurrentResourceTable() {
+    DestroyAll();
+    for (std::atomic<Chunk*>& chunk : chunks_) {
+      delete chunk.load(std::memory_order_relaxed);
+    }
+  }
+
+  ConcurrentResourceTable(const ConcurrentResourceTable&) = delete;
+  ConcurrentResourceTable& operator=(const ConcurrentResourceTable&) = delete;
+
+  engine_native_status_t Insert(T value, ResourceHandle* out_handle) {
+    if (out_handle == nullptr) {
+      return ENGINE_NATIVE_STATUS_INVALID_ARGUMENT;
+    }
+
+    std::lock_guard<std::mutex> lock(writer_mutex_);
+    try {
+      if (free_indices_.empty()) {
+        if (chunk_count_ >= kMaxChunks) {
+          return ENGINE_NATIVE_STATUS_INTERNAL_ERROR;
+        }
+
+        const size_t slot_count = static_cast<size_t>(chunk_count_ + 1u)
+                                  << kChunkShift;
+        if (free_indices_.capacity() < slot_count) {
+          free_indices_.reserve(
+              std::max(slot_count, free_indices_.capacity() * 2u));
+        }
+        if (retired_indices_.capacity() < slot_count) {
+          retired_indices_.reserve(
+              std::max(slot_count, retired_indices_.capacity() * 2u));
+        }
+        Chunk* chunk = new Chunk();
+        chunks_[chunk_count_].store(chunk, std::memory_order_release);
+        const uint32_t chunk_base = chunk_count_ << kChunkShift;
+        ++chunk_count_;
+        for (uint32_t offset = kChunkSize; offset > 0u; --offset) {
+          free_indices_.push_back(chunk_base + offset - 1u);
+        }
+      }
+
+      const uint32_t index = free_indices_.back();
+      Slot& slot = SlotAt(index);
+      ::new (static_cast<void*>(slot.bytes)) T(std::move(value));
+      free_indices_.pop_back();
+      slot.live_generation.store(slot.generation, std::memory_order_release);
+      size_.fetch_add(1u, std::memory_order_relaxed);
+      *out_handle = ResourceHandle{.index = index, .generation = slot.generation};
+      return ENGINE_NATIVE_STATUS_OK;
+    } catch (const std::bad_alloc&) {
+      return ENGINE_NATIVE_STATUS_OUT_OF_MEMORY;
+    }
+  }
+
+  bool Remove(ResourceHandle handle) {
+    std::lock_guard<std::mutex> lock(writer_mutex_);
+    Slot* slot = FindLiveSlot(handle);
+    if (slot == nullptr) {
+      return false;
+    }
+
+    slot->live_generation.store(0u, std::memory_order_release);
+    slot->generation = NextGeneration(slot->generation);
+    retired_indices_.push_back(handle.index);
+    size_.fetch_sub(1u, std::memory_order_relaxed);
+    return true;
+  }
+
+  T* Get(ResourceHandle handle) {
+    Slot* slot = FindLiveSlot(handle);
+    return slot != nullptr ? ValueOf(slot) : nullptr;
+  }
+
+  const T* Get(ResourceHandle handle) const {
+    const Slot* slot = FindLiveSlot(handle);
+    return slot != nullptr ? ValueOf(slot) : nullptr;
+  }
+
+  size_t ReclaimRetired() {
+    std::lock_guard<std::mutex> lock(writer_mutex_);
+    const size_t reclaimed = retired_indices_.size();
+    for (const uint32_t index : retired_indices_) {
+      ValueOf(&SlotAt(index))->~T();
+      free_indices_.push_back(index);
+    }
+    retired_indices_.clear();
+    return reclaimed;
+  }
+
+  void Clear() {
+    std::lock_guard<std::mutex> lock(writer_mutex_);
+    DestroyAll();
+
+    free_indices_.clear();
+    const uint32_t slot_count = chunk_count_ << kChunkShift;
+    for (uint32_t index = 0u; index < slot_count; ++index) {
+      free_indices_.push_back(slot_count - index - 1u);
+    }
+  }
+
+  size_t Size() const { return size_.load(std::memory_order_relaxed); }
+
+  size_t retired_count() const {
+    std::lock_guard<std::mutex> lock(writer_mutex_);
+    return retired_indices_.size();
+  }
+
+ private:
+  struct Slot {
+    alignas(T) unsigned char bytes[sizeof(T)];
+    std::atomic<uint32_t> live_generation{0u};
+    uint32_t generation = 1u;
+  };
+
+  struct Chunk {
+    Slot slots[kChunkSize];
+  };
+
+  static uint32_t NextGeneration(uint32_t generation) {
+    return generation == std::numeric_limits<uint32_t>::max() ? 1u
+                                                              : generation + 1u;
+  }
+
+  static T* ValueOf(Slot* slot) {
+    return std::launder(reinterpret_cast<T*>(slot->bytes));
+  }
+
+  static const T* ValueOf(const Slot* slot) {
+    return std::launder(reinterpret_cast<const T*>(slot->bytes));
+  }
+
+  Slot& SlotAt(uint32_t index) {
+    return chunks_[index >> kChunkShift].load(std::memory_order_relaxed)
+        ->slots[index & (kChunkSize - 1u)];
+  }
+
+  Slot* FindLiveSlot(ResourceHandle handle) const {
+    const uint32_t chunk_index = handle.index >> kChunkShift;
+    if (handle.generation == 0u || chunk_index >= kMaxChunks) {
+      return nullptr;
+    }
+
+    Chunk* chunk = chunks_[chunk_index].load(std::memory_order_acquire);
+    if (chunk == nullptr) {
+      return nullptr;
+    }
+
+    Slot& slot = chunk->slots[handle.index & (kChunkSize - 1u)];
+    if (slot.live_generation.load(std::memory_order_acquire) !=
+        handle.generation) {
+      return nullptr;
+    }
+
+    return &slot;
+  }
+
+  void DestroyAll() {
+    for (uint32_t chunk_index = 0u; chunk_index < chunk_count_; ++chunk_index) {
+      Chunk* chunk = chunks_[chunk_index].load(std::memory_order_relaxed);
+      for (Slot& slot : chunk->slots) {
+        if (slot.live_generation.load(std::memory_order_relaxed) != 0u) {
+          slot.live_generation.store(0u, std::memory_order_release);
+          slot.generation = NextGeneration(slot.generation);
+          ValueOf(&slot)->~T();
+        }
+      }
+    }
+
+    for (const uint32_t index : retired_indices_) {
+      ValueOf(&SlotAt(index))->~T();
+    }
+    retired_indices_.clear();
+    size_.store(0u, std::memory_order_relaxed);
+  }
+
+  mutable std::mutex writer_mutex_;
+  std::array<std::atomic<Chunk*>, kMaxChunks> chunks_;
+  uint32_t chunk_count_ = 0u;
+  std::atomic<size_t> size_{0u};
+  std::vector<uint32_t> free_indices_;
+  std::vector<uint32_t> retired_indices_;
+};
+
+}  // namespace dff::native
+
+#endif
@@ -1,6 +1,7 @@
 #include "core/engine_state.h"
 
 #include <algorithm>
+#include <atomic>
 #include <cctype>
 #include <cmath>
 #include <cstdint>
@@ -22,6 +23,10 @@
 
 #include "render/frame_graph_builder.h"
 
+#ifndef DFF_NATIVE_BUILD_ID
+#define DFF_NATIVE_BUILD_ID "dev"
+#endif
+
 namespace dff::native {
 
 namespace {
@@ -46,6 +51,10 @@ constexpr size_t kMeshBlobIndexDataSizeOffset = sizeof(uint32_t) * 5u;
 constexpr size_t kMeshCpuIndexCountOffset = sizeof(uint32_t) * 2u;
 constexpr const char* kPipelineCachePathEnv = "DFF_PIPELINE_CACHE_PATH";
 constexpr const char* kRenderBackendEnv = "DFF_RENDER_BACKEND";
+constexpr const char* kFrameArenaDepthEnv = "DFF_FRAME_ARENA_DEPTH";
+constexpr const char* kPipelineCacheSaveIntervalEnv =
+    "DFF_PIPELINE_CACHE_SAVE_INTERVAL";
+constexpr uint32_t kDefaultPipelineCacheSaveIntervalFrames = 1800u;
 
 const char* PassNameForKind(rhi::RhiDevice::PassKind pass_kind) {
   switch (pass_kind) {
@@ -129,6 +138,28 @@ bool HasValidUiScissor(const engine_native_ui_draw_item_t& item) {
          IsFiniteNonNegative(item.scissor_height);
 }
 
+bool TryAddCounter(std::atomic<uint64_t>* counter, uint64_t value) {
+  uint64_t current = counter->load(std::memory_order_relaxed);
+  do {
+    if (value > std::numeric_limits<uint64_t>::max() - current) {
+      return false;
+    }
+  } while (!counter->compare_exchange_weak(current, current + value,
+                                           std::memory_order_relaxed));
+  return true;
+}
+
+bool TrySubtractCounter(std::atomic<uint64_t>* counter, uint64_t value) {
+  uint64_t current = counter->load(std::memory_order_relaxed);
+  do {
+    if (value > current) {
+      return false;
+    }
+  } while (!counter->compare_exchange_weak(current, current - value,
+                                           std::memory_order_relaxed));
+  return true;
+}
+
 std::string ResolveEnvironmentValue(const char* variable_name) {
   if (variable_name == nullptr || variable_name[0] == '\0') {
     return {};
@@ -193,6 +224,57 @@ rhi::RhiDevice::BackendKind ResolveRenderBackendKind() {
   return rhi::RhiDevice::BackendKind::kVulkan;
 }
 
+size_t ResolveFrameArenaDepth() {
+  const std::string configured_depth = ResolveEnvironmentValue(kFrameArenaDepthEnv);
+  if (configured_depth.empty()) {
+    return render::FrameArenaRing::kDefaultDepth;
+  }
+
+  char* parse_end = nullptr;
+  const unsigned long depth = std::strtoul(configured_depth.c_str(), &parse_end, 10);
+  if (parse_end == configured_depth.c_str() || *parse_end != '\0' || depth == 0u ||
+      depth > render::FrameArenaRing::kMaxDepth) {
+    return render::FrameArenaRing::kDefaultDepth;
+  }
+
+  return static_cast<size_t>(depth);
+}
+
+uint32_t ResolvePipelineCacheSaveInterval() {
+  const std::string configured_interval =
+      ResolveEnvironmentValue(kPipelineCacheSaveIntervalEnv);
+  if (configured_interval.empty()) {
+    return kDefaultPipelineCacheSaveIntervalFrames;
+  }
+
+  char* parse_end = nullptr;
+  const unsigned long interval =
+      std::strtoul(configured_interval.c_str(), &parse_end, 10);
+  if (parse_end == configured_interval.c_str() || *parse_end != '\0' ||
+      interval > std::numeric_limits<uint32_t>::max()) {
+    return kDefaultPipelineCacheSaveIntervalFrames;
+  }
+
+  return static_cast<uint32_t>(interval);
+}
+
+uint64_t ComputeBuildFingerprint() {
+  uint64_t hash = 0xCBF29CE484222325ull;
+  auto mix = [&hash](const void* data, size_t size) {
+    const auto* bytes = static_cast<const uint8_t*>(data);
+    for (size_t i = 0u; i < size; ++i) {
+      hash ^= bytes[i];
+      hash *= 0x100000001B3ull;
+    }
+  };
+
+  constexpr uint32_t kApiVersion = ENGINE_NATIVE_API_VERSION;
+  constexpr std::string_view kBuildId = DFF_NATIVE_BUILD_ID;
+  mix(&kApiVersion, sizeof(kApiVersion));
+  mix(kBuildId.data(), kBuildId.size());
+  return hash;
+}
+
 bool IsSupportedDebugViewMode(uint8_t mode) {
   return mode == ENGINE_NATIVE_DEBUG_VIEW_NONE ||
          mode == ENGINE_NATIVE_DEBUG_VIEW_DEPTH ||
@@ -211,6 +293,12 @@ bool IsSupportedRenderFeatureFlags(uint8_t flags) {
   return (flags & static_cast<uint8_t>(~kSupportedFlags)) == 0u;
 }
 
+bool IsSupportedRenderPacketFlags(uint8_t flags) {
+  constexpr uint8_t kSupportedFlags =
+      ENGINE_NATIVE_RENDER_PACKET_FLAG_DRAW_ITEMS_IN_FRAME_MEMORY;
+  return (flags & static_cast<uint8_t>(~kSupportedFlags)) == 0u;
+}
+
 uint32_t ExtractMaterialFeatureFlags(
     const engine_native_draw_item_t& draw_item) {
   return draw_item.sort_key_high & 0x7u;
@@ -370,10 +458,17 @@ bool IsValidResourceBlob(RendererState::ResourceKind kind,
 EngineState::EngineState() {
   rhi_device.SetBackendKind(ResolveRenderBackendKind());
   renderer.AttachDevice(&rhi_device);
+  static_cast<void>(renderer.SetFrameArenaDepth(ResolveFrameArenaDepth()));
+  renderer.SetPipelineCacheFingerprint(rhi::PipelineCacheFingerprint{
+      .build_id = ComputeBuildFingerprint(),
+      .backend_kind = static_cast<uint32_t>(rhi_device.backend_kind()),
+  });
   const std::string cache_path = ResolvePipelineCachePath();
   if (!cache_path.empty()) {
     pipeline_cache_path = cache_path;
     renderer.LoadPipelineCacheFromDisk(pipeline_cache_path.c_str());
+    renderer.SetPipelineCacheAutosave(pipeline_cache_path,
+                                      ResolvePipelineCacheSaveInterval());
   }
 }
 
@@ -412,33 +507,29 @@ engine_native_status_t RendererState::BeginFrame(size_t requested_bytes,
     return ENGINE_NATIVE_STATUS_INVALID_ARGUMENT;
   }
 
-  const size_t storage_size = requested_bytes + (alignment - static_cast<size_t>(1u));
-
-  try {
-    frame_storage_.assign(storage_size, static_cast<uint8_t>(0u));
-  } catch (const std::bad_alloc&) {
-    return ENGINE_NATIVE_STATUS_OUT_OF_MEMORY;
-  }
-
-  if (frame_storage_.empty()) {
-    return ENGINE_NATIVE_STATUS_INTERNAL_ERROR;
+  void* arena_memory = nullptr;
+  const engine_native_status_t acquire_status =
+      frame_arenas_.Acquire(requested_bytes, alignment, &arena_memory);
+  if (acquire_status != ENGINE_NATIVE_STATUS_OK) {
+    return acquire_status;
   }
 
-  uintptr_t base = reinterpret_cast<uintptr_t>(frame_storage_.data());
-  const uintptr_t aligned =
-      (base + static_cast<uintptr_t>(alignment - static_cast<size_t>(1u))) &
-      ~static_cast<uintptr_t>(alignment - static_cast<size_t>(1u));
-
-  frame_memory_ = reinterpret_cast<void*>(aligned);
+  frame_memory_ = arena_memory;
   frame_capacity_ = requested_bytes;
   submitted_draw_count_ = 0u;
   submitted_ui_count_ = 0u;
   submitted_draw_items_.clear();
+  referenced_draw_spans_.clear();
   submitted_ui_items_.clear();
   submitted_debug_view_mode_ = ENGINE_NATIVE_DEBUG_VIEW_NONE;
   submitted_render_feature_flags_ = 0u;
   last_executed_rhi_passes_.clear();
   last_pass_mask_ = 0u;
+  pipeline_memo_.BeginFrame();
+  if (prewarm_first_frame_ == PrewarmFirstFrame::kAwaitingPrewarm) {
+    prewarm_first_frame_ = PrewarmFirstFrame::kMeasuring;
+    prewarm_first_frame_misses_at_begin_ = pipeline_cache_.miss_count();
+  }
 
   engine_native_status_t status = rhi_device_->BeginFrame();
   if (status != ENGINE_NATIVE_STATUS_OK) {
@@ -458,6 +549,45 @@ engine_native_status_t RendererState::BeginFrame(size_t requested_bytes,
   return ENGINE_NATIVE_STATUS_OK;
 }
 
+engine_native_status_t RendererState::ResizeFrame(size_t requested_bytes,
+                                                  size_t alignment,
+                                                  void** out_frame_memory) {
+  if (out_frame_memory == nullptr) {
+    return ENGINE_NATIVE_STATUS_INVALID_ARGUMENT;
+  }
+
+  *out_frame_memory = nullptr;
+
+  // Nothing may reference the current arena, so only an empty frame regrows.
+  if (!frame_open_ || submitted_draw_count_ != 0u || submitted_ui_count_ != 0u) {
+    return ENGINE_NATIVE_STATUS_INVALID_STATE;
+  }
+
+  if (requested_bytes == 0u || !IsPowerOfTwo(alignment)) {
+    return ENGINE_NATIVE_STATUS_INVALID_ARGUMENT;
+  }
+
+  if (requested_bytes >
+      std::numeric_limits<size_t>::max() - (alignment - static_cast<size_t>(1u))) {
+    return ENGINE_NATIVE_STATUS_INVALID_ARGUMENT;
+  }
+
+  frame_arenas_.Release();
+  void* arena_memory = nullptr;
+  const engine_native_status_t acquire_status =
+      frame_arenas_.Acquire(requested_bytes, alignment, &arena_memory);
+  if (acquire_status != ENGINE_NATIVE_STATUS_OK) {
+    static_cast<void>(rhi_device_->EndFrame());
+    ResetFrameState();
+    return acquire_status;
+  }
+
+  frame_memory_ = arena_memory;
+  frame_capacity_ = requested_bytes;
+  *out_frame_memory = frame_memory_;
+  return ENGINE_NATIVE_STATUS_OK;
+}
+
 engine_native_status_t RendererState::Submit(
     const engine_native_render_packet_t& packet) {
   if (!frame_open_) {
@@ -473,8 +603,19 @@ engine_native_status_t RendererState::Submit(
   if (!IsSupportedDebugViewMode(packet.debug_view_mode)) {
     return ENGINE_NATIVE_STATUS_INVALID_ARGUMENT;
   }
-  if (packet.reserved1 != 0u || packet.reserved2 != 0u ||
-      !IsSupportedRenderFeatureFlags(packet.reserved0)) {
+  if (packet.reserved2 != 0u ||
+      !IsSupportedRenderFeatureFlags(packet.reserved0) ||
+      !IsSupportedRenderPacketFlags(packet.reserved1)) {
+    return ENGINE_NATIVE_STATUS_INVALID_ARGUMENT;
+  }
+
+  const bool draw_items_in_frame_memory =
+      (packet.reserved1 &
+       ENGINE_NATIVE_RENDER_PACKET_FLAG_DRAW_ITEMS_IN_FRAME_MEMORY) != 0u;
+  if (draw_items_in_frame_memory && packet.draw_item_count > 0u &&
+      !frame_arenas_.Contains(packet.draw_items,
+                              static_cast<size_t>(packet.draw_item_count) *
+                                  sizeof(engine_native_draw_item_t))) {
     return ENGINE_NATIVE_STATUS_INVALID_ARGUMENT;
   }
 
@@ -523,11 +664,16 @@ engine_native_status_t RendererState::Submit(
   }
 
   if (packet.draw_item_count > 0u) {
-    const size_t old_size = submitted_draw_items_.size();
-    const size_t added = static_cast<size_t>(packet.draw_item_count);
-    submitted_draw_items_.resize(old_size + added);
-    std::copy_n(packet.draw_items, packet.draw_item_count,
-                submitted_draw_items_.data() + old_size);
+    if (draw_items_in_frame_memory) {
+      referenced_draw_spans_.emplace_back(packet.draw_items,
+                                          packet.draw_item_count);
+    } else {
+      const size_t old_size = submitted_draw_items_.size();
+      const size_t added = static_cast<size_t>(packet.draw_item_count);
+      submitted_draw_items_.resize(old_size + added);
+      std::copy_n(packet.draw_items, packet.draw_item_count,
+                  submitted_draw_items_.data() + old_size);
+    }
 
     for (uint32_t i = 0u; i < packet.draw_item_count; ++i) {
       const engine_native_draw_item_t& draw_item = packet.draw_items[i];
@@ -536,6 +682,10 @@ engine_native_status_t RendererState::Submit(
       }
 
       const uint32_t feature_flags = ExtractMaterialFeatureFlags(draw_item);
+      if (pipeline_memo_.Find(draw_item.material, feature_flags) != nullptr) {
+        continue;
+      }
+
       const engine_native_status_t register_status =
           material_system_.RegisterMaterial(draw_item.material, feature_flags);
       if (register_status != ENGINE_NATIVE_STATUS_OK) {
@@ -550,7 +700,12 @@ engine_native_status_t RendererState::Submit(
         return resolve_status;
       }
 
-      pipeline_cache_.GetOrCreate(ComposePipelineKey(draw_item.material, variant));
+      const engine_native_status_t memo_status = pipeline_memo_.Insert(
+          draw_item.material, feature_flags,
+          pipeline_cache_.GetOrCreate(ComposePipelineKey(draw_item.material, variant)));
+      if (memo_status != ENGINE_NATIVE_STATUS_OK) {
+        return memo_status;
+      }
     }
   }
 
@@ -656,7 +811,12 @@ engine_native_status_t RendererState::Present() {
     return ENGINE_NATIVE_STATUS_INVALID_STATE;
   }
 
-  engine_native_status_t status = BuildFrameGraph();
+  engine_native_status_t status = SortSubmittedDrawItems();
+  if (status != ENGINE_NATIVE_STATUS_OK) {
+    return status;
+  }
+
+  status = BuildFrameGraph();
   if (status != ENGINE_NATIVE_STATUS_OK) {
     return status;
   }
@@ -681,11 +841,48 @@ engine_native_status_t RendererState::Present() {
   last_frame_stats_.pipeline_cache_misses = pipeline_cache_misses();
   last_frame_stats_.pass_mask = last_pass_mask_;
   last_frame_stats_.triangle_count = ComputeSubmittedTriangleCount();
-  last_frame_stats_.upload_bytes = resource_upload_bytes_pending_;
-  last_frame_stats_.gpu_memory_bytes = resource_gpu_memory_bytes_;
-  resource_upload_bytes_pending_ = 0u;
+  last_frame_stats_.upload_bytes =
+      resource_upload_bytes_pending_.exchange(0u, std::memory_order_relaxed);
+  last_frame_stats_.gpu_memory_bytes =
+      resource_gpu_memory_bytes_.load(std::memory_order_relaxed);
+  last_frame_stats_.frame_arena_reuse_count = frame_arenas_.reuse_count();
+  last_frame_stats_.frame_arena_grow_count = frame_arenas_.grow_count();
+  last_frame_stats_.frame_arena_high_water_bytes =
+      frame_arenas_.high_water_mark_bytes();
+  last_frame_stats_.frame_arena_reserved_bytes = frame_arenas_.reserved_bytes();
+  last_frame_stats_.frame_graph_cache_hits = frame_graph_cache_.hit_count();
+  last_frame_stats_.frame_graph_cache_misses = frame_graph_cache_.miss_count();
+  last_frame_stats_.culled_pass_mask = compiled_frame_graph_->culled_pass_mask;
+  last_frame_stats_.pass_record_cpu_ns = 0u;
+  for (uint64_t pass_cpu_ns : pass_cpu_ns_) {
+    last_frame_stats_.pass_record_cpu_ns += pass_cpu_ns;
+  }
+  last_frame_stats_.pass_record_level_count = pass_recorder_.last_level_count();
+  last_frame_stats_.pass_record_max_parallel_passes =
+      pass_recorder_.last_max_level_width();
+  last_frame_stats_.transient_naive_bytes =
+      compiled_frame_graph_->aliasing_plan.naive_bytes;
+  last_frame_stats_.transient_aliased_bytes =
+      compiled_frame_graph_->aliasing_plan.aliased_bytes;
+  last_frame_stats_.draw_sort_cpu_ns = draw_sorter_.last_sort_cpu_ns();
+  last_frame_stats_.draw_batch_count =
+      static_cast<uint32_t>(draw_sorter_.batches().size());
+  last_frame_stats_.draw_batch_max_instances =
+      draw_sorter_.max_batch_instance_count();
+  last_frame_stats_.material_resolve_lookups = pipeline_memo_.lookup_count();
+  last_frame_stats_.material_resolve_unique = pipeline_memo_.unique_count();
+
+  if (prewarm_first_frame_ == PrewarmFirstFrame::kMeasuring) {
+    prewarm_first_frame_miss_count_ = static_cast<uint32_t>(std::min<uint64_t>(
+        pipeline_cache_.miss_count() - prewarm_first_frame_misses_at_begin_,
+        std::numeric_limits<uint32_t>::max()));
+    prewarm_first_frame_ = PrewarmFirstFrame::kMeasured;
+  }
 
   ResetFrameState();
+  RemoveRetiredMaterials();
+  static_cast<void>(resources_.ReclaimRetired());
+  MaybeSchedulePipelineCacheSave();
   return ENGINE_NATIVE_STATUS_OK;
 }
 
@@ -840,18 +1037,22 @@ engine_native_status_t RendererState::DestroyResource(
     return ENGINE_NATIVE_STATUS_NOT_FOUND;
   }
 
+  // The material system and pipeline memo belong to the render thread; a
+  // destroy from any other thread is queued and applied at Present.
   if (blob->kind == ResourceKind::kMaterial) {
-    material_system_.RemoveMaterial(handle);
+    std::lock_guard<std::mutex> guard(retired_materials_mutex_);
+    retired_materials_.push_back(handle);
   }
 
   const uint64_t blob_size = static_cast<uint64_t>(blob->bytes.size());
-  if (blob_size > resource_gpu_memory_bytes_) {
+  if (!resources_.Remove(resource_handle)) {
+    return ENGINE_NATIVE_STATUS_NOT_FOUND;
+  }
+  if (!TrySubtractCounter(&resource_gpu_memory_bytes_, blob_size)) {
     return ENGINE_NATIVE_STATUS_INTERNAL_ERROR;
   }
-  resource_gpu_memory_bytes_ -= blob_size;
 
-  return resources_.Remove(resource_handle) ? ENGINE_NATIVE_STATUS_OK
-                                            : ENGINE_NATIVE_STATUS_NOT_FOUND;
+  return ENGINE_NATIVE_STATUS_OK;
 }
 
 engine_native_status_t RendererState::CreateResourceFromBlob(
@@ -896,15 +1097,16 @@ engine_native_status_t RendererState::CreateResourceFromBlob(
   }
 
   const uint64_t blob_size = static_cast<uint64_t>(size);
-  if (blob_size > std::numeric_limits<uint64_t>::max() - resource_gpu_memory_bytes_ ||
-      blob_size >
-          std::numeric_limits<uint64_t>::max() - resource_upload_bytes_pending_) {
+  if (!TryAddCounter(&resource_gpu_memory_bytes_, blob_size)) {
+    static_cast<void>(resources_.Remove(resource_handle));
+    return ENGINE_NATIVE_STATUS_INTERNAL_ERROR;
+  }
+  if (!TryAddCounter(&resource_upload_bytes_pending_, blob_size)) {
+    static_cast<void>(TrySubtractCounter(&resource_gpu_memory_bytes_, blob_size));
     static_cast<void>(resources_.Remove(resource_handle));
     return ENGINE_NATIVE_STATUS_INTERNAL_ERROR;
   }
 
-  resource_gpu_memory_bytes_ += blob_size;
-  resource_upload_bytes_pending_ += blob_size;
   *out_handle = EncodeResourceHandle(resource_handle);
   return ENGINE_NATIVE_STATUS_OK;
 }
@@ -913,69 +1115,84 @@ engine_native_status_t RendererState::BuildFrameGraph() {
   render::FrameGraphBuildConfig build_config{
       .has_draws = submitted_draw_count_ > 0u,
       .has_ui = submitted_ui_count_ > 0u,
-      .debug_view_mode = submitted_debug_view_mode_};
-  render::FrameGraphBuildOutput build_output;
-  std::string compile_error;
-  const engine_native_status_t status = render::BuildCanonicalFrameGraph(
-      build_config, &frame_graph_, &build_output, &compile_error);
-  if (status != ENGINE_NATIVE_STATUS_OK) {
-    return status;
-  }
-
-  compiled_pass_order_ = std::move(build_output.pass_order);
-  pass_kinds_by_id_ = std::move(build_output.pass_kinds_by_id);
-  return ENGINE_NATIVE_STATUS_OK;
+      .debug_view_mode = submitted_debug_view_mode_,
+      .render_feature_flags = submitted_render_feature_flags_,
+      .target_width = render_target_width_,
+      .target_height = render_target_height_};
+  return frame_graph_cache_.GetOrBuild(build_config, &compiled_frame_graph_);
 }
 
 engine_native_status_t RendererState::ExecuteCompiledFrameGraph() {
-  if (rhi_device_ == nullptr) {
+  if (rhi_device_ == nullptr || compiled_frame_graph_ == nullptr) {
     return ENGINE_NATIVE_STATUS_INVALID_STATE;
   }
 
+  engine_native_status_t status = pass_recorder_.Record(
+      *compiled_frame_graph_, &pass_command_lists_, &pass_cpu_ns_);
+  if (status != ENGINE_NATIVE_STATUS_OK) {
+    return status;
+  }
+
   last_executed_rhi_passes_.clear();
-  last_executed_rhi_passes_.reserve(compiled_pass_order_.size());
+  last_executed_rhi_passes_.reserve(compiled_frame_graph_->pass_order.size());
   uint64_t pass_mask = 0u;
 
-  for (render::RenderPassId pass_id : compiled_pass_order_) {
-    const size_t pass_index = static_cast<size_t>(pass_id);
-    if (pass_index >= pass_kinds_by_id_.size()) {
-      return ENGINE_NATIVE_STATUS_INTERNAL_ERROR;
-    }
-
-    const rhi::RhiDevice::PassKind pass_kind = pass_kinds_by_id_[pass_index];
-    const engine_native_status_t status = rhi_device_->ExecutePass(pass_kind);
+  for (size_t position = 0u; position < compiled_frame_graph_->pass_order.size();
+       ++position) {
+    const rhi::RhiCommandList& command_list = pass_command_lists_[position];
+    status = rhi_device_->SubmitCommandList(command_list);
     if (status != ENGINE_NATIVE_STATUS_OK) {
       return status;
     }
 
-    pass_mask |= static_cast<uint64_t>(1u)
-                 << static_cast<uint32_t>(pass_kind);
-    last_executed_rhi_passes_.push_back(PassNameForKind(pass_kind));
+    for (rhi::RhiDevice::PassKind pass_kind : command_list.passes()) {
+      pass_mask |= static_cast<uint64_t>(1u)
+                   << static_cast<uint32_t>(pass_kind);
+      last_executed_rhi_passes_.push_back(PassNameForKind(pass_kind));
+    }
   }
 
   last_pass_mask_ = pass_mask;
   return ENGINE_NATIVE_STATUS_OK;
 }
 
+engine_native_status_t RendererState::SortSubmittedDrawItems() {
+  draw_sorter_.Reset();
+  engine_native_status_t status = draw_sorter_.Append(submitted_draw_items_);
+  if (status != ENGINE_NATIVE_STATUS_OK) {
+    return status;
+  }
+
+  for (const auto& span : referenced_draw_spans_) {
+    status = draw_sorter_.Append(span);
+    if (status != ENGINE_NATIVE_STATUS_OK) {
+      return status;
+    }
+  }
+
+  return draw_sorter_.SortAndBatch();
+}
+
 uint64_t RendererState::ComputeSubmittedTriangleCount() const {
   uint64_t total_triangles = 0u;
 
-  for (const engine_native_draw_item_t& draw_item : submitted_draw_items_) {
-    if (draw_item.mesh == kInvalidResourceHandle) {
+  for (const render::DrawBatch& batch : draw_sorter_.batches()) {
+    if (batch.mesh == kInvalidResourceHandle) {
       continue;
     }
 
-    const ResourceBlob* mesh_blob = resources_.Get(DecodeResourceHandle(draw_item.mesh));
+    const ResourceBlob* mesh_blob = resources_.Get(DecodeResourceHandle(batch.mesh));
     if (mesh_blob == nullptr || mesh_blob->kind != ResourceKind::kMesh) {
       continue;
     }
 
-    if (mesh_blob->triangle_count >
-        std::numeric_limits<uint64_t>::max() - total_triangles) {
+    if (mesh_blob->triangle_count != 0u &&
+        batch.instance_count > (std::numeric_limits<uint64_t>::max() - total_triangles) /
+                                   mesh_blob->triangle_count) {
       return std::numeric_limits<uint64_t>::max();
     }
 
-    total_triangles += mesh_blob->triangle_count;
+    total_triangles += mesh_blob->triangle_count * batch.instance_count;
   }
 
   return total_triangles;
@@ -991,14 +1208,150 @@ engine_native_status_t RendererState::GetLastFrameStats(
   return ENGINE_NATIVE_STATUS_OK;
 }
 
+engine_native_status_t RendererState::PrewarmPipelines(
+    const engine_native_pipeline_prewarm_item_t* items,
+    uint32_t item_count) {
+  if (item_count > 0u && items == nullptr) {
+    return ENGINE_NATIVE_STATUS_INVALID_ARGUMENT;
+  }
+
+  // Composing a variant is a few bit operations and the noop backend has no
+  // pipeline compile to overlap, so items resolve on the calling thread.
+  for (const engine_native_pipeline_prewarm_item_t& item :
+       std::span(items, item_count)) {
+    ++prewarm_requested_count_;
+    if (!IsLiveMaterial(item.material) ||
+        material_system_.RegisterMaterial(item.material, item.feature_flags) !=
+            ENGINE_NATIVE_STATUS_OK) {
+      ++prewarm_rejected_count_;
+      continue;
+    }
+
+    ++prewarm_resolved_count_;
+    const render::ShaderVariantKey variant = render::MaterialSystem::ComposeVariant(
+        item.feature_flags, /*shadows_enabled=*/true);
+    if (!pipeline_cache_.Prewarm(ComposePipelineKey(item.material, variant))) {
+      ++prewarm_already_cached_count_;
+    }
+  }
+
+  prewarm_first_frame_ = PrewarmFirstFrame::kAwaitingPrewarm;
+  prewarm_first_frame_miss_count_ = 0u;
+  return ENGINE_NATIVE_STATUS_OK;
+}
+
+engine_native_status_t RendererState::GetPipelinePrewarmProgress(
+    engine_native_pipeline_prewarm_progress_t* out_progress) {
+  if (out_progress == nullptr) {
+    return ENGINE_NATIVE_STATUS_INVALID_ARGUMENT;
+  }
+
+  *out_progress = engine_native_pipeline_prewarm_progress_t{};
+  out_progress->requested_count = prewarm_requested_count_;
+  out_progress->resolved_count = prewarm_resolved_count_;
+  out_progress->rejected_count = prewarm_rejected_count_;
+  out_progress->already_cached_count = prewarm_already_cached_count_;
+  out_progress->first_frame_miss_count = prewarm_first_frame_miss_count_;
+  out_progress->is_complete = 1u;
+  out_progress->first_frame_measured =
+      prewarm_first_frame_ == PrewarmFirstFrame::kMeasured ? 1u : 0u;
+  return ENGINE_NATIVE_STATUS_OK;
+}
+
+bool RendererState::IsLiveMaterial(engine_native_resource_handle_t handle) const {
+  if (handle == kInvalidResourceHandle) {
+    return false;
+  }
+
+  const ResourceBlob* blob = resources_.Get(DecodeResourceHandle(handle));
+  return blob != nullptr && blob->kind == ResourceKind::kMaterial;
+}
+
+void RendererState::RemoveRetiredMaterials() {
+  {
+    std::lock_guard<std::mutex> guard(retired_materials_mutex_);
+    retired_materials_.swap(removing_materials_);
+  }
+  if (removing_materials_.empty()) {
+    return;
+  }
+
+  for (const engine_native_resource_handle_t material : removing_materials_) {
+    material_system_.RemoveMaterial(material);
+  }
+  pipeline_memo_.Invalidate();
+  removing_materials_.clear();
+}
+
+void RendererState::SetPipelineCacheFingerprint(
+    const rhi::PipelineCacheFingerprint& fingerprint) {
+  pipeline_cache_.SetFingerprint(fingerprint);
+}
+
 void RendererState::LoadPipelineCacheFromDisk(const char* file_path) {
   static_cast<void>(pipeline_cache_.LoadFromFile(file_path));
+  pipeline_cache_lookups_at_save_ = 0u;
 }
 
-void RendererState::SavePipelineCacheToDisk(const char* file_path) const {
+void RendererState::SavePipelineCacheToDisk(const char* file_path) {
+  pipeline_cache_writer_.Flush();
   static_cast<void>(pipeline_cache_.SaveToFile(file_path));
 }
 
+void RendererState::SetPipelineCacheAutosave(const std::string& file_path,
+                                             uint32_t interval_frames) {
+  try {
+    pipeline_cache_autosave_path_ = file_path;
+  } catch (const std::bad_alloc&) {
+    pipeline_cache_autosave_path_.clear();
+  }
+  pipeline_cache_autosave_interval_ = interval_frames;
+  frames_since_pipeline_cache_save_ = 0u;
+}
+
+void RendererState::MaybeSchedulePipelineCacheSave() {
+  if (pipeline_cache_autosave_interval_ == 0u ||
+      pipeline_cache_autosave_path_.empty() ||
+      ++frames_since_pipeline_cache_save_ < pipeline_cache_autosave_interval_) {
+    return;
+  }
+
+  frames_since_pipeline_cache_save_ = 0u;
+  const uint64_t lookups = pipeline_cache_.hit_count() + pipeline_cache_.miss_count();
+  if (lookups == pipeline_cache_lookups_at_save_) {
+    return;
+  }
+
+  std::vector<uint8_t> snapshot;
+  if (!pipeline_cache_.Serialize(&snapshot)) {
+    return;
+  }
+
+  if (pipeline_cache_writer_.Schedule(pipeline_cache_autosave_path_,
+                                      std::move(snapshot)) ==
+      ENGINE_NATIVE_STATUS_OK) {
+    pipeline_cache_lookups_at_save_ = lookups;
+  }
+}
+
+engine_native_status_t RendererState::SetFrameArenaDepth(size_t depth) {
+  if (frame_open_) {
+    return ENGINE_NATIVE_STATUS_INVALID_STATE;
+  }
+
+  return frame_arenas_.SetDepth(depth);
+}
+
+void RendererState::SetRenderTargetExtent(uint32_t width, uint32_t height) {
+  if (width > 0u) {
+    render_target_width_ = width;
+  }
+
+  if (height > 0u) {
+    render_target_height_ = height;
+  }
+}
+
 void RendererState::ResetFrameState() {
   frame_memory_ = nullptr;
   frame_capacity_ = 0u;
@@ -1006,13 +1359,13 @@ void RendererState::ResetFrameState() {
   submitted_ui_count_ = 0u;
   submitted_debug_view_mode_ = ENGINE_NATIVE_DEBUG_VIEW_NONE;
   submitted_render_feature_flags_ = 0u;
-  frame_graph_.Clear();
-  compiled_pass_order_.clear();
-  pass_kinds_by_id_.clear();
+  compiled_frame_graph_ = nullptr;
   submitted_draw_items_.clear();
+  referenced_draw_spans_.clear();
+  draw_sorter_.Reset();
   submitted_ui_items_.clear();
   frame_open_ = false;
-  frame_storage_.clear();
+  frame_arenas_.Release();
 }
 
 engine_native_status_t PhysicsState::Step(double dt_seconds) {
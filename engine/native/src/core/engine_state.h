@@ -6,19 +6,32 @@
 
 #include <algorithm>
 #include <array>
+#include <atomic>
 #include <cmath>
+#include <mutex>
+#include <span>
 #include <string>
 #include <unordered_map>
 #include <vector>
 
+#include "content/content_read_queue.h"
 #include "content/content_runtime.h"
+#include "content/streaming_scheduler.h"
 #include "engine_native.h"
+#include "core/concurrent_resource_table.h"
 #include "core/net_state.h"
 #include "core/resource_table.h"
+#include "render/draw_item_sorter.h"
+#include "render/frame_arena_ring.h"
+#include "render/frame_graph_cache.h"
+#include "render/material_pipeline_memo.h"
 #include "render/material_system.h"
+#include "render/parallel_pass_recorder.h"
 #include "platform/platform_state.h"
 #include "render/render_graph.h"
+#include "rhi/pipeline_cache_writer.h"
 #include "rhi/pipeline_state_cache.h"
+#include "rhi/rhi_command_list.h"
 #include "rhi/rhi_device.h"
 
 namespace dff::native {
@@ -42,6 +55,9 @@ class RendererState {
   engine_native_status_t BeginFrame(size_t requested_bytes,
                                     size_t alignment,
                                     void** out_frame_memory);
+  engine_native_status_t ResizeFrame(size_t requested_bytes,
+                                     size_t alignment,
+                                     void** out_frame_memory);
   engine_native_status_t Submit(const engine_native_render_packet_t& packet);
   engine_native_status_t UiReset();
   engine_native_status_t UiAppend(const engine_native_ui_draw_item_t* items,
@@ -72,8 +88,18 @@ class RendererState {
   engine_native_status_t DestroyResource(engine_native_resource_handle_t handle);
   engine_native_status_t GetLastFrameStats(
       engine_native_renderer_frame_stats_t* out_stats) const;
+  engine_native_status_t PrewarmPipelines(
+      const engine_native_pipeline_prewarm_item_t* items,
+      uint32_t item_count);
+  engine_native_status_t GetPipelinePrewarmProgress(
+      engine_native_pipeline_prewarm_progress_t* out_progress);
+  void SetPipelineCacheFingerprint(const rhi::PipelineCacheFingerprint& fingerprint);
   void LoadPipelineCacheFromDisk(const char* file_path);
-  void SavePipelineCacheToDisk(const char* file_path) const;
+  void SavePipelineCacheToDisk(const char* file_path);
+  void SetPipelineCacheAutosave(const std::string& file_path,
+                                uint32_t interval_frames);
+  engine_native_status_t SetFrameArenaDepth(size_t depth);
+  void SetRenderTargetExtent(uint32_t width, uint32_t height);
 
   bool is_frame_open() const { return frame_open_; }
   uint32_t submitted_draw_count() const { return submitted_draw_count_; }
@@ -88,10 +114,30 @@ class RendererState {
   const std::vector<engine_native_ui_draw_item_t>& submitted_ui_items() const {
     return submitted_ui_items_;
   }
+  size_t copied_draw_item_count() const { return submitted_draw_items_.size(); }
+  size_t referenced_draw_span_count() const { return referenced_draw_spans_.size(); }
   uint64_t pipeline_cache_hits() const { return pipeline_cache_.hit_count(); }
   uint64_t pipeline_cache_misses() const { return pipeline_cache_.miss_count(); }
   size_t cached_pipeline_count() const { return pipeline_cache_.size(); }
+  const rhi::PipelineCacheWriter& pipeline_cache_writer() const {
+    return pipeline_cache_writer_;
+  }
+  void FlushPipelineCacheWrites() { pipeline_cache_writer_.Flush(); }
+  const render::MaterialPipelineMemo& pipeline_memo() const {
+    return pipeline_memo_;
+  }
   size_t resource_count() const { return resources_.Size(); }
+  const render::FrameArenaRing& frame_arenas() const { return frame_arenas_; }
+  const render::FrameGraphCache& frame_graph_cache() const {
+    return frame_graph_cache_;
+  }
+  const std::vector<uint64_t>& last_pass_cpu_ns() const { return pass_cpu_ns_; }
+  const render::DrawItemSorter& draw_sorter() const { return draw_sorter_; }
+  const render::ParallelPassRecorder& pass_recorder() const {
+    return pass_recorder_;
+  }
+  uint32_t render_target_width() const { return render_target_width_; }
+  uint32_t render_target_height() const { return render_target_height_; }
 
  private:
   static bool IsPowerOfTwo(size_t value);
@@ -100,33 +146,65 @@ class RendererState {
       const void* data,
       size_t size,
       engine_native_resource_handle_t* out_handle);
+  engine_native_status_t SortSubmittedDrawItems();
   engine_native_status_t BuildFrameGraph();
   engine_native_status_t ExecuteCompiledFrameGraph();
   uint64_t ComputeSubmittedTriangleCount() const;
+  void MaybeSchedulePipelineCacheSave();
+  bool IsLiveMaterial(engine_native_resource_handle_t handle) const;
+  void RemoveRetiredMaterials();
   void ResetFrameState();
 
   rhi::RhiDevice* rhi_device_ = nullptr;
   bool frame_open_ = false;
-  std::vector<uint8_t> frame_storage_;
+  render::FrameArenaRing frame_arenas_;
   void* frame_memory_ = nullptr;
   size_t frame_capacity_ = 0;
   uint32_t submitted_draw_count_ = 0;
   uint32_t submitted_ui_count_ = 0;
-  render::RenderGraph frame_graph_;
-  std::vector<render::RenderPassId> compiled_pass_order_;
-  std::vector<rhi::RhiDevice::PassKind> pass_kinds_by_id_;
+  render::FrameGraphCache frame_graph_cache_;
+  const render::FrameGraphBuildOutput* compiled_frame_graph_ = nullptr;
+  render::ParallelPassRecorder pass_recorder_;
+  std::vector<rhi::RhiCommandList> pass_command_lists_;
+  std::vector<uint64_t> pass_cpu_ns_;
+  uint32_t render_target_width_ = 1280u;
+  uint32_t render_target_height_ = 720u;
   std::vector<std::string> last_executed_rhi_passes_;
   std::array<float, 4> last_clear_color_{0.05f, 0.07f, 0.10f, 1.0f};
   std::vector<engine_native_draw_item_t> submitted_draw_items_;
+  std::vector<std::span<const engine_native_draw_item_t>> referenced_draw_spans_;
+  render::DrawItemSorter draw_sorter_;
   std::vector<engine_native_ui_draw_item_t> submitted_ui_items_;
   engine_native_debug_view_mode_t submitted_debug_view_mode_ =
       ENGINE_NATIVE_DEBUG_VIEW_NONE;
   uint8_t submitted_render_feature_flags_ = 0u;
   render::MaterialSystem material_system_;
   rhi::PipelineStateCache pipeline_cache_;
-  ResourceTable<ResourceBlob> resources_;
-  uint64_t resource_upload_bytes_pending_ = 0u;
-  uint64_t resource_gpu_memory_bytes_ = 0u;
+  render::MaterialPipelineMemo pipeline_memo_;
+  rhi::PipelineCacheWriter pipeline_cache_writer_;
+  std::string pipeline_cache_autosave_path_;
+  uint32_t pipeline_cache_autosave_interval_ = 0u;
+  uint32_t frames_since_pipeline_cache_save_ = 0u;
+  uint64_t pipeline_cache_lookups_at_save_ = 0u;
+  enum class PrewarmFirstFrame : uint8_t {
+    kIdle = 0u,
+    kAwaitingPrewarm = 1u,
+    kMeasuring = 2u,
+    kMeasured = 3u,
+  };
+  uint32_t prewarm_requested_count_ = 0u;
+  uint32_t prewarm_resolved_count_ = 0u;
+  uint32_t prewarm_rejected_count_ = 0u;
+  uint32_t prewarm_already_cached_count_ = 0u;
+  uint32_t prewarm_first_frame_miss_count_ = 0u;
+  uint64_t prewarm_first_frame_misses_at_begin_ = 0u;
+  PrewarmFirstFrame prewarm_first_frame_ = PrewarmFirstFrame::kIdle;
+  ConcurrentResourceTable<ResourceBlob> resources_;
+  std::mutex retired_materials_mutex_;
+  std::vector<engine_native_resource_handle_t> retired_materials_;
+  std::vector<engine_native_resource_handle_t> removing_materials_;
+  std::atomic<uint64_t> resource_upload_bytes_pending_{0u};
+  std::atomic<uint64_t> resource_gpu_memory_bytes_{0u};
   uint64_t last_pass_mask_ = 0u;
   engine_native_renderer_frame_stats_t last_frame_stats_{};
 };
@@ -368,6 +446,8 @@ struct EngineState {
 
   platform::PlatformState platform;
   content::ContentRuntime content;
+  content::ContentReadQueue content_reads{content};
+  content::StreamingScheduler content_streaming{content, content_reads};
   NetState net;
   rhi::RhiDevice rhi_device;
   RendererState renderer;
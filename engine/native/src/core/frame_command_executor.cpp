@@ -0,0 +1,301 @@
+#include "core/frame_command_executor.h"
+
+#include <cstdint>
+#include <limits>
+
+namespace dff::native {
+namespace {
+
+using CommandHeader = engine_native_frame_command_header_t;
+
+constexpr size_t kCommandAlignment = ENGINE_NATIVE_FRAME_COMMAND_ALIGNMENT;
+
+static_assert(sizeof(CommandHeader) % kCommandAlignment == 0u);
+static_assert(sizeof(engine_native_frame_command_submit_t) % kCommandAlignment == 0u);
+static_assert(sizeof(engine_native_frame_command_items_t) % kCommandAlignment == 0u);
+static_assert(alignof(engine_native_draw_item_t) <= kCommandAlignment);
+static_assert(alignof(engine_native_ui_draw_item_t) <= kCommandAlignment);
+static_assert(alignof(engine_native_body_write_t) <= kCommandAlignment);
+static_assert(sizeof(engine_native_draw_item_t) % kCommandAlignment == 0u);
+
+constexpr size_t AlignCommandSize(size_t size) {
+  return (size + kCommandAlignment - 1u) & ~(kCommandAlignment - 1u);
+}
+
+template <typename Payload>
+constexpr size_t FixedCommandSize() {
+  return AlignCommandSize(sizeof(CommandHeader) + sizeof(Payload));
+}
+
+template <typename Payload>
+const Payload* PayloadOf(const CommandHeader* header) {
+  return reinterpret_cast<const Payload*>(
+      reinterpret_cast<const uint8_t*>(header) + sizeof(CommandHeader));
+}
+
+template <typename Item>
+const Item* ItemsAfter(const CommandHeader* header, size_t payload_size) {
+  return reinterpret_cast<const Item*>(reinterpret_cast<const uint8_t*>(header) +
+                                       sizeof(CommandHeader) + payload_size);
+}
+
+bool ItemsCommandSize(uint32_t item_count, size_t item_size, size_t* out_size) {
+  const size_t fixed_size = sizeof(CommandHeader) +
+                            sizeof(engine_native_frame_command_items_t);
+  if (item_count > (std::numeric_limits<uint32_t>::max() - fixed_size) / item_size) {
+    return false;
+  }
+
+  *out_size = AlignCommandSize(fixed_size + static_cast<size_t>(item_count) * item_size);
+  return true;
+}
+
+// Only items without a pointer are carried inline.
+bool SubmitCommandSize(const engine_native_frame_command_submit_t& submit,
+                       size_t* out_size) {
+  const uint64_t inline_draw_count =
+      submit.draw_items == nullptr ? submit.draw_item_count : 0u;
+  const uint64_t inline_ui_count =
+      submit.ui_items == nullptr ? submit.ui_item_count : 0u;
+  const uint64_t size =
+      static_cast<uint64_t>(sizeof(CommandHeader) +
+                            sizeof(engine_native_frame_command_submit_t)) +
+      inline_draw_count * sizeof(engine_native_draw_item_t) +
+      inline_ui_count * sizeof(engine_native_ui_draw_item_t);
+  if (size > std::numeric_limits<uint32_t>::max()) {
+    return false;
+  }
+
+  *out_size = AlignCommandSize(static_cast<size_t>(size));
+  return true;
+}
+
+bool HasValidLayout(const CommandHeader* header) {
+  size_t expected_size = 0u;
+  switch (header->kind) {
+    case ENGINE_NATIVE_FRAME_COMMAND_RENDERER_BEGIN_FRAME:
+    case ENGINE_NATIVE_FRAME_COMMAND_RENDERER_RESIZE_FRAME:
+      expected_size = FixedCommandSize<engine_native_frame_command_begin_frame_t>();
+      break;
+    case ENGINE_NATIVE_FRAME_COMMAND_RENDERER_SUBMIT:
+      if (header->size < FixedCommandSize<engine_native_frame_command_submit_t>() ||
+          !SubmitCommandSize(*PayloadOf<engine_native_frame_command_submit_t>(header),
+                             &expected_size)) {
+        return false;
+      }
+      break;
+    case ENGINE_NATIVE_FRAME_COMMAND_RENDERER_UI_APPEND:
+    case ENGINE_NATIVE_FRAME_COMMAND_PHYSICS_SYNC_FROM_WORLD: {
+      if (header->size < FixedCommandSize<engine_native_frame_command_items_t>()) {
+        return false;
+      }
+      const size_t item_size =
+          header->kind == ENGINE_NATIVE_FRAME_COMMAND_RENDERER_UI_APPEND
+              ? sizeof(engine_native_ui_draw_item_t)
+              : sizeof(engine_native_body_write_t);
+      if (!ItemsCommandSize(
+              PayloadOf<engine_native_frame_command_items_t>(header)->item_count,
+              item_size, &expected_size)) {
+        return false;
+      }
+      break;
+    }
+    case ENGINE_NATIVE_FRAME_COMMAND_RENDERER_PRESENT:
+    case ENGINE_NATIVE_FRAME_COMMAND_NET_PUMP:
+      expected_size = sizeof(CommandHeader);
+      break;
+    case ENGINE_NATIVE_FRAME_COMMAND_PHYSICS_STEP:
+      expected_size = FixedCommandSize<engine_native_frame_command_physics_step_t>();
+      break;
+    case ENGINE_NATIVE_FRAME_COMMAND_PHYSICS_SYNC_TO_WORLD:
+      expected_size = FixedCommandSize<engine_native_frame_command_sync_to_world_t>();
+      break;
+    case ENGINE_NATIVE_FRAME_COMMAND_AUDIO_SET_EMITTER_PARAMS:
+      expected_size =
+          FixedCommandSize<engine_native_frame_command_emitter_params_t>();
+      break;
+    default:
+      return false;
+  }
+
+  return header->size == expected_size;
+}
+
+bool OpensFrame(const CommandHeader* header) {
+  return header->kind == ENGINE_NATIVE_FRAME_COMMAND_RENDERER_BEGIN_FRAME ||
+         header->kind == ENGINE_NATIVE_FRAME_COMMAND_RENDERER_RESIZE_FRAME;
+}
+
+engine_native_status_t ExecuteSubmit(RendererState* renderer,
+                                     const CommandHeader* header) {
+  const auto* submit = PayloadOf<engine_native_frame_command_submit_t>(header);
+  const auto* inline_items = ItemsAfter<engine_native_draw_item_t>(
+      header, sizeof(engine_native_frame_command_submit_t));
+  const auto* draw_items = submit->draw_items;
+  if (draw_items == nullptr) {
+    draw_items = inline_items;
+    inline_items += submit->draw_item_count;
+  }
+  const auto* ui_items = submit->ui_items;
+  if (ui_items == nullptr) {
+    ui_items = reinterpret_cast<const engine_native_ui_draw_item_t*>(inline_items);
+  }
+  const size_t draw_bytes = static_cast<size_t>(submit->draw_item_count) *
+                            sizeof(engine_native_draw_item_t);
+
+  engine_native_render_packet_t packet{};
+  packet.draw_items = submit->draw_item_count > 0u ? draw_items : nullptr;
+  packet.draw_item_count = submit->draw_item_count;
+  packet.ui_items = submit->ui_item_count > 0u ? ui_items : nullptr;
+  packet.ui_item_count = submit->ui_item_count;
+  packet.debug_view_mode = submit->debug_view_mode;
+  packet.reserved0 = submit->render_feature_flags;
+  if (submit->reserved0 != 0u || submit->reserved1 != 0u ||
+      submit->reserved2 != 0u) {
+    return ENGINE_NATIVE_STATUS_INVALID_ARGUMENT;
+  }
+  if (draw_bytes > 0u && renderer->frame_arenas().Contains(draw_items, draw_bytes)) {
+    packet.reserved1 = ENGINE_NATIVE_RENDER_PACKET_FLAG_DRAW_ITEMS_IN_FRAME_MEMORY;
+  }
+
+  return renderer->Submit(packet);
+}
+
+engine_native_status_t ExecuteCommand(
+    EngineState* state,
+    const CommandHeader* header,
+    engine_native_frame_command_results_t* results) {
+  switch (header->kind) {
+    case ENGINE_NATIVE_FRAME_COMMAND_RENDERER_BEGIN_FRAME:
+    case ENGINE_NATIVE_FRAME_COMMAND_RENDERER_RESIZE_FRAME: {
+      const bool resize =
+          header->kind == ENGINE_NATIVE_FRAME_COMMAND_RENDERER_RESIZE_FRAME;
+      const engine_native_frame_command_begin_frame_t begin =
+          *PayloadOf<engine_native_frame_command_begin_frame_t>(header);
+      if (begin.requested_bytes > std::numeric_limits<size_t>::max() ||
+          begin.alignment > std::numeric_limits<size_t>::max()) {
+        return ENGINE_NATIVE_STATUS_INVALID_ARGUMENT;
+      }
+      const size_t requested_bytes = static_cast<size_t>(begin.requested_bytes);
+      const size_t alignment = static_cast<size_t>(begin.alignment);
+      const engine_native_status_t status =
+          resize ? state->renderer.ResizeFrame(requested_bytes, alignment,
+                                               &results->frame_memory)
+                 : state->renderer.BeginFrame(requested_bytes, alignment,
+                                              &results->frame_memory);
+      results->has_frame_memory = status == ENGINE_NATIVE_STATUS_OK ? 1u : 0u;
+      return status;
+    }
+    case ENGINE_NATIVE_FRAME_COMMAND_RENDERER_SUBMIT:
+      return ExecuteSubmit(&state->renderer, header);
+    case ENGINE_NATIVE_FRAME_COMMAND_RENDERER_UI_APPEND: {
+      const auto* items = PayloadOf<engine_native_frame_command_items_t>(header);
+      return state->renderer.UiAppend(
+          ItemsAfter<engine_native_ui_draw_item_t>(
+              header, sizeof(engine_native_frame_command_items_t)),
+          items->item_count);
+    }
+    case ENGINE_NATIVE_FRAME_COMMAND_RENDERER_PRESENT: {
+      const engine_native_status_t status = state->renderer.Present();
+      if (status != ENGINE_NATIVE_STATUS_OK) {
+        return status;
+      }
+      const engine_native_status_t stats_status =
+          state->renderer.GetLastFrameStats(&results->frame_stats);
+      results->has_frame_stats = stats_status == ENGINE_NATIVE_STATUS_OK ? 1u : 0u;
+      return stats_status;
+    }
+    case ENGINE_NATIVE_FRAME_COMMAND_PHYSICS_SYNC_FROM_WORLD: {
+      const auto* items = PayloadOf<engine_native_frame_command_items_t>(header);
+      return state->physics.SyncFromWorld(
+          ItemsAfter<engine_native_body_write_t>(
+              header, sizeof(engine_native_frame_command_items_t)),
+          items->item_count);
+    }
+    case ENGINE_NATIVE_FRAME_COMMAND_PHYSICS_STEP:
+      return state->physics.Step(
+          PayloadOf<engine_native_frame_command_physics_step_t>(header)->dt_seconds);
+    case ENGINE_NATIVE_FRAME_COMMAND_PHYSICS_SYNC_TO_WORLD: {
+      const auto* sync =
+          PayloadOf<engine_native_frame_command_sync_to_world_t>(header);
+      return state->physics.SyncToWorld(sync->reads, sync->read_capacity,
+                                        &results->physics_read_count);
+    }
+    case ENGINE_NATIVE_FRAME_COMMAND_AUDIO_SET_EMITTER_PARAMS: {
+      const auto* emitter =
+          PayloadOf<engine_native_frame_command_emitter_params_t>(header);
+      return state->audio.SetEmitterParams(emitter->emitter_id, emitter->params);
+    }
+    case ENGINE_NATIVE_FRAME_COMMAND_NET_PUMP: {
+      const engine_native_status_t status = state->net.Pump(&results->net_events);
+      results->has_net_events = status == ENGINE_NATIVE_STATUS_OK ? 1u : 0u;
+      return status;
+    }
+    default:
+      return ENGINE_NATIVE_STATUS_INVALID_ARGUMENT;
+  }
+}
+
+}  // namespace
+
+engine_native_status_t ExecuteFrameCommands(
+    EngineState* state,
+    const void* commands,
+    size_t command_bytes,
+    engine_native_frame_command_results_t* out_results) {
+  if (state == nullptr || out_results == nullptr) {
+    return ENGINE_NATIVE_STATUS_INVALID_ARGUMENT;
+  }
+
+  *out_results = engine_native_frame_command_results_t{};
+  out_results->failed_command_index = ENGINE_NATIVE_FRAME_COMMAND_NO_FAILURE;
+  out_results->failed_status = ENGINE_NATIVE_STATUS_OK;
+
+  if (command_bytes > 0u && commands == nullptr) {
+    return ENGINE_NATIVE_STATUS_INVALID_ARGUMENT;
+  }
+  if ((reinterpret_cast<uintptr_t>(commands) & (kCommandAlignment - 1u)) != 0u ||
+      (command_bytes & (kCommandAlignment - 1u)) != 0u) {
+    return ENGINE_NATIVE_STATUS_INVALID_ARGUMENT;
+  }
+
+  const uint8_t* stream = static_cast<const uint8_t*>(commands);
+  uint32_t command_count = 0u;
+  for (size_t offset = 0u; offset < command_bytes; ++command_count) {
+    const auto* header = reinterpret_cast<const CommandHeader*>(stream + offset);
+    if (command_bytes - offset < sizeof(CommandHeader) ||
+        header->size < sizeof(CommandHeader) ||
+        header->size > command_bytes - offset ||
+        (header->size & (kCommandAlignment - 1u)) != 0u ||
+        command_count == ENGINE_NATIVE_FRAME_COMMAND_NO_FAILURE ||
+        !HasValidLayout(header) ||
+        (OpensFrame(header) && header->size != command_bytes - offset)) {
+      out_results->failed_command_index = command_count;
+      out_results->failed_status = ENGINE_NATIVE_STATUS_INVALID_ARGUMENT;
+      return ENGINE_NATIVE_STATUS_INVALID_ARGUMENT;
+    }
+    offset += header->size;
+  }
+
+  size_t offset = 0u;
+  for (uint32_t index = 0u; index < command_count; ++index) {
+    const auto* header = reinterpret_cast<const CommandHeader*>(stream + offset);
+    // Begin- and resize-frame are always last and may recycle the arena
+    // holding the stream, so nothing in the stream is read after a command
+    // runs.
+    const uint32_t command_size = header->size;
+    const engine_native_status_t status =
+        ExecuteCommand(state, header, out_results);
+    if (status != ENGINE_NATIVE_STATUS_OK) {
+      out_results->failed_command_index = index;
+      out_results->failed_status = status;
+      return status;
+    }
+    ++out_results->executed_command_count;
+    offset += command_size;
+  }
+
+  return ENGINE_NATIVE_STATUS_OK;
+}
+
+}  // namespace dff::native
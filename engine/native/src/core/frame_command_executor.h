@@ -0,0 +1,23 @@
+#ifndef DFF_ENGINE_NATIVE_FRAME_COMMAND_EXECUTOR_H
+#define DFF_ENGINE_NATIVE_FRAME_COMMAND_EXECUTOR_H
+
+#include <cstddef>
+
+#include "core/engine_state.h"
+#include "engine_native.h"
+
+namespace dff::native {
+
+// Validates the whole stream before running any command, then executes the
+// records in order against the engine's subsystems and stops at the first
+// failing one. A begin- or resize-frame record must come last: it may reuse or
+// regrow the frame arena the stream itself was written into.
+engine_native_status_t ExecuteFrameCommands(
+    EngineState* state,
+    const void* commands,
+    size_t command_bytes,
+    engine_native_frame_command_results_t* out_results);
+
+}  // namespace dff::native
+
+#endif
@@ -1,10 +1,11 @@
 #ifndef DFF_ENGINE_NATIVE_RESOURCE_TABLE_H
 #define DFF_ENGINE_NATIVE_RESOURCE_TABLE_H
 
+#include <algorithm>
 #include <cstddef>
 #include <limits>
+#include <memory>
 #include <new>
-#include <optional>
 #include <utility>
 #include <vector>
 
@@ -32,37 +33,50 @@ inline ResourceHandle DecodeResourceHandle(
       .generation = static_cast<uint32_t>((handle >> 32u) & 0xFFFFFFFFu)};
 }
 
+// Values live in fixed-size chunks that are never reallocated, so pointers
+// returned by Get stay valid until the handle is removed. Live slots are
+// also tracked in a dense array that ForEach walks without touching holes.
 template <typename T>
 class ResourceTable {
  public:
+  static constexpr uint32_t kChunkShift = 8u;
+  static constexpr uint32_t kChunkSize = 1u << kChunkShift;
+
+  ResourceTable() = default;
+  ~ResourceTable() { DestroyAlive(); }
+
+  ResourceTable(const ResourceTable&) = delete;
+  ResourceTable& operator=(const ResourceTable&) = delete;
+
   engine_native_status_t Insert(T value, ResourceHandle* out_handle) {
     if (out_handle == nullptr) {
       return ENGINE_NATIVE_STATUS_INVALID_ARGUMENT;
     }
 
     try {
-      if (!free_indices_.empty()) {
-        const uint32_t index = free_indices_.back();
-        free_indices_.pop_back();
-        Slot& slot = slots_[index];
-        slot.value.emplace(std::move(value));
-        *out_handle = ResourceHandle{.index = index, .generation = slot.generation};
-        ++size_;
-        return ENGINE_NATIVE_STATUS_OK;
+      if (free_indices_.empty()) {
+        if (chunks_.size() >= kMaxChunks) {
+          return ENGINE_NATIVE_STATUS_INTERNAL_ERROR;
+        }
+
+        chunks_.push_back(std::make_unique<Chunk>());
+        ReserveGeometric(&free_indices_, chunks_.size() << kChunkShift);
+        const uint32_t chunk_base =
+            static_cast<uint32_t>((chunks_.size() - 1u) << kChunkShift);
+        for (uint32_t offset = kChunkSize; offset > 0u; --offset) {
+          free_indices_.push_back(chunk_base + offset - 1u);
+        }
       }
 
-      if (slots_.size() >=
-          static_cast<size_t>(std::numeric_limits<uint32_t>::max()) + 1u) {
-        return ENGINE_NATIVE_STATUS_INTERNAL_ERROR;
-      }
+      ReserveGeometric(&alive_, alive_.size() + 1u);
 
-      Slot slot;
-      slot.value.emplace(std::move(value));
-      slots_.push_back(std::move(slot));
-      *out_handle = ResourceHandle{
-          .index = static_cast<uint32_t>(slots_.size() - 1u),
-          .generation = 1u};
-      ++size_;
+      const uint32_t index = free_indices_.back();
+      Slot& slot = SlotAt(index);
+      ::new (static_cast<void*>(slot.bytes)) T(std::move(value));
+      free_indices_.pop_back();
+      slot.dense_index = static_cast<uint32_t>(alive_.size());
+      alive_.push_back(index);
+      *out_handle = ResourceHandle{.index = index, .generation = slot.generation};
       return ENGINE_NATIVE_STATUS_OK;
     } catch (const std::bad_alloc&) {
       return ENGINE_NATIVE_STATUS_OUT_OF_MEMORY;
@@ -70,79 +84,128 @@ class ResourceTable {
   }
 
   bool Remove(ResourceHandle handle) {
-    if (handle.index >= slots_.size()) {
+    if (!IsAlive(handle)) {
       return false;
     }
 
-    Slot& slot = slots_[handle.index];
-    if (!slot.value.has_value() || slot.generation != handle.generation) {
-      return false;
-    }
+    const uint32_t dense_index = SlotAt(handle.index).dense_index;
+    const uint32_t moved_index = alive_.back();
+    alive_[dense_index] = moved_index;
+    SlotAt(moved_index).dense_index = dense_index;
+    alive_.pop_back();
 
-    slot.value.reset();
-    slot.generation = (slot.generation == std::numeric_limits<uint32_t>::max())
-                          ? 1u
-                          : slot.generation + 1u;
+    ReleaseSlot(handle.index);
     free_indices_.push_back(handle.index);
-    --size_;
     return true;
   }
 
   T* Get(ResourceHandle handle) {
-    if (handle.index >= slots_.size()) {
-      return nullptr;
-    }
-
-    Slot& slot = slots_[handle.index];
-    if (!slot.value.has_value() || slot.generation != handle.generation) {
-      return nullptr;
-    }
-
-    return &slot.value.value();
+    return IsAlive(handle) ? ValueAt(handle.index) : nullptr;
   }
 
   const T* Get(ResourceHandle handle) const {
-    if (handle.index >= slots_.size()) {
-      return nullptr;
-    }
+    return IsAlive(handle) ? ValueAt(handle.index) : nullptr;
+  }
 
-    const Slot& slot = slots_[handle.index];
-    if (!slot.value.has_value() || slot.generation != handle.generation) {
-      return nullptr;
+  template <typename Fn>
+  void ForEach(Fn&& fn) {
+    for (const uint32_t index : alive_) {
+      fn(ResourceHandle{.index = index, .generation = GenerationAt(index)},
+         *ValueAt(index));
     }
+  }
 
-    return &slot.value.value();
+  template <typename Fn>
+  void ForEach(Fn&& fn) const {
+    for (const uint32_t index : alive_) {
+      fn(ResourceHandle{.index = index, .generation = GenerationAt(index)},
+         static_cast<const T&>(*ValueAt(index)));
+    }
   }
 
   void Clear() {
+    DestroyAlive();
+
     free_indices_.clear();
-    free_indices_.reserve(slots_.size());
-
-    for (size_t index = 0; index < slots_.size(); ++index) {
-      Slot& slot = slots_[index];
-      if (slot.value.has_value()) {
-        slot.value.reset();
-        slot.generation = (slot.generation == std::numeric_limits<uint32_t>::max())
-                              ? 1u
-                              : slot.generation + 1u;
-      }
-      free_indices_.push_back(static_cast<uint32_t>(index));
+    const uint32_t slot_count =
+        static_cast<uint32_t>(chunks_.size() << kChunkShift);
+    for (uint32_t index = 0u; index < slot_count; ++index) {
+      free_indices_.push_back(slot_count - index - 1u);
     }
-
-    size_ = 0u;
   }
 
-  size_t Size() const { return size_; }
+  size_t Size() const { return alive_.size(); }
 
  private:
+  static constexpr uint32_t kNotAlive = std::numeric_limits<uint32_t>::max();
+  static constexpr size_t kMaxChunks =
+      (static_cast<size_t>(std::numeric_limits<uint32_t>::max()) + 1u) >>
+      kChunkShift;
+
   struct Slot {
-    std::optional<T> value;
+    alignas(T) unsigned char bytes[sizeof(T)];
     uint32_t generation = 1u;
+    uint32_t dense_index = kNotAlive;
+  };
+
+  struct Chunk {
+    Slot slots[kChunkSize];
   };
 
-  std::vector<Slot> slots_;
+  static void ReserveGeometric(std::vector<uint32_t>* values, size_t required) {
+    if (values->capacity() < required) {
+      values->reserve(std::max(required, values->capacity() * 2u));
+    }
+  }
+
+  Slot& SlotAt(uint32_t index) {
+    return chunks_[index >> kChunkShift]->slots[index & (kChunkSize - 1u)];
+  }
+
+  const Slot& SlotAt(uint32_t index) const {
+    return chunks_[index >> kChunkShift]->slots[index & (kChunkSize - 1u)];
+  }
+
+  bool IsAlive(ResourceHandle handle) const {
+    if ((handle.index >> kChunkShift) >= chunks_.size()) {
+      return false;
+    }
+
+    const Slot& slot = SlotAt(handle.index);
+    return slot.dense_index != kNotAlive && slot.generation == handle.generation;
+  }
+
+  uint32_t GenerationAt(uint32_t index) const {
+    return SlotAt(index).generation;
+  }
+
+  T* ValueAt(uint32_t index) {
+    return std::launder(reinterpret_cast<T*>(SlotAt(index).bytes));
+  }
+
+  const T* ValueAt(uint32_t index) const {
+    return std::launder(reinterpret_cast<const T*>(SlotAt(index).bytes));
+  }
+
+  void ReleaseSlot(uint32_t index) {
+    ValueAt(index)->~T();
+    Slot& slot = SlotAt(index);
+    slot.dense_index = kNotAlive;
+    slot.generation = (slot.generation == std::numeric_limits<uint32_t>::max())
+                          ? 1u
+                          : slot.generation + 1u;
+  }
+
+  void DestroyAlive() {
+    for (const uint32_t index : alive_) {
+      ReleaseSlot(index);
+    }
+    alive_.clear();
+  }
+
+  std::vector<std::unique_ptr<Chunk>> chunks_;
+  std::vector<uint32_t> alive_;
   std::vector<uint32_t> free_indices_;
-  size_t size_ = 0u;
 };
 
 }  // namespace dff::native
@@ -17,6 +17,8 @@ class PlatformState {
   void SetWindowSize(uint32_t width, uint32_t height);
 
   uint64_t pump_count() const { return pump_count_; }
+  uint32_t width() const { return width_; }
+  uint32_t height() const { return height_; }
 
  private:
   uint64_t pump_count_ = 0;
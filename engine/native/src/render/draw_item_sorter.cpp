@@ -0,0 +1,123 @@
+#include "render/draw_item_sorter.h"
+
+#include <array>
+#include <chrono>
+#include <new>
+#include <utility>
+
+namespace dff::native::render {
+
+namespace {
+
+constexpr uint32_t kRadixBits = 8u;
+constexpr uint32_t kRadixBuckets = 1u << kRadixBits;
+constexpr uint32_t kRadixDigits = 64u / kRadixBits;
+
+uint32_t ExtractDigit(uint64_t key, uint32_t digit) {
+  return static_cast<uint32_t>((key >> (digit * kRadixBits)) & (kRadixBuckets - 1u));
+}
+
+}  // namespace
+
+void DrawItemSorter::Reset() {
+  entries_.clear();
+  batches_.clear();
+  max_batch_instance_count_ = 0u;
+}
+
+engine_native_status_t DrawItemSorter::Append(
+    std::span<const engine_native_draw_item_t> items) {
+  try {
+    entries_.reserve(entries_.size() + items.size());
+  } catch (const std::bad_alloc&) {
+    return ENGINE_NATIVE_STATUS_OUT_OF_MEMORY;
+  }
+
+  for (const engine_native_draw_item_t& item : items) {
+    entries_.push_back(SortEntry{ComposeSortKey(item), &item});
+  }
+  return ENGINE_NATIVE_STATUS_OK;
+}
+
+engine_native_status_t DrawItemSorter::SortAndBatch() {
+  const auto start = std::chrono::steady_clock::now();
+  try {
+    scratch_.resize(entries_.size());
+    batches_.reserve(entries_.size());
+  } catch (const std::bad_alloc&) {
+    return ENGINE_NATIVE_STATUS_OUT_OF_MEMORY;
+  }
+
+  RadixSort();
+  BuildBatches();
+  last_sort_cpu_ns_ = static_cast<uint64_t>(
+      std::chrono::duration_cast<std::chrono::nanoseconds>(
+          std::chrono::steady_clock::now() - start)
+          .count());
+  return ENGINE_NATIVE_STATUS_OK;
+}
+
+void DrawItemSorter::RadixSort() {
+  last_radix_pass_count_ = 0u;
+  const size_t count = entries_.size();
+  if (count < 2u) {
+    return;
+  }
+
+  std::array<std::array<uint32_t, kRadixBuckets>, kRadixDigits> histograms{};
+  for (const SortEntry& entry : entries_) {
+    for (uint32_t digit = 0u; digit < kRadixDigits; ++digit) {
+      ++histograms[digit][ExtractDigit(entry.key, digit)];
+    }
+  }
+
+  SortEntry* source = entries_.data();
+  SortEntry* destination = scratch_.data();
+  for (uint32_t digit = 0u; digit < kRadixDigits; ++digit) {
+    std::array<uint32_t, kRadixBuckets>& histogram = histograms[digit];
+    if (histogram[ExtractDigit(source[0].key, digit)] == count) {
+      continue;
+    }
+
+    uint32_t offset = 0u;
+    for (uint32_t& bucket : histogram) {
+      const uint32_t bucket_count = bucket;
+      bucket = offset;
+      offset += bucket_count;
+    }
+
+    for (size_t i = 0u; i < count; ++i) {
+      const SortEntry& entry = source[i];
+      destination[histogram[ExtractDigit(entry.key, digit)]++] = entry;
+    }
+
+    std::swap(source, destination);
+    ++last_radix_pass_count_;
+  }
+
+  if (source != entries_.data()) {
+    entries_.swap(scratch_);
+  }
+}
+
+void DrawItemSorter::BuildBatches() {
+  batches_.clear();
+  max_batch_instance_count_ = 0u;
+
+  const uint32_t count = static_cast<uint32_t>(entries_.size());
+  for (uint32_t i = 0u; i < count; ++i) {
+    const engine_native_draw_item_t& item = *entries_[i].item;
+    if (batches_.empty() || batches_.back().mesh != item.mesh ||
+        batches_.back().material != item.material) {
+      batches_.push_back(DrawBatch{item.mesh, item.material, i, 0u});
+    }
+
+    DrawBatch& batch = batches_.back();
+    ++batch.instance_count;
+    if (batch.instance_count > max_batch_instance_count_) {
+      max_batch_instance_count_ = batch.instance_count;
+    }
+  }
+}
+
+}  // namespace dff::native::render
@@ -0,0 +1,63 @@
+#ifndef DFF_ENGINE_NATIVE_DRAW_ITEM_SORTER_H
+#define DFF_ENGINE_NATIVE_DRAW_ITEM_SORTER_H
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include "engine_native.h"
+
+namespace dff::native::render {
+
+struct DrawBatch {
+  engine_native_resource_handle_t mesh = 0u;
+  engine_native_resource_handle_t material = 0u;
+  uint32_t first_item = 0u;
+  uint32_t instance_count = 0u;
+};
+
+// Orders a frame's draw items by (sort_key_high << 32 | sort_key_low) with a
+// stable LSD radix sort and merges runs sharing mesh+material into batches.
+class DrawItemSorter {
+ public:
+  static uint64_t ComposeSortKey(const engine_native_draw_item_t& item) {
+    return (static_cast<uint64_t>(item.sort_key_high) << 32u) |
+           static_cast<uint64_t>(item.sort_key_low);
+  }
+
+  void Reset();
+
+  engine_native_status_t Append(std::span<const engine_native_draw_item_t> items);
+
+  engine_native_status_t SortAndBatch();
+
+  size_t item_count() const { return entries_.size(); }
+  const engine_native_draw_item_t& sorted_item(size_t index) const {
+    return *entries_[index].item;
+  }
+  const std::vector<DrawBatch>& batches() const { return batches_; }
+  uint32_t max_batch_instance_count() const { return max_batch_instance_count_; }
+  uint32_t last_radix_pass_count() const { return last_radix_pass_count_; }
+  uint64_t last_sort_cpu_ns() const { return last_sort_cpu_ns_; }
+
+ private:
+  struct SortEntry {
+    uint64_t key = 0u;
+    const engine_native_draw_item_t* item = nullptr;
+  };
+
+  void RadixSort();
+  void BuildBatches();
+
+  std::vector<SortEntry> entries_;
+  std::vector<SortEntry> scratch_;
+  std::vector<DrawBatch> batches_;
+  uint32_t max_batch_instance_count_ = 0u;
+  uint32_t last_radix_pass_count_ = 0u;
+  uint64_t last_sort_cpu_ns_ = 0u;
+};
+
+}  // namespace dff::native::render
+
+#endif
@@ -0,0 +1,134 @@
+#include "render/frame_arena_ring.h"
+
+#include <algorithm>
+#include <limits>
+#include <new>
+
+namespace dff::native::render {
+
+namespace {
+
+bool IsPowerOfTwo(size_t value) {
+  return value != 0u && (value & (value - 1u)) == 0u;
+}
+
+}  // namespace
+
+FrameArenaRing::FrameArenaRing(size_t depth) {
+  arenas_.resize(std::clamp<size_t>(depth, 1u, kMaxDepth));
+}
+
+FrameArenaRing::~FrameArenaRing() {
+  for (Arena& arena : arenas_) {
+    FreeArena(&arena);
+  }
+}
+
+engine_native_status_t FrameArenaRing::SetDepth(size_t depth) {
+  if (depth == 0u || depth > kMaxDepth) {
+    return ENGINE_NATIVE_STATUS_INVALID_ARGUMENT;
+  }
+  if (has_active_arena()) {
+    return ENGINE_NATIVE_STATUS_INVALID_STATE;
+  }
+
+  for (size_t i = depth; i < arenas_.size(); ++i) {
+    reserved_bytes_ -= static_cast<uint64_t>(arenas_[i].capacity);
+    FreeArena(&arenas_[i]);
+  }
+
+  try {
+    arenas_.resize(depth);
+  } catch (const std::bad_alloc&) {
+    return ENGINE_NATIVE_STATUS_OUT_OF_MEMORY;
+  }
+
+  next_arena_ %= arenas_.size();
+  return ENGINE_NATIVE_STATUS_OK;
+}
+
+engine_native_status_t FrameArenaRing::Acquire(size_t requested_bytes,
+                                               size_t alignment,
+                                               void** out_memory) {
+  if (out_memory == nullptr) {
+    return ENGINE_NATIVE_STATUS_INVALID_ARGUMENT;
+  }
+
+  *out_memory = nullptr;
+
+  if (requested_bytes == 0u || !IsPowerOfTwo(alignment)) {
+    return ENGINE_NATIVE_STATUS_INVALID_ARGUMENT;
+  }
+  if (has_active_arena()) {
+    return ENGINE_NATIVE_STATUS_INVALID_STATE;
+  }
+  if (requested_bytes > std::numeric_limits<size_t>::max() - (kPageSize - 1u)) {
+    return ENGINE_NATIVE_STATUS_INVALID_ARGUMENT;
+  }
+
+  const size_t required_capacity =
+      (requested_bytes + (kPageSize - 1u)) & ~(kPageSize - 1u);
+  const size_t required_alignment = std::max(kPageSize, alignment);
+
+  Arena& arena = arenas_[next_arena_];
+  if (arena.memory != nullptr && arena.capacity >= required_capacity &&
+      arena.alignment >= required_alignment) {
+    ++reuse_count_;
+  } else {
+    const size_t grown_capacity = std::max(required_capacity, arena.capacity);
+    const size_t grown_alignment = std::max(required_alignment, arena.alignment);
+    void* memory = ::operator new(grown_capacity, std::align_val_t(grown_alignment),
+                                  std::nothrow);
+    if (memory == nullptr) {
+      return ENGINE_NATIVE_STATUS_OUT_OF_MEMORY;
+    }
+
+    reserved_bytes_ -= static_cast<uint64_t>(arena.capacity);
+    FreeArena(&arena);
+    arena.memory = memory;
+    arena.capacity = grown_capacity;
+    arena.alignment = grown_alignment;
+    reserved_bytes_ += static_cast<uint64_t>(grown_capacity);
+    ++grow_count_;
+  }
+
+  next_arena_ = (next_arena_ + 1u) % arenas_.size();
+  high_water_mark_bytes_ =
+      std::max(high_water_mark_bytes_, static_cast<uint64_t>(requested_bytes));
+  active_memory_ = static_cast<uint8_t*>(arena.memory);
+  active_capacity_ = requested_bytes;
+  *out_memory = arena.memory;
+  return ENGINE_NATIVE_STATUS_OK;
+}
+
+void FrameArenaRing::Release() {
+  active_memory_ = nullptr;
+  active_capacity_ = 0u;
+}
+
+bool FrameArenaRing::Contains(const void* data, size_t size) const {
+  if (active_memory_ == nullptr || data == nullptr) {
+    return false;
+  }
+
+  const uintptr_t begin = reinterpret_cast<uintptr_t>(active_memory_);
+  const uintptr_t address = reinterpret_cast<uintptr_t>(data);
+  if (address < begin || address - begin > active_capacity_) {
+    return false;
+  }
+
+  return size <= active_capacity_ - static_cast<size_t>(address - begin);
+}
+
+void FrameArenaRing::FreeArena(Arena* arena) {
+  if (arena == nullptr || arena->memory == nullptr) {
+    return;
+  }
+
+  ::operator delete(arena->memory, std::align_val_t(arena->alignment));
+  arena->memory = nullptr;
+  arena->capacity = 0u;
+  arena->alignment = 0u;
+}
+
+}  // namespace dff::native::render
@@ -0,0 +1,63 @@
+#ifndef DFF_ENGINE_NATIVE_FRAME_ARENA_RING_H
+#define DFF_ENGINE_NATIVE_FRAME_ARENA_RING_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "engine_native.h"
+
+namespace dff::native::render {
+
+class FrameArenaRing {
+ public:
+  static constexpr size_t kPageSize = 4096u;
+  static constexpr size_t kDefaultDepth = 3u;
+  static constexpr size_t kMaxDepth = 16u;
+
+  explicit FrameArenaRing(size_t depth = kDefaultDepth);
+  ~FrameArenaRing();
+
+  FrameArenaRing(const FrameArenaRing&) = delete;
+  FrameArenaRing& operator=(const FrameArenaRing&) = delete;
+
+  engine_native_status_t SetDepth(size_t depth);
+
+  engine_native_status_t Acquire(size_t requested_bytes,
+                                 size_t alignment,
+                                 void** out_memory);
+
+  void Release();
+
+  bool Contains(const void* data, size_t size) const;
+
+  size_t depth() const { return arenas_.size(); }
+  bool has_active_arena() const { return active_memory_ != nullptr; }
+  size_t active_capacity() const { return active_capacity_; }
+  uint64_t reuse_count() const { return reuse_count_; }
+  uint64_t grow_count() const { return grow_count_; }
+  uint64_t high_water_mark_bytes() const { return high_water_mark_bytes_; }
+  uint64_t reserved_bytes() const { return reserved_bytes_; }
+
+ private:
+  struct Arena {
+    void* memory = nullptr;
+    size_t capacity = 0u;
+    size_t alignment = 0u;
+  };
+
+  static void FreeArena(Arena* arena);
+
+  std::vector<Arena> arenas_;
+  size_t next_arena_ = 0u;
+  uint8_t* active_memory_ = nullptr;
+  size_t active_capacity_ = 0u;
+  uint64_t reuse_count_ = 0u;
+  uint64_t grow_count_ = 0u;
+  uint64_t high_water_mark_bytes_ = 0u;
+  uint64_t reserved_bytes_ = 0u;
+};
+
+}  // namespace dff::native::render
+
+#endif
@@ -31,6 +31,67 @@ constexpr const char* kTonemappedColorResourceName = "tonemapped_ldr_color";
 constexpr const char* kLdrColorResourceName = "ldr_color";
 constexpr const char* kFxaaColorResourceName = "fxaa_ldr_color";
 constexpr const char* kDebugColorResourceName = "debug_ldr_color";
+constexpr uint64_t kShadowMapByteSize = 2048u * 2048u * 4u;
+
+struct CanonicalResources {
+  RenderResourceId shadow_map = 0u;
+  RenderResourceId hdr_color = 0u;
+  RenderResourceId depth = 0u;
+  RenderResourceId normals = 0u;
+  RenderResourceId albedo = 0u;
+  RenderResourceId roughness = 0u;
+  RenderResourceId ambient_occlusion = 0u;
+  RenderResourceId bloom_color = 0u;
+  RenderResourceId tonemapped_color = 0u;
+  RenderResourceId ldr_color = 0u;
+  RenderResourceId fxaa_color = 0u;
+  RenderResourceId debug_color = 0u;
+};
+
+engine_native_status_t RegisterCanonicalResources(const FrameGraphBuildConfig& config,
+                                                  RenderGraph* graph,
+                                                  CanonicalResources* out_resources) {
+  struct Registration {
+    const char* name;
+    RenderResourceId* out_id;
+    uint32_t bytes_per_pixel;
+  };
+  const Registration registrations[] = {
+      {kShadowMapResourceName, &out_resources->shadow_map, 0u},
+      {kHdrColorResourceName, &out_resources->hdr_color, 8u},
+      {kDepthResourceName, &out_resources->depth, 4u},
+      {kNormalsResourceName, &out_resources->normals, 4u},
+      {kAlbedoResourceName, &out_resources->albedo, 4u},
+      {kRoughnessResourceName, &out_resources->roughness, 1u},
+      {kAmbientOcclusionResourceName, &out_resources->ambient_occlusion, 1u},
+      {kBloomColorResourceName, &out_resources->bloom_color, 8u},
+      {kTonemappedColorResourceName, &out_resources->tonemapped_color, 4u},
+      {kLdrColorResourceName, &out_resources->ldr_color, 4u},
+      {kFxaaColorResourceName, &out_resources->fxaa_color, 4u},
+      {kDebugColorResourceName, &out_resources->debug_color, 4u},
+  };
+
+  const uint64_t target_pixels = static_cast<uint64_t>(config.target_width) *
+                                 static_cast<uint64_t>(config.target_height);
+  for (const Registration& registration : registrations) {
+    engine_native_status_t status =
+        graph->RegisterResource(registration.name, registration.out_id);
+    if (status != ENGINE_NATIVE_STATUS_OK) {
+      return status;
+    }
+
+    const uint64_t byte_size =
+        registration.bytes_per_pixel == 0u
+            ? (target_pixels == 0u ? 0u : kShadowMapByteSize)
+            : target_pixels * registration.bytes_per_pixel;
+    status = graph->SetResourceByteSize(*registration.out_id, byte_size);
+    if (status != ENGINE_NATIVE_STATUS_OK) {
+      return status;
+    }
+  }
+
+  return ENGINE_NATIVE_STATUS_OK;
+}
 
 engine_native_status_t AddPass(RenderGraph* graph,
                                FrameGraphBuildOutput* output,
@@ -70,31 +131,32 @@ engine_native_status_t AddDebugViewPass(engine_native_debug_view_mode_t mode,
                                         RenderGraph* graph,
                                         FrameGraphBuildOutput* output,
                                         RenderPassId* out_pass_id,
-                                        const char** out_resource_name) {
+                                        const CanonicalResources& resources,
+                                        RenderResourceId* out_resource_id) {
   if (graph == nullptr || output == nullptr || out_pass_id == nullptr ||
-      out_resource_name == nullptr) {
+      out_resource_id == nullptr) {
     return ENGINE_NATIVE_STATUS_INVALID_ARGUMENT;
   }
 
   switch (mode) {
     case ENGINE_NATIVE_DEBUG_VIEW_DEPTH:
-      *out_resource_name = kDepthResourceName;
+      *out_resource_id = resources.depth;
       return AddPass(graph, output, kDebugDepthPassName,
                      rhi::RhiDevice::PassKind::kDebugDepth, out_pass_id);
     case ENGINE_NATIVE_DEBUG_VIEW_NORMALS:
-      *out_resource_name = kNormalsResourceName;
+      *out_resource_id = resources.normals;
       return AddPass(graph, output, kDebugNormalsPassName,
                      rhi::RhiDevice::PassKind::kDebugNormals, out_pass_id);
     case ENGINE_NATIVE_DEBUG_VIEW_ALBEDO:
-      *out_resource_name = kAlbedoResourceName;
+      *out_resource_id = resources.albedo;
       return AddPass(graph, output, kDebugAlbedoPassName,
                      rhi::RhiDevice::PassKind::kDebugAlbedo, out_pass_id);
     case ENGINE_NATIVE_DEBUG_VIEW_ROUGHNESS:
-      *out_resource_name = kRoughnessResourceName;
+      *out_resource_id = resources.roughness;
       return AddPass(graph, output, kDebugRoughnessPassName,
                      rhi::RhiDevice::PassKind::kDebugRoughness, out_pass_id);
     case ENGINE_NATIVE_DEBUG_VIEW_AMBIENT_OCCLUSION:
-      *out_resource_name = kAmbientOcclusionResourceName;
+      *out_resource_id = resources.ambient_occlusion;
       return AddPass(graph, output, kDebugAmbientOcclusionPassName,
                      rhi::RhiDevice::PassKind::kDebugAmbientOcclusion,
                      out_pass_id);
@@ -124,11 +186,21 @@ engine_native_status_t BuildCanonicalFrameGraph(const FrameGraphBuildConfig& con
 
   graph->Clear();
   output->pass_order.clear();
+  output->pass_levels.clear();
   output->pass_kinds_by_id.clear();
+  output->culled_passes.clear();
+  output->culled_pass_mask = 0u;
   if (out_error != nullptr) {
     out_error->clear();
   }
 
+  CanonicalResources resources;
+  engine_native_status_t status =
+      RegisterCanonicalResources(config, graph, &resources);
+  if (status != ENGINE_NATIVE_STATUS_OK) {
+    return status;
+  }
+
   RenderPassId shadow_pass = 0u;
   RenderPassId pbr_pass = 0u;
   RenderPassId ambient_occlusion_pass = 0u;
@@ -139,9 +211,8 @@ engine_native_status_t BuildCanonicalFrameGraph(const FrameGraphBuildConfig& con
   RenderPassId debug_view_pass = 0u;
   RenderPassId ui_pass = 0u;
   RenderPassId present_pass = 0u;
-  const char* final_color_resource = nullptr;
+  RenderResourceId final_color_resource = 0u;
 
-  engine_native_status_t status = ENGINE_NATIVE_STATUS_OK;
   if (config.has_draws) {
     status = AddPass(graph, output, kShadowPassName, rhi::RhiDevice::PassKind::kShadowMap,
                      &shadow_pass);
@@ -149,7 +220,7 @@ engine_native_status_t BuildCanonicalFrameGraph(const FrameGraphBuildConfig& con
       return status;
     }
 
-    status = graph->AddWrite(shadow_pass, kShadowMapResourceName);
+    status = graph->AddWrite(shadow_pass, resources.shadow_map);
     if (status != ENGINE_NATIVE_STATUS_OK) {
       return status;
     }
@@ -160,62 +231,57 @@ engine_native_status_t BuildCanonicalFrameGraph(const FrameGraphBuildConfig& con
       return status;
     }
 
-    status = graph->AddRead(pbr_pass, kShadowMapResourceName);
+    status = graph->AddRead(pbr_pass, resources.shadow_map);
     if (status != ENGINE_NATIVE_STATUS_OK) {
       return status;
     }
 
-    status = graph->AddWrite(pbr_pass, kHdrColorResourceName);
+    status = graph->AddWrite(pbr_pass, resources.hdr_color);
     if (status != ENGINE_NATIVE_STATUS_OK) {
       return status;
     }
 
-    status = graph->AddWrite(pbr_pass, kDepthResourceName);
+    status = graph->AddWrite(pbr_pass, resources.depth);
     if (status != ENGINE_NATIVE_STATUS_OK) {
       return status;
     }
 
-    status = graph->AddWrite(pbr_pass, kNormalsResourceName);
+    status = graph->AddWrite(pbr_pass, resources.normals);
     if (status != ENGINE_NATIVE_STATUS_OK) {
       return status;
     }
 
-    status = graph->AddWrite(pbr_pass, kAlbedoResourceName);
+    status = graph->AddWrite(pbr_pass, resources.albedo);
     if (status != ENGINE_NATIVE_STATUS_OK) {
       return status;
     }
 
-    status = graph->AddWrite(pbr_pass, kRoughnessResourceName);
+    status = graph->AddWrite(pbr_pass, resources.roughness);
     if (status != ENGINE_NATIVE_STATUS_OK) {
       return status;
     }
 
-    const bool needs_ambient_occlusion_pass =
-        config.debug_view_mode == ENGINE_NATIVE_DEBUG_VIEW_NONE ||
-        config.debug_view_mode == ENGINE_NATIVE_DEBUG_VIEW_AMBIENT_OCCLUSION;
-    if (needs_ambient_occlusion_pass) {
-      status = AddPass(graph, output, kAmbientOcclusionPassName,
-                       rhi::RhiDevice::PassKind::kAmbientOcclusion,
-                       &ambient_occlusion_pass);
-      if (status != ENGINE_NATIVE_STATUS_OK) {
-        return status;
-      }
+    status = AddPass(graph, output, kAmbientOcclusionPassName,
+                     rhi::RhiDevice::PassKind::kAmbientOcclusion,
+                     &ambient_occlusion_pass);
+    if (status != ENGINE_NATIVE_STATUS_OK) {
+      return status;
+    }
 
-      status = graph->AddRead(ambient_occlusion_pass, kDepthResourceName);
-      if (status != ENGINE_NATIVE_STATUS_OK) {
-        return status;
-      }
+    status = graph->AddRead(ambient_occlusion_pass, resources.depth);
+    if (status != ENGINE_NATIVE_STATUS_OK) {
+      return status;
+    }
 
-      status = graph->AddRead(ambient_occlusion_pass, kNormalsResourceName);
-      if (status != ENGINE_NATIVE_STATUS_OK) {
-        return status;
-      }
+    status = graph->AddRead(ambient_occlusion_pass, resources.normals);
+    if (status != ENGINE_NATIVE_STATUS_OK) {
+      return status;
+    }
 
-      status = graph->AddWrite(ambient_occlusion_pass,
-                               kAmbientOcclusionResourceName);
-      if (status != ENGINE_NATIVE_STATUS_OK) {
-        return status;
-      }
+    status = graph->AddWrite(ambient_occlusion_pass,
+                             resources.ambient_occlusion);
+    if (status != ENGINE_NATIVE_STATUS_OK) {
+      return status;
     }
 
     if (config.debug_view_mode == ENGINE_NATIVE_DEBUG_VIEW_NONE) {
@@ -225,17 +291,17 @@ engine_native_status_t BuildCanonicalFrameGraph(const FrameGraphBuildConfig& con
         return status;
       }
 
-      status = graph->AddRead(bloom_pass, kHdrColorResourceName);
+      status = graph->AddRead(bloom_pass, resources.hdr_color);
       if (status != ENGINE_NATIVE_STATUS_OK) {
         return status;
       }
 
-      status = graph->AddRead(bloom_pass, kAmbientOcclusionResourceName);
+      status = graph->AddRead(bloom_pass, resources.ambient_occlusion);
       if (status != ENGINE_NATIVE_STATUS_OK) {
         return status;
       }
 
-      status = graph->AddWrite(bloom_pass, kBloomColorResourceName);
+      status = graph->AddWrite(bloom_pass, resources.bloom_color);
       if (status != ENGINE_NATIVE_STATUS_OK) {
         return status;
       }
@@ -246,12 +312,12 @@ engine_native_status_t BuildCanonicalFrameGraph(const FrameGraphBuildConfig& con
         return status;
       }
 
-      status = graph->AddRead(tonemap_pass, kBloomColorResourceName);
+      status = graph->AddRead(tonemap_pass, resources.bloom_color);
       if (status != ENGINE_NATIVE_STATUS_OK) {
         return status;
       }
 
-      status = graph->AddWrite(tonemap_pass, kTonemappedColorResourceName);
+      status = graph->AddWrite(tonemap_pass, resources.tonemapped_color);
       if (status != ENGINE_NATIVE_STATUS_OK) {
         return status;
       }
@@ -263,12 +329,12 @@ engine_native_status_t BuildCanonicalFrameGraph(const FrameGraphBuildConfig& con
         return status;
       }
 
-      status = graph->AddRead(color_grading_pass, kTonemappedColorResourceName);
+      status = graph->AddRead(color_grading_pass, resources.tonemapped_color);
       if (status != ENGINE_NATIVE_STATUS_OK) {
         return status;
       }
 
-      status = graph->AddWrite(color_grading_pass, kLdrColorResourceName);
+      status = graph->AddWrite(color_grading_pass, resources.ldr_color);
       if (status != ENGINE_NATIVE_STATUS_OK) {
         return status;
       }
@@ -279,24 +345,25 @@ engine_native_status_t BuildCanonicalFrameGraph(const FrameGraphBuildConfig& con
         return status;
       }
 
-      status = graph->AddRead(fxaa_pass, kLdrColorResourceName);
+      status = graph->AddRead(fxaa_pass, resources.ldr_color);
       if (status != ENGINE_NATIVE_STATUS_OK) {
         return status;
       }
 
-      status = graph->AddWrite(fxaa_pass, kFxaaColorResourceName);
+      status = graph->AddWrite(fxaa_pass, resources.fxaa_color);
       if (status != ENGINE_NATIVE_STATUS_OK) {
         return status;
       }
 
-      final_color_resource = kFxaaColorResourceName;
+      final_color_resource = resources.fxaa_color;
     } else {
-      const char* debug_input_resource = nullptr;
+      RenderResourceId debug_input_resource = 0u;
       status = AddDebugViewPass(
           config.debug_view_mode,
           graph,
           output,
           &debug_view_pass,
+          resources,
           &debug_input_resource);
       if (status != ENGINE_NATIVE_STATUS_OK) {
         return status;
@@ -307,12 +374,12 @@ engine_native_status_t BuildCanonicalFrameGraph(const FrameGraphBuildConfig& con
         return status;
       }
 
-      status = graph->AddWrite(debug_view_pass, kDebugColorResourceName);
+      status = graph->AddWrite(debug_view_pass, resources.debug_color);
       if (status != ENGINE_NATIVE_STATUS_OK) {
         return status;
       }
 
-      final_color_resource = kDebugColorResourceName;
+      final_color_resource = resources.debug_color;
     }
   }
 
@@ -333,11 +400,11 @@ engine_native_status_t BuildCanonicalFrameGraph(const FrameGraphBuildConfig& con
         return status;
       }
     } else {
-      status = graph->AddWrite(ui_pass, kLdrColorResourceName);
+      status = graph->AddWrite(ui_pass, resources.ldr_color);
       if (status != ENGINE_NATIVE_STATUS_OK) {
         return status;
       }
-      final_color_resource = kLdrColorResourceName;
+      final_color_resource = resources.ldr_color;
     }
   }
 
@@ -354,7 +421,24 @@ engine_native_status_t BuildCanonicalFrameGraph(const FrameGraphBuildConfig& con
     }
   }
 
-  return graph->Compile(&output->pass_order, out_error);
+  status = graph->MarkRoot(present_pass);
+  if (status != ENGINE_NATIVE_STATUS_OK) {
+    return status;
+  }
+
+  status = graph->Compile(&output->pass_order, &output->culled_passes,
+                          &output->pass_levels, out_error);
+  if (status != ENGINE_NATIVE_STATUS_OK) {
+    return status;
+  }
+
+  for (RenderPassId culled_pass : output->culled_passes) {
+    output->culled_pass_mask |=
+        static_cast<uint64_t>(1u)
+        << static_cast<uint32_t>(output->pass_kinds_by_id[culled_pass]);
+  }
+
+  return graph->BuildAliasingPlan(output->pass_order, &output->aliasing_plan);
 }
 
 }  // namespace dff::native::render
@@ -1,6 +1,7 @@
 #ifndef DFF_ENGINE_NATIVE_FRAME_GRAPH_BUILDER_H
 #define DFF_ENGINE_NATIVE_FRAME_GRAPH_BUILDER_H
 
+#include <cstdint>
 #include <string>
 #include <vector>
 
@@ -13,11 +14,18 @@ struct FrameGraphBuildConfig {
   bool has_draws = false;
   bool has_ui = false;
   engine_native_debug_view_mode_t debug_view_mode = ENGINE_NATIVE_DEBUG_VIEW_NONE;
+  uint8_t render_feature_flags = 0u;
+  uint32_t target_width = 0u;
+  uint32_t target_height = 0u;
 };
 
 struct FrameGraphBuildOutput {
   std::vector<RenderPassId> pass_order;
+  std::vector<uint32_t> pass_levels;
   std::vector<rhi::RhiDevice::PassKind> pass_kinds_by_id;
+  std::vector<RenderPassId> culled_passes;
+  uint64_t culled_pass_mask = 0u;
+  TransientAliasingPlan aliasing_plan;
 };
 
 engine_native_status_t BuildCanonicalFrameGraph(const FrameGraphBuildConfig& config,
@@ -0,0 +1,63 @@
+#include "render/frame_graph_cache.h"
+
+#include <new>
+#include <utility>
+
+namespace dff::native::render {
+
+uint64_t FrameGraphCache::ComposeKey(const FrameGraphBuildConfig& config) {
+  return (config.has_draws ? 0x1u : 0u) | (config.has_ui ? 0x2u : 0u) |
+         (static_cast<uint64_t>(config.debug_view_mode & 0xFFu) << 8u) |
+         (static_cast<uint64_t>(config.render_feature_flags) << 16u);
+}
+
+engine_native_status_t FrameGraphCache::GetOrBuild(
+    const FrameGraphBuildConfig& config,
+    const FrameGraphBuildOutput** out_output) {
+  if (out_output == nullptr) {
+    return ENGINE_NATIVE_STATUS_INVALID_ARGUMENT;
+  }
+
+  *out_output = nullptr;
+  if (config.target_width != target_width_ ||
+      config.target_height != target_height_) {
+    entries_.clear();
+    target_width_ = config.target_width;
+    target_height_ = config.target_height;
+  }
+
+  const uint64_t key = ComposeKey(config);
+  const auto it = entries_.find(key);
+  if (it != entries_.end()) {
+    ++hit_count_;
+    *out_output = &it->second;
+    return ENGINE_NATIVE_STATUS_OK;
+  }
+
+  ++miss_count_;
+  try {
+    FrameGraphBuildOutput output;
+    const engine_native_status_t status =
+        BuildCanonicalFrameGraph(config, &scratch_graph_, &output, &last_error_);
+    if (status != ENGINE_NATIVE_STATUS_OK) {
+      return status;
+    }
+
+    const auto inserted = entries_.emplace(key, std::move(output));
+    *out_output = &inserted.first->second;
+  } catch (const std::bad_alloc&) {
+    return ENGINE_NATIVE_STATUS_OUT_OF_MEMORY;
+  }
+
+  return ENGINE_NATIVE_STATUS_OK;
+}
+
+void FrameGraphCache::Clear() {
+  scratch_graph_.Clear();
+  entries_.clear();
+  last_error_.clear();
+  target_width_ = 0u;
+  target_height_ = 0u;
+}
+
+}  // namespace dff::native::render
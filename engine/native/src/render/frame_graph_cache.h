@@ -0,0 +1,43 @@
+#ifndef DFF_ENGINE_NATIVE_FRAME_GRAPH_CACHE_H
+#define DFF_ENGINE_NATIVE_FRAME_GRAPH_CACHE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+
+#include "render/frame_graph_builder.h"
+#include "render/render_graph.h"
+
+namespace dff::native::render {
+
+// Compiled frame graphs keyed by the structural parts of the build config.
+// Cached outputs are sized for a single render-target extent; a request for a
+// different extent drops every entry, so resizing never accumulates graphs.
+class FrameGraphCache {
+ public:
+  engine_native_status_t GetOrBuild(const FrameGraphBuildConfig& config,
+                                    const FrameGraphBuildOutput** out_output);
+
+  void Clear();
+
+  size_t size() const { return entries_.size(); }
+  uint64_t hit_count() const { return hit_count_; }
+  uint64_t miss_count() const { return miss_count_; }
+  const std::string& last_error() const { return last_error_; }
+
+  static uint64_t ComposeKey(const FrameGraphBuildConfig& config);
+
+ private:
+  RenderGraph scratch_graph_;
+  std::unordered_map<uint64_t, FrameGraphBuildOutput> entries_;
+  std::string last_error_;
+  uint32_t target_width_ = 0u;
+  uint32_t target_height_ = 0u;
+  uint64_t hit_count_ = 0u;
+  uint64_t miss_count_ = 0u;
+};
+
+}  // namespace dff::native::render
+
+#endif
@@ -0,0 +1,113 @@
+#include "render/material_pipeline_memo.h"
+
+#include <new>
+#include <utility>
+
+namespace dff::native::render {
+
+void MaterialPipelineMemo::BeginFrame() {
+  AdvanceEpoch();
+  lookup_count_ = 0u;
+  hit_count_ = 0u;
+}
+
+void MaterialPipelineMemo::Invalidate() { AdvanceEpoch(); }
+
+const rhi::PipelineStateRecord* MaterialPipelineMemo::Find(
+    engine_native_resource_handle_t material,
+    uint32_t feature_flags) {
+  ++lookup_count_;
+  if (size_ == 0u) {
+    return nullptr;
+  }
+
+  const size_t mask = slots_.size() - 1u;
+  for (size_t index = Hash(material, feature_flags) & mask;;
+       index = (index + 1u) & mask) {
+    const Slot& slot = slots_[index];
+    if (slot.epoch != epoch_) {
+      return nullptr;
+    }
+
+    if (slot.material == material && slot.feature_flags == feature_flags) {
+      ++hit_count_;
+      return &slot.record;
+    }
+  }
+}
+
+engine_native_status_t MaterialPipelineMemo::Insert(
+    engine_native_resource_handle_t material,
+    uint32_t feature_flags,
+    const rhi::PipelineStateRecord& record) {
+  if ((size_ + 1u) * 2u > slots_.size()) {
+    const engine_native_status_t status = Grow();
+    if (status != ENGINE_NATIVE_STATUS_OK) {
+      return status;
+    }
+  }
+
+  const size_t mask = slots_.size() - 1u;
+  size_t index = Hash(material, feature_flags) & mask;
+  while (slots_[index].epoch == epoch_) {
+    if (slots_[index].material == material &&
+        slots_[index].feature_flags == feature_flags) {
+      slots_[index].record = record;
+      return ENGINE_NATIVE_STATUS_OK;
+    }
+    index = (index + 1u) & mask;
+  }
+
+  slots_[index] = Slot{material, feature_flags, epoch_, record};
+  ++size_;
+  return ENGINE_NATIVE_STATUS_OK;
+}
+
+size_t MaterialPipelineMemo::Hash(engine_native_resource_handle_t material,
+                                  uint32_t feature_flags) {
+  uint64_t value = static_cast<uint64_t>(material) ^
+                   (static_cast<uint64_t>(feature_flags) * 0x9E3779B97F4A7C15ull);
+  value ^= value >> 33u;
+  value *= 0xFF51AFD7ED558CCDull;
+  value ^= value >> 33u;
+  return static_cast<size_t>(value);
+}
+
+void MaterialPipelineMemo::AdvanceEpoch() {
+  size_ = 0u;
+  if (++epoch_ != 0u) {
+    return;
+  }
+
+  for (Slot& slot : slots_) {
+    slot.epoch = 0u;
+  }
+  epoch_ = 1u;
+}
+
+engine_native_status_t MaterialPipelineMemo::Grow() {
+  std::vector<Slot> grown;
+  try {
+    grown.resize(slots_.empty() ? kInitialCapacity : slots_.size() * 2u);
+  } catch (const std::bad_alloc&) {
+    return ENGINE_NATIVE_STATUS_OUT_OF_MEMORY;
+  }
+
+  const size_t mask = grown.size() - 1u;
+  for (const Slot& slot : slots_) {
+    if (slot.epoch != epoch_) {
+      continue;
+    }
+
+    size_t index = Hash(slot.material, slot.feature_flags) & mask;
+    while (grown[index].epoch == epoch_) {
+      index = (index + 1u) & mask;
+    }
+    grown[index] = slot;
+  }
+
+  slots_ = std::move(grown);
+  return ENGINE_NATIVE_STATUS_OK;
+}
+
+}  // namespace dff::native::render
@@ -0,0 +1,58 @@
+#ifndef DFF_ENGINE_NATIVE_MATERIAL_PIPELINE_MEMO_H
+#define DFF_ENGINE_NATIVE_MATERIAL_PIPELINE_MEMO_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "engine_native.h"
+#include "rhi/pipeline_state_cache.h"
+
+namespace dff::native::render {
+
+// Frame-scoped open-addressing map from (material, feature flags) to the
+// pipeline record resolved for it. Slots are stamped with a frame epoch, so
+// starting a new frame does not touch the table.
+class MaterialPipelineMemo {
+ public:
+  static constexpr size_t kInitialCapacity = 64u;
+
+  void BeginFrame();
+  void Invalidate();
+
+  const rhi::PipelineStateRecord* Find(engine_native_resource_handle_t material,
+                                       uint32_t feature_flags);
+
+  engine_native_status_t Insert(engine_native_resource_handle_t material,
+                                uint32_t feature_flags,
+                                const rhi::PipelineStateRecord& record);
+
+  size_t size() const { return size_; }
+  size_t capacity() const { return slots_.size(); }
+  uint32_t lookup_count() const { return lookup_count_; }
+  uint32_t hit_count() const { return hit_count_; }
+  uint32_t unique_count() const { return lookup_count_ - hit_count_; }
+
+ private:
+  struct Slot {
+    engine_native_resource_handle_t material = 0u;
+    uint32_t feature_flags = 0u;
+    uint32_t epoch = 0u;
+    rhi::PipelineStateRecord record;
+  };
+
+  static size_t Hash(engine_native_resource_handle_t material,
+                     uint32_t feature_flags);
+  void AdvanceEpoch();
+  engine_native_status_t Grow();
+
+  std::vector<Slot> slots_;
+  size_t size_ = 0u;
+  uint32_t epoch_ = 1u;
+  uint32_t lookup_count_ = 0u;
+  uint32_t hit_count_ = 0u;
+};
+
+}  // namespace dff::native::render
+
+#endif
@@ -21,7 +21,7 @@ engine_native_status_t MaterialSystem::RegisterMaterial(
     return ENGINE_NATIVE_STATUS_INVALID_ARGUMENT;
   }
 
-  if ((feature_flags & ~kAllowedFeatureMask) != 0u) {
+  if (!IsSupportedFeatureFlags(feature_flags)) {
     return ENGINE_NATIVE_STATUS_INVALID_ARGUMENT;
   }
 
@@ -43,11 +43,7 @@ engine_native_status_t MaterialSystem::ResolveVariant(
     feature_flags = material_it->second;
   }
 
-  out_variant->value = feature_flags;
-  if (shadows_enabled) {
-    out_variant->value |= kVariantShadowBit;
-  }
-
+  *out_variant = ComposeVariant(feature_flags, shadows_enabled);
   return ENGINE_NATIVE_STATUS_OK;
 }
 
@@ -59,4 +55,17 @@ void MaterialSystem::RemoveMaterial(engine_native_resource_handle_t material) {
   feature_flags_by_material_.erase(material);
 }
 
+bool MaterialSystem::IsSupportedFeatureFlags(uint32_t feature_flags) {
+  return (feature_flags & ~kAllowedFeatureMask) == 0u;
+}
+
+ShaderVariantKey MaterialSystem::ComposeVariant(uint32_t feature_flags,
+                                                bool shadows_enabled) {
+  ShaderVariantKey variant{feature_flags};
+  if (shadows_enabled) {
+    variant.value |= kVariantShadowBit;
+  }
+  return variant;
+}
+
 }  // namespace dff::native::render
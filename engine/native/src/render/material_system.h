@@ -24,6 +24,9 @@ class MaterialSystem {
 
   void RemoveMaterial(engine_native_resource_handle_t material);
 
+  static bool IsSupportedFeatureFlags(uint32_t feature_flags);
+  static ShaderVariantKey ComposeVariant(uint32_t feature_flags, bool shadows_enabled);
+
   void Clear() { feature_flags_by_material_.clear(); }
 
   size_t material_count() const { return feature_flags_by_material_.size(); }
@@ -0,0 +1,225 @@
+#include "render/parallel_pass_recorder.h"
+
+#include <algorithm>
+#include <chrono>
+#include <new>
+#include <system_error>
+
+namespace dff::native::render {
+
+ParallelPassRecorder::ParallelPassRecorder(size_t worker_count)
+    : worker_count_(std::min(worker_count, kMaxWorkerCount)) {}
+
+ParallelPassRecorder::~ParallelPassRecorder() {
+  {
+    std::lock_guard<std::mutex> guard(mutex_);
+    stopping_ = true;
+  }
+  work_cv_.notify_all();
+
+  for (std::thread& worker : workers_) {
+    worker.join();
+  }
+}
+
+size_t ParallelPassRecorder::DefaultWorkerCount() {
+  const unsigned int hardware_threads = std::thread::hardware_concurrency();
+  if (hardware_threads <= 1u) {
+    return 1u;
+  }
+
+  return std::min<size_t>(hardware_threads - 1u, kMaxWorkerCount);
+}
+
+engine_native_status_t ParallelPassRecorder::Record(
+    const FrameGraphBuildOutput& graph,
+    std::vector<rhi::RhiCommandList>* out_command_lists,
+    std::vector<uint64_t>* out_pass_cpu_ns) {
+  if (out_command_lists == nullptr || out_pass_cpu_ns == nullptr) {
+    return ENGINE_NATIVE_STATUS_INVALID_ARGUMENT;
+  }
+
+  const size_t pass_count = graph.pass_order.size();
+  if (graph.pass_levels.size() != pass_count) {
+    return ENGINE_NATIVE_STATUS_INVALID_ARGUMENT;
+  }
+
+  try {
+    out_command_lists->resize(pass_count);
+    out_pass_cpu_ns->assign(pass_count, 0u);
+
+    uint32_t level_count = 0u;
+    for (uint32_t level : graph.pass_levels) {
+      level_count = std::max(level_count, level + 1u);
+    }
+
+    level_offsets_.assign(static_cast<size_t>(level_count) + 1u, 0u);
+    for (uint32_t level : graph.pass_levels) {
+      ++level_offsets_[level + 1u];
+    }
+    for (uint32_t level = 0u; level < level_count; ++level) {
+      level_offsets_[level + 1u] += level_offsets_[level];
+    }
+
+    positions_by_level_.resize(pass_count);
+    std::vector<uint32_t> fill_cursor(level_offsets_.begin(),
+                                      level_offsets_.end() - 1);
+    for (uint32_t position = 0u; position < static_cast<uint32_t>(pass_count);
+         ++position) {
+      positions_by_level_[fill_cursor[graph.pass_levels[position]]++] = position;
+    }
+  } catch (const std::bad_alloc&) {
+    return ENGINE_NATIVE_STATUS_OUT_OF_MEMORY;
+  }
+
+  const uint32_t level_count =
+      static_cast<uint32_t>(level_offsets_.size() - 1u);
+  uint32_t max_level_width = 0u;
+  for (uint32_t level = 0u; level < level_count; ++level) {
+    Batch batch;
+    batch.graph = &graph;
+    batch.positions = positions_by_level_.data() + level_offsets_[level];
+    batch.count = level_offsets_[level + 1u] - level_offsets_[level];
+    batch.command_lists = out_command_lists;
+    batch.pass_cpu_ns = out_pass_cpu_ns;
+    if (batch.count == 0u) {
+      continue;
+    }
+
+    max_level_width = std::max(max_level_width, static_cast<uint32_t>(batch.count));
+    engine_native_status_t status = ENGINE_NATIVE_STATUS_OK;
+    if (batch.count == 1u || worker_count_ == 0u) {
+      for (size_t i = 0u; i < batch.count && status == ENGINE_NATIVE_STATUS_OK;
+           ++i) {
+        status = RecordPosition(batch, batch.positions[i]);
+      }
+    } else {
+      status = DispatchBatch(batch);
+    }
+
+    if (status != ENGINE_NATIVE_STATUS_OK) {
+      return status;
+    }
+  }
+
+  last_level_count_ = level_count;
+  last_max_level_width_ = max_level_width;
+  return ENGINE_NATIVE_STATUS_OK;
+}
+
+engine_native_status_t ParallelPassRecorder::StartWorkers() {
+  if (!workers_.empty()) {
+    return ENGINE_NATIVE_STATUS_OK;
+  }
+
+  try {
+    workers_.reserve(worker_count_);
+    for (size_t i = 0u; i < worker_count_; ++i) {
+      workers_.emplace_back(&ParallelPassRecorder::WorkerLoop, this);
+    }
+  } catch (const std::system_error&) {
+    return workers_.empty() ? ENGINE_NATIVE_STATUS_INTERNAL_ERROR
+                            : ENGINE_NATIVE_STATUS_OK;
+  } catch (const std::bad_alloc&) {
+    return workers_.empty() ? ENGINE_NATIVE_STATUS_OUT_OF_MEMORY
+                            : ENGINE_NATIVE_STATUS_OK;
+  }
+
+  return ENGINE_NATIVE_STATUS_OK;
+}
+
+engine_native_status_t ParallelPassRecorder::DispatchBatch(const Batch& batch) {
+  const engine_native_status_t start_status = StartWorkers();
+  if (start_status != ENGINE_NATIVE_STATUS_OK) {
+    return start_status;
+  }
+
+  {
+    std::lock_guard<std::mutex> guard(mutex_);
+    batch_ = batch;
+    pending_jobs_ = batch.count;
+    next_job_.store(0u, std::memory_order_relaxed);
+    batch_status_.store(ENGINE_NATIVE_STATUS_OK, std::memory_order_relaxed);
+    ++generation_;
+  }
+  work_cv_.notify_all();
+
+  size_t completed = 0u;
+  RunBatchJobs(batch, &completed);
+
+  std::unique_lock<std::mutex> lock(mutex_);
+  pending_jobs_ -= completed;
+  done_cv_.wait(lock, [this] { return pending_jobs_ == 0u && active_workers_ == 0u; });
+  batch_ = Batch{};
+  return static_cast<engine_native_status_t>(
+      batch_status_.load(std::memory_order_relaxed));
+}
+
+void ParallelPassRecorder::WorkerLoop() {
+  uint64_t seen_generation = 0u;
+  for (;;) {
+    Batch batch;
+    {
+      std::unique_lock<std::mutex> lock(mutex_);
+      work_cv_.wait(lock, [&] {
+        return stopping_ || (generation_ != seen_generation && pending_jobs_ > 0u);
+      });
+      if (stopping_) {
+        return;
+      }
+
+      seen_generation = generation_;
+      batch = batch_;
+      ++active_workers_;
+    }
+
+    size_t completed = 0u;
+    RunBatchJobs(batch, &completed);
+
+    {
+      std::lock_guard<std::mutex> guard(mutex_);
+      pending_jobs_ -= completed;
+      --active_workers_;
+    }
+    done_cv_.notify_all();
+  }
+}
+
+void ParallelPassRecorder::RunBatchJobs(const Batch& batch, size_t* out_completed) {
+  size_t completed = 0u;
+  for (;;) {
+    const size_t job = next_job_.fetch_add(1u, std::memory_order_relaxed);
+    if (job >= batch.count) {
+      break;
+    }
+
+    const engine_native_status_t status = RecordPosition(batch, batch.positions[job]);
+    if (status != ENGINE_NATIVE_STATUS_OK) {
+      batch_status_.store(status, std::memory_order_relaxed);
+    }
+    ++completed;
+  }
+
+  *out_completed = completed;
+}
+
+engine_native_status_t ParallelPassRecorder::RecordPosition(const Batch& batch,
+                                                            uint32_t position) {
+  const auto start = std::chrono::steady_clock::now();
+  rhi::RhiCommandList& command_list = (*batch.command_lists)[position];
+  command_list.Reset();
+
+  const size_t pass_index = static_cast<size_t>(batch.graph->pass_order[position]);
+  engine_native_status_t status = ENGINE_NATIVE_STATUS_INTERNAL_ERROR;
+  if (pass_index < batch.graph->pass_kinds_by_id.size()) {
+    status = command_list.RecordPass(batch.graph->pass_kinds_by_id[pass_index]);
+  }
+
+  (*batch.pass_cpu_ns)[position] = static_cast<uint64_t>(
+      std::chrono::duration_cast<std::chrono::nanoseconds>(
+          std::chrono::steady_clock::now() - start)
+          .count());
+  return status;
+}
+
+}  // namespace dff::native::render
@@ -0,0 +1,74 @@
+#ifndef DFF_ENGINE_NATIVE_PARALLEL_PASS_RECORDER_H
+#define DFF_ENGINE_NATIVE_PARALLEL_PASS_RECORDER_H
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "engine_native.h"
+#include "render/frame_graph_builder.h"
+#include "rhi/rhi_command_list.h"
+
+namespace dff::native::render {
+
+class ParallelPassRecorder {
+ public:
+  static constexpr size_t kMaxWorkerCount = 4u;
+
+  explicit ParallelPassRecorder(size_t worker_count = DefaultWorkerCount());
+  ~ParallelPassRecorder();
+
+  ParallelPassRecorder(const ParallelPassRecorder&) = delete;
+  ParallelPassRecorder& operator=(const ParallelPassRecorder&) = delete;
+
+  engine_native_status_t Record(const FrameGraphBuildOutput& graph,
+                                std::vector<rhi::RhiCommandList>* out_command_lists,
+                                std::vector<uint64_t>* out_pass_cpu_ns);
+
+  static size_t DefaultWorkerCount();
+
+  size_t worker_count() const { return worker_count_; }
+  size_t started_worker_count() const { return workers_.size(); }
+  uint32_t last_level_count() const { return last_level_count_; }
+  uint32_t last_max_level_width() const { return last_max_level_width_; }
+
+ private:
+  struct Batch {
+    const FrameGraphBuildOutput* graph = nullptr;
+    const uint32_t* positions = nullptr;
+    size_t count = 0u;
+    std::vector<rhi::RhiCommandList>* command_lists = nullptr;
+    std::vector<uint64_t>* pass_cpu_ns = nullptr;
+  };
+
+  engine_native_status_t StartWorkers();
+  void WorkerLoop();
+  void RunBatchJobs(const Batch& batch, size_t* out_completed);
+  engine_native_status_t RecordPosition(const Batch& batch, uint32_t position);
+  engine_native_status_t DispatchBatch(const Batch& batch);
+
+  size_t worker_count_ = 0u;
+  std::vector<std::thread> workers_;
+  std::mutex mutex_;
+  std::condition_variable work_cv_;
+  std::condition_variable done_cv_;
+  Batch batch_;
+  uint64_t generation_ = 0u;
+  size_t pending_jobs_ = 0u;
+  size_t active_workers_ = 0u;
+  bool stopping_ = false;
+  std::atomic<size_t> next_job_{0u};
+  std::atomic<int> batch_status_{ENGINE_NATIVE_STATUS_OK};
+  std::vector<uint32_t> positions_by_level_;
+  std::vector<uint32_t> level_offsets_;
+  uint32_t last_level_count_ = 0u;
+  uint32_t last_max_level_width_ = 0u;
+};
+
+}  // namespace dff::native::render
+
+#endif
@@ -3,20 +3,35 @@
 #include <algorithm>
 #include <limits>
 #include <queue>
-#include <unordered_map>
-#include <unordered_set>
 #include <utility>
 
 namespace dff::native::render {
 
 namespace {
 
+constexpr uint32_t kNoEntry = std::numeric_limits<uint32_t>::max();
+
 bool IsValidResourceName(const std::string& name) {
   return !name.empty();
 }
 
-uint64_t EncodeEdge(RenderPassId from, RenderPassId to) {
-  return (static_cast<uint64_t>(from) << 32u) | static_cast<uint64_t>(to);
+void BuildAdjacency(size_t pass_count,
+                    const std::vector<std::pair<RenderPassId, RenderPassId>>& edges,
+                    std::vector<uint32_t>* out_offsets,
+                    std::vector<RenderPassId>* out_targets) {
+  out_offsets->assign(pass_count + 1u, 0u);
+  for (const auto& edge : edges) {
+    ++(*out_offsets)[edge.first + 1u];
+  }
+  for (size_t i = 0u; i < pass_count; ++i) {
+    (*out_offsets)[i + 1u] += (*out_offsets)[i];
+  }
+
+  out_targets->resize(edges.size());
+  std::vector<uint32_t> fill_cursor(out_offsets->begin(), out_offsets->end() - 1);
+  for (const auto& edge : edges) {
+    (*out_targets)[fill_cursor[edge.first]++] = edge.second;
+  }
 }
 
 }  // namespace
@@ -57,75 +72,193 @@ engine_native_status_t RenderGraph::AddDependency(RenderPassId before,
   return ENGINE_NATIVE_STATUS_OK;
 }
 
-engine_native_status_t RenderGraph::ImportResource(
-    const std::string& resource_name) {
-  if (!IsValidResourceName(resource_name)) {
+engine_native_status_t RenderGraph::MarkRoot(RenderPassId pass_id) {
+  if (!IsValidPassId(pass_id)) {
+    return ENGINE_NATIVE_STATUS_INVALID_ARGUMENT;
+  }
+
+  if (!passes_[pass_id].is_root) {
+    passes_[pass_id].is_root = true;
+    ++root_count_;
+  }
+  return ENGINE_NATIVE_STATUS_OK;
+}
+
+engine_native_status_t RenderGraph::RegisterResource(
+    const std::string& resource_name,
+    RenderResourceId* out_resource_id) {
+  if (out_resource_id == nullptr || !IsValidResourceName(resource_name)) {
+    return ENGINE_NATIVE_STATUS_INVALID_ARGUMENT;
+  }
+
+  const auto it = resource_ids_.find(resource_name);
+  if (it != resource_ids_.end()) {
+    *out_resource_id = it->second;
+    return ENGINE_NATIVE_STATUS_OK;
+  }
+
+  if (resource_names_.size() >= static_cast<size_t>(kNoEntry)) {
+    return ENGINE_NATIVE_STATUS_INTERNAL_ERROR;
+  }
+
+  const RenderResourceId resource_id =
+      static_cast<RenderResourceId>(resource_names_.size());
+  resource_names_.push_back(resource_name);
+  resource_imported_.push_back(0u);
+  resource_byte_sizes_.push_back(0u);
+  resource_ids_.emplace(resource_name, resource_id);
+  *out_resource_id = resource_id;
+  return ENGINE_NATIVE_STATUS_OK;
+}
+
+engine_native_status_t RenderGraph::ImportResource(RenderResourceId resource_id) {
+  if (!IsValidResourceId(resource_id) || resource_imported_[resource_id] != 0u) {
     return ENGINE_NATIVE_STATUS_INVALID_ARGUMENT;
   }
-  if (!imported_resources_.insert(resource_name).second) {
+
+  resource_imported_[resource_id] = 1u;
+  return ENGINE_NATIVE_STATUS_OK;
+}
+
+engine_native_status_t RenderGraph::SetResourceByteSize(
+    RenderResourceId resource_id,
+    uint64_t byte_size) {
+  if (!IsValidResourceId(resource_id)) {
     return ENGINE_NATIVE_STATUS_INVALID_ARGUMENT;
   }
 
+  resource_byte_sizes_[resource_id] = byte_size;
   return ENGINE_NATIVE_STATUS_OK;
 }
 
 engine_native_status_t RenderGraph::AddRead(RenderPassId pass_id,
-                                            const std::string& resource_name) {
-  if (!IsValidPassId(pass_id) || !IsValidResourceName(resource_name)) {
+                                            RenderResourceId resource_id) {
+  if (!IsValidPassId(pass_id) || !IsValidResourceId(resource_id)) {
     return ENGINE_NATIVE_STATUS_INVALID_ARGUMENT;
   }
-  if (std::find(passes_[pass_id].reads.begin(), passes_[pass_id].reads.end(),
-                resource_name) != passes_[pass_id].reads.end()) {
+
+  std::vector<RenderResourceId>& reads = passes_[pass_id].reads;
+  if (std::find(reads.begin(), reads.end(), resource_id) != reads.end()) {
     return ENGINE_NATIVE_STATUS_INVALID_ARGUMENT;
   }
 
-  passes_[pass_id].reads.push_back(resource_name);
+  reads.push_back(resource_id);
   return ENGINE_NATIVE_STATUS_OK;
 }
 
 engine_native_status_t RenderGraph::AddWrite(RenderPassId pass_id,
-                                             const std::string& resource_name) {
-  if (!IsValidPassId(pass_id) || !IsValidResourceName(resource_name)) {
+                                             RenderResourceId resource_id) {
+  if (!IsValidPassId(pass_id) || !IsValidResourceId(resource_id)) {
     return ENGINE_NATIVE_STATUS_INVALID_ARGUMENT;
   }
-  if (std::find(passes_[pass_id].writes.begin(), passes_[pass_id].writes.end(),
-                resource_name) != passes_[pass_id].writes.end()) {
+
+  std::vector<RenderResourceId>& writes = passes_[pass_id].writes;
+  if (std::find(writes.begin(), writes.end(), resource_id) != writes.end()) {
     return ENGINE_NATIVE_STATUS_INVALID_ARGUMENT;
   }
 
-  passes_[pass_id].writes.push_back(resource_name);
+  writes.push_back(resource_id);
   return ENGINE_NATIVE_STATUS_OK;
 }
 
+engine_native_status_t RenderGraph::ImportResource(
+    const std::string& resource_name) {
+  RenderResourceId resource_id = 0u;
+  const engine_native_status_t status =
+      RegisterResource(resource_name, &resource_id);
+  if (status != ENGINE_NATIVE_STATUS_OK) {
+    return status;
+  }
+
+  return ImportResource(resource_id);
+}
+
+engine_native_status_t RenderGraph::AddRead(RenderPassId pass_id,
+                                            const std::string& resource_name) {
+  if (!IsValidPassId(pass_id)) {
+    return ENGINE_NATIVE_STATUS_INVALID_ARGUMENT;
+  }
+
+  RenderResourceId resource_id = 0u;
+  const engine_native_status_t status =
+      RegisterResource(resource_name, &resource_id);
+  if (status != ENGINE_NATIVE_STATUS_OK) {
+    return status;
+  }
+
+  return AddRead(pass_id, resource_id);
+}
+
+engine_native_status_t RenderGraph::AddWrite(RenderPassId pass_id,
+                                             const std::string& resource_name) {
+  if (!IsValidPassId(pass_id)) {
+    return ENGINE_NATIVE_STATUS_INVALID_ARGUMENT;
+  }
+
+  RenderResourceId resource_id = 0u;
+  const engine_native_status_t status =
+      RegisterResource(resource_name, &resource_id);
+  if (status != ENGINE_NATIVE_STATUS_OK) {
+    return status;
+  }
+
+  return AddWrite(pass_id, resource_id);
+}
+
+engine_native_status_t RenderGraph::Compile(std::vector<RenderPassId>* out_order,
+                                            std::string* out_error) const {
+  return Compile(out_order, nullptr, nullptr, out_error);
+}
+
+engine_native_status_t RenderGraph::Compile(std::vector<RenderPassId>* out_order,
+                                            std::vector<RenderPassId>* out_culled,
+                                            std::string* out_error) const {
+  return Compile(out_order, out_culled, nullptr, out_error);
+}
+
 engine_native_status_t RenderGraph::Compile(std::vector<RenderPassId>* out_order,
+                                            std::vector<RenderPassId>* out_culled,
+                                            std::vector<uint32_t>* out_levels,
                                             std::string* out_error) const {
   if (out_order == nullptr) {
     return ENGINE_NATIVE_STATUS_INVALID_ARGUMENT;
   }
 
   out_order->clear();
+  if (out_culled != nullptr) {
+    out_culled->clear();
+  }
+  if (out_levels != nullptr) {
+    out_levels->clear();
+  }
   if (out_error != nullptr) {
     out_error->clear();
   }
 
   const size_t pass_count = passes_.size();
+  const size_t resource_count = resource_names_.size();
+  const size_t words_per_row = (pass_count + 63u) / 64u;
   out_order->reserve(pass_count);
 
-  std::vector<std::vector<RenderPassId>> adjacency(pass_count);
+  std::vector<uint64_t> edge_bits(pass_count * words_per_row, 0u);
+  std::vector<std::pair<RenderPassId, RenderPassId>> edges;
+  std::vector<std::pair<RenderPassId, RenderPassId>> producer_edges;
   std::vector<uint32_t> indegree(pass_count, 0u);
-  std::unordered_set<uint64_t> edge_set;
+  std::vector<uint32_t> level(pass_count, 0u);
 
   auto add_edge = [&](RenderPassId from, RenderPassId to) {
     if (from == to) {
       return;
     }
 
-    const uint64_t encoded = EncodeEdge(from, to);
-    if (!edge_set.insert(encoded).second) {
+    uint64_t& word = edge_bits[static_cast<size_t>(from) * words_per_row + (to >> 6u)];
+    const uint64_t bit = static_cast<uint64_t>(1u) << (to & 63u);
+    if ((word & bit) != 0u) {
       return;
     }
 
-    adjacency[from].push_back(to);
+    word |= bit;
+    edges.emplace_back(from, to);
     ++indegree[to];
   };
 
@@ -141,52 +274,61 @@ engine_native_status_t RenderGraph::Compile(std::vector<RenderPassId>* out_order
       }
 
       add_edge(dependency, pass_id);
+      producer_edges.emplace_back(pass_id, dependency);
     }
   }
 
-  std::unordered_map<std::string, RenderPassId> last_writer;
-  std::unordered_map<std::string, std::vector<RenderPassId>> last_readers;
+  std::vector<RenderPassId> last_writer(resource_count, kNoEntry);
+  std::vector<uint32_t> reader_head(resource_count, kNoEntry);
+  std::vector<RenderPassId> reader_pass;
+  std::vector<uint32_t> reader_next;
 
   for (RenderPassId pass_id = 0u; pass_id < static_cast<RenderPassId>(pass_count);
        ++pass_id) {
     const PassNode& pass = passes_[pass_id];
 
-    for (const std::string& resource : pass.reads) {
-      auto writer_it = last_writer.find(resource);
-      if (writer_it != last_writer.end()) {
-        add_edge(writer_it->second, pass_id);
-      } else if (!imported_resources_.contains(resource)) {
+    for (RenderResourceId resource : pass.reads) {
+      if (last_writer[resource] != kNoEntry) {
+        add_edge(last_writer[resource], pass_id);
+        producer_edges.emplace_back(pass_id, last_writer[resource]);
+      } else if (resource_imported_[resource] == 0u) {
         out_order->clear();
         if (out_error != nullptr) {
-          *out_error = "RenderGraph reads unknown resource: " + resource +
-                       " in pass '" + pass.name + "'.";
+          *out_error = "RenderGraph reads unknown resource: " +
+                       resource_names_[resource] + " in pass '" + pass.name +
+                       "'.";
         }
         return ENGINE_NATIVE_STATUS_INVALID_STATE;
       }
 
-      last_readers[resource].push_back(pass_id);
+      reader_pass.push_back(pass_id);
+      reader_next.push_back(reader_head[resource]);
+      reader_head[resource] = static_cast<uint32_t>(reader_pass.size() - 1u);
     }
 
-    for (const std::string& resource : pass.writes) {
-      auto writer_it = last_writer.find(resource);
-      if (writer_it != last_writer.end()) {
-        add_edge(writer_it->second, pass_id);
+    for (RenderResourceId resource : pass.writes) {
+      if (last_writer[resource] != kNoEntry) {
+        add_edge(last_writer[resource], pass_id);
       }
 
-      auto readers_it = last_readers.find(resource);
-      if (readers_it != last_readers.end()) {
-        for (RenderPassId reader : readers_it->second) {
-          add_edge(reader, pass_id);
-        }
-
-        readers_it->second.clear();
+      for (uint32_t node = reader_head[resource]; node != kNoEntry;
+           node = reader_next[node]) {
+        add_edge(reader_pass[node], pass_id);
       }
 
+      reader_head[resource] = kNoEntry;
       last_writer[resource] = pass_id;
     }
   }
 
-  std::priority_queue<RenderPassId, std::vector<RenderPassId>, std::greater<>> ready;
+  std::vector<uint32_t> adjacency_offsets;
+  std::vector<RenderPassId> adjacency;
+  BuildAdjacency(pass_count, edges, &adjacency_offsets, &adjacency);
+
+  std::vector<RenderPassId> ready_storage;
+  ready_storage.reserve(pass_count);
+  std::priority_queue<RenderPassId, std::vector<RenderPassId>, std::greater<>> ready(
+      std::greater<>{}, std::move(ready_storage));
   for (RenderPassId pass_id = 0u; pass_id < static_cast<RenderPassId>(pass_count);
        ++pass_id) {
     if (indegree[pass_id] == 0u) {
@@ -199,7 +341,10 @@ engine_native_status_t RenderGraph::Compile(std::vector<RenderPassId>* out_order
     ready.pop();
     out_order->push_back(current);
 
-    for (RenderPassId next : adjacency[current]) {
+    for (uint32_t i = adjacency_offsets[current];
+         i < adjacency_offsets[current + 1u]; ++i) {
+      const RenderPassId next = adjacency[i];
+      level[next] = std::max(level[next], level[current] + 1u);
       --indegree[next];
       if (indegree[next] == 0u) {
         ready.push(next);
@@ -215,17 +360,180 @@ engine_native_status_t RenderGraph::Compile(std::vector<RenderPassId>* out_order
     return ENGINE_NATIVE_STATUS_INVALID_STATE;
   }
 
+  if (root_count_ == 0u) {
+    if (out_levels != nullptr) {
+      out_levels->reserve(out_order->size());
+      for (RenderPassId pass_id : *out_order) {
+        out_levels->push_back(level[pass_id]);
+      }
+    }
+    return ENGINE_NATIVE_STATUS_OK;
+  }
+
+  std::vector<uint32_t> producer_offsets;
+  std::vector<RenderPassId> producers;
+  BuildAdjacency(pass_count, producer_edges, &producer_offsets, &producers);
+
+  std::vector<uint8_t> live(pass_count, 0u);
+  std::vector<RenderPassId> pending;
+  pending.reserve(pass_count);
+  for (RenderPassId pass_id = 0u; pass_id < static_cast<RenderPassId>(pass_count);
+       ++pass_id) {
+    if (passes_[pass_id].is_root) {
+      live[pass_id] = 1u;
+      pending.push_back(pass_id);
+    }
+  }
+
+  while (!pending.empty()) {
+    const RenderPassId current = pending.back();
+    pending.pop_back();
+    for (uint32_t i = producer_offsets[current]; i < producer_offsets[current + 1u];
+         ++i) {
+      const RenderPassId producer = producers[i];
+      if (live[producer] == 0u) {
+        live[producer] = 1u;
+        pending.push_back(producer);
+      }
+    }
+  }
+
+  size_t kept = 0u;
+  for (RenderPassId pass_id : *out_order) {
+    if (live[pass_id] != 0u) {
+      (*out_order)[kept++] = pass_id;
+      if (out_levels != nullptr) {
+        out_levels->push_back(level[pass_id]);
+      }
+    } else if (out_culled != nullptr) {
+      out_culled->push_back(pass_id);
+    }
+  }
+  out_order->resize(kept);
+  return ENGINE_NATIVE_STATUS_OK;
+}
+
+engine_native_status_t RenderGraph::BuildAliasingPlan(
+    const std::vector<RenderPassId>& order,
+    TransientAliasingPlan* out_plan) const {
+  if (out_plan == nullptr || order.size() > passes_.size()) {
+    return ENGINE_NATIVE_STATUS_INVALID_ARGUMENT;
+  }
+
+  const size_t resource_count = resource_names_.size();
+  out_plan->first_use.assign(resource_count, TransientAliasingPlan::kUnused);
+  out_plan->last_use.assign(resource_count, TransientAliasingPlan::kUnused);
+  out_plan->slot_by_resource.assign(resource_count, TransientAliasingPlan::kUnused);
+  out_plan->slot_bytes.clear();
+  out_plan->naive_bytes = 0u;
+  out_plan->aliased_bytes = 0u;
+
+  auto touch = [&](RenderResourceId resource, uint32_t position) {
+    if (out_plan->first_use[resource] == TransientAliasingPlan::kUnused) {
+      out_plan->first_use[resource] = position;
+    }
+    out_plan->last_use[resource] = position;
+  };
+
+  for (uint32_t position = 0u; position < static_cast<uint32_t>(order.size());
+       ++position) {
+    if (!IsValidPassId(order[position])) {
+      return ENGINE_NATIVE_STATUS_INVALID_ARGUMENT;
+    }
+
+    const PassNode& pass = passes_[order[position]];
+    for (RenderResourceId resource : pass.reads) {
+      touch(resource, position);
+    }
+    for (RenderResourceId resource : pass.writes) {
+      touch(resource, position);
+    }
+  }
+
+  std::vector<RenderResourceId> transients;
+  transients.reserve(resource_count);
+  for (RenderResourceId resource = 0u;
+       resource < static_cast<RenderResourceId>(resource_count); ++resource) {
+    if (resource_imported_[resource] != 0u || resource_byte_sizes_[resource] == 0u ||
+        out_plan->first_use[resource] == TransientAliasingPlan::kUnused) {
+      continue;
+    }
+
+    transients.push_back(resource);
+    out_plan->naive_bytes += resource_byte_sizes_[resource];
+  }
+
+  std::sort(transients.begin(), transients.end(),
+            [&](RenderResourceId lhs, RenderResourceId rhs) {
+              if (out_plan->first_use[lhs] != out_plan->first_use[rhs]) {
+                return out_plan->first_use[lhs] < out_plan->first_use[rhs];
+              }
+              if (resource_byte_sizes_[lhs] != resource_byte_sizes_[rhs]) {
+                return resource_byte_sizes_[lhs] > resource_byte_sizes_[rhs];
+              }
+              return lhs < rhs;
+            });
+
+  std::vector<uint32_t> slot_busy_until;
+  for (RenderResourceId resource : transients) {
+    const uint64_t bytes = resource_byte_sizes_[resource];
+    const uint32_t first_use = out_plan->first_use[resource];
+    uint32_t best_fit = TransientAliasingPlan::kUnused;
+    uint32_t largest_free = TransientAliasingPlan::kUnused;
+    for (uint32_t slot = 0u; slot < static_cast<uint32_t>(slot_busy_until.size());
+         ++slot) {
+      if (slot_busy_until[slot] >= first_use) {
+        continue;
+      }
+
+      const uint64_t slot_bytes = out_plan->slot_bytes[slot];
+      if (slot_bytes >= bytes &&
+          (best_fit == TransientAliasingPlan::kUnused ||
+           slot_bytes < out_plan->slot_bytes[best_fit])) {
+        best_fit = slot;
+      }
+      if (largest_free == TransientAliasingPlan::kUnused ||
+          slot_bytes > out_plan->slot_bytes[largest_free]) {
+        largest_free = slot;
+      }
+    }
+
+    uint32_t slot = best_fit != TransientAliasingPlan::kUnused ? best_fit
+                                                               : largest_free;
+    if (slot == TransientAliasingPlan::kUnused) {
+      slot = static_cast<uint32_t>(slot_busy_until.size());
+      slot_busy_until.push_back(0u);
+      out_plan->slot_bytes.push_back(0u);
+    }
+
+    slot_busy_until[slot] = out_plan->last_use[resource];
+    out_plan->slot_bytes[slot] = std::max(out_plan->slot_bytes[slot], bytes);
+    out_plan->slot_by_resource[resource] = slot;
+  }
+
+  for (uint64_t slot_bytes : out_plan->slot_bytes) {
+    out_plan->aliased_bytes += slot_bytes;
+  }
+
   return ENGINE_NATIVE_STATUS_OK;
 }
 
 void RenderGraph::Clear() {
   passes_.clear();
   pass_names_.clear();
-  imported_resources_.clear();
+  root_count_ = 0u;
+  resource_names_.clear();
+  resource_imported_.clear();
+  resource_byte_sizes_.clear();
+  resource_ids_.clear();
 }
 
 bool RenderGraph::IsValidPassId(RenderPassId pass_id) const {
   return static_cast<size_t>(pass_id) < passes_.size();
 }
 
+bool RenderGraph::IsValidResourceId(RenderResourceId resource_id) const {
+  return static_cast<size_t>(resource_id) < resource_names_.size();
+}
+
 }  // namespace dff::native::render
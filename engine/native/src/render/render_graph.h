@@ -3,6 +3,7 @@
 
 #include <cstdint>
 #include <string>
+#include <unordered_map>
 #include <unordered_set>
 #include <vector>
 
@@ -11,6 +12,18 @@
 namespace dff::native::render {
 
 using RenderPassId = uint32_t;
+using RenderResourceId = uint32_t;
+
+struct TransientAliasingPlan {
+  static constexpr uint32_t kUnused = 0xFFFFFFFFu;
+
+  std::vector<uint32_t> first_use;
+  std::vector<uint32_t> last_use;
+  std::vector<uint32_t> slot_by_resource;
+  std::vector<uint64_t> slot_bytes;
+  uint64_t naive_bytes = 0u;
+  uint64_t aliased_bytes = 0u;
+};
 
 class RenderGraph {
  public:
@@ -18,6 +31,20 @@ class RenderGraph {
 
   engine_native_status_t AddDependency(RenderPassId before, RenderPassId after);
 
+  engine_native_status_t MarkRoot(RenderPassId pass_id);
+
+  engine_native_status_t RegisterResource(const std::string& resource_name,
+                                          RenderResourceId* out_resource_id);
+
+  engine_native_status_t ImportResource(RenderResourceId resource_id);
+
+  engine_native_status_t SetResourceByteSize(RenderResourceId resource_id,
+                                             uint64_t byte_size);
+
+  engine_native_status_t AddRead(RenderPassId pass_id, RenderResourceId resource_id);
+
+  engine_native_status_t AddWrite(RenderPassId pass_id, RenderResourceId resource_id);
+
   engine_native_status_t ImportResource(const std::string& resource_name);
 
   engine_native_status_t AddRead(RenderPassId pass_id, const std::string& resource_name);
@@ -27,23 +54,45 @@ class RenderGraph {
   engine_native_status_t Compile(std::vector<RenderPassId>* out_order,
                                  std::string* out_error) const;
 
+  engine_native_status_t Compile(std::vector<RenderPassId>* out_order,
+                                 std::vector<RenderPassId>* out_culled,
+                                 std::string* out_error) const;
+
+  engine_native_status_t Compile(std::vector<RenderPassId>* out_order,
+                                 std::vector<RenderPassId>* out_culled,
+                                 std::vector<uint32_t>* out_levels,
+                                 std::string* out_error) const;
+
+  engine_native_status_t BuildAliasingPlan(const std::vector<RenderPassId>& order,
+                                           TransientAliasingPlan* out_plan) const;
+
   void Clear();
 
   size_t PassCount() const { return passes_.size(); }
+  size_t ResourceCount() const { return resource_names_.size(); }
+  const std::string& ResourceName(RenderResourceId resource_id) const {
+    return resource_names_[resource_id];
+  }
 
  private:
   struct PassNode {
     std::string name;
     std::vector<RenderPassId> explicit_dependencies;
-    std::vector<std::string> reads;
-    std::vector<std::string> writes;
+    std::vector<RenderResourceId> reads;
+    std::vector<RenderResourceId> writes;
+    bool is_root = false;
   };
 
   bool IsValidPassId(RenderPassId pass_id) const;
+  bool IsValidResourceId(RenderResourceId resource_id) const;
 
   std::vector<PassNode> passes_;
   std::unordered_set<std::string> pass_names_;
-  std::unordered_set<std::string> imported_resources_;
+  size_t root_count_ = 0u;
+  std::vector<std::string> resource_names_;
+  std::vector<uint8_t> resource_imported_;
+  std::vector<uint64_t> resource_byte_sizes_;
+  std::unordered_map<std::string, RenderResourceId> resource_ids_;
 };
 
 }  // namespace dff::native::render
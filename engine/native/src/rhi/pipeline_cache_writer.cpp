@@ -0,0 +1,98 @@
+#include "rhi/pipeline_cache_writer.h"
+
+#include <new>
+#include <system_error>
+#include <utility>
+
+#include "rhi/pipeline_state_cache.h"
+
+namespace dff::native::rhi {
+
+PipelineCacheWriter::~PipelineCacheWriter() {
+  {
+    std::lock_guard<std::mutex> guard(mutex_);
+    stopping_ = true;
+  }
+  work_cv_.notify_all();
+
+  if (worker_.joinable()) {
+    worker_.join();
+  }
+}
+
+engine_native_status_t PipelineCacheWriter::Schedule(
+    const std::string& file_path,
+    std::vector<uint8_t>&& snapshot) {
+  if (file_path.empty()) {
+    return ENGINE_NATIVE_STATUS_INVALID_ARGUMENT;
+  }
+
+  {
+    std::lock_guard<std::mutex> guard(mutex_);
+    try {
+      if (!worker_.joinable()) {
+        worker_ = std::thread(&PipelineCacheWriter::WorkerLoop, this);
+      }
+      pending_path_ = file_path;
+    } catch (const std::system_error&) {
+      return ENGINE_NATIVE_STATUS_INTERNAL_ERROR;
+    } catch (const std::bad_alloc&) {
+      return ENGINE_NATIVE_STATUS_OUT_OF_MEMORY;
+    }
+
+    pending_snapshot_ = std::move(snapshot);
+    has_pending_ = true;
+  }
+  work_cv_.notify_one();
+  return ENGINE_NATIVE_STATUS_OK;
+}
+
+void PipelineCacheWriter::Flush() {
+  std::unique_lock<std::mutex> lock(mutex_);
+  idle_cv_.wait(lock, [&] { return !has_pending_ && !writing_; });
+}
+
+uint64_t PipelineCacheWriter::completed_write_count() const {
+  std::lock_guard<std::mutex> guard(mutex_);
+  return completed_write_count_;
+}
+
+uint64_t PipelineCacheWriter::failed_write_count() const {
+  std::lock_guard<std::mutex> guard(mutex_);
+  return failed_write_count_;
+}
+
+void PipelineCacheWriter::WorkerLoop() {
+  std::string path;
+  std::vector<uint8_t> snapshot;
+  for (;;) {
+    {
+      std::unique_lock<std::mutex> lock(mutex_);
+      work_cv_.wait(lock, [&] { return stopping_ || has_pending_; });
+      if (!has_pending_) {
+        return;
+      }
+
+      path.swap(pending_path_);
+      snapshot.swap(pending_snapshot_);
+      has_pending_ = false;
+      writing_ = true;
+    }
+
+    const bool written =
+        PipelineStateCache::WriteSnapshotFile(path.c_str(), snapshot);
+
+    {
+      std::lock_guard<std::mutex> guard(mutex_);
+      writing_ = false;
+      if (written) {
+        ++completed_write_count_;
+      } else {
+        ++failed_write_count_;
+      }
+    }
+    idle_cv_.notify_all();
+  }
+}
+
+}  // namespace dff::native::rhi
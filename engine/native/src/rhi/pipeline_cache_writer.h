@@ -0,0 +1,50 @@
+#ifndef DFF_ENGINE_NATIVE_PIPELINE_CACHE_WRITER_H
+#define DFF_ENGINE_NATIVE_PIPELINE_CACHE_WRITER_H
+
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "engine_native.h"
+
+namespace dff::native::rhi {
+
+// Writes pipeline cache snapshots on a background thread. Only the latest
+// scheduled snapshot is kept; an older one still waiting is replaced.
+class PipelineCacheWriter {
+ public:
+  PipelineCacheWriter() = default;
+  ~PipelineCacheWriter();
+
+  PipelineCacheWriter(const PipelineCacheWriter&) = delete;
+  PipelineCacheWriter& operator=(const PipelineCacheWriter&) = delete;
+
+  engine_native_status_t Schedule(const std::string& file_path,
+                                  std::vector<uint8_t>&& snapshot);
+  void Flush();
+
+  uint64_t completed_write_count() const;
+  uint64_t failed_write_count() const;
+
+ private:
+  void WorkerLoop();
+
+  mutable std::mutex mutex_;
+  std::condition_variable work_cv_;
+  std::condition_variable idle_cv_;
+  std::thread worker_;
+  std::string pending_path_;
+  std::vector<uint8_t> pending_snapshot_;
+  bool has_pending_ = false;
+  bool writing_ = false;
+  bool stopping_ = false;
+  uint64_t completed_write_count_ = 0u;
+  uint64_t failed_write_count_ = 0u;
+};
+
+}  // namespace dff::native::rhi
+
+#endif
@@ -1,51 +1,144 @@
 #include "rhi/pipeline_state_cache.h"
 
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstring>
+#include <filesystem>
 #include <fstream>
+#include <functional>
 #include <limits>
+#include <new>
+#include <string>
+#include <system_error>
+
+#if defined(_WIN32)
+#include <process.h>
+#else
+#include <unistd.h>
+#endif
 
 namespace dff::native::rhi {
 
 namespace {
 
 constexpr uint32_t kPipelineCacheDiskMagic = 0x43465044u;    // DPFC
-constexpr uint32_t kPipelineCacheDiskVersion = 1u;
+constexpr uint32_t kPipelineCacheDiskVersion = 2u;
+constexpr uint32_t kPipelineCacheEntriesPerBlock = 512u;
+
+std::atomic<uint64_t> g_snapshot_temp_counter{0u};
 
 struct PipelineCacheDiskHeader {
   uint32_t magic = 0u;
   uint32_t version = 0u;
+  uint64_t build_id = 0u;
+  uint32_t backend_kind = 0u;
   uint32_t key_count = 0u;
+  uint32_t block_count = 0u;
+  uint32_t header_crc = 0u;
+};
+
+struct PipelineCacheDiskBlockHeader {
+  uint32_t entry_count = 0u;
+  uint32_t entries_crc = 0u;
+};
+
+struct PipelineCacheDiskEntry {
+  uint64_t key = 0u;
+  uint32_t use_count = 0u;
   uint32_t reserved0 = 0u;
 };
 
+static_assert(sizeof(PipelineCacheDiskHeader) == 32u);
+static_assert(sizeof(PipelineCacheDiskEntry) == 16u);
+
 bool IsFilePathValid(const char* file_path) {
   return file_path != nullptr && file_path[0] != '\0';
 }
 
+uint32_t ComputeCrc32(const void* data, size_t size) {
+  static const auto kTable = [] {
+    std::array<uint32_t, 256> table{};
+    for (uint32_t i = 0u; i < table.size(); ++i) {
+      uint32_t value = i;
+      for (int bit = 0; bit < 8; ++bit) {
+        value = (value & 1u) != 0u ? 0xEDB88320u ^ (value >> 1u) : value >> 1u;
+      }
+      table[i] = value;
+    }
+    return table;
+  }();
+
+  uint32_t crc = 0xFFFFFFFFu;
+  const auto* bytes = static_cast<const uint8_t*>(data);
+  for (size_t i = 0u; i < size; ++i) {
+    crc = kTable[(crc ^ bytes[i]) & 0xFFu] ^ (crc >> 8u);
+  }
+  return crc ^ 0xFFFFFFFFu;
+}
+
+uint32_t ComputeHeaderCrc(const PipelineCacheDiskHeader& header) {
+  return ComputeCrc32(&header, offsetof(PipelineCacheDiskHeader, header_crc));
+}
+
+template <typename T>
+void AppendPod(std::vector<uint8_t>* bytes, const T& value) {
+  const auto* begin = reinterpret_cast<const uint8_t*>(&value);
+  bytes->insert(bytes->end(), begin, begin + sizeof(T));
+}
+
+// Concurrent writers, from this or another process, each stage the snapshot in
+// their own temp file so only the final rename races.
+std::filesystem::path MakeSnapshotTempPath(const std::filesystem::path& target_path) {
+#if defined(_WIN32)
+  const uint64_t process_id = static_cast<uint64_t>(_getpid());
+#else
+  const uint64_t process_id = static_cast<uint64_t>(getpid());
+#endif
+  std::filesystem::path temp_path = target_path;
+  temp_path += ".tmp." + std::to_string(process_id) + "." +
+               std::to_string(g_snapshot_temp_counter.fetch_add(
+                   1u, std::memory_order_relaxed));
+  return temp_path;
+}
+
 }  // namespace
 
 const PipelineStateRecord& PipelineStateCache::GetOrCreate(uint64_t key) {
-  auto entry_it = entries_.find(key);
-  if (entry_it != entries_.end()) {
+  EnsureStorage();
+
+  const size_t slot_index = FindSlot(key);
+  const uint32_t found_node = slots_[slot_index].node;
+  if (found_node != kInvalidIndex) {
     ++hit_count_;
-    Touch(&entry_it->second);
-    return entry_it->second.record;
+    uint32_t& use_count = nodes_[found_node].record.use_count;
+    if (use_count != std::numeric_limits<uint32_t>::max()) {
+      ++use_count;
+    }
+    if (found_node != lru_tail_) {
+      Unlink(found_node);
+      LinkBack(found_node);
+    }
+    return nodes_[found_node].record;
   }
 
   ++miss_count_;
-  EvictIfNeeded();
-
-  lru_keys_.push_back(key);
-  CacheEntry entry{
-      .record =
-          PipelineStateRecord{
-              .key = key,
-              .generation = next_generation_++,
-          },
-      .lru_it = std::prev(lru_keys_.end()),
-  };
+  const uint32_t node_index = InsertNew(key, slot_index);
+  nodes_[node_index].record.use_count = 1u;
+  return nodes_[node_index].record;
+}
 
-  const auto [inserted_it, _] = entries_.emplace(key, entry);
-  return inserted_it->second.record;
+bool PipelineStateCache::Prewarm(uint64_t key) {
+  EnsureStorage();
+
+  const size_t slot_index = FindSlot(key);
+  if (slots_[slot_index].node != kInvalidIndex) {
+    return false;
+  }
+
+  static_cast<void>(InsertNew(key, slot_index));
+  return true;
 }
 
 bool PipelineStateCache::LoadFromFile(const char* file_path) {
@@ -53,108 +146,336 @@ bool PipelineStateCache::LoadFromFile(const char* file_path) {
     return false;
   }
 
-  std::ifstream stream(file_path, std::ios::binary);
+  std::ifstream stream(file_path, std::ios::binary | std::ios::ate);
   if (!stream.is_open()) {
     return false;
   }
 
-  PipelineCacheDiskHeader header{};
-  stream.read(reinterpret_cast<char*>(&header), sizeof(header));
+  const std::streamoff file_size = stream.tellg();
+  if (file_size < static_cast<std::streamoff>(sizeof(PipelineCacheDiskHeader))) {
+    return false;
+  }
+
+  std::vector<uint8_t> bytes;
+  try {
+    bytes.resize(static_cast<size_t>(file_size));
+  } catch (const std::bad_alloc&) {
+    return false;
+  }
+
+  stream.seekg(0, std::ios::beg);
+  stream.read(reinterpret_cast<char*>(bytes.data()), file_size);
   if (!stream.good()) {
     return false;
   }
-  if (header.magic != kPipelineCacheDiskMagic ||
-      header.version != kPipelineCacheDiskVersion) {
+
+  return Deserialize(bytes);
+}
+
+bool PipelineStateCache::SaveToFile(const char* file_path) const {
+  if (!IsFilePathValid(file_path)) {
     return false;
   }
 
-  if (header.key_count >
-      static_cast<uint32_t>(std::numeric_limits<size_t>::max())) {
+  std::vector<uint8_t> bytes;
+  return Serialize(&bytes) && WriteSnapshotFile(file_path, bytes);
+}
+
+bool PipelineStateCache::Serialize(std::vector<uint8_t>* out_bytes) const {
+  if (out_bytes == nullptr ||
+      size_ > static_cast<size_t>(std::numeric_limits<uint32_t>::max())) {
     return false;
   }
 
-  Clear();
-  for (uint32_t i = 0u; i < header.key_count; ++i) {
-    uint64_t key = 0u;
-    stream.read(reinterpret_cast<char*>(&key), sizeof(key));
-    if (!stream.good()) {
-      Clear();
-      return false;
-    }
+  const uint32_t key_count = static_cast<uint32_t>(size_);
+  const uint32_t block_count =
+      (key_count + kPipelineCacheEntriesPerBlock - 1u) / kPipelineCacheEntriesPerBlock;
+  PipelineCacheDiskHeader header{
+      .magic = kPipelineCacheDiskMagic,
+      .version = kPipelineCacheDiskVersion,
+      .build_id = fingerprint_.build_id,
+      .backend_kind = fingerprint_.backend_kind,
+      .key_count = key_count,
+      .block_count = block_count,
+      .header_crc = 0u,
+  };
+  header.header_crc = ComputeHeaderCrc(header);
+
+  try {
+    out_bytes->clear();
+    out_bytes->reserve(sizeof(header) +
+                       block_count * sizeof(PipelineCacheDiskBlockHeader) +
+                       size_ * sizeof(PipelineCacheDiskEntry));
+    AppendPod(out_bytes, header);
+
+    uint32_t node_index = lru_head_;
+    for (uint32_t block = 0u; block < block_count; ++block) {
+      const uint32_t entry_count = std::min(
+          kPipelineCacheEntriesPerBlock, key_count - block * kPipelineCacheEntriesPerBlock);
+      const size_t block_offset = out_bytes->size();
+      AppendPod(out_bytes, PipelineCacheDiskBlockHeader{entry_count, 0u});
 
-    static_cast<void>(GetOrCreate(key));
+      const size_t entries_offset = out_bytes->size();
+      for (uint32_t i = 0u; i < entry_count; ++i) {
+        const PipelineStateRecord& record = nodes_[node_index].record;
+        AppendPod(out_bytes, PipelineCacheDiskEntry{record.key, record.use_count, 0u});
+        node_index = nodes_[node_index].next;
+      }
+
+      const uint32_t entries_crc =
+          ComputeCrc32(out_bytes->data() + entries_offset,
+                       out_bytes->size() - entries_offset);
+      std::memcpy(out_bytes->data() + block_offset +
+                      offsetof(PipelineCacheDiskBlockHeader, entries_crc),
+                  &entries_crc, sizeof(entries_crc));
+    }
+  } catch (const std::bad_alloc&) {
+    out_bytes->clear();
+    return false;
   }
 
-  hit_count_ = 0u;
-  miss_count_ = 0u;
   return true;
 }
 
-bool PipelineStateCache::SaveToFile(const char* file_path) const {
-  if (!IsFilePathValid(file_path)) {
+bool PipelineStateCache::Deserialize(std::span<const uint8_t> bytes) {
+  PipelineCacheDiskHeader header{};
+  if (bytes.size() < sizeof(header)) {
     return false;
   }
 
-  std::ofstream stream(file_path, std::ios::binary | std::ios::trunc);
-  if (!stream.is_open()) {
+  std::memcpy(&header, bytes.data(), sizeof(header));
+  if (header.magic != kPipelineCacheDiskMagic ||
+      header.version != kPipelineCacheDiskVersion ||
+      header.header_crc != ComputeHeaderCrc(header) ||
+      header.build_id != fingerprint_.build_id ||
+      header.backend_kind != fingerprint_.backend_kind) {
     return false;
   }
 
-  if (entries_.size() >
-      static_cast<size_t>(std::numeric_limits<uint32_t>::max())) {
+  std::vector<PipelineCacheDiskEntry> entries;
+  size_t offset = sizeof(header);
+  try {
+    entries.reserve(std::min<size_t>(header.key_count,
+                                     bytes.size() / sizeof(PipelineCacheDiskEntry)));
+    for (uint32_t block = 0u; block < header.block_count; ++block) {
+      PipelineCacheDiskBlockHeader block_header{};
+      if (bytes.size() - offset < sizeof(block_header)) {
+        break;
+      }
+      std::memcpy(&block_header, bytes.data() + offset, sizeof(block_header));
+      offset += sizeof(block_header);
+
+      const size_t entry_bytes =
+          static_cast<size_t>(block_header.entry_count) * sizeof(PipelineCacheDiskEntry);
+      if (block_header.entry_count > kPipelineCacheEntriesPerBlock ||
+          bytes.size() - offset < entry_bytes ||
+          ComputeCrc32(bytes.data() + offset, entry_bytes) != block_header.entries_crc) {
+        break;
+      }
+
+      const size_t first_entry = entries.size();
+      entries.resize(first_entry + block_header.entry_count);
+      std::memcpy(entries.data() + first_entry, bytes.data() + offset, entry_bytes);
+      offset += entry_bytes;
+    }
+  } catch (const std::bad_alloc&) {
     return false;
   }
 
-  PipelineCacheDiskHeader header{
-      .magic = kPipelineCacheDiskMagic,
-      .version = kPipelineCacheDiskVersion,
-      .key_count = static_cast<uint32_t>(entries_.size()),
-      .reserved0 = 0u,
-  };
-  stream.write(reinterpret_cast<const char*>(&header), sizeof(header));
-  if (!stream.good()) {
+  if (entries.size() > capacity_) {
+    std::vector<uint32_t> hottest_counts;
+    try {
+      hottest_counts.reserve(entries.size());
+    } catch (const std::bad_alloc&) {
+      return false;
+    }
+    for (const PipelineCacheDiskEntry& entry : entries) {
+      hottest_counts.push_back(entry.use_count);
+    }
+    std::nth_element(hottest_counts.begin(),
+                     hottest_counts.begin() + static_cast<std::ptrdiff_t>(capacity_ - 1u),
+                     hottest_counts.end(), std::greater<uint32_t>());
+    const uint32_t threshold = hottest_counts[capacity_ - 1u];
+
+    size_t above_threshold = 0u;
+    for (const PipelineCacheDiskEntry& entry : entries) {
+      above_threshold += entry.use_count > threshold ? 1u : 0u;
+    }
+
+    size_t threshold_budget = capacity_ - above_threshold;
+    std::erase_if(entries, [&](const PipelineCacheDiskEntry& entry) {
+      if (entry.use_count > threshold) {
+        return false;
+      }
+      if (entry.use_count == threshold && threshold_budget > 0u) {
+        --threshold_budget;
+        return false;
+      }
+      return true;
+    });
+  }
+
+  Clear();
+  for (const PipelineCacheDiskEntry& entry : entries) {
+    static_cast<void>(GetOrCreate(entry.key));
+    nodes_[lru_tail_].record.use_count = entry.use_count;
+  }
+
+  hit_count_ = 0u;
+  miss_count_ = 0u;
+  return true;
+}
+
+bool PipelineStateCache::WriteSnapshotFile(const char* file_path,
+                                           std::span<const uint8_t> bytes) {
+  if (!IsFilePathValid(file_path)) {
     return false;
   }
 
-  for (uint64_t key : lru_keys_) {
-    stream.write(reinterpret_cast<const char*>(&key), sizeof(key));
+  const std::filesystem::path target_path(file_path);
+  const std::filesystem::path temp_path = MakeSnapshotTempPath(target_path);
+  {
+    std::ofstream stream(temp_path, std::ios::binary | std::ios::trunc);
+    if (!stream.is_open()) {
+      return false;
+    }
+
+    stream.write(reinterpret_cast<const char*>(bytes.data()),
+                 static_cast<std::streamsize>(bytes.size()));
+    stream.flush();
     if (!stream.good()) {
       return false;
     }
   }
 
+  std::error_code rename_error;
+  std::filesystem::rename(temp_path, target_path, rename_error);
+  if (rename_error) {
+    std::error_code remove_error;
+    std::filesystem::remove(temp_path, remove_error);
+    return false;
+  }
+
   return true;
 }
 
 void PipelineStateCache::Clear() {
-  lru_keys_.clear();
-  entries_.clear();
+  for (Slot& slot : slots_) {
+    slot.node = kInvalidIndex;
+  }
+  nodes_.clear();
+  size_ = 0u;
+  lru_head_ = kInvalidIndex;
+  lru_tail_ = kInvalidIndex;
   hit_count_ = 0u;
   miss_count_ = 0u;
   next_generation_ = 1u;
 }
 
-void PipelineStateCache::Touch(CacheEntry* entry) {
-  if (entry == nullptr) {
+size_t PipelineStateCache::HashKey(uint64_t key) {
+  key ^= key >> 33u;
+  key *= 0xFF51AFD7ED558CCDull;
+  key ^= key >> 33u;
+  key *= 0xC4CEB9FE1A85EC53ull;
+  key ^= key >> 33u;
+  return static_cast<size_t>(key);
+}
+
+void PipelineStateCache::EnsureStorage() {
+  if (!slots_.empty()) {
     return;
   }
 
-  lru_keys_.splice(lru_keys_.end(), lru_keys_, entry->lru_it);
-  entry->lru_it = std::prev(lru_keys_.end());
+  size_t slot_count = 1u;
+  while (slot_count < capacity_ * 2u) {
+    slot_count <<= 1u;
+  }
+
+  nodes_.reserve(capacity_);
+  slots_.assign(slot_count, Slot{});
+  slot_mask_ = slot_count - 1u;
 }
 
-void PipelineStateCache::EvictIfNeeded() {
-  if (capacity_ == 0u) {
-    entries_.clear();
-    lru_keys_.clear();
-    return;
+size_t PipelineStateCache::FindSlot(uint64_t key) const {
+  size_t index = HashKey(key) & slot_mask_;
+  while (slots_[index].node != kInvalidIndex && slots_[index].key != key) {
+    index = (index + 1u) & slot_mask_;
   }
+  return index;
+}
+
+void PipelineStateCache::EraseSlot(size_t slot_index) {
+  size_t hole = slot_index;
+  size_t index = (hole + 1u) & slot_mask_;
+  while (slots_[index].node != kInvalidIndex) {
+    const size_t home = HashKey(slots_[index].key) & slot_mask_;
+    if (((index - home) & slot_mask_) >= ((index - hole) & slot_mask_)) {
+      slots_[hole] = slots_[index];
+      hole = index;
+    }
+    index = (index + 1u) & slot_mask_;
+  }
+  slots_[hole].node = kInvalidIndex;
+}
 
-  while (entries_.size() >= capacity_ && !lru_keys_.empty()) {
-    const uint64_t oldest_key = lru_keys_.front();
-    lru_keys_.pop_front();
-    entries_.erase(oldest_key);
+void PipelineStateCache::LinkBack(uint32_t node_index) {
+  Node& node = nodes_[node_index];
+  node.prev = lru_tail_;
+  node.next = kInvalidIndex;
+  if (lru_tail_ != kInvalidIndex) {
+    nodes_[lru_tail_].next = node_index;
+  } else {
+    lru_head_ = node_index;
   }
+  lru_tail_ = node_index;
+}
+
+void PipelineStateCache::Unlink(uint32_t node_index) {
+  Node& node = nodes_[node_index];
+  if (node.prev != kInvalidIndex) {
+    nodes_[node.prev].next = node.next;
+  } else {
+    lru_head_ = node.next;
+  }
+
+  if (node.next != kInvalidIndex) {
+    nodes_[node.next].prev = node.prev;
+  } else {
+    lru_tail_ = node.prev;
+  }
+  node.prev = kInvalidIndex;
+  node.next = kInvalidIndex;
+}
+
+uint32_t PipelineStateCache::InsertNew(uint64_t key, size_t slot_index) {
+  const bool evicting = nodes_.size() >= capacity_;
+  const uint32_t node_index = AcquireNode();
+  if (evicting) {
+    slot_index = FindSlot(key);
+  }
+
+  nodes_[node_index].record = PipelineStateRecord{
+      .key = key,
+      .generation = next_generation_++,
+      .use_count = 0u,
+  };
+  LinkBack(node_index);
+  slots_[slot_index] = Slot{key, node_index};
+  ++size_;
+  return node_index;
+}
+
+uint32_t PipelineStateCache::AcquireNode() {
+  if (nodes_.size() < capacity_) {
+    nodes_.emplace_back();
+    return static_cast<uint32_t>(nodes_.size() - 1u);
+  }
+
+  const uint32_t oldest = lru_head_;
+  Unlink(oldest);
+  EraseSlot(FindSlot(nodes_[oldest].record.key));
+  --size_;
+  return oldest;
 }
 
 }  // namespace dff::native::rhi
@@ -3,45 +3,90 @@
 
 #include <cstddef>
 #include <cstdint>
-#include <list>
-#include <unordered_map>
+#include <span>
+#include <vector>
 
 namespace dff::native::rhi {
 
 struct PipelineStateRecord {
   uint64_t key = 0u;
   uint64_t generation = 0u;
+  uint32_t use_count = 0u;
 };
 
+struct PipelineCacheFingerprint {
+  uint64_t build_id = 0u;
+  uint32_t backend_kind = 0u;
+};
+
+// Fixed-capacity LRU cache. Entries live in a node pool threaded by an
+// index-linked recency list and are found through a linear-probing key table
+// sized to at least twice the capacity; after the first miss reserves both,
+// GetOrCreate never allocates.
 class PipelineStateCache {
  public:
-  explicit PipelineStateCache(size_t capacity = 256u) : capacity_(capacity) {}
+  explicit PipelineStateCache(size_t capacity = 256u)
+      : capacity_(capacity == 0u ? 1u : capacity) {}
 
   const PipelineStateRecord& GetOrCreate(uint64_t key);
+  // Inserts without counting a hit or miss; returns false if already cached.
+  bool Prewarm(uint64_t key);
   bool LoadFromFile(const char* file_path);
   bool SaveToFile(const char* file_path) const;
 
+  // v2 snapshot: fingerprinted header followed by CRC-checked blocks of
+  // (key, use count) in least-to-most recently used order.
+  bool Serialize(std::vector<uint8_t>* out_bytes) const;
+  bool Deserialize(std::span<const uint8_t> bytes);
+  static bool WriteSnapshotFile(const char* file_path,
+                                std::span<const uint8_t> bytes);
+
+  void SetFingerprint(const PipelineCacheFingerprint& fingerprint) {
+    fingerprint_ = fingerprint;
+  }
+
   void Clear();
 
-  size_t size() const { return entries_.size(); }
+  size_t size() const { return size_; }
+  size_t capacity() const { return capacity_; }
   uint64_t hit_count() const { return hit_count_; }
   uint64_t miss_count() const { return miss_count_; }
+  const PipelineCacheFingerprint& fingerprint() const { return fingerprint_; }
 
  private:
-  struct CacheEntry {
+  static constexpr uint32_t kInvalidIndex = 0xFFFFFFFFu;
+
+  struct Node {
     PipelineStateRecord record;
-    std::list<uint64_t>::iterator lru_it;
+    uint32_t prev = kInvalidIndex;
+    uint32_t next = kInvalidIndex;
+  };
+
+  struct Slot {
+    uint64_t key = 0u;
+    uint32_t node = kInvalidIndex;
   };
 
-  void Touch(CacheEntry* entry);
-  void EvictIfNeeded();
+  static size_t HashKey(uint64_t key);
+  void EnsureStorage();
+  size_t FindSlot(uint64_t key) const;
+  void EraseSlot(size_t slot_index);
+  void LinkBack(uint32_t node_index);
+  void Unlink(uint32_t node_index);
+  uint32_t AcquireNode();
+  uint32_t InsertNew(uint64_t key, size_t slot_index);
 
+  PipelineCacheFingerprint fingerprint_;
   size_t capacity_ = 256u;
+  size_t size_ = 0u;
+  size_t slot_mask_ = 0u;
   uint64_t next_generation_ = 1u;
   uint64_t hit_count_ = 0u;
   uint64_t miss_count_ = 0u;
-  std::list<uint64_t> lru_keys_;
-  std::unordered_map<uint64_t, CacheEntry> entries_;
+  uint32_t lru_head_ = kInvalidIndex;
+  uint32_t lru_tail_ = kInvalidIndex;
+  std::vector<Node> nodes_;
+  std::vector<Slot> slots_;
 };
 
 }  // namespace dff::native::rhi
@@ -0,0 +1,20 @@
+#include "rhi/rhi_command_list.h"
+
+#include <new>
+
+namespace dff::native::rhi {
+
+engine_native_status_t RhiCommandList::RecordPass(RhiDevice::PassKind pass_kind) {
+  if (!RhiDevice::IsKnownPassKind(pass_kind)) {
+    return ENGINE_NATIVE_STATUS_INVALID_ARGUMENT;
+  }
+
+  try {
+    passes_.push_back(pass_kind);
+  } catch (const std::bad_alloc&) {
+    return ENGINE_NATIVE_STATUS_OUT_OF_MEMORY;
+  }
+  return ENGINE_NATIVE_STATUS_OK;
+}
+
+}  // namespace dff::native::rhi
@@ -0,0 +1,25 @@
+#ifndef DFF_ENGINE_NATIVE_RHI_COMMAND_LIST_H
+#define DFF_ENGINE_NATIVE_RHI_COMMAND_LIST_H
+
+#include <vector>
+
+#include "engine_native.h"
+#include "rhi/rhi_device.h"
+
+namespace dff::native::rhi {
+
+class RhiCommandList {
+ public:
+  engine_native_status_t RecordPass(RhiDevice::PassKind pass_kind);
+
+  void Reset() { passes_.clear(); }
+
+  const std::vector<RhiDevice::PassKind>& passes() const { return passes_; }
+
+ private:
+  std::vector<RhiDevice::PassKind> passes_;
+};
+
+}  // namespace dff::native::rhi
+
+#endif
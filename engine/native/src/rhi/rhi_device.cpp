@@ -1,5 +1,7 @@
 #include "rhi/rhi_device.h"
 
+#include "rhi/rhi_command_list.h"
+
 namespace dff::native::rhi {
 
 engine_native_status_t RhiDevice::BeginFrame() {
@@ -67,6 +69,41 @@ engine_native_status_t RhiDevice::ExecutePass(PassKind pass_kind) {
   return ENGINE_NATIVE_STATUS_INVALID_ARGUMENT;
 }
 
+engine_native_status_t RhiDevice::SubmitCommandList(
+    const RhiCommandList& command_list) {
+  for (PassKind pass_kind : command_list.passes()) {
+    const engine_native_status_t status = ExecutePass(pass_kind);
+    if (status != ENGINE_NATIVE_STATUS_OK) {
+      return status;
+    }
+  }
+
+  return ENGINE_NATIVE_STATUS_OK;
+}
+
+bool RhiDevice::IsKnownPassKind(PassKind pass_kind) {
+  switch (pass_kind) {
+    case PassKind::kSceneOpaque:
+    case PassKind::kUiOverlay:
+    case PassKind::kPresent:
+    case PassKind::kShadowMap:
+    case PassKind::kPbrOpaque:
+    case PassKind::kTonemap:
+    case PassKind::kBloom:
+    case PassKind::kColorGrading:
+    case PassKind::kFxaa:
+    case PassKind::kDebugDepth:
+    case PassKind::kDebugNormals:
+    case PassKind::kDebugAlbedo:
+    case PassKind::kDebugRoughness:
+    case PassKind::kDebugAmbientOcclusion:
+    case PassKind::kAmbientOcclusion:
+      return true;
+  }
+
+  return false;
+}
+
 engine_native_status_t RhiDevice::EndFrame() {
   if (!frame_open_) {
     return ENGINE_NATIVE_STATUS_INVALID_STATE;
@@ -9,6 +9,8 @@
 
 namespace dff::native::rhi {
 
+class RhiCommandList;
+
 class RhiDevice {
  public:
   enum class BackendKind : uint8_t {
@@ -41,8 +43,12 @@ class RhiDevice {
 
   engine_native_status_t ExecutePass(PassKind pass_kind);
 
+  engine_native_status_t SubmitCommandList(const RhiCommandList& command_list);
+
   engine_native_status_t EndFrame();
 
+  static bool IsKnownPassKind(PassKind pass_kind);
+
   void SetBackendKind(BackendKind backend_kind) { backend_kind_ = backend_kind; }
 
   BackendKind backend_kind() const { return backend_kind_; }
@@ -0,0 +1,157 @@
+#include "content/asset_cache_tests.h"
+
+#include <assert.h>
+
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <string>
+
+#include "content/asset_cache.h"
+#include "engine_native.h"
+
+namespace dff::native::tests {
+namespace {
+
+using dff::native::content::AssetCache;
+
+engine_native_content_cache_stats_t CacheStats(const AssetCache& cache) {
+  engine_native_content_cache_stats_t stats{};
+  cache.GetStats(&stats);
+  return stats;
+}
+
+std::unique_ptr<uint8_t[]> Bytes(const std::string& payload) {
+  std::unique_ptr<uint8_t[]> bytes(new uint8_t[payload.size()]);
+  std::memcpy(bytes.get(), payload.data(), payload.size());
+  return bytes;
+}
+
+bool Cached(AssetCache* cache, const char* path, uint64_t generation) {
+  size_t size = 0u;
+  return cache->Read(path, generation, nullptr, 0u, &size) ==
+         ENGINE_NATIVE_STATUS_OK;
+}
+
+void TestEvictsLeastRecentlyUsedWithinBudget() {
+  AssetCache cache;
+  const std::string payload(100u, 'x');
+  cache.Insert("a.bin", 0u, payload.data(), payload.size());
+  assert(CacheStats(cache).entry_count == 0u);
+
+  cache.SetBudget(250u);
+  cache.Insert("a.bin", 0u, payload.data(), payload.size());
+  cache.Insert("b.bin", 0u, payload.data(), payload.size());
+  assert(Cached(&cache, "a.bin", 0u));
+  cache.Insert("c.bin", 0u, payload.data(), payload.size());
+
+  engine_native_content_cache_stats_t stats = CacheStats(cache);
+  assert(stats.entry_count == 2u);
+  assert(stats.resident_bytes == 200u);
+  assert(stats.eviction_count == 1u);
+  assert(stats.insert_count == 3u);
+  assert(Cached(&cache, "a.bin", 0u));
+  assert(Cached(&cache, "c.bin", 0u));
+  assert(!Cached(&cache, "b.bin", 0u));
+
+  std::array<char, 100> buffer{};
+  size_t size = 0u;
+  assert(cache.Read("c.bin", 0u, buffer.data(), 99u, &size) ==
+         ENGINE_NATIVE_STATUS_INVALID_ARGUMENT);
+  assert(size == payload.size());
+  assert(cache.Read("c.bin", 0u, buffer.data(), buffer.size(), &size) ==
+         ENGINE_NATIVE_STATUS_OK);
+  assert(std::string(buffer.data(), size) == payload);
+
+  const std::string oversized(300u, 'o');
+  cache.Insert("big.bin", 0u, oversized.data(), oversized.size());
+  assert(!Cached(&cache, "big.bin", 0u));
+
+  cache.SetBudget(100u);
+  stats = CacheStats(cache);
+  assert(stats.entry_count == 1u);
+  assert(stats.resident_bytes == 100u);
+  assert(Cached(&cache, "c.bin", 0u));
+  assert(stats.hit_count >= 4u);
+  assert(stats.miss_count >= 2u);
+}
+
+void TestPinnedEntriesShareOneCopy() {
+  AssetCache cache;
+  const void* data = nullptr;
+  size_t size = 0u;
+  assert(!cache.Acquire("atlas.bin", 0u, &data, &size));
+  assert(cache.InsertPinned("atlas.bin", 0u, Bytes("atlas"), 5u, &data) ==
+         ENGINE_NATIVE_STATUS_OK);
+
+  const void* second = nullptr;
+  assert(cache.InsertPinned("atlas.bin", 0u, Bytes("atlas"), 5u, &second) ==
+         ENGINE_NATIVE_STATUS_OK);
+  assert(second == data);
+  const void* third = nullptr;
+  assert(cache.Acquire("atlas.bin", 0u, &third, &size));
+  assert(third == data && size == 5u);
+
+  engine_native_content_cache_stats_t stats = CacheStats(cache);
+  assert(stats.entry_count == 1u);
+  assert(stats.pinned_entry_count == 1u);
+  assert(stats.pinned_bytes == 5u);
+  assert(stats.resident_bytes == 5u);
+
+  assert(cache.Release(data) == ENGINE_NATIVE_STATUS_OK);
+  assert(cache.Release(data) == ENGINE_NATIVE_STATUS_OK);
+  assert(CacheStats(cache).entry_count == 1u);
+  assert(std::memcmp(data, "atlas", 5u) == 0);
+  assert(cache.Release(data) == ENGINE_NATIVE_STATUS_OK);
+
+  stats = CacheStats(cache);
+  assert(stats.entry_count == 0u);
+  assert(stats.pinned_bytes == 0u);
+  assert(stats.resident_bytes == 0u);
+  assert(stats.eviction_count == 1u);
+  assert(cache.Release(data) == ENGINE_NATIVE_STATUS_NOT_FOUND);
+  assert(cache.Release(nullptr) == ENGINE_NATIVE_STATUS_OK);
+}
+
+void TestNewerGenerationDetachesPinnedEntry() {
+  AssetCache cache;
+  cache.SetBudget(1024u);
+  const void* old_data = nullptr;
+  assert(cache.InsertPinned("shared.bin", 1u, Bytes("old"), 3u, &old_data) ==
+         ENGINE_NATIVE_STATUS_OK);
+  cache.Insert("loose.bin", 1u, "loose", 5u);
+
+  const void* data = nullptr;
+  size_t size = 0u;
+  assert(!cache.Acquire("shared.bin", 2u, &data, &size));
+  assert(!Cached(&cache, "loose.bin", 2u));
+  assert(cache.InsertPinned("shared.bin", 2u, Bytes("newer"), 5u, &data) ==
+         ENGINE_NATIVE_STATUS_OK);
+  assert(data != old_data);
+
+  engine_native_content_cache_stats_t stats = CacheStats(cache);
+  assert(stats.entry_count == 2u);
+  assert(stats.pinned_entry_count == 2u);
+  assert(stats.resident_bytes == 8u);
+  assert(std::memcmp(old_data, "old", 3u) == 0);
+
+  assert(cache.Release(old_data) == ENGINE_NATIVE_STATUS_OK);
+  stats = CacheStats(cache);
+  assert(stats.entry_count == 1u);
+  assert(stats.resident_bytes == 5u);
+  assert(cache.Release(data) == ENGINE_NATIVE_STATUS_OK);
+  assert(Cached(&cache, "shared.bin", 2u));
+  assert(!Cached(&cache, "shared.bin", 3u));
+  assert(CacheStats(cache).entry_count == 0u);
+}
+
+}  // namespace
+
+void RunAssetCacheTests() {
+  TestEvictsLeastRecentlyUsedWithinBudget();
+  TestPinnedEntriesShareOneCopy();
+  TestNewerGenerationDetachesPinnedEntry();
+}
+
+}  // namespace dff::native::tests
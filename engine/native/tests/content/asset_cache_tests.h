@@ -0,0 +1,10 @@
+#ifndef DFF_ENGINE_NATIVE_ASSET_CACHE_TESTS_H
+#define DFF_ENGINE_NATIVE_ASSET_CACHE_TESTS_H
+
+namespace dff::native::tests {
+
+void RunAssetCacheTests();
+
+}  // namespace dff::native::tests
+
+#endif
@@ -0,0 +1,72 @@
+#include "content/asset_path_tests.h"
+
+#include <assert.h>
+
+#include <string>
+#include <string_view>
+
+#include "content/asset_path.h"
+
+namespace dff::native::tests {
+namespace {
+
+using dff::native::content::NormalizedAssetPath;
+
+bool Normalizes(std::string_view input, std::string_view expected) {
+  NormalizedAssetPath path;
+  return path.Assign(input) == ENGINE_NATIVE_STATUS_OK && path.view() == expected;
+}
+
+bool Rejects(std::string_view input) {
+  NormalizedAssetPath path;
+  return path.Assign(input) == ENGINE_NATIVE_STATUS_INVALID_ARGUMENT &&
+         path.view().empty();
+}
+
+void TestNormalizesSeparatorsAndEmptySegments() {
+  assert(Normalizes("textures/stone.png", "textures/stone.png"));
+  assert(Normalizes("textures\\stone.png", "textures/stone.png"));
+  assert(Normalizes("ui//atlas\\\\main.bin/", "ui/atlas/main.bin"));
+  assert(Normalizes("a", "a"));
+  assert(Normalizes("dir/.hidden/..name", "dir/.hidden/..name"));
+
+  assert(Rejects(""));
+  assert(Rejects("/rooted.bin"));
+  assert(Rejects("\\rooted.bin"));
+  assert(Rejects("a/./b"));
+  assert(Rejects("a/../b"));
+  assert(Rejects("a\\..\\b"));
+  assert(Rejects(".."));
+  assert(Normalizes("a//", "a"));
+}
+
+void TestReassignAndLongPaths() {
+  NormalizedAssetPath path;
+  assert(path.Assign("first\\path.bin") == ENGINE_NATIVE_STATUS_OK);
+  assert(path.view() == "first/path.bin");
+  assert(path.Assign("../escape") == ENGINE_NATIVE_STATUS_INVALID_ARGUMENT);
+  assert(path.view().empty());
+
+  std::string long_input;
+  std::string long_expected;
+  while (long_input.size() <= NormalizedAssetPath::kInlineCapacity * 2u) {
+    long_input += "segment\\\\";
+    long_expected += long_expected.empty() ? "segment" : "/segment";
+  }
+  long_input += "leaf.bin";
+  long_expected += "/leaf.bin";
+  assert(path.Assign(long_input) == ENGINE_NATIVE_STATUS_OK);
+  assert(path.view() == long_expected);
+
+  assert(path.Assign("short.bin") == ENGINE_NATIVE_STATUS_OK);
+  assert(path.view() == "short.bin");
+}
+
+}  // namespace
+
+void RunAssetPathTests() {
+  TestNormalizesSeparatorsAndEmptySegments();
+  TestReassignAndLongPaths();
+}
+
+}  // namespace dff::native::tests
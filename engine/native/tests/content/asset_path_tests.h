@@ -0,0 +1,10 @@
+#ifndef DFF_ENGINE_NATIVE_ASSET_PATH_TESTS_H
+#define DFF_ENGINE_NATIVE_ASSET_PATH_TESTS_H
+
+namespace dff::native::tests {
+
+void RunAssetPathTests();
+
+}  // namespace dff::native::tests
+
+#endif
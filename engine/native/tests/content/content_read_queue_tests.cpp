@@ -0,0 +1,260 @@
+#include "content/content_read_queue_tests.h"
+
+#include <assert.h>
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "content/content_read_queue.h"
+#include "content/content_runtime.h"
+#include "engine_native.h"
+
+namespace dff::native::tests {
+namespace {
+
+using dff::native::content::ContentReadQueue;
+using dff::native::content::ContentRuntime;
+
+struct ScopedTempDirectory {
+  explicit ScopedTempDirectory(const std::string& test_name) {
+    const auto suffix = std::to_string(
+        std::chrono::steady_clock::now().time_since_epoch().count());
+    path = std::filesystem::temp_directory_path() /
+           ("dff_native_" + test_name + "_" + suffix);
+    std::filesystem::create_directories(path);
+  }
+
+  ~ScopedTempDirectory() { std::filesystem::remove_all(path); }
+
+  std::filesystem::path path;
+};
+
+void WriteLooseFile(const std::filesystem::path& path, const std::string& payload) {
+  std::filesystem::create_directories(path.parent_path());
+  std::ofstream file(path, std::ios::binary | std::ios::trunc);
+  assert(file.is_open());
+  file.write(payload.data(), static_cast<std::streamsize>(payload.size()));
+}
+
+engine_native_content_read_result_t WaitForRead(ContentReadQueue* queue,
+                                                uint64_t request_id) {
+  const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+  engine_native_content_read_result_t result{};
+  uint8_t is_ready = 0u;
+  while (true) {
+    assert(queue->Poll(request_id, &result, &is_ready) == ENGINE_NATIVE_STATUS_OK);
+    if (is_ready != 0u) {
+      return result;
+    }
+    assert(std::chrono::steady_clock::now() < deadline);
+    std::this_thread::yield();
+  }
+}
+
+void TestPooledAndCallerBufferReads() {
+  ScopedTempDirectory temp("content_read_queue_buffers");
+  const std::string pooled_payload(4096u, 'p');
+  WriteLooseFile(temp.path / "assets" / "pooled.bin", pooled_payload);
+  WriteLooseFile(temp.path / "assets" / "caller.bin", "caller");
+
+  ContentRuntime runtime;
+  assert(runtime.MountDirectory(temp.path.string()) == ENGINE_NATIVE_STATUS_OK);
+  ContentReadQueue queue(runtime, 2u);
+  assert(queue.started_worker_count() == 0u);
+
+  uint64_t pooled_id = 0u;
+  assert(queue.Submit("assets/pooled.bin", nullptr, 0u, &pooled_id) ==
+         ENGINE_NATIVE_STATUS_OK);
+  assert(pooled_id != 0u);
+  assert(queue.started_worker_count() == 2u);
+
+  std::array<char, 16> caller_buffer{};
+  uint64_t caller_id = 0u;
+  assert(queue.Submit("assets\\caller.bin", caller_buffer.data(),
+                      caller_buffer.size(), &caller_id) == ENGINE_NATIVE_STATUS_OK);
+  assert(caller_id != pooled_id);
+
+  engine_native_content_read_result_t pooled = WaitForRead(&queue, pooled_id);
+  assert(pooled.status == ENGINE_NATIVE_STATUS_OK);
+  assert(pooled.size == pooled_payload.size());
+  assert(pooled.data != nullptr);
+  assert(std::memcmp(pooled.data, pooled_payload.data(), pooled.size) == 0);
+
+  const engine_native_content_read_result_t caller = WaitForRead(&queue, caller_id);
+  assert(caller.status == ENGINE_NATIVE_STATUS_OK);
+  assert(caller.size == 6u);
+  assert(caller.data == reinterpret_cast<const uint8_t*>(caller_buffer.data()));
+  assert(std::string(caller_buffer.data(), caller.size) == "caller");
+
+  uint8_t is_ready = 1u;
+  engine_native_content_read_result_t retired{};
+  assert(queue.Poll(pooled_id, &retired, &is_ready) == ENGINE_NATIVE_STATUS_NOT_FOUND);
+  assert(is_ready == 0u);
+
+  engine_native_content_read_stats_t stats{};
+  assert(queue.GetStats(&stats) == ENGINE_NATIVE_STATUS_OK);
+  assert(stats.pooled_buffer_bytes == 0u);
+  assert(queue.FreeResult(&pooled) == ENGINE_NATIVE_STATUS_OK);
+  assert(pooled.data == nullptr && pooled.size == 0u);
+  assert(queue.GetStats(&stats) == ENGINE_NATIVE_STATUS_OK);
+  assert(stats.pooled_buffer_bytes == pooled_payload.size());
+
+  assert(queue.Submit("assets/caller.bin", nullptr, 0u, &pooled_id) ==
+         ENGINE_NATIVE_STATUS_OK);
+  pooled = WaitForRead(&queue, pooled_id);
+  assert(pooled.status == ENGINE_NATIVE_STATUS_OK);
+  assert(std::memcmp(pooled.data, "caller", 6u) == 0);
+  assert(queue.GetStats(&stats) == ENGINE_NATIVE_STATUS_OK);
+  assert(stats.pooled_buffer_bytes == 0u);
+  assert(queue.FreeResult(&pooled) == ENGINE_NATIVE_STATUS_OK);
+
+  assert(queue.GetStats(&stats) == ENGINE_NATIVE_STATUS_OK);
+  assert(stats.submitted_count == 3u);
+  assert(stats.completed_count == 3u);
+  assert(stats.failed_count == 0u);
+  assert(stats.queued_count == 0u);
+  assert(stats.in_flight_count == 0u);
+  assert(stats.worker_count == 2u);
+  assert(stats.max_queue_depth >= 1u);
+  assert(stats.max_latency_ns > 0u);
+  assert(stats.total_latency_ns >= stats.max_latency_ns);
+}
+
+void TestFailuresReportThroughResult() {
+  ScopedTempDirectory temp("content_read_queue_failures");
+  WriteLooseFile(temp.path / "assets" / "big.bin", "0123456789");
+
+  ContentRuntime runtime;
+  assert(runtime.MountDirectory(temp.path.string()) == ENGINE_NATIVE_STATUS_OK);
+  ContentReadQueue queue(runtime, 1u);
+
+  uint64_t request_id = 7u;
+  assert(queue.Submit("assets/big.bin", nullptr, 4u, &request_id) ==
+         ENGINE_NATIVE_STATUS_INVALID_ARGUMENT);
+  assert(request_id == 0u);
+  assert(queue.Submit("", nullptr, 0u, &request_id) ==
+         ENGINE_NATIVE_STATUS_INVALID_ARGUMENT);
+  assert(queue.Submit("assets/big.bin", nullptr, 0u, nullptr) ==
+         ENGINE_NATIVE_STATUS_INVALID_ARGUMENT);
+
+  assert(queue.Submit("assets/missing.bin", nullptr, 0u, &request_id) ==
+         ENGINE_NATIVE_STATUS_OK);
+  engine_native_content_read_result_t result = WaitForRead(&queue, request_id);
+  assert(result.status == ENGINE_NATIVE_STATUS_NOT_FOUND);
+  assert(result.data == nullptr);
+
+  std::array<char, 4> small{};
+  assert(queue.Submit("assets/big.bin", small.data(), small.size(), &request_id) ==
+         ENGINE_NATIVE_STATUS_OK);
+  result = WaitForRead(&queue, request_id);
+  assert(result.status == ENGINE_NATIVE_STATUS_INVALID_ARGUMENT);
+  assert(result.size == 10u);
+  assert(result.data == nullptr);
+
+  assert(queue.Submit("../escape.bin", nullptr, 0u, &request_id) ==
+         ENGINE_NATIVE_STATUS_OK);
+  result = WaitForRead(&queue, request_id);
+  assert(result.status == ENGINE_NATIVE_STATUS_INVALID_ARGUMENT);
+
+  uint8_t is_ready = 0u;
+  assert(queue.Poll(0u, &result, &is_ready) == ENGINE_NATIVE_STATUS_INVALID_ARGUMENT);
+  assert(queue.Poll(999u, &result, &is_ready) == ENGINE_NATIVE_STATUS_NOT_FOUND);
+  assert(queue.Cancel(999u) == ENGINE_NATIVE_STATUS_NOT_FOUND);
+  assert(queue.FreeResult(nullptr) == ENGINE_NATIVE_STATUS_INVALID_ARGUMENT);
+  assert(queue.GetStats(nullptr) == ENGINE_NATIVE_STATUS_INVALID_ARGUMENT);
+
+  engine_native_content_read_stats_t stats{};
+  assert(queue.GetStats(&stats) == ENGINE_NATIVE_STATUS_OK);
+  assert(stats.submitted_count == 3u);
+  assert(stats.failed_count == 3u);
+}
+
+void TestCancelReleasesQueuedAndInFlightReads() {
+  ScopedTempDirectory temp("content_read_queue_cancel");
+  const std::string payload(64u * 1024u, 'c');
+  WriteLooseFile(temp.path / "assets" / "chunk.bin", payload);
+
+  ContentRuntime runtime;
+  assert(runtime.MountDirectory(temp.path.string()) == ENGINE_NATIVE_STATUS_OK);
+  ContentReadQueue queue(runtime, 1u);
+
+  constexpr size_t kRequestCount = 48u;
+  std::vector<std::vector<char>> buffers(kRequestCount,
+                                         std::vector<char>(payload.size()));
+  std::vector<uint64_t> request_ids(kRequestCount, 0u);
+  for (size_t i = 0u; i < kRequestCount; ++i) {
+    void* buffer = (i % 2u) == 0u ? buffers[i].data() : nullptr;
+    const size_t buffer_size = buffer == nullptr ? 0u : buffers[i].size();
+    assert(queue.Submit("assets/chunk.bin", buffer, buffer_size, &request_ids[i]) ==
+           ENGINE_NATIVE_STATUS_OK);
+  }
+
+  for (const uint64_t request_id : request_ids) {
+    assert(queue.Cancel(request_id) == ENGINE_NATIVE_STATUS_OK);
+    assert(queue.Cancel(request_id) == ENGINE_NATIVE_STATUS_NOT_FOUND);
+  }
+
+  engine_native_content_read_stats_t stats{};
+  assert(queue.GetStats(&stats) == ENGINE_NATIVE_STATUS_OK);
+  assert(stats.cancelled_count == kRequestCount);
+  assert(stats.queued_count == 0u);
+  assert(stats.in_flight_count == 0u);
+  assert(stats.max_queue_depth >= 1u);
+  assert(stats.completed_count < kRequestCount);
+  assert(stats.pooled_buffer_bytes <=
+         ContentReadQueue::kMaxPooledBuffers * payload.size());
+}
+
+void TestReadsRunWhileMounting() {
+  ScopedTempDirectory temp("content_read_queue_mounting");
+  WriteLooseFile(temp.path / "base" / "assets" / "shared.bin", "base");
+  constexpr size_t kOverlayCount = 16u;
+  for (size_t i = 0u; i < kOverlayCount; ++i) {
+    WriteLooseFile(temp.path / ("overlay_" + std::to_string(i)) / "assets" /
+                       ("only_" + std::to_string(i) + ".bin"),
+                   "overlay");
+  }
+
+  ContentRuntime runtime;
+  assert(runtime.MountDirectory((temp.path / "base").string()) ==
+         ENGINE_NATIVE_STATUS_OK);
+  ContentReadQueue queue(runtime, 2u);
+
+  std::vector<uint64_t> request_ids;
+  for (size_t i = 0u; i < kOverlayCount; ++i) {
+    uint64_t request_id = 0u;
+    assert(queue.Submit("assets/shared.bin", nullptr, 0u, &request_id) ==
+           ENGINE_NATIVE_STATUS_OK);
+    request_ids.push_back(request_id);
+    assert(runtime.MountDirectory(
+               (temp.path / ("overlay_" + std::to_string(i))).string()) ==
+           ENGINE_NATIVE_STATUS_OK);
+  }
+
+  for (const uint64_t request_id : request_ids) {
+    engine_native_content_read_result_t result = WaitForRead(&queue, request_id);
+    assert(result.status == ENGINE_NATIVE_STATUS_OK);
+    assert(std::string(reinterpret_cast<const char*>(result.data), result.size) ==
+           "base");
+    assert(queue.FreeResult(&result) == ENGINE_NATIVE_STATUS_OK);
+  }
+  assert(runtime.directory_mount_count() == kOverlayCount + 1u);
+}
+
+}  // namespace
+
+void RunContentReadQueueTests() {
+  TestPooledAndCallerBufferReads();
+  TestFailuresReportThroughResult();
+  TestCancelReleasesQueuedAndInFlightReads();
+  TestReadsRunWhileMounting();
+}
+
+}  // namespace dff::native::tests
@@ -0,0 +1,10 @@
+#ifndef DFF_ENGINE_NATIVE_CONTENT_READ_QUEUE_TESTS_H
+#define DFF_ENGINE_NATIVE_CONTENT_READ_QUEUE_TESTS_H
+
+namespace dff::native::tests {
+
+void RunContentReadQueueTests();
+
+}  // namespace dff::native::tests
+
+#endif
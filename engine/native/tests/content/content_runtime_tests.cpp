@@ -2,22 +2,36 @@
 
 #include <assert.h>
 
+#include <algorithm>
 #include <array>
 #include <chrono>
 #include <cstdint>
 #include <cstring>
 #include <filesystem>
 #include <fstream>
+#include <sstream>
 #include <string>
+#include <thread>
+#include <utility>
 #include <vector>
 
+#include "content/content_runtime.h"
+#include "content/lz4_block.h"
+#include "content/pak_index.h"
 #include "engine_native.h"
 
 namespace dff::native::tests {
 namespace {
 
 constexpr uint32_t kPakMagic = 0x50464644u;  // DFFP
-constexpr uint32_t kPakVersion = 3u;
+constexpr uint32_t kPakVersionLegacy = 3u;
+constexpr uint32_t kPakVersionUncompressed = 4u;
+constexpr uint32_t kPakVersion = 5u;
+constexpr size_t kPakHeaderSize = 64u;
+constexpr size_t kPakTocEntrySizeUncompressed = 56u;
+constexpr size_t kPakTocEntrySize = 72u;
+constexpr uint32_t kPakCodecLz4Chunked = 1u;
+constexpr uint32_t kPakChunkStoredBit = 0x80000000u;
 
 struct ScopedTempDirectory {
   explicit ScopedTempDirectory(const std::string& test_name) {
@@ -39,8 +53,50 @@ struct PakAsset {
   std::string compiled_path;
   std::string asset_key;
   std::string payload;
+  uint32_t chunk_size = 0u;
 };
 
+struct StoredPayload {
+  std::string bytes;
+  uint32_t codec = 0u;
+  uint32_t chunk_size = 0u;
+};
+
+StoredPayload EncodePayload(const PakAsset& asset) {
+  if (asset.chunk_size == 0u) {
+    return StoredPayload{.bytes = asset.payload};
+  }
+
+  const size_t chunk_count =
+      (asset.payload.size() + asset.chunk_size - 1u) / asset.chunk_size;
+  std::string table(chunk_count * sizeof(uint32_t), '\0');
+  std::string data;
+  std::vector<uint8_t> scratch(content::Lz4CompressBound(asset.chunk_size));
+  for (size_t chunk = 0u; chunk < chunk_count; ++chunk) {
+    const size_t offset = chunk * asset.chunk_size;
+    const size_t size = std::min<size_t>(asset.chunk_size,
+                                         asset.payload.size() - offset);
+    const size_t compressed_size = content::Lz4CompressBlock(
+        reinterpret_cast<const uint8_t*>(asset.payload.data()) + offset, size,
+        scratch.data(), scratch.size());
+    assert(compressed_size != 0u);
+
+    uint32_t descriptor = static_cast<uint32_t>(compressed_size);
+    if (compressed_size >= size) {
+      descriptor = static_cast<uint32_t>(size) | kPakChunkStoredBit;
+      data.append(asset.payload, offset, size);
+    } else {
+      data.append(reinterpret_cast<const char*>(scratch.data()), compressed_size);
+    }
+    std::memcpy(table.data() + chunk * sizeof(uint32_t), &descriptor,
+                sizeof(descriptor));
+  }
+
+  return StoredPayload{.bytes = table + data,
+                       .codec = kPakCodecLz4Chunked,
+                       .chunk_size = asset.chunk_size};
+}
+
 void Write7BitEncodedInt(std::ostream* stream, uint32_t value) {
   assert(stream != nullptr);
   while (value >= 0x80u) {
@@ -84,8 +140,8 @@ size_t ComputeIndexSize(const std::vector<PakAsset>& assets) {
   return index_size;
 }
 
-void WritePak(const std::filesystem::path& pak_path,
-              const std::vector<PakAsset>& assets) {
+void WriteLegacyPak(const std::filesystem::path& pak_path,
+                    const std::vector<PakAsset>& assets) {
   std::ofstream stream(pak_path, std::ios::binary | std::ios::trunc);
   assert(stream.is_open());
 
@@ -100,7 +156,8 @@ void WritePak(const std::filesystem::path& pak_path,
   int64_t next_offset = static_cast<int64_t>(header_size + index_size);
 
   stream.write(reinterpret_cast<const char*>(&kPakMagic), sizeof(kPakMagic));
-  stream.write(reinterpret_cast<const char*>(&kPakVersion), sizeof(kPakVersion));
+  stream.write(reinterpret_cast<const char*>(&kPakVersionLegacy),
+               sizeof(kPakVersionLegacy));
   stream.write(reinterpret_cast<const char*>(&entry_count), sizeof(entry_count));
   stream.write(reinterpret_cast<const char*>(&reserved), sizeof(reserved));
   stream.write(reinterpret_cast<const char*>(&created_at_ticks),
@@ -127,6 +184,160 @@ void WritePak(const std::filesystem::path& pak_path,
   }
 }
 
+uint64_t HashPath(const std::string& path) {
+  uint64_t hash = 14695981039346656037ull;
+  for (const char c : path) {
+    hash ^= static_cast<uint8_t>(c);
+    hash *= 1099511628211ull;
+  }
+
+  return hash;
+}
+
+template <typename T>
+void WritePod(std::ostream* stream, const T& value) {
+  stream->write(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+std::string BuildPak(const std::vector<PakAsset>& assets,
+                     uint32_t version = kPakVersion) {
+  std::ostringstream stream(std::ios::binary);
+  const size_t record_size = version == kPakVersion ? kPakTocEntrySize
+                                                    : kPakTocEntrySizeUncompressed;
+  std::vector<StoredPayload> payloads;
+  for (const PakAsset& asset : assets) {
+    payloads.push_back(EncodePayload(asset));
+    assert(version == kPakVersion || payloads.back().codec == 0u);
+  }
+
+  std::string strings;
+  auto append_string = [&strings](const std::string& value) {
+    const uint32_t offset = static_cast<uint32_t>(strings.size());
+    strings += value;
+    return std::pair<uint32_t, uint32_t>{offset,
+                                         static_cast<uint32_t>(value.size())};
+  };
+
+  const uint64_t toc_offset = kPakHeaderSize;
+  const uint64_t toc_size = assets.size() * record_size;
+  std::vector<std::pair<uint32_t, uint32_t>> string_refs;
+  for (const PakAsset& asset : assets) {
+    string_refs.push_back(append_string(asset.path));
+    string_refs.push_back(append_string(asset.kind));
+    string_refs.push_back(append_string(asset.compiled_path));
+    string_refs.push_back(append_string(asset.asset_key));
+  }
+
+  uint32_t bucket_bits = 0u;
+  while ((size_t{1} << bucket_bits) < assets.size()) {
+    ++bucket_bits;
+  }
+  const size_t bucket_count = size_t{1} << bucket_bits;
+  const uint64_t buckets_offset = toc_offset + toc_size;
+  const uint64_t strings_offset =
+      buckets_offset + (bucket_count + 1u) * sizeof(uint32_t);
+  uint64_t next_offset = strings_offset + strings.size();
+  std::vector<uint64_t> payload_offsets;
+  for (const StoredPayload& payload : payloads) {
+    payload_offsets.push_back(payload.bytes.empty() ? 0u : next_offset);
+    next_offset += payload.bytes.size();
+  }
+
+  std::vector<size_t> order(assets.size());
+  for (size_t i = 0u; i < order.size(); ++i) {
+    order[i] = i;
+  }
+  std::sort(order.begin(), order.end(), [&assets](size_t lhs, size_t rhs) {
+    const uint64_t lhs_hash = HashPath(assets[lhs].path);
+    const uint64_t rhs_hash = HashPath(assets[rhs].path);
+    return lhs_hash != rhs_hash ? lhs_hash < rhs_hash
+                                : assets[lhs].path < assets[rhs].path;
+  });
+
+  WritePod(&stream, kPakMagic);
+  WritePod(&stream, version);
+  WritePod(&stream, static_cast<int32_t>(assets.size()));
+  WritePod(&stream, uint32_t{0u});
+  WritePod(&stream, int64_t{0});
+  WritePod(&stream, toc_offset);
+  WritePod(&stream, strings_offset);
+  WritePod(&stream, static_cast<uint64_t>(strings.size()));
+  WritePod(&stream, buckets_offset);
+  WritePod(&stream, bucket_bits);
+  WritePod(&stream, uint32_t{0u});
+
+  for (const size_t index : order) {
+    WritePod(&stream, HashPath(assets[index].path));
+    WritePod(&stream, payload_offsets[index]);
+    WritePod(&stream, static_cast<uint64_t>(payloads[index].bytes.size()));
+    if (version == kPakVersion) {
+      WritePod(&stream, static_cast<uint64_t>(assets[index].payload.size()));
+      WritePod(&stream, payloads[index].codec);
+      WritePod(&stream, payloads[index].chunk_size);
+    }
+    for (size_t field = 0u; field < 4u; ++field) {
+      WritePod(&stream, string_refs[index * 4u + field].first);
+      WritePod(&stream, string_refs[index * 4u + field].second);
+    }
+  }
+
+  size_t next_record = 0u;
+  for (size_t bucket = 0u; bucket <= bucket_count; ++bucket) {
+    while (next_record < order.size() && bucket_bits != 0u &&
+           (HashPath(assets[order[next_record]].path) >> (64u - bucket_bits)) <
+               bucket) {
+      ++next_record;
+    }
+    WritePod(&stream, static_cast<uint32_t>(
+                          bucket == bucket_count ? order.size() : next_record));
+  }
+
+  stream.write(strings.data(), static_cast<std::streamsize>(strings.size()));
+  for (const StoredPayload& payload : payloads) {
+    stream.write(payload.bytes.data(),
+                 static_cast<std::streamsize>(payload.bytes.size()));
+  }
+  return stream.str();
+}
+
+void WritePak(const std::filesystem::path& pak_path,
+              const std::vector<PakAsset>& assets,
+              uint32_t version = kPakVersion) {
+  const std::string bytes = BuildPak(assets, version);
+  std::ofstream stream(pak_path, std::ios::binary | std::ios::trunc);
+  assert(stream.is_open());
+  stream.write(bytes.data(), static_cast<std::streamsize>(bytes.size()));
+}
+
+void WriteLooseFile(const std::filesystem::path& path, const std::string& payload) {
+  std::filesystem::create_directories(path.parent_path());
+  std::ofstream file(path, std::ios::binary | std::ios::trunc);
+  assert(file.is_open());
+  file.write(payload.data(), static_cast<std::streamsize>(payload.size()));
+}
+
+std::string ReadAsset(engine_native_engine_t* engine, const char* asset_path) {
+  std::array<char, 64> buffer{};
+  size_t out_size = 0u;
+  const engine_native_status_t status = content_read_file(
+      engine, asset_path, buffer.data(), buffer.size(), &out_size);
+  if (status != ENGINE_NATIVE_STATUS_OK) {
+    return "status:" + std::to_string(static_cast<int>(status));
+  }
+
+  return std::string(buffer.data(), out_size);
+}
+
+PakAsset RawAsset(const std::string& path, const std::string& payload) {
+  return PakAsset{
+      .path = path,
+      .kind = "raw",
+      .compiled_path = "raw/" + path,
+      .asset_key = path + "_key",
+      .payload = payload,
+  };
+}
+
 void TestMountPakAndReadFile() {
   ScopedTempDirectory temp("content_pak");
   const std::filesystem::path pak_path = temp.path / "content.pak";
@@ -179,6 +390,813 @@ void TestMountPakAndReadFile() {
   assert(engine_destroy(engine) == ENGINE_NATIVE_STATUS_OK);
 }
 
+void TestMapFileReturnsPakBytesWithoutCopy() {
+  ScopedTempDirectory temp("content_map");
+  const std::filesystem::path pak_path = temp.path / "content.pak";
+  const std::filesystem::path override_path = temp.path / "override.pak";
+  const std::string mesh_payload = "mesh-bytes";
+  const std::string texture_payload = "texture-bytes";
+
+  WritePak(pak_path,
+           {PakAsset{
+                .path = "assets/mesh.bin",
+                .kind = "mesh",
+                .compiled_path = "mesh/mesh.bin",
+                .asset_key = "mesh_key",
+                .payload = mesh_payload,
+            },
+            PakAsset{
+                .path = "assets/empty.bin",
+                .kind = "raw",
+                .compiled_path = "raw/empty.bin",
+                .asset_key = "empty_key",
+                .payload = "",
+            }});
+  WritePak(override_path,
+           {PakAsset{
+               .path = "assets/texture.bin",
+               .kind = "texture",
+               .compiled_path = "texture/texture.bin",
+               .asset_key = "texture_key",
+               .payload = texture_payload,
+           }});
+
+  engine_native_engine_t* engine = nullptr;
+  const engine_native_create_desc_t create_desc{
+      .api_version = ENGINE_NATIVE_API_VERSION,
+      .user_data = nullptr,
+  };
+  assert(engine_create(&create_desc, &engine) == ENGINE_NATIVE_STATUS_OK);
+
+  const void* data = nullptr;
+  size_t out_size = 0u;
+  assert(content_map_file(engine, "assets/mesh.bin", &data, &out_size) ==
+         ENGINE_NATIVE_STATUS_NOT_FOUND);
+
+  assert(content_mount_pak(engine, pak_path.string().c_str()) ==
+         ENGINE_NATIVE_STATUS_OK);
+  assert(content_map_file(engine, "assets/mesh.bin", &data, &out_size) ==
+         ENGINE_NATIVE_STATUS_OK);
+  assert(data != nullptr);
+  assert(out_size == mesh_payload.size());
+  assert(std::memcmp(data, mesh_payload.data(), mesh_payload.size()) == 0);
+
+  const void* mesh_data = data;
+  assert(content_mount_pak(engine, override_path.string().c_str()) ==
+         ENGINE_NATIVE_STATUS_OK);
+  assert(content_map_file(engine, "assets/mesh.bin", &data, &out_size) ==
+         ENGINE_NATIVE_STATUS_OK);
+  assert(data == mesh_data);
+
+  assert(content_map_file(engine, "assets\\texture.bin", &data, &out_size) ==
+         ENGINE_NATIVE_STATUS_OK);
+  assert(out_size == texture_payload.size());
+  assert(std::memcmp(data, texture_payload.data(), texture_payload.size()) == 0);
+
+  assert(content_map_file(engine, "assets/empty.bin", &data, &out_size) ==
+         ENGINE_NATIVE_STATUS_OK);
+  assert(data == nullptr);
+  assert(out_size == 0u);
+
+  std::array<char, 16> buffer{};
+  for (int i = 0; i < 64; ++i) {
+    assert(content_read_file(engine, "assets/mesh.bin", buffer.data(),
+                             buffer.size(), &out_size) == ENGINE_NATIVE_STATUS_OK);
+  }
+  assert(std::memcmp(buffer.data(), mesh_payload.data(), mesh_payload.size()) ==
+         0);
+
+  assert(content_map_file(engine, "../mesh.bin", &data, &out_size) ==
+         ENGINE_NATIVE_STATUS_INVALID_ARGUMENT);
+  assert(content_map_file(engine, "assets/mesh.bin", nullptr, &out_size) ==
+         ENGINE_NATIVE_STATUS_INVALID_ARGUMENT);
+  assert(content_map_file(engine, "assets/mesh.bin", &data, nullptr) ==
+         ENGINE_NATIVE_STATUS_INVALID_ARGUMENT);
+
+  assert(engine_destroy(engine) == ENGINE_NATIVE_STATUS_OK);
+}
+
+void TestMountValidatesTruncatedPak() {
+  ScopedTempDirectory temp("content_truncated");
+  const PakAsset asset{
+      .path = "assets/a.bin",
+      .kind = "raw",
+      .compiled_path = "raw/a.bin",
+      .asset_key = "a_key",
+      .payload = "payload",
+  };
+
+  const std::filesystem::path short_payload_path = temp.path / "short_payload.pak";
+  WritePak(short_payload_path, {asset});
+  std::filesystem::resize_file(
+      short_payload_path, std::filesystem::file_size(short_payload_path) - 2u);
+
+  const std::filesystem::path short_toc_path = temp.path / "short_toc.pak";
+  WritePak(short_toc_path, {asset});
+  std::filesystem::resize_file(short_toc_path, kPakHeaderSize + 8u);
+
+  const std::filesystem::path legacy_path = temp.path / "legacy.pak";
+  WriteLegacyPak(legacy_path, {asset});
+  std::filesystem::resize_file(legacy_path,
+                               std::filesystem::file_size(legacy_path) - 2u);
+
+  const std::filesystem::path empty_path = temp.path / "empty.pak";
+  { std::ofstream empty(empty_path, std::ios::binary | std::ios::trunc); }
+
+  engine_native_engine_t* engine = nullptr;
+  const engine_native_create_desc_t create_desc{
+      .api_version = ENGINE_NATIVE_API_VERSION,
+      .user_data = nullptr,
+  };
+  assert(engine_create(&create_desc, &engine) == ENGINE_NATIVE_STATUS_OK);
+
+  assert(content_mount_pak(engine, short_toc_path.string().c_str()) ==
+         ENGINE_NATIVE_STATUS_INTERNAL_ERROR);
+  assert(content_mount_pak(engine, legacy_path.string().c_str()) ==
+         ENGINE_NATIVE_STATUS_INTERNAL_ERROR);
+  assert(content_mount_pak(engine, empty_path.string().c_str()) ==
+         ENGINE_NATIVE_STATUS_INTERNAL_ERROR);
+
+  size_t out_size = 0u;
+  assert(content_read_file(engine, "assets/a.bin", nullptr, 0u, &out_size) ==
+         ENGINE_NATIVE_STATUS_NOT_FOUND);
+
+  assert(content_mount_pak(engine, short_payload_path.string().c_str()) ==
+         ENGINE_NATIVE_STATUS_OK);
+  std::array<char, 16> buffer{};
+  assert(content_read_file(engine, "assets/a.bin", buffer.data(), buffer.size(),
+                           &out_size) == ENGINE_NATIVE_STATUS_INTERNAL_ERROR);
+  const void* data = nullptr;
+  assert(content_map_file(engine, "assets/a.bin", &data, &out_size) ==
+         ENGINE_NATIVE_STATUS_INTERNAL_ERROR);
+  assert(data == nullptr);
+
+  assert(engine_destroy(engine) == ENGINE_NATIVE_STATUS_OK);
+}
+
+void TestHashedTocResolvesEveryEntry() {
+  ScopedTempDirectory temp("content_hashed_toc");
+  const std::filesystem::path pak_path = temp.path / "many.pak";
+
+  constexpr size_t kAssetCount = 2048u;
+  std::vector<PakAsset> assets;
+  assets.reserve(kAssetCount);
+  for (size_t i = 0u; i < kAssetCount; ++i) {
+    assets.push_back(PakAsset{
+        .path = "assets/group_" + std::to_string(i % 17u) + "/item_" +
+                std::to_string(i) + ".bin",
+        .kind = "raw",
+        .compiled_path = "raw/" + std::to_string(i) + ".bin",
+        .asset_key = "key_" + std::to_string(i),
+        .payload = std::to_string(i * 31u),
+    });
+  }
+  WritePak(pak_path, assets);
+
+  engine_native_engine_t* engine = nullptr;
+  const engine_native_create_desc_t create_desc{
+      .api_version = ENGINE_NATIVE_API_VERSION,
+      .user_data = nullptr,
+  };
+  assert(engine_create(&create_desc, &engine) == ENGINE_NATIVE_STATUS_OK);
+  assert(content_mount_pak(engine, pak_path.string().c_str()) ==
+         ENGINE_NATIVE_STATUS_OK);
+
+  std::array<char, 32> buffer{};
+  size_t out_size = 0u;
+  for (const PakAsset& asset : assets) {
+    assert(content_read_file(engine, asset.path.c_str(), buffer.data(),
+                             buffer.size(), &out_size) == ENGINE_NATIVE_STATUS_OK);
+    assert(out_size == asset.payload.size());
+    assert(std::memcmp(buffer.data(), asset.payload.data(), out_size) == 0);
+  }
+
+  assert(content_read_file(engine, "assets/group_0/item_2048.bin", nullptr, 0u,
+                           &out_size) == ENGINE_NATIVE_STATUS_NOT_FOUND);
+  assert(content_read_file(engine, "assets/group_0/item_0.bi", nullptr, 0u,
+                           &out_size) == ENGINE_NATIVE_STATUS_NOT_FOUND);
+
+  assert(engine_destroy(engine) == ENGINE_NATIVE_STATUS_OK);
+}
+
+void TestMountLegacyPakVersion() {
+  ScopedTempDirectory temp("content_legacy_pak");
+  const std::filesystem::path pak_path = temp.path / "legacy.pak";
+  const std::string payload = "legacy";
+  WriteLegacyPak(pak_path, {PakAsset{
+                               .path = "assets\\legacy.bin",
+                               .kind = "raw",
+                               .compiled_path = "raw/legacy.bin",
+                               .asset_key = "legacy_key",
+                               .payload = payload,
+                           }});
+
+  engine_native_engine_t* engine = nullptr;
+  const engine_native_create_desc_t create_desc{
+      .api_version = ENGINE_NATIVE_API_VERSION,
+      .user_data = nullptr,
+  };
+  assert(engine_create(&create_desc, &engine) == ENGINE_NATIVE_STATUS_OK);
+  assert(content_mount_pak(engine, pak_path.string().c_str()) ==
+         ENGINE_NATIVE_STATUS_OK);
+
+  std::array<char, 16> buffer{};
+  size_t out_size = 0u;
+  assert(content_read_file(engine, "assets/legacy.bin", buffer.data(),
+                           buffer.size(), &out_size) == ENGINE_NATIVE_STATUS_OK);
+  assert(out_size == payload.size());
+  assert(std::memcmp(buffer.data(), payload.data(), payload.size()) == 0);
+
+  assert(engine_destroy(engine) == ENGINE_NATIVE_STATUS_OK);
+}
+
+void TestCompressedPakEntriesDecodeIntoCallerBuffer() {
+  ScopedTempDirectory temp("content_compressed");
+  std::string texture;
+  for (size_t i = 0u; i < 300000u; ++i) {
+    texture.push_back(static_cast<char>("rgba"[i % 4u] + (i / 4096u) % 3u));
+  }
+  std::string noise(10000u, '\0');
+  uint32_t state = 7u;
+  for (char& c : noise) {
+    state = state * 1664525u + 1013904223u;
+    c = static_cast<char>(state >> 24u);
+  }
+
+  PakAsset texture_asset = RawAsset("textures/albedo.tex", texture);
+  texture_asset.chunk_size = 65536u;
+  PakAsset noise_asset = RawAsset("audio/noise.snd", noise);
+  noise_asset.chunk_size = 4096u;
+  PakAsset empty_asset = RawAsset("meshes/empty.mesh", "");
+  empty_asset.chunk_size = 65536u;
+  const std::vector<PakAsset> assets = {
+      texture_asset, noise_asset, empty_asset, RawAsset("config/stored.txt", "stored")};
+
+  const std::filesystem::path pak_path = temp.path / "compressed.pak";
+  WritePak(pak_path, assets);
+  assert(std::filesystem::file_size(pak_path) < texture.size() / 2u);
+
+  const std::filesystem::path uncompressed_path = temp.path / "uncompressed.pak";
+  WritePak(uncompressed_path, {RawAsset("config/v4.txt", "version4")},
+           kPakVersionUncompressed);
+
+  engine_native_engine_t* engine = nullptr;
+  const engine_native_create_desc_t create_desc{
+      .api_version = ENGINE_NATIVE_API_VERSION,
+      .user_data = nullptr,
+  };
+  assert(engine_create(&create_desc, &engine) == ENGINE_NATIVE_STATUS_OK);
+  assert(content_mount_pak(engine, pak_path.string().c_str()) ==
+         ENGINE_NATIVE_STATUS_OK);
+  assert(content_mount_pak(engine, uncompressed_path.string().c_str()) ==
+         ENGINE_NATIVE_STATUS_OK);
+
+  std::vector<char> buffer(texture.size());
+  size_t out_size = 0u;
+  for (const PakAsset& asset : assets) {
+    assert(content_read_file(engine, asset.path.c_str(), nullptr, 0u,
+                             &out_size) == ENGINE_NATIVE_STATUS_OK);
+    assert(out_size == asset.payload.size());
+    assert(content_read_file(engine, asset.path.c_str(), buffer.data(),
+                             buffer.size(), &out_size) == ENGINE_NATIVE_STATUS_OK);
+    assert(out_size == asset.payload.size());
+    assert(std::memcmp(buffer.data(), asset.payload.data(), out_size) == 0);
+  }
+  assert(ReadAsset(engine, "config/v4.txt") == "version4");
+
+  assert(content_read_file(engine, "textures/albedo.tex", buffer.data(),
+                           texture.size() - 1u, &out_size) ==
+         ENGINE_NATIVE_STATUS_INVALID_ARGUMENT);
+
+  const void* data = nullptr;
+  assert(content_map_file(engine, "textures/albedo.tex", &data, &out_size) ==
+         ENGINE_NATIVE_STATUS_INVALID_STATE);
+  assert(data == nullptr);
+  assert(content_map_file(engine, "config/stored.txt", &data, &out_size) ==
+         ENGINE_NATIVE_STATUS_OK);
+  assert(out_size == 6u && std::memcmp(data, "stored", 6u) == 0);
+
+  assert(engine_destroy(engine) == ENGINE_NATIVE_STATUS_OK);
+}
+
+void TestCompressedChunksDecodeIndependently() {
+  std::string payload;
+  for (size_t i = 0u; i < 20000u; ++i) {
+    payload += static_cast<char>('a' + (i * 7u) % 13u);
+  }
+  PakAsset asset = RawAsset("assets/big.bin", payload);
+  asset.chunk_size = 4096u;
+  std::string pak = BuildPak({asset});
+
+  content::PakIndex index;
+  assert(index.Load(reinterpret_cast<const uint8_t*>(pak.data()), pak.size()) ==
+         ENGINE_NATIVE_STATUS_OK);
+  content::PakAssetEntry entry;
+  assert(index.Find("assets/big.bin", &entry));
+  assert(entry.codec == content::PakCodec::kLz4Chunked);
+  assert(entry.uncompressed_size_bytes == payload.size());
+  assert(content::PakAssetChunkCount(entry) == 5u);
+
+  const uint8_t* pak_bytes = reinterpret_cast<const uint8_t*>(pak.data());
+  std::vector<uint8_t> output(payload.size());
+  engine_native_status_t statuses[2] = {ENGINE_NATIVE_STATUS_INTERNAL_ERROR,
+                                        ENGINE_NATIVE_STATUS_INTERNAL_ERROR};
+  std::thread worker([&]() {
+    statuses[1] = content::DecodePakAssetChunks(pak_bytes, pak.size(), entry, 2u,
+                                                3u, output.data(), output.size());
+  });
+  statuses[0] = content::DecodePakAssetChunks(pak_bytes, pak.size(), entry, 0u,
+                                              2u, output.data(), output.size());
+  worker.join();
+  assert(statuses[0] == ENGINE_NATIVE_STATUS_OK);
+  assert(statuses[1] == ENGINE_NATIVE_STATUS_OK);
+  assert(std::memcmp(output.data(), payload.data(), payload.size()) == 0);
+  assert(content::DecodePakAssetChunks(pak_bytes, pak.size(), entry, 4u, 2u,
+                                       output.data(), output.size()) ==
+         ENGINE_NATIVE_STATUS_INVALID_ARGUMENT);
+
+  size_t out_size = 0u;
+  const uint32_t oversized_chunk = 0x7FFFFFFFu;
+  std::memcpy(pak.data() + entry.offset_bytes, &oversized_chunk,
+              sizeof(oversized_chunk));
+  assert(content::ReadPakAssetBytes(pak_bytes, pak.size(), entry, output.data(),
+                                    output.size(), &out_size) ==
+         ENGINE_NATIVE_STATUS_INTERNAL_ERROR);
+
+  const uint32_t short_stored_chunk = 16u | kPakChunkStoredBit;
+  std::memcpy(pak.data() + entry.offset_bytes, &short_stored_chunk,
+              sizeof(short_stored_chunk));
+  assert(content::ReadPakAssetBytes(pak_bytes, pak.size(), entry, output.data(),
+                                    output.size(), &out_size) ==
+         ENGINE_NATIVE_STATUS_INTERNAL_ERROR);
+}
+
+void TestAsyncReadsCompleteThroughPolling() {
+  ScopedTempDirectory temp("content_async");
+  std::string texture;
+  for (size_t i = 0u; i < 200000u; ++i) {
+    texture.push_back(static_cast<char>('a' + (i / 512u) % 26u));
+  }
+  PakAsset texture_asset = RawAsset("textures/streamed.tex", texture);
+  texture_asset.chunk_size = 65536u;
+  const std::filesystem::path pak_path = temp.path / "streamed.pak";
+  WritePak(pak_path, {texture_asset, RawAsset("config/small.txt", "small")});
+
+  engine_native_engine_t* engine = nullptr;
+  const engine_native_create_desc_t create_desc{
+      .api_version = ENGINE_NATIVE_API_VERSION,
+      .user_data = nullptr,
+  };
+  assert(engine_create(&create_desc, &engine) == ENGINE_NATIVE_STATUS_OK);
+  assert(content_mount_pak(engine, pak_path.string().c_str()) ==
+         ENGINE_NATIVE_STATUS_OK);
+
+  uint64_t texture_id = 0u;
+  assert(content_read_file_async(engine, "textures/streamed.tex", nullptr, 0u,
+                                 &texture_id) == ENGINE_NATIVE_STATUS_OK);
+  std::array<char, 8> small{};
+  uint64_t small_id = 0u;
+  assert(content_read_file_async(engine, "config/small.txt", small.data(),
+                                 small.size(), &small_id) == ENGINE_NATIVE_STATUS_OK);
+  uint64_t cancelled_id = 0u;
+  assert(content_read_file_async(engine, "textures/streamed.tex", nullptr, 0u,
+                                 &cancelled_id) == ENGINE_NATIVE_STATUS_OK);
+  assert(content_cancel_read(engine, cancelled_id) == ENGINE_NATIVE_STATUS_OK);
+
+  const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+  engine_native_content_read_result_t texture_result{};
+  engine_native_content_read_result_t small_result{};
+  uint8_t texture_ready = 0u;
+  uint8_t small_ready = 0u;
+  while (texture_ready == 0u || small_ready == 0u) {
+    assert(std::chrono::steady_clock::now() < deadline);
+    if (texture_ready == 0u) {
+      assert(content_poll_read(engine, texture_id, &texture_result,
+                               &texture_ready) == ENGINE_NATIVE_STATUS_OK);
+    }
+    if (small_ready == 0u) {
+      assert(content_poll_read(engine, small_id, &small_result, &small_ready) ==
+             ENGINE_NATIVE_STATUS_OK);
+    }
+    std::this_thread::yield();
+  }
+
+  assert(texture_result.status == ENGINE_NATIVE_STATUS_OK);
+  assert(texture_result.size == texture.size());
+  assert(std::memcmp(texture_result.data, texture.data(), texture.size()) == 0);
+  assert(content_free_read_result(engine, &texture_result) == ENGINE_NATIVE_STATUS_OK);
+  assert(small_result.status == ENGINE_NATIVE_STATUS_OK);
+  assert(std::string(small.data(), small_result.size) == "small");
+
+  uint8_t is_ready = 0u;
+  assert(content_poll_read(engine, cancelled_id, &small_result, &is_ready) ==
+         ENGINE_NATIVE_STATUS_NOT_FOUND);
+  assert(content_poll_read(nullptr, small_id, &small_result, &is_ready) ==
+         ENGINE_NATIVE_STATUS_INVALID_ARGUMENT);
+  assert(content_read_file_async(engine, nullptr, nullptr, 0u, &texture_id) ==
+         ENGINE_NATIVE_STATUS_INVALID_ARGUMENT);
+
+  engine_native_content_read_stats_t stats{};
+  assert(content_get_read_stats(engine, &stats) == ENGINE_NATIVE_STATUS_OK);
+  assert(stats.submitted_count == 3u);
+  assert(stats.cancelled_count == 1u);
+  assert(stats.failed_count == 0u);
+  assert(stats.queued_count == 0u && stats.in_flight_count == 0u);
+  assert(stats.worker_count > 0u);
+  assert(stats.pooled_buffer_bytes >= texture.size());
+
+  for (size_t i = 0u; i < 8u; ++i) {
+    assert(content_read_file_async(engine, "textures/streamed.tex", nullptr, 0u,
+                                   &texture_id) == ENGINE_NATIVE_STATUS_OK);
+  }
+  assert(engine_destroy(engine) == ENGINE_NATIVE_STATUS_OK);
+}
+
+void TestStreamingRequestsLocatePakOffsets() {
+  ScopedTempDirectory temp("content_streaming");
+  std::string terrain;
+  for (size_t i = 0u; i < 100000u; ++i) {
+    terrain.push_back(static_cast<char>('a' + (i / 256u) % 26u));
+  }
+  PakAsset terrain_asset = RawAsset("world/terrain.bin", terrain);
+  terrain_asset.chunk_size = 32768u;
+  const std::vector<PakAsset> assets{RawAsset("world/props.bin", "props"),
+                                     terrain_asset,
+                                     RawAsset("world/sky.bin", "sky-dome")};
+  const std::filesystem::path pak_path = temp.path / "world.pak";
+  WritePak(pak_path, assets);
+
+  content::ContentRuntime runtime;
+  assert(runtime.MountPak(pak_path.string()) == ENGINE_NATIVE_STATUS_OK);
+  std::array<content::ContentLocation, 3> locations{};
+  for (size_t i = 0u; i < assets.size(); ++i) {
+    assert(runtime.Locate(assets[i].path, &locations[i]) ==
+           ENGINE_NATIVE_STATUS_OK);
+    assert(locations[i].source == content::VfsSource::kPak);
+    assert(locations[i].mount_index == 0u);
+    assert(locations[i].size_bytes == assets[i].payload.size());
+  }
+  assert(locations[0].offset_bytes < locations[1].offset_bytes);
+  assert(locations[1].offset_bytes < locations[2].offset_bytes);
+  assert(locations[1].stored_size_bytes < terrain.size());
+  assert(locations[2].stored_size_bytes == 8u);
+  content::ContentLocation missing;
+  assert(runtime.Locate("world/missing.bin", &missing) ==
+         ENGINE_NATIVE_STATUS_NOT_FOUND);
+  assert(runtime.Locate("world/sky.bin", nullptr) ==
+         ENGINE_NATIVE_STATUS_INVALID_ARGUMENT);
+
+  engine_native_engine_t* engine = nullptr;
+  const engine_native_create_desc_t create_desc{
+      .api_version = ENGINE_NATIVE_API_VERSION,
+      .user_data = nullptr,
+  };
+  assert(engine_create(&create_desc, &engine) == ENGINE_NATIVE_STATUS_OK);
+  assert(content_mount_pak(engine, pak_path.string().c_str()) ==
+         ENGINE_NATIVE_STATUS_OK);
+  assert(content_stream_set_frame_budget(engine, 0u) == ENGINE_NATIVE_STATUS_OK);
+
+  std::array<uint64_t, 3> request_ids{};
+  for (size_t i = 0u; i < assets.size(); ++i) {
+    assert(content_stream_request(engine, assets[i].path.c_str(),
+                                  static_cast<float>(assets.size() - i), nullptr,
+                                  0u, &request_ids[i]) == ENGINE_NATIVE_STATUS_OK);
+  }
+  assert(content_stream_update(engine) == ENGINE_NATIVE_STATUS_OK);
+
+  engine_native_content_stream_stats_t stats{};
+  assert(content_stream_get_stats(engine, &stats) == ENGINE_NATIVE_STATUS_OK);
+  assert(stats.last_frame_issued_count == 3u);
+  assert(stats.issued_bytes == locations[0].stored_size_bytes +
+                                   locations[1].stored_size_bytes +
+                                   locations[2].stored_size_bytes);
+
+  const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+  for (size_t i = 0u; i < assets.size(); ++i) {
+    engine_native_content_read_result_t result{};
+    uint8_t is_ready = 0u;
+    while (is_ready == 0u) {
+      assert(std::chrono::steady_clock::now() < deadline);
+      assert(content_stream_poll(engine, request_ids[i], &result, &is_ready) ==
+             ENGINE_NATIVE_STATUS_OK);
+      std::this_thread::yield();
+    }
+    assert(result.status == ENGINE_NATIVE_STATUS_OK);
+    assert(result.size == assets[i].payload.size());
+    assert(std::memcmp(result.data, assets[i].payload.data(), result.size) == 0);
+    assert(content_free_read_result(engine, &result) == ENGINE_NATIVE_STATUS_OK);
+  }
+
+  assert(content_stream_get_stats(engine, &stats) == ENGINE_NATIVE_STATUS_OK);
+  assert(stats.completed_count == 3u);
+  assert(stats.completed_bytes == terrain.size() + 5u + 8u);
+  assert(stats.pending_count == 0u && stats.issued_count == 0u);
+  assert(content_stream_request(engine, "world/missing.bin", 1.0f, nullptr, 0u,
+                                &request_ids[0]) == ENGINE_NATIVE_STATUS_NOT_FOUND);
+  assert(content_stream_set_priority(nullptr, 1u, 1.0f) ==
+         ENGINE_NATIVE_STATUS_INVALID_ARGUMENT);
+  assert(content_stream_update(nullptr) == ENGINE_NATIVE_STATUS_INVALID_ARGUMENT);
+  assert(engine_destroy(engine) == ENGINE_NATIVE_STATUS_OK);
+}
+
+void TestCacheServesRepeatedReadsAndSharedAcquires() {
+  ScopedTempDirectory temp("content_cache");
+  std::string material;
+  for (size_t i = 0u; i < 20000u; ++i) {
+    material.push_back(static_cast<char>('a' + (i / 128u) % 26u));
+  }
+  PakAsset material_asset = RawAsset("materials/shared.mat", material);
+  material_asset.chunk_size = 8192u;
+  const std::filesystem::path pak_path = temp.path / "materials.pak";
+  WritePak(pak_path, {material_asset, RawAsset("materials/stored.mat", "stored")});
+  WriteLooseFile(temp.path / "base" / "ui" / "atlas.bin", "atlas-v1");
+  WriteLooseFile(temp.path / "patch" / "ui" / "atlas.bin", "atlas-v2");
+
+  engine_native_engine_t* engine = nullptr;
+  const engine_native_create_desc_t create_desc{
+      .api_version = ENGINE_NATIVE_API_VERSION,
+      .user_data = nullptr,
+  };
+  assert(engine_create(&create_desc, &engine) == ENGINE_NATIVE_STATUS_OK);
+  assert(content_mount_pak(engine, pak_path.string().c_str()) ==
+         ENGINE_NATIVE_STATUS_OK);
+  assert(content_mount_directory(engine, (temp.path / "base").string().c_str()) ==
+         ENGINE_NATIVE_STATUS_OK);
+
+  engine_native_content_cache_stats_t stats{};
+  assert(ReadAsset(engine, "ui/atlas.bin") == "atlas-v1");
+  assert(content_get_cache_stats(engine, &stats) == ENGINE_NATIVE_STATUS_OK);
+  assert(stats.budget_bytes == 0u && stats.entry_count == 0u);
+  assert(stats.hit_count == 0u && stats.miss_count == 0u);
+
+  assert(content_set_cache_budget(engine, 1u << 20u) == ENGINE_NATIVE_STATUS_OK);
+  std::vector<char> buffer(material.size());
+  size_t out_size = 0u;
+  for (int i = 0; i < 3; ++i) {
+    assert(content_read_file(engine, "materials/shared.mat", buffer.data(),
+                             buffer.size(), &out_size) == ENGINE_NATIVE_STATUS_OK);
+    assert(std::memcmp(buffer.data(), material.data(), material.size()) == 0);
+    assert(ReadAsset(engine, "ui/atlas.bin") == "atlas-v1");
+    assert(ReadAsset(engine, "materials/stored.mat") == "stored");
+  }
+  assert(content_get_cache_stats(engine, &stats) == ENGINE_NATIVE_STATUS_OK);
+  assert(stats.entry_count == 2u);
+  assert(stats.insert_count == 2u);
+  assert(stats.hit_count == 4u);
+  assert(stats.resident_bytes == material.size() + 8u);
+
+  const void* first = nullptr;
+  const void* second = nullptr;
+  size_t first_size = 0u;
+  size_t second_size = 0u;
+  assert(content_acquire_file(engine, "ui/atlas.bin", &first, &first_size) ==
+         ENGINE_NATIVE_STATUS_OK);
+  assert(content_acquire_file(engine, "ui\\atlas.bin", &second, &second_size) ==
+         ENGINE_NATIVE_STATUS_OK);
+  assert(first == second && first_size == 8u);
+  assert(std::memcmp(first, "atlas-v1", 8u) == 0);
+
+  assert(content_mount_directory(engine, (temp.path / "patch").string().c_str()) ==
+         ENGINE_NATIVE_STATUS_OK);
+  assert(ReadAsset(engine, "ui/atlas.bin") == "atlas-v2");
+  const void* patched = nullptr;
+  assert(content_acquire_file(engine, "ui/atlas.bin", &patched, &out_size) ==
+         ENGINE_NATIVE_STATUS_OK);
+  assert(patched != first);
+  assert(std::memcmp(patched, "atlas-v2", 8u) == 0);
+  assert(std::memcmp(first, "atlas-v1", 8u) == 0);
+
+  assert(content_get_cache_stats(engine, &stats) == ENGINE_NATIVE_STATUS_OK);
+  assert(stats.pinned_entry_count == 2u);
+  assert(content_release_file(engine, first) == ENGINE_NATIVE_STATUS_OK);
+  assert(content_release_file(engine, second) == ENGINE_NATIVE_STATUS_OK);
+  assert(content_release_file(engine, patched) == ENGINE_NATIVE_STATUS_OK);
+  assert(content_release_file(engine, patched) == ENGINE_NATIVE_STATUS_NOT_FOUND);
+  assert(content_get_cache_stats(engine, &stats) == ENGINE_NATIVE_STATUS_OK);
+  assert(stats.pinned_entry_count == 0u && stats.pinned_bytes == 0u);
+
+  assert(content_acquire_file(engine, "ui/missing.bin", &first, &first_size) ==
+         ENGINE_NATIVE_STATUS_NOT_FOUND);
+  assert(first == nullptr && first_size == 0u);
+  assert(content_acquire_file(engine, "ui/atlas.bin", nullptr, &first_size) ==
+         ENGINE_NATIVE_STATUS_INVALID_ARGUMENT);
+  assert(content_get_cache_stats(engine, nullptr) ==
+         ENGINE_NATIVE_STATUS_INVALID_ARGUMENT);
+
+  assert(content_set_cache_budget(engine, 0u) == ENGINE_NATIVE_STATUS_OK);
+  assert(content_get_cache_stats(engine, &stats) == ENGINE_NATIVE_STATUS_OK);
+  assert(stats.entry_count == 0u && stats.resident_bytes == 0u);
+  assert(engine_destroy(engine) == ENGINE_NATIVE_STATUS_OK);
+}
+
+void TestRangeReadsCoverPakAndDirectoryMounts() {
+  ScopedTempDirectory temp("content_range");
+  std::string track;
+  for (size_t i = 0u; i < 20000u; ++i) {
+    track.push_back(static_cast<char>('a' + (i * 7u) % 13u + (i / 4096u)));
+  }
+  PakAsset track_asset = RawAsset("audio/track.ogg", track);
+  track_asset.chunk_size = 4096u;
+  const std::filesystem::path pak_path = temp.path / "audio.pak";
+  WritePak(pak_path, {track_asset, RawAsset("audio/stored.bin", track)});
+  WriteLooseFile(temp.path / "loose" / "level" / "chunk.bin", track);
+
+  engine_native_engine_t* engine = nullptr;
+  const engine_native_create_desc_t create_desc{
+      .api_version = ENGINE_NATIVE_API_VERSION,
+      .user_data = nullptr,
+  };
+  assert(engine_create(&create_desc, &engine) == ENGINE_NATIVE_STATUS_OK);
+  assert(content_mount_pak(engine, pak_path.string().c_str()) ==
+         ENGINE_NATIVE_STATUS_OK);
+  assert(content_mount_directory(engine, (temp.path / "loose").string().c_str()) ==
+         ENGINE_NATIVE_STATUS_OK);
+
+  const std::array<std::pair<uint64_t, size_t>, 5> ranges = {{
+      {0u, 100u},      // inside the first chunk
+      {4000u, 9000u},  // partial chunks on both sides of a whole one
+      {8192u, 4096u},  // exactly one chunk
+      {19990u, 64u},   // clamped at the end
+      {20000u, 16u},   // empty at the end
+  }};
+  for (const char* path : {"audio/track.ogg", "audio/stored.bin", "level/chunk.bin"}) {
+    for (const auto& [offset, length] : ranges) {
+      std::vector<char> buffer(length, '\0');
+      size_t out_size = 1u;
+      assert(content_read_file_range(engine, path, offset, buffer.data(), length,
+                                     &out_size) == ENGINE_NATIVE_STATUS_OK);
+      const size_t expected = std::min<size_t>(length, track.size() - offset);
+      assert(out_size == expected);
+      assert(std::memcmp(buffer.data(), track.data() + offset, expected) == 0);
+    }
+
+    char byte = 0;
+    size_t out_size = 0u;
+    assert(content_read_file_range(engine, path, track.size() + 1u, &byte, 1u,
+                                   &out_size) ==
+           ENGINE_NATIVE_STATUS_INVALID_ARGUMENT);
+    assert(content_read_file_range(engine, path, 0u, nullptr, 1u, &out_size) ==
+           ENGINE_NATIVE_STATUS_INVALID_ARGUMENT);
+  }
+
+  char byte = 0;
+  size_t out_size = 0u;
+  assert(content_read_file_range(engine, "audio/missing.ogg", 0u, &byte, 1u,
+                                 &out_size) == ENGINE_NATIVE_STATUS_NOT_FOUND);
+  assert(engine_destroy(engine) == ENGINE_NATIVE_STATUS_OK);
+}
+
+std::string ReadByKey(engine_native_engine_t* engine, const std::string& asset_key) {
+  const uint64_t key = content::HashAssetKey(asset_key);
+  size_t out_size = 0u;
+  const engine_native_status_t status =
+      content_read_by_key(engine, key, nullptr, 0u, &out_size);
+  if (status != ENGINE_NATIVE_STATUS_OK) {
+    return "status:" + std::to_string(static_cast<int>(status));
+  }
+
+  std::string bytes(out_size, '\0');
+  assert(content_read_by_key(engine, key, bytes.data(), bytes.size(), &out_size) ==
+         ENGINE_NATIVE_STATUS_OK);
+  assert(out_size == bytes.size());
+  return bytes;
+}
+
+void TestReadByKeyResolvesNewestPakEntry() {
+  ScopedTempDirectory temp("content_read_by_key");
+  std::string mesh;
+  for (size_t i = 0u; i < 10000u; ++i) {
+    mesh.push_back(static_cast<char>('a' + (i / 64u) % 26u));
+  }
+  PakAsset mesh_asset = RawAsset("meshes/rock.mesh", mesh);
+  mesh_asset.chunk_size = 4096u;
+  PakAsset unkeyed_asset = RawAsset("config/unkeyed.txt", "unkeyed");
+  unkeyed_asset.asset_key.clear();
+  const std::filesystem::path base_path = temp.path / "base.pak";
+  WritePak(base_path, {mesh_asset, RawAsset("config/game.txt", "game-v1"),
+                       unkeyed_asset});
+
+  PakAsset patched_asset = RawAsset("config/game.txt", "game-v2");
+  patched_asset.asset_key = "config/game.txt_key@2";
+  PakAsset moved_asset = RawAsset("meshes/rock_lod0.mesh", "moved-mesh");
+  moved_asset.asset_key = mesh_asset.asset_key;
+  const std::filesystem::path patch_path = temp.path / "patch.pak";
+  WritePak(patch_path, {patched_asset, moved_asset});
+
+  const std::filesystem::path legacy_path = temp.path / "legacy.pak";
+  WriteLegacyPak(legacy_path, {RawAsset("legacy/old.bin", "legacy-bytes")});
+  WriteLooseFile(temp.path / "loose" / "loose.txt", "loose");
+
+  engine_native_engine_t* engine = nullptr;
+  const engine_native_create_desc_t create_desc{
+      .api_version = ENGINE_NATIVE_API_VERSION,
+      .user_data = nullptr,
+  };
+  assert(engine_create(&create_desc, &engine) == ENGINE_NATIVE_STATUS_OK);
+  assert(content_mount_pak(engine, base_path.string().c_str()) ==
+         ENGINE_NATIVE_STATUS_OK);
+  assert(content_mount_pak(engine, legacy_path.string().c_str()) ==
+         ENGINE_NATIVE_STATUS_OK);
+  assert(content_mount_directory(engine, (temp.path / "loose").string().c_str()) ==
+         ENGINE_NATIVE_STATUS_OK);
+
+  assert(ReadByKey(engine, "meshes/rock.mesh_key") == mesh);
+  assert(ReadByKey(engine, "config/game.txt_key") == "game-v1");
+  assert(ReadByKey(engine, "legacy/old.bin_key") == "legacy-bytes");
+  assert(ReadByKey(engine, "loose.txt_key") ==
+         "status:" + std::to_string(ENGINE_NATIVE_STATUS_NOT_FOUND));
+
+  assert(content_mount_pak(engine, patch_path.string().c_str()) ==
+         ENGINE_NATIVE_STATUS_OK);
+  assert(ReadByKey(engine, "meshes/rock.mesh_key") == "moved-mesh");
+  size_t mesh_size = 0u;
+  assert(content_read_file(engine, "meshes/rock.mesh", nullptr, 0u, &mesh_size) ==
+         ENGINE_NATIVE_STATUS_OK);
+  assert(mesh_size == mesh.size());
+  assert(ReadAsset(engine, "config/game.txt") == "game-v2");
+  assert(ReadByKey(engine, "config/game.txt_key") == "game-v1");
+  assert(ReadByKey(engine, "config/game.txt_key@2") == "game-v2");
+
+  char byte = 0;
+  size_t out_size = 0u;
+  assert(content_read_by_key(engine, 0u, &byte, 1u, &out_size) ==
+         ENGINE_NATIVE_STATUS_INVALID_ARGUMENT);
+  assert(content_read_by_key(engine, content::HashAssetKey("meshes/rock.mesh_key"),
+                             nullptr, 1u, &out_size) ==
+         ENGINE_NATIVE_STATUS_INVALID_ARGUMENT);
+  assert(content_read_by_key(nullptr, 1u, &byte, 1u, &out_size) ==
+         ENGINE_NATIVE_STATUS_INVALID_ARGUMENT);
+  assert(content::HashAssetKey("") == 0u);
+
+  content::ContentRuntime runtime;
+  assert(runtime.MountPak(base_path.string()) == ENGINE_NATIVE_STATUS_OK);
+  assert(runtime.indexed_path_count() == 3u);
+  assert(runtime.indexed_key_count() == 2u);
+
+  assert(engine_destroy(engine) == ENGINE_NATIVE_STATUS_OK);
+}
+
+void TestOverlayPrecedenceAcrossMounts() {
+  ScopedTempDirectory temp("content_overlay");
+  const std::filesystem::path base_directory = temp.path / "base";
+  const std::filesystem::path patch_directory = temp.path / "patch";
+  WriteLooseFile(base_directory / "assets/shared.txt", "base-shared");
+  WriteLooseFile(base_directory / "assets/loose.txt", "base-loose");
+  WriteLooseFile(base_directory / "assets/only_base.txt", "base-only");
+  WriteLooseFile(patch_directory / "assets/shared.txt", "patch-shared");
+  WriteLooseFile(patch_directory / "assets/loose.txt", "patch-loose");
+
+  const std::filesystem::path game_pak = temp.path / "game.pak";
+  const std::filesystem::path dlc_pak = temp.path / "dlc.pak";
+  WritePak(game_pak, {RawAsset("assets/shared.txt", "game-shared"),
+                      RawAsset("assets/level.bin", "game-level"),
+                      RawAsset("assets/music.bin", "game-music")});
+  WriteLegacyPak(dlc_pak, {RawAsset("assets/level.bin", "dlc-level")});
+
+  engine_native_engine_t* engine = nullptr;
+  const engine_native_create_desc_t create_desc{
+      .api_version = ENGINE_NATIVE_API_VERSION,
+      .user_data = nullptr,
+  };
+  assert(engine_create(&create_desc, &engine) == ENGINE_NATIVE_STATUS_OK);
+
+  assert(content_mount_directory(engine, base_directory.string().c_str()) ==
+         ENGINE_NATIVE_STATUS_OK);
+  assert(ReadAsset(engine, "assets/shared.txt") == "base-shared");
+
+  assert(content_mount_pak(engine, game_pak.string().c_str()) ==
+         ENGINE_NATIVE_STATUS_OK);
+  assert(content_mount_pak(engine, dlc_pak.string().c_str()) ==
+         ENGINE_NATIVE_STATUS_OK);
+  assert(content_mount_directory(engine, patch_directory.string().c_str()) ==
+         ENGINE_NATIVE_STATUS_OK);
+
+  assert(ReadAsset(engine, "assets/shared.txt") == "game-shared");
+  assert(ReadAsset(engine, "assets/level.bin") == "dlc-level");
+  assert(ReadAsset(engine, "assets/music.bin") == "game-music");
+  assert(ReadAsset(engine, "assets/loose.txt") == "patch-loose");
+  assert(ReadAsset(engine, "assets/only_base.txt") == "base-only");
+
+  WriteLooseFile(base_directory / "assets/late.txt", "base-late");
+  assert(ReadAsset(engine, "assets/late.txt") == "base-late");
+  std::filesystem::remove(patch_directory / "assets/loose.txt");
+  assert(ReadAsset(engine, "assets/loose.txt") == "base-loose");
+
+  const void* data = nullptr;
+  size_t out_size = 0u;
+  assert(content_map_file(engine, "assets/level.bin", &data, &out_size) ==
+         ENGINE_NATIVE_STATUS_OK);
+  assert(std::string(static_cast<const char*>(data), out_size) == "dlc-level");
+  assert(content_map_file(engine, "assets/only_base.txt", &data, &out_size) ==
+         ENGINE_NATIVE_STATUS_INVALID_STATE);
+  assert(content_map_file(engine, "assets/late.txt", &data, &out_size) ==
+         ENGINE_NATIVE_STATUS_INVALID_STATE);
+  assert(content_map_file(engine, "assets/none.txt", &data, &out_size) ==
+         ENGINE_NATIVE_STATUS_NOT_FOUND);
+
+  assert(engine_destroy(engine) == ENGINE_NATIVE_STATUS_OK);
+}
+
 void TestMountDirectoryAndValidation() {
   ScopedTempDirectory temp("content_directory");
   const std::filesystem::path source_root = temp.path / "dev";
@@ -231,6 +1249,18 @@ void TestMountDirectoryAndValidation() {
 
 void RunContentRuntimeTests() {
   TestMountPakAndReadFile();
+  TestMapFileReturnsPakBytesWithoutCopy();
+  TestMountValidatesTruncatedPak();
+  TestHashedTocResolvesEveryEntry();
+  TestMountLegacyPakVersion();
+  TestCompressedPakEntriesDecodeIntoCallerBuffer();
+  TestCompressedChunksDecodeIndependently();
+  TestAsyncReadsCompleteThroughPolling();
+  TestStreamingRequestsLocatePakOffsets();
+  TestCacheServesRepeatedReadsAndSharedAcquires();
+  TestRangeReadsCoverPakAndDirectoryMounts();
+  TestReadByKeyResolvesNewestPakEntry();
+  TestOverlayPrecedenceAcrossMounts();
   TestMountDirectoryAndValidation();
 }
 
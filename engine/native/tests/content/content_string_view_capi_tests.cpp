@@ -91,6 +91,11 @@ void TestPointerStringViewContentApis() {
   assert(out_size == payload.size());
   assert(std::memcmp(buffer.data(), payload.data(), payload.size()) == 0);
 
+  const void* mapped_data = nullptr;
+  assert(content_map_file_view(engine, asset_view, &mapped_data, &out_size) ==
+         ENGINE_NATIVE_STATUS_INVALID_STATE);
+  assert(mapped_data == nullptr);
+
   const char asset_with_embedded_null[]{
       'a', 's', 's', 'e', 't', 's', '/', 'r', 'a',
       'w', '.', 'b', 'i', 'n', '\0', 'x'};
@@ -149,6 +154,13 @@ void TestHandleStringViewContentApis() {
   assert(out_size == payload.size());
   assert(std::memcmp(buffer.data(), payload.data(), payload.size()) == 0);
 
+  const void* mapped_data = nullptr;
+  assert(content_map_file_view_handle(engine, asset_view, &mapped_data,
+                                      &out_size) ==
+         ENGINE_NATIVE_STATUS_INVALID_STATE);
+  assert(content_map_file_handle(engine, "assets/missing.bin", &mapped_data,
+                                 &out_size) == ENGINE_NATIVE_STATUS_NOT_FOUND);
+
   const engine_native_string_view_t invalid_view{
       .data = nullptr,
       .length = 2u,
@@ -156,8 +168,115 @@ void TestHandleStringViewContentApis() {
   assert(content_mount_pak_view_handle(engine, invalid_view) ==
          ENGINE_NATIVE_STATUS_INVALID_ARGUMENT);
 
+  uint64_t request_id = 0u;
+  assert(content_read_file_async_view_handle(engine, asset_view, nullptr, 0u,
+                                             &request_id) == ENGINE_NATIVE_STATUS_OK);
+  engine_native_content_read_result_t result{};
+  uint8_t is_ready = 0u;
+  const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+  while (is_ready == 0u) {
+    assert(std::chrono::steady_clock::now() < deadline);
+    assert(content_poll_read_handle(engine, request_id, &result, &is_ready) ==
+           ENGINE_NATIVE_STATUS_OK);
+  }
+  assert(result.status == ENGINE_NATIVE_STATUS_OK);
+  assert(result.size == payload.size());
+  assert(std::memcmp(result.data, payload.data(), payload.size()) == 0);
+  assert(content_free_read_result_handle(engine, &result) == ENGINE_NATIVE_STATUS_OK);
+
+  assert(content_read_file_async_handle(engine, "assets/raw.bin", buffer.data(),
+                                        buffer.size(), &request_id) ==
+         ENGINE_NATIVE_STATUS_OK);
+  assert(content_cancel_read_handle(engine, request_id) == ENGINE_NATIVE_STATUS_OK);
+  assert(content_read_file_async_view_handle(engine, invalid_view, nullptr, 0u,
+                                             &request_id) ==
+         ENGINE_NATIVE_STATUS_INVALID_ARGUMENT);
+
+  engine_native_content_read_stats_t stats{};
+  assert(content_get_read_stats_handle(engine, &stats) == ENGINE_NATIVE_STATUS_OK);
+  assert(stats.submitted_count == 2u);
+  assert(stats.cancelled_count == 1u);
+
+  assert(content_stream_set_frame_budget_handle(engine, 1u) ==
+         ENGINE_NATIVE_STATUS_OK);
+  assert(content_stream_request_view_handle(engine, asset_view, 2.0f, nullptr,
+                                            0u, &request_id) ==
+         ENGINE_NATIVE_STATUS_OK);
+  uint64_t cancelled_id = 0u;
+  assert(content_stream_request_handle(engine, "assets/raw.bin", 1.0f, nullptr,
+                                       0u, &cancelled_id) ==
+         ENGINE_NATIVE_STATUS_OK);
+  assert(content_stream_set_priority_handle(engine, request_id, 0.0f) ==
+         ENGINE_NATIVE_STATUS_OK);
+  assert(content_stream_cancel_handle(engine, cancelled_id) ==
+         ENGINE_NATIVE_STATUS_OK);
+  assert(content_stream_update_handle(engine) == ENGINE_NATIVE_STATUS_OK);
+  is_ready = 0u;
+  while (is_ready == 0u) {
+    assert(std::chrono::steady_clock::now() < deadline);
+    assert(content_stream_poll_handle(engine, request_id, &result, &is_ready) ==
+           ENGINE_NATIVE_STATUS_OK);
+  }
+  assert(result.status == ENGINE_NATIVE_STATUS_OK);
+  assert(std::memcmp(result.data, payload.data(), payload.size()) == 0);
+  assert(content_free_read_result_handle(engine, &result) == ENGINE_NATIVE_STATUS_OK);
+  assert(content_stream_request_view_handle(engine, invalid_view, 1.0f, nullptr,
+                                            0u, &request_id) ==
+         ENGINE_NATIVE_STATUS_INVALID_ARGUMENT);
+
+  engine_native_content_stream_stats_t stream_stats{};
+  assert(content_stream_get_stats_handle(engine, &stream_stats) ==
+         ENGINE_NATIVE_STATUS_OK);
+  assert(stream_stats.completed_count == 1u);
+  assert(stream_stats.cancelled_count == 1u);
+  assert(stream_stats.reprioritized_count == 1u);
+  assert(stream_stats.frame_budget_bytes == 1u);
+
+  char range[4] = {};
+  assert(content_read_file_range_view_handle(engine, asset_view, 1u, range,
+                                             sizeof(range), &out_size) ==
+         ENGINE_NATIVE_STATUS_OK);
+  assert(out_size == payload.size() - 1u);
+  assert(std::memcmp(range, payload.data() + 1u, out_size) == 0);
+  assert(content_read_file_range_handle(engine, "assets/raw.bin", 0u, range,
+                                        sizeof(range), &out_size) ==
+         ENGINE_NATIVE_STATUS_OK);
+  assert(content_read_file_range_view_handle(engine, invalid_view, 0u, range,
+                                             sizeof(range), &out_size) ==
+         ENGINE_NATIVE_STATUS_INVALID_ARGUMENT);
+
+  assert(content_read_by_key_handle(engine, 0u, range, sizeof(range), &out_size) ==
+         ENGINE_NATIVE_STATUS_INVALID_ARGUMENT);
+  assert(content_read_by_key_handle(engine, 1u, range, sizeof(range), &out_size) ==
+         ENGINE_NATIVE_STATUS_NOT_FOUND);
+
+  assert(content_set_cache_budget_handle(engine, 4096u) == ENGINE_NATIVE_STATUS_OK);
+  const void* shared_data = nullptr;
+  assert(content_acquire_file_view_handle(engine, asset_view, &shared_data,
+                                          &out_size) == ENGINE_NATIVE_STATUS_OK);
+  const void* second_data = nullptr;
+  assert(content_acquire_file_handle(engine, "assets/raw.bin", &second_data,
+                                     &out_size) == ENGINE_NATIVE_STATUS_OK);
+  assert(shared_data == second_data && out_size == payload.size());
+  assert(content_acquire_file_view_handle(engine, invalid_view, &shared_data,
+                                          &out_size) ==
+         ENGINE_NATIVE_STATUS_INVALID_ARGUMENT);
+  assert(content_release_file_handle(engine, second_data) == ENGINE_NATIVE_STATUS_OK);
+  assert(content_release_file_handle(engine, second_data) == ENGINE_NATIVE_STATUS_OK);
+
+  engine_native_content_cache_stats_t cache_stats{};
+  assert(content_get_cache_stats_handle(engine, &cache_stats) ==
+         ENGINE_NATIVE_STATUS_OK);
+  assert(cache_stats.budget_bytes == 4096u);
+  assert(cache_stats.hit_count == 1u);
+  assert(cache_stats.pinned_entry_count == 0u);
+
   assert(engine_destroy_handle(engine) == ENGINE_NATIVE_STATUS_OK);
 
+  assert(content_get_read_stats_handle(engine, &stats) ==
+         ENGINE_NATIVE_STATUS_NOT_FOUND);
+  assert(content_stream_update_handle(engine) == ENGINE_NATIVE_STATUS_NOT_FOUND);
+
   assert(content_mount_directory_view_handle(engine, mount_view) ==
          ENGINE_NATIVE_STATUS_NOT_FOUND);
 }
@@ -0,0 +1,105 @@
+#include "content/lz4_block_tests.h"
+
+#include <assert.h>
+
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+#include "content/lz4_block.h"
+
+namespace dff::native::tests {
+namespace {
+
+using dff::native::content::Lz4CompressBlock;
+using dff::native::content::Lz4CompressBound;
+using dff::native::content::Lz4DecompressBlock;
+
+std::vector<uint8_t> Compress(const std::vector<uint8_t>& input) {
+  std::vector<uint8_t> output(Lz4CompressBound(input.size()));
+  const size_t size =
+      Lz4CompressBlock(input.data(), input.size(), output.data(), output.size());
+  assert(size != 0u);
+  output.resize(size);
+  return output;
+}
+
+void AssertRoundTrip(const std::vector<uint8_t>& input) {
+  const std::vector<uint8_t> compressed = Compress(input);
+  std::vector<uint8_t> output(input.size());
+  assert(Lz4DecompressBlock(compressed.data(), compressed.size(), output.data(),
+                            output.size()));
+  assert(output == input);
+}
+
+void TestRoundTripsAcrossInputShapes() {
+  AssertRoundTrip({});
+  AssertRoundTrip({1u, 2u, 3u});
+  AssertRoundTrip(std::vector<uint8_t>(100000u, 0x42u));
+
+  std::vector<uint8_t> noise(70000u);
+  uint32_t state = 11u;
+  for (uint8_t& value : noise) {
+    state = state * 1664525u + 1013904223u;
+    value = static_cast<uint8_t>(state >> 24u);
+  }
+  AssertRoundTrip(noise);
+
+  for (uint32_t period = 1u; period <= 20u; ++period) {
+    std::vector<uint8_t> repeating(5000u + period);
+    for (size_t i = 0u; i < repeating.size(); ++i) {
+      repeating[i] = static_cast<uint8_t>(i % period);
+    }
+    AssertRoundTrip(repeating);
+  }
+
+  std::vector<uint8_t> mixed;
+  for (uint32_t block = 0u; block < 64u; ++block) {
+    mixed.insert(mixed.end(), noise.begin() + block * 300u,
+                 noise.begin() + block * 300u + 17u + block * 5u);
+    mixed.insert(mixed.end(), 40u + block * 9u, static_cast<uint8_t>(block));
+  }
+  AssertRoundTrip(mixed);
+
+  const std::vector<uint8_t> compressed = Compress(std::vector<uint8_t>(4096u, 7u));
+  assert(compressed.size() < 64u);
+}
+
+void TestRejectsMalformedBlocks() {
+  std::vector<uint8_t> input(4096u);
+  for (size_t i = 0u; i < input.size(); ++i) {
+    input[i] = static_cast<uint8_t>((i * 7u) % 13u);
+  }
+  const std::vector<uint8_t> compressed = Compress(input);
+  std::vector<uint8_t> output(input.size());
+
+  for (size_t size = 0u; size < compressed.size(); ++size) {
+    assert(!Lz4DecompressBlock(compressed.data(), size, output.data(),
+                               output.size()));
+  }
+  assert(!Lz4DecompressBlock(compressed.data(), compressed.size(), output.data(),
+                             output.size() - 1u));
+  assert(Lz4DecompressBlock(compressed.data(), compressed.size(), output.data(),
+                            output.size()));
+
+  const uint8_t zero_offset[] = {0x10u, 'a', 0x00u, 0x00u, 0x50u, 1, 2, 3, 4, 5};
+  assert(!Lz4DecompressBlock(zero_offset, sizeof(zero_offset), output.data(), 32u));
+  const uint8_t far_offset[] = {0x10u, 'a', 0x02u, 0x00u, 0x50u, 1, 2, 3, 4, 5};
+  assert(!Lz4DecompressBlock(far_offset, sizeof(far_offset), output.data(), 10u));
+  const uint8_t unterminated_length[] = {0xF0u, 0xFFu, 0xFFu};
+  assert(!Lz4DecompressBlock(unterminated_length, sizeof(unterminated_length),
+                             output.data(), output.size()));
+
+  std::vector<uint8_t> small(8u);
+  assert(Lz4CompressBlock(input.data(), input.size(), small.data(), small.size()) ==
+         0u);
+}
+
+}  // namespace
+
+void RunLz4BlockTests() {
+  TestRoundTripsAcrossInputShapes();
+  TestRejectsMalformedBlocks();
+}
+
+}  // namespace dff::native::tests
@@ -0,0 +1,10 @@
+#ifndef DFF_ENGINE_NATIVE_LZ4_BLOCK_TESTS_H
+#define DFF_ENGINE_NATIVE_LZ4_BLOCK_TESTS_H
+
+namespace dff::native::tests {
+
+void RunLz4BlockTests();
+
+}  // namespace dff::native::tests
+
+#endif
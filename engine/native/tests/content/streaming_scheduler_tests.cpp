@@ -0,0 +1,313 @@
+#include "content/streaming_scheduler_tests.h"
+
+#include <assert.h>
+
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "content/content_read_queue.h"
+#include "content/content_runtime.h"
+#include "content/streaming_scheduler.h"
+#include "engine_native.h"
+
+namespace dff::native::tests {
+namespace {
+
+using dff::native::content::ContentReadQueue;
+using dff::native::content::ContentRuntime;
+using dff::native::content::StreamingScheduler;
+
+struct ScopedTempDirectory {
+  explicit ScopedTempDirectory(const std::string& test_name) {
+    const auto suffix = std::to_string(
+        std::chrono::steady_clock::now().time_since_epoch().count());
+    path = std::filesystem::temp_directory_path() /
+           ("dff_native_" + test_name + "_" + suffix);
+    std::filesystem::create_directories(path);
+  }
+
+  ~ScopedTempDirectory() { std::filesystem::remove_all(path); }
+
+  std::filesystem::path path;
+};
+
+void WriteLooseFile(const std::filesystem::path& path, const std::string& payload) {
+  std::filesystem::create_directories(path.parent_path());
+  std::ofstream file(path, std::ios::binary | std::ios::trunc);
+  assert(file.is_open());
+  file.write(payload.data(), static_cast<std::streamsize>(payload.size()));
+}
+
+engine_native_content_read_result_t WaitForStream(StreamingScheduler* scheduler,
+                                                  uint64_t request_id) {
+  const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+  engine_native_content_read_result_t result{};
+  uint8_t is_ready = 0u;
+  while (true) {
+    assert(scheduler->Poll(request_id, &result, &is_ready) ==
+           ENGINE_NATIVE_STATUS_OK);
+    if (is_ready != 0u) {
+      return result;
+    }
+    assert(std::chrono::steady_clock::now() < deadline);
+    std::this_thread::yield();
+  }
+}
+
+engine_native_content_stream_stats_t StreamStats(
+    const StreamingScheduler& scheduler) {
+  engine_native_content_stream_stats_t stats{};
+  assert(scheduler.GetStats(&stats) == ENGINE_NATIVE_STATUS_OK);
+  return stats;
+}
+
+void TestFrameBudgetIssuesByPriority() {
+  ScopedTempDirectory temp("streaming_scheduler_budget");
+  const std::string payload(1000u, 'b');
+  for (int i = 0; i < 5; ++i) {
+    WriteLooseFile(temp.path / "chunks" / ("chunk_" + std::to_string(i) + ".bin"),
+                   payload);
+  }
+
+  ContentRuntime runtime;
+  assert(runtime.MountDirectory(temp.path.string()) == ENGINE_NATIVE_STATUS_OK);
+  ContentReadQueue reads(runtime, 1u);
+  StreamingScheduler scheduler(runtime, reads);
+  assert(StreamStats(scheduler).frame_budget_bytes ==
+         StreamingScheduler::kDefaultFrameBudgetBytes);
+  assert(scheduler.SetFrameBudget(2500u) == ENGINE_NATIVE_STATUS_OK);
+
+  std::array<uint64_t, 5> request_ids{};
+  const std::array<float, 5> priorities{40.0f, 10.0f, 30.0f, 0.5f, 20.0f};
+  for (size_t i = 0u; i < request_ids.size(); ++i) {
+    assert(scheduler.Request("chunks/chunk_" + std::to_string(i) + ".bin",
+                             priorities[i], nullptr, 0u, &request_ids[i]) ==
+           ENGINE_NATIVE_STATUS_OK);
+  }
+
+  engine_native_content_stream_stats_t stats = StreamStats(scheduler);
+  assert(stats.pending_count == 5u);
+  assert(stats.pending_bytes == 5u * payload.size());
+  assert(stats.issued_count == 0u);
+  assert(reads.started_worker_count() == 0u);
+
+  engine_native_content_read_result_t result{};
+  uint8_t is_ready = 1u;
+  assert(scheduler.Poll(request_ids[3], &result, &is_ready) ==
+         ENGINE_NATIVE_STATUS_OK);
+  assert(is_ready == 0u);
+
+  assert(scheduler.Update() == ENGINE_NATIVE_STATUS_OK);
+  stats = StreamStats(scheduler);
+  assert(stats.last_frame_issued_count == 2u);
+  assert(stats.last_frame_issued_bytes == 2u * payload.size());
+  assert(stats.pending_count == 3u);
+  assert(stats.issued_count == 2u);
+  assert(stats.frame_count == 1u);
+
+  for (const size_t index : {3u, 1u}) {
+    result = WaitForStream(&scheduler, request_ids[index]);
+    assert(result.status == ENGINE_NATIVE_STATUS_OK);
+    assert(result.size == payload.size());
+    assert(reads.FreeResult(&result) == ENGINE_NATIVE_STATUS_OK);
+  }
+  assert(scheduler.Poll(request_ids[4], &result, &is_ready) ==
+         ENGINE_NATIVE_STATUS_OK);
+  assert(is_ready == 0u);
+
+  assert(scheduler.SetFrameBudget(1u) == ENGINE_NATIVE_STATUS_OK);
+  assert(scheduler.Update() == ENGINE_NATIVE_STATUS_OK);
+  stats = StreamStats(scheduler);
+  assert(stats.last_frame_issued_count == 1u);
+  result = WaitForStream(&scheduler, request_ids[4]);
+  assert(reads.FreeResult(&result) == ENGINE_NATIVE_STATUS_OK);
+
+  assert(scheduler.SetFrameBudget(0u) == ENGINE_NATIVE_STATUS_OK);
+  assert(scheduler.Update() == ENGINE_NATIVE_STATUS_OK);
+  stats = StreamStats(scheduler);
+  assert(stats.last_frame_issued_count == 2u);
+  assert(stats.pending_count == 0u);
+  assert(stats.pending_bytes == 0u);
+  for (const size_t index : {0u, 2u}) {
+    result = WaitForStream(&scheduler, request_ids[index]);
+    assert(reads.FreeResult(&result) == ENGINE_NATIVE_STATUS_OK);
+  }
+
+  stats = StreamStats(scheduler);
+  assert(stats.completed_count == 5u);
+  assert(stats.completed_bytes == 5u * payload.size());
+  assert(stats.issued_bytes == 5u * payload.size());
+  assert(stats.issued_count == 0u);
+  assert(scheduler.Poll(request_ids[0], &result, &is_ready) ==
+         ENGINE_NATIVE_STATUS_NOT_FOUND);
+}
+
+void TestBatchIssuesInStorageOrder() {
+  ScopedTempDirectory temp("streaming_scheduler_order");
+  constexpr size_t kMountCount = 3u;
+  for (size_t i = 0u; i < kMountCount; ++i) {
+    WriteLooseFile(temp.path / ("mount_" + std::to_string(i)) / "assets" /
+                       ("only_" + std::to_string(i) + ".bin"),
+                   std::string(256u * 1024u, static_cast<char>('a' + i)));
+  }
+
+  ContentRuntime runtime;
+  for (size_t i = 0u; i < kMountCount; ++i) {
+    assert(runtime.MountDirectory(
+               (temp.path / ("mount_" + std::to_string(i))).string()) ==
+           ENGINE_NATIVE_STATUS_OK);
+  }
+  ContentReadQueue reads(runtime, 1u);
+  StreamingScheduler scheduler(runtime, reads);
+
+  // Priority alone would read the last mount first; the batch goes in mount
+  // order, so with one worker the last mount completes after the others.
+  std::array<uint64_t, kMountCount> request_ids{};
+  for (size_t i = 0u; i < kMountCount; ++i) {
+    assert(scheduler.Request("assets/only_" + std::to_string(i) + ".bin",
+                             static_cast<float>(kMountCount - i), nullptr, 0u,
+                             &request_ids[i]) == ENGINE_NATIVE_STATUS_OK);
+  }
+  assert(scheduler.Update() == ENGINE_NATIVE_STATUS_OK);
+
+  engine_native_content_read_result_t last =
+      WaitForStream(&scheduler, request_ids[kMountCount - 1u]);
+  assert(last.status == ENGINE_NATIVE_STATUS_OK);
+  assert(last.data[0] == static_cast<uint8_t>('a' + kMountCount - 1u));
+  assert(reads.FreeResult(&last) == ENGINE_NATIVE_STATUS_OK);
+
+  for (size_t i = 0u; i + 1u < kMountCount; ++i) {
+    engine_native_content_read_result_t result{};
+    uint8_t is_ready = 0u;
+    assert(scheduler.Poll(request_ids[i], &result, &is_ready) ==
+           ENGINE_NATIVE_STATUS_OK);
+    assert(is_ready == 1u);
+    assert(result.data[0] == static_cast<uint8_t>('a' + i));
+    assert(reads.FreeResult(&result) == ENGINE_NATIVE_STATUS_OK);
+  }
+}
+
+void TestReprioritizeAndCancel() {
+  ScopedTempDirectory temp("streaming_scheduler_reprioritize");
+  const std::string payload(512u, 'r');
+  WriteLooseFile(temp.path / "far.bin", payload);
+  WriteLooseFile(temp.path / "near.bin", payload);
+  WriteLooseFile(temp.path / "dropped.bin", payload);
+
+  ContentRuntime runtime;
+  assert(runtime.MountDirectory(temp.path.string()) == ENGINE_NATIVE_STATUS_OK);
+  ContentReadQueue reads(runtime, 1u);
+  StreamingScheduler scheduler(runtime, reads);
+  assert(scheduler.SetFrameBudget(payload.size()) == ENGINE_NATIVE_STATUS_OK);
+
+  uint64_t far_id = 0u;
+  uint64_t near_id = 0u;
+  uint64_t dropped_id = 0u;
+  std::vector<char> far_buffer(payload.size());
+  assert(scheduler.Request("far.bin", 100.0f, far_buffer.data(),
+                           far_buffer.size(), &far_id) == ENGINE_NATIVE_STATUS_OK);
+  assert(scheduler.Request("near.bin", 5.0f, nullptr, 0u, &near_id) ==
+         ENGINE_NATIVE_STATUS_OK);
+  assert(scheduler.Request("dropped.bin", 1.0f, nullptr, 0u, &dropped_id) ==
+         ENGINE_NATIVE_STATUS_OK);
+
+  assert(scheduler.Cancel(dropped_id) == ENGINE_NATIVE_STATUS_OK);
+  assert(scheduler.Cancel(dropped_id) == ENGINE_NATIVE_STATUS_NOT_FOUND);
+  assert(scheduler.SetPriority(far_id, 1.0f) == ENGINE_NATIVE_STATUS_OK);
+  assert(scheduler.SetPriority(far_id, 1.0f) == ENGINE_NATIVE_STATUS_OK);
+  assert(StreamStats(scheduler).reprioritized_count == 1u);
+
+  assert(scheduler.Update() == ENGINE_NATIVE_STATUS_OK);
+  engine_native_content_read_result_t result = WaitForStream(&scheduler, far_id);
+  assert(result.status == ENGINE_NATIVE_STATUS_OK);
+  assert(result.data == reinterpret_cast<const uint8_t*>(far_buffer.data()));
+
+  engine_native_content_stream_stats_t stats = StreamStats(scheduler);
+  assert(stats.pending_count == 1u);
+  assert(stats.pending_bytes == payload.size());
+  assert(stats.cancelled_count == 1u);
+
+  assert(scheduler.Update() == ENGINE_NATIVE_STATUS_OK);
+  assert(scheduler.SetPriority(near_id, 50.0f) == ENGINE_NATIVE_STATUS_OK);
+  assert(StreamStats(scheduler).reprioritized_count == 1u);
+  assert(scheduler.Cancel(near_id) == ENGINE_NATIVE_STATUS_OK);
+  uint8_t is_ready = 0u;
+  assert(scheduler.Poll(near_id, &result, &is_ready) ==
+         ENGINE_NATIVE_STATUS_NOT_FOUND);
+
+  engine_native_content_read_stats_t read_stats{};
+  assert(reads.GetStats(&read_stats) == ENGINE_NATIVE_STATUS_OK);
+  assert(read_stats.cancelled_count == 1u);
+  assert(read_stats.queued_count == 0u);
+  assert(read_stats.in_flight_count == 0u);
+  stats = StreamStats(scheduler);
+  assert(stats.cancelled_count == 2u);
+  assert(stats.issued_count == 0u);
+}
+
+void TestThroughputAndValidation() {
+  ScopedTempDirectory temp("streaming_scheduler_throughput");
+  const std::string payload(64u * 1024u, 't');
+  WriteLooseFile(temp.path / "stream.bin", payload);
+
+  ContentRuntime runtime;
+  assert(runtime.MountDirectory(temp.path.string()) == ENGINE_NATIVE_STATUS_OK);
+  ContentReadQueue reads(runtime, 1u);
+  StreamingScheduler scheduler(runtime, reads);
+
+  uint64_t request_id = 7u;
+  assert(scheduler.Request("missing.bin", 1.0f, nullptr, 0u, &request_id) ==
+         ENGINE_NATIVE_STATUS_NOT_FOUND);
+  assert(request_id == 0u);
+  assert(scheduler.Request("stream.bin", std::nanf(""), nullptr, 0u,
+                           &request_id) == ENGINE_NATIVE_STATUS_INVALID_ARGUMENT);
+  assert(scheduler.Request("stream.bin", 1.0f, nullptr, 4u, &request_id) ==
+         ENGINE_NATIVE_STATUS_INVALID_ARGUMENT);
+  assert(scheduler.Request("../stream.bin", 1.0f, nullptr, 0u, &request_id) ==
+         ENGINE_NATIVE_STATUS_INVALID_ARGUMENT);
+  assert(scheduler.Request("stream.bin", 1.0f, nullptr, 0u, nullptr) ==
+         ENGINE_NATIVE_STATUS_INVALID_ARGUMENT);
+  assert(scheduler.SetPriority(0u, 1.0f) == ENGINE_NATIVE_STATUS_INVALID_ARGUMENT);
+  assert(scheduler.SetPriority(99u, 1.0f) == ENGINE_NATIVE_STATUS_NOT_FOUND);
+  assert(scheduler.Cancel(99u) == ENGINE_NATIVE_STATUS_NOT_FOUND);
+  assert(scheduler.GetStats(nullptr) == ENGINE_NATIVE_STATUS_INVALID_ARGUMENT);
+
+  assert(scheduler.Update() == ENGINE_NATIVE_STATUS_OK);
+  for (int i = 0; i < 4; ++i) {
+    assert(scheduler.Request("stream.bin", 1.0f, nullptr, 0u, &request_id) ==
+           ENGINE_NATIVE_STATUS_OK);
+    assert(scheduler.Update() == ENGINE_NATIVE_STATUS_OK);
+    engine_native_content_read_result_t result =
+        WaitForStream(&scheduler, request_id);
+    assert(reads.FreeResult(&result) == ENGINE_NATIVE_STATUS_OK);
+  }
+
+  std::this_thread::sleep_for(std::chrono::nanoseconds(
+      StreamingScheduler::kThroughputWindowNs + 10000000u));
+  assert(scheduler.Update() == ENGINE_NATIVE_STATUS_OK);
+  const engine_native_content_stream_stats_t stats = StreamStats(scheduler);
+  assert(stats.throughput_bytes_per_second > 0u);
+  assert(stats.throughput_bytes_per_second <=
+         4u * payload.size() * 1000000000u /
+             StreamingScheduler::kThroughputWindowNs);
+  assert(stats.completed_bytes == 4u * payload.size());
+  assert(stats.frame_count == 6u);
+}
+
+}  // namespace
+
+void RunStreamingSchedulerTests() {
+  TestFrameBudgetIssuesByPriority();
+  TestBatchIssuesInStorageOrder();
+  TestReprioritizeAndCancel();
+  TestThroughputAndValidation();
+}
+
+}  // namespace dff::native::tests
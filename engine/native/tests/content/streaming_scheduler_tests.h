@@ -0,0 +1,10 @@
+#ifndef DFF_ENGINE_NATIVE_STREAMING_SCHEDULER_TESTS_H
+#define DFF_ENGINE_NATIVE_STREAMING_SCHEDULER_TESTS_H
+
+namespace dff::native::tests {
+
+void RunStreamingSchedulerTests();
+
+}  // namespace dff::native::tests
+
+#endif
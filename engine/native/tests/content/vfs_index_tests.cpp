@@ -0,0 +1,119 @@
+#include "content/vfs_index_tests.h"
+
+#include <assert.h>
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "content/pak_index.h"
+#include "content/vfs_index.h"
+
+namespace dff::native::tests {
+namespace {
+
+using dff::native::content::HashPakPath;
+using dff::native::content::PakAssetEntry;
+using dff::native::content::VfsEntry;
+using dff::native::content::VfsIndex;
+using dff::native::content::VfsSource;
+
+void Insert(VfsIndex* index,
+            std::string_view path,
+            VfsSource source,
+            uint32_t mount_index,
+            uint64_t offset_bytes = 0u) {
+  index->Insert(path, HashPakPath(path),
+                VfsEntry{source, mount_index,
+                         PakAssetEntry{offset_bytes, 1u}});
+}
+
+void TestFindsEveryPathAcrossGrowth() {
+  VfsIndex index;
+  assert(index.Find("assets/missing.bin") == nullptr);
+
+  std::vector<std::string> paths;
+  for (uint32_t i = 0u; i < 5000u; ++i) {
+    paths.push_back("assets/dir_" + std::to_string(i % 13u) + "/file_" +
+                    std::to_string(i) + ".bin");
+  }
+
+  for (size_t i = 0u; i < paths.size(); i += 500u) {
+    assert(index.Reserve(500u) == ENGINE_NATIVE_STATUS_OK);
+    for (size_t j = i; j < i + 500u; ++j) {
+      Insert(&index, paths[j], VfsSource::kPak, 0u, j);
+    }
+  }
+
+  assert(index.size() == paths.size());
+  for (size_t i = 0u; i < paths.size(); ++i) {
+    const VfsEntry* entry = index.Find(paths[i]);
+    assert(entry != nullptr);
+    assert(entry->pak_entry.offset_bytes == i);
+  }
+  assert(index.Find("assets/dir_0/file_5000.bin") == nullptr);
+  assert(index.Find("assets/dir_0/file_0.bi") == nullptr);
+}
+
+void TestOverlayPrecedence() {
+  VfsIndex index;
+  assert(index.Reserve(8u) == ENGINE_NATIVE_STATUS_OK);
+
+  Insert(&index, "a.bin", VfsSource::kDirectory, 0u);
+  Insert(&index, "a.bin", VfsSource::kDirectory, 1u);
+  assert(index.Find("a.bin")->mount_index == 1u);
+
+  Insert(&index, "a.bin", VfsSource::kPak, 0u);
+  assert(index.Find("a.bin")->source == VfsSource::kPak);
+
+  Insert(&index, "a.bin", VfsSource::kDirectory, 2u);
+  assert(index.Find("a.bin")->source == VfsSource::kPak);
+  assert(index.Find("a.bin")->mount_index == 0u);
+
+  Insert(&index, "a.bin", VfsSource::kPak, 3u);
+  assert(index.Find("a.bin")->mount_index == 3u);
+  assert(index.size() == 1u);
+}
+
+void TestKeysResolveToNewestPakEntry() {
+  VfsIndex index;
+  assert(index.FindKey(1u) == nullptr);
+
+  assert(index.Reserve(4u) == ENGINE_NATIVE_STATUS_OK);
+  Insert(&index, "a.bin", VfsSource::kPak, 0u);
+  assert(index.FindKey(1u) == nullptr);
+
+  for (uint64_t key = 1u; key <= 3000u; key += 1000u) {
+    assert(index.Reserve(1000u, 1000u) == ENGINE_NATIVE_STATUS_OK);
+    for (uint64_t i = key; i < key + 1000u; ++i) {
+      index.InsertKey(i * 0x9E3779B97F4A7C15ull,
+                      VfsEntry{VfsSource::kPak, 0u, PakAssetEntry{i, 1u}});
+    }
+  }
+
+  assert(index.key_count() == 3000u);
+  for (uint64_t i = 1u; i <= 3000u; ++i) {
+    const VfsEntry* entry = index.FindKey(i * 0x9E3779B97F4A7C15ull);
+    assert(entry != nullptr && entry->pak_entry.offset_bytes == i);
+  }
+
+  index.InsertKey(0x9E3779B97F4A7C15ull,
+                  VfsEntry{VfsSource::kPak, 7u, PakAssetEntry{42u, 1u}});
+  assert(index.key_count() == 3000u);
+  assert(index.FindKey(0x9E3779B97F4A7C15ull)->mount_index == 7u);
+
+  index.InsertKey(0u, VfsEntry{VfsSource::kPak, 8u, PakAssetEntry{}});
+  assert(index.FindKey(0u) == nullptr);
+  assert(index.key_count() == 3000u);
+}
+
+}  // namespace
+
+void RunVfsIndexTests() {
+  TestFindsEveryPathAcrossGrowth();
+  TestOverlayPrecedence();
+  TestKeysResolveToNewestPakEntry();
+}
+
+}  // namespace dff::native::tests
@@ -0,0 +1,10 @@
+#ifndef DFF_ENGINE_NATIVE_VFS_INDEX_TESTS_H
+#define DFF_ENGINE_NATIVE_VFS_INDEX_TESTS_H
+
+namespace dff::native::tests {
+
+void RunVfsIndexTests();
+
+}  // namespace dff::native::tests
+
+#endif
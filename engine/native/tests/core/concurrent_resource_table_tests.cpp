@@ -0,0 +1,153 @@
+#include "core/concurrent_resource_table_tests.h"
+
+#include <assert.h>
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "core/concurrent_resource_table.h"
+
+namespace dff::native::tests {
+namespace {
+
+using dff::native::ConcurrentResourceTable;
+using dff::native::ResourceHandle;
+
+void TestRemoveDefersDestructionUntilReclaim() {
+  auto counter = std::make_shared<int>(0);
+  ConcurrentResourceTable<std::shared_ptr<int>> table;
+
+  ResourceHandle first{};
+  assert(table.Insert(counter, &first) == ENGINE_NATIVE_STATUS_OK);
+  const std::shared_ptr<int>* reader_view = table.Get(first);
+  assert(reader_view != nullptr);
+  assert(counter.use_count() == 2);
+
+  assert(table.Remove(first));
+  assert(!table.Remove(first));
+  assert(table.Get(first) == nullptr);
+  assert(table.Size() == 0u);
+  assert(table.retired_count() == 1u);
+  assert(counter.use_count() == 2);
+  assert(reader_view->get() == counter.get());
+
+  ResourceHandle second{};
+  assert(table.Insert(counter, &second) == ENGINE_NATIVE_STATUS_OK);
+  assert(second.index != first.index);
+
+  assert(table.ReclaimRetired() == 1u);
+  assert(table.retired_count() == 0u);
+  assert(counter.use_count() == 2);
+
+  ResourceHandle reused{};
+  assert(table.Insert(counter, &reused) == ENGINE_NATIVE_STATUS_OK);
+  assert(reused.index == first.index);
+  assert(reused.generation != first.generation);
+  assert(table.Get(first) == nullptr);
+
+  table.Clear();
+  assert(counter.use_count() == 1);
+  assert(table.Get(second) == nullptr);
+  assert(table.Get(reused) == nullptr);
+}
+
+void TestRejectsInvalidHandles() {
+  ConcurrentResourceTable<int> table;
+  assert(table.Insert(1, nullptr) == ENGINE_NATIVE_STATUS_INVALID_ARGUMENT);
+  assert(table.Get(ResourceHandle{.index = 0u, .generation = 1u}) == nullptr);
+  assert(table.Get(ResourceHandle{.index = 0xFFFFFFFFu, .generation = 1u}) ==
+         nullptr);
+
+  ResourceHandle handle{};
+  assert(table.Insert(3, &handle) == ENGINE_NATIVE_STATUS_OK);
+  assert(table.Get(ResourceHandle{.index = handle.index, .generation = 0u}) ==
+         nullptr);
+  assert(table.Get(ResourceHandle{.index = handle.index,
+                                  .generation = handle.generation + 1u}) ==
+         nullptr);
+  assert(*table.Get(handle) == 3);
+}
+
+void TestGrowsAcrossManyChunks() {
+  constexpr uint32_t kValueCount =
+      ConcurrentResourceTable<uint32_t>::kChunkSize * 48u;
+  ConcurrentResourceTable<uint32_t> table;
+  std::vector<ResourceHandle> handles(kValueCount);
+  for (uint32_t i = 0u; i < kValueCount; ++i) {
+    assert(table.Insert(i, &handles[i]) == ENGINE_NATIVE_STATUS_OK);
+  }
+
+  assert(table.Size() == kValueCount);
+  for (uint32_t i = 0u; i < kValueCount; i += 97u) {
+    assert(*table.Get(handles[i]) == i);
+  }
+}
+
+void TestReadersObservePublishedValuesWhileWriterGrows() {
+  constexpr uint32_t kValueCount =
+      ConcurrentResourceTable<uint64_t>::kChunkSize * 8u;
+  ConcurrentResourceTable<uint64_t> table;
+  std::vector<std::atomic<uint64_t>> published(kValueCount);
+  for (std::atomic<uint64_t>& encoded : published) {
+    encoded.store(0u, std::memory_order_relaxed);
+  }
+
+  std::atomic<bool> writer_done{false};
+  std::vector<std::thread> readers;
+  for (uint32_t reader = 0u; reader < 3u; ++reader) {
+    readers.emplace_back([&]() {
+      while (!writer_done.load(std::memory_order_acquire)) {
+        for (uint32_t i = 0u; i < kValueCount; ++i) {
+          const uint64_t encoded = published[i].load(std::memory_order_acquire);
+          if (encoded == 0u) {
+            continue;
+          }
+          const uint64_t* value =
+              table.Get(dff::native::DecodeResourceHandle(encoded));
+          if (value != nullptr) {
+            assert(*value == static_cast<uint64_t>(i) * 3u + 1u);
+          }
+        }
+      }
+    });
+  }
+
+  for (uint32_t i = 0u; i < kValueCount; ++i) {
+    ResourceHandle handle{};
+    assert(table.Insert(static_cast<uint64_t>(i) * 3u + 1u, &handle) ==
+           ENGINE_NATIVE_STATUS_OK);
+    published[i].store(dff::native::EncodeResourceHandle(handle),
+                       std::memory_order_release);
+    if (i % 7u == 0u) {
+      assert(table.Remove(handle));
+    }
+  }
+  writer_done.store(true, std::memory_order_release);
+
+  for (std::thread& reader : readers) {
+    reader.join();
+  }
+
+  assert(table.Size() == kValueCount - (kValueCount + 6u) / 7u);
+  assert(table.ReclaimRetired() == (kValueCount + 6u) / 7u);
+  for (uint32_t i = 1u; i < kValueCount; i += 7u) {
+    const uint64_t* value = table.Get(
+        dff::native::DecodeResourceHandle(published[i].load()));
+    assert(value != nullptr);
+    assert(*value == static_cast<uint64_t>(i) * 3u + 1u);
+  }
+}
+
+}  // namespace
+
+void RunConcurrentResourceTableTests() {
+  TestRemoveDefersDestructionUntilReclaim();
+  TestRejectsInvalidHandles();
+  TestGrowsAcrossManyChunks();
+  TestReadersObservePublishedValuesWhileWriterGrows();
+}
+
+}  // namespace dff::native::tests
@@ -0,0 +1,10 @@
+#ifndef DFF_ENGINE_NATIVE_CONCURRENT_RESOURCE_TABLE_TESTS_H
+#define DFF_ENGINE_NATIVE_CONCURRENT_RESOURCE_TABLE_TESTS_H
+
+namespace dff::native::tests {
+
+void RunConcurrentResourceTableTests();
+
+}  // namespace dff::native::tests
+
+#endif
@@ -7,6 +7,7 @@
 #include <filesystem>
 #include <fstream>
 #include <string>
+#include <thread>
 
 #include "engine_native.h"
 
@@ -15,6 +16,8 @@ namespace {
 
 constexpr const char* kPipelineCachePathEnv = "DFF_PIPELINE_CACHE_PATH";
 constexpr const char* kRenderBackendEnv = "DFF_RENDER_BACKEND";
+constexpr const char* kPipelineCacheSaveIntervalEnv =
+    "DFF_PIPELINE_CACHE_SAVE_INTERVAL";
 
 std::filesystem::path MakeTempCachePath() {
   const auto stamp =
@@ -55,6 +58,32 @@ bool ClearRenderBackendEnv() {
   return SetRenderBackendEnv(nullptr);
 }
 
+bool SetPipelineCacheSaveIntervalEnv(const char* interval) {
+#if defined(_WIN32)
+  return _putenv_s(kPipelineCacheSaveIntervalEnv,
+                   interval == nullptr ? "" : interval) == 0;
+#else
+  if (interval == nullptr || interval[0] == '\0') {
+    return unsetenv(kPipelineCacheSaveIntervalEnv) == 0;
+  }
+
+  return setenv(kPipelineCacheSaveIntervalEnv, interval, 1) == 0;
+#endif
+}
+
+bool WaitForFile(const std::filesystem::path& path) {
+  const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+  while (std::chrono::steady_clock::now() < deadline) {
+    std::error_code error;
+    if (std::filesystem::exists(path, error) &&
+        std::filesystem::file_size(path, error) > 0u) {
+      return true;
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  }
+  return false;
+}
+
 engine_native_status_t ExecuteSingleDrawFrame(
     engine_native_engine_t* engine,
     engine_native_resource_handle_t material,
@@ -239,6 +268,43 @@ void TestRenderBackendCanBeSelectedFromEnvironment() {
   assert(ClearRenderBackendEnv());
 }
 
+void TestPipelineCacheIsSavedPeriodicallyInBackground() {
+  const std::filesystem::path cache_path = MakeTempCachePath();
+  std::error_code remove_error;
+  std::filesystem::remove(cache_path, remove_error);
+
+  assert(SetPipelineCachePathEnv(cache_path));
+  assert(SetPipelineCacheSaveIntervalEnv("2"));
+
+  engine_native_create_desc_t create_desc{
+      .api_version = ENGINE_NATIVE_API_VERSION,
+      .user_data = nullptr};
+
+  engine_native_engine_t* engine = nullptr;
+  assert(engine_create(&create_desc, &engine) == ENGINE_NATIVE_STATUS_OK);
+
+  engine_native_renderer_frame_stats_t stats{};
+  assert(ExecuteSingleDrawFrame(engine, 1301u, &stats) == ENGINE_NATIVE_STATUS_OK);
+  assert(!std::filesystem::exists(cache_path));
+  assert(ExecuteSingleDrawFrame(engine, 1302u, &stats) == ENGINE_NATIVE_STATUS_OK);
+  assert(WaitForFile(cache_path));
+
+  // A process that dies now still restarts warm from the periodic snapshot.
+  assert(SetPipelineCacheSaveIntervalEnv("0"));
+  engine_native_engine_t* restarted_engine = nullptr;
+  assert(engine_create(&create_desc, &restarted_engine) == ENGINE_NATIVE_STATUS_OK);
+  assert(ExecuteSingleDrawFrame(restarted_engine, 1301u, &stats) ==
+         ENGINE_NATIVE_STATUS_OK);
+  assert(stats.pipeline_cache_hits >= 1u);
+  assert(stats.pipeline_cache_misses == 0u);
+  assert(engine_destroy(restarted_engine) == ENGINE_NATIVE_STATUS_OK);
+
+  assert(engine_destroy(engine) == ENGINE_NATIVE_STATUS_OK);
+  assert(SetPipelineCacheSaveIntervalEnv(nullptr));
+  assert(ClearPipelineCachePathEnv());
+  std::filesystem::remove(cache_path, remove_error);
+}
+
 }  // namespace
 
 void RunEnginePipelineCachePersistenceTests() {
@@ -246,6 +312,7 @@ void RunEnginePipelineCachePersistenceTests() {
   TestPipelineCacheCorruptedFileIsIgnored();
   TestPipelineCachePathIsCapturedAtEngineCreate();
   TestRenderBackendCanBeSelectedFromEnvironment();
+  TestPipelineCacheIsSavedPeriodicallyInBackground();
 }
 
 }  // namespace dff::native::tests
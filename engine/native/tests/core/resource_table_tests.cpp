@@ -0,0 +1,131 @@
+#include "core/resource_table_tests.h"
+
+#include <assert.h>
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "core/resource_table.h"
+
+namespace dff::native::tests {
+namespace {
+
+using dff::native::ResourceHandle;
+using dff::native::ResourceTable;
+
+void TestAddressesStayStableAcrossGrowth() {
+  ResourceTable<std::vector<uint8_t>> table;
+
+  ResourceHandle first{};
+  assert(table.Insert(std::vector<uint8_t>(16u, 7u), &first) ==
+         ENGINE_NATIVE_STATUS_OK);
+  const std::vector<uint8_t>* first_value = table.Get(first);
+  const uint8_t* first_bytes = first_value->data();
+
+  constexpr uint32_t kGrowthCount =
+      ResourceTable<std::vector<uint8_t>>::kChunkSize * 4u;
+  for (uint32_t i = 0u; i < kGrowthCount; ++i) {
+    ResourceHandle handle{};
+    assert(table.Insert(std::vector<uint8_t>(4u, 1u), &handle) ==
+           ENGINE_NATIVE_STATUS_OK);
+  }
+
+  assert(table.Size() == kGrowthCount + 1u);
+  assert(table.Get(first) == first_value);
+  assert(table.Get(first)->data() == first_bytes);
+  assert((*table.Get(first))[15] == 7u);
+}
+
+void TestForEachVisitsOnlyLiveValues() {
+  ResourceTable<uint32_t> table;
+
+  std::vector<ResourceHandle> handles;
+  for (uint32_t i = 0u; i < 600u; ++i) {
+    ResourceHandle handle{};
+    assert(table.Insert(i, &handle) == ENGINE_NATIVE_STATUS_OK);
+    handles.push_back(handle);
+  }
+
+  for (uint32_t i = 0u; i < 600u; i += 3u) {
+    assert(table.Remove(handles[i]));
+  }
+
+  std::vector<uint8_t> seen(600u, 0u);
+  size_t visited = 0u;
+  table.ForEach([&](ResourceHandle handle, uint32_t& value) {
+    assert(value % 3u != 0u);
+    assert(table.Get(handle) == &value);
+    ++seen[value];
+    ++visited;
+  });
+
+  assert(visited == table.Size());
+  assert(visited == 400u);
+  for (uint32_t i = 0u; i < 600u; ++i) {
+    assert(seen[i] == ((i % 3u == 0u) ? 0u : 1u));
+  }
+
+  const ResourceTable<uint32_t>& const_table = table;
+  uint64_t sum = 0u;
+  const_table.ForEach(
+      [&](ResourceHandle, const uint32_t& value) { sum += value; });
+  assert(sum == 600u * 599u / 2u - 3u * (200u * 199u / 2u));
+}
+
+void TestRemoveAndClearDestroyValues() {
+  auto counter = std::make_shared<int>(0);
+
+  {
+    ResourceTable<std::shared_ptr<int>> table;
+    ResourceHandle first{};
+    ResourceHandle second{};
+    ResourceHandle third{};
+    assert(table.Insert(counter, &first) == ENGINE_NATIVE_STATUS_OK);
+    assert(table.Insert(counter, &second) == ENGINE_NATIVE_STATUS_OK);
+    assert(table.Insert(counter, &third) == ENGINE_NATIVE_STATUS_OK);
+    assert(counter.use_count() == 4);
+
+    assert(table.Remove(second));
+    assert(counter.use_count() == 3);
+
+    table.Clear();
+    assert(counter.use_count() == 1);
+    assert(table.Get(first) == nullptr);
+    assert(table.Get(third) == nullptr);
+
+    ResourceHandle reused{};
+    assert(table.Insert(counter, &reused) == ENGINE_NATIVE_STATUS_OK);
+    assert(reused.index == first.index);
+    assert(reused.generation != first.generation);
+    assert(counter.use_count() == 2);
+  }
+
+  assert(counter.use_count() == 1);
+}
+
+void TestRejectsOutOfRangeAndStaleHandles() {
+  ResourceTable<int> table;
+  assert(table.Get(ResourceHandle{.index = 0u, .generation = 1u}) == nullptr);
+  assert(!table.Remove(ResourceHandle{.index = 1u << 20u, .generation = 1u}));
+  assert(table.Insert(1, nullptr) == ENGINE_NATIVE_STATUS_INVALID_ARGUMENT);
+
+  ResourceHandle handle{};
+  assert(table.Insert(5, &handle) == ENGINE_NATIVE_STATUS_OK);
+  assert(table.Get(ResourceHandle{.index = handle.index + 1u,
+                                  .generation = handle.generation}) == nullptr);
+  assert(table.Get(ResourceHandle{.index = handle.index,
+                                  .generation = handle.generation + 1u}) ==
+         nullptr);
+}
+
+}  // namespace
+
+void RunResourceTableTests() {
+  TestAddressesStayStableAcrossGrowth();
+  TestForEachVisitsOnlyLiveValues();
+  TestRemoveAndClearDestroyValues();
+  TestRejectsOutOfRangeAndStaleHandles();
+}
+
+}  // namespace dff::native::tests
@@ -0,0 +1,10 @@
+#ifndef DFF_ENGINE_NATIVE_RESOURCE_TABLE_TESTS_H
+#define DFF_ENGINE_NATIVE_RESOURCE_TABLE_TESTS_H
+
+namespace dff::native::tests {
+
+void RunResourceTableTests();
+
+}  // namespace dff::native::tests
+
+#endif
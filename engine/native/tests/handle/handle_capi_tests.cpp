@@ -98,6 +98,40 @@ void TestHandleLifecycleAndSubsystemAccess() {
          ENGINE_NATIVE_STATUS_OK);
   assert(stats.present_count == 1u);
 
+  const engine_native_pipeline_prewarm_item_t prewarm_items[1]{{77u, 0u, 0u}};
+  assert(renderer_prewarm_pipelines_handle(renderer, prewarm_items, 1u) ==
+         ENGINE_NATIVE_STATUS_OK);
+  assert(renderer_prewarm_pipelines_handle(renderer, nullptr, 1u) ==
+         ENGINE_NATIVE_STATUS_INVALID_ARGUMENT);
+  engine_native_pipeline_prewarm_progress_t prewarm_progress{};
+  assert(renderer_get_pipeline_prewarm_progress_handle(renderer, &prewarm_progress) ==
+         ENGINE_NATIVE_STATUS_OK);
+  assert(prewarm_progress.requested_count == 1u);
+  assert(renderer_get_pipeline_prewarm_progress_handle(renderer, nullptr) ==
+         ENGINE_NATIVE_STATUS_INVALID_ARGUMENT);
+
+  uint64_t frame_commands[3]{};
+  const engine_native_frame_command_header_t begin_header{
+      .kind = ENGINE_NATIVE_FRAME_COMMAND_RENDERER_BEGIN_FRAME,
+      .size = static_cast<uint32_t>(sizeof(frame_commands))};
+  const engine_native_frame_command_begin_frame_t begin_payload{
+      .requested_bytes = 1024u, .alignment = 16u};
+  std::memcpy(&frame_commands[0], &begin_header, sizeof(begin_header));
+  std::memcpy(&frame_commands[1], &begin_payload, sizeof(begin_payload));
+  engine_native_frame_command_results_t frame_results{};
+  assert(engine_execute_frame_commands_handle(engine, frame_commands,
+                                              sizeof(frame_commands),
+                                              &frame_results) ==
+         ENGINE_NATIVE_STATUS_OK);
+  assert(frame_results.executed_command_count == 1u);
+  assert(frame_results.frame_memory != nullptr);
+  assert(renderer_present_handle(renderer) == ENGINE_NATIVE_STATUS_OK);
+  assert(engine_execute_frame_commands_handle(ENGINE_NATIVE_INVALID_HANDLE,
+                                              frame_commands,
+                                              sizeof(frame_commands),
+                                              &frame_results) ==
+         ENGINE_NATIVE_STATUS_INVALID_ARGUMENT);
+
   assert(physics_step_handle(physics, 1.0 / 60.0) ==
          ENGINE_NATIVE_STATUS_INVALID_STATE);
 
@@ -0,0 +1,166 @@
+#include "handle/handle_table_tests.h"
+
+#include <assert.h>
+
+#include <atomic>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+#include "bridge_capi/handle_table.h"
+
+namespace dff::native::tests {
+namespace {
+
+using dff::native::bridge::HandleTable;
+
+void* FakeObject(uintptr_t value) { return reinterpret_cast<void*>(value * 16u); }
+
+engine_native_engine_t* FakeOwner(uintptr_t value) {
+  return reinterpret_cast<engine_native_engine_t*>(value * 16u + 8u);
+}
+
+void TestGetOrCreateReturnsStableHandlePerObject() {
+  HandleTable table;
+  uint64_t first = 0u;
+  uint64_t again = 0u;
+  uint64_t other = 0u;
+  assert(table.GetOrCreate(FakeObject(1u), FakeOwner(1u), true, &first) ==
+         ENGINE_NATIVE_STATUS_OK);
+  assert(table.GetOrCreate(FakeObject(1u), nullptr, false, &again) ==
+         ENGINE_NATIVE_STATUS_OK);
+  assert(table.GetOrCreate(FakeObject(2u), nullptr, false, &other) ==
+         ENGINE_NATIVE_STATUS_OK);
+  assert(first == again);
+  assert(first != other);
+  assert(table.live_count() == 2u);
+
+  void* object = nullptr;
+  engine_native_engine_t* owner = nullptr;
+  bool owns_state = false;
+  assert(table.Resolve(first, &object, &owner, &owns_state) ==
+         ENGINE_NATIVE_STATUS_OK);
+  assert(object == FakeObject(1u));
+  assert(owner == FakeOwner(1u));
+  assert(owns_state);
+
+  assert(table.GetOrCreate(nullptr, nullptr, false, &first) ==
+         ENGINE_NATIVE_STATUS_INVALID_ARGUMENT);
+  assert(table.Resolve(ENGINE_NATIVE_INVALID_HANDLE, &object, nullptr,
+                       nullptr) == ENGINE_NATIVE_STATUS_INVALID_ARGUMENT);
+  assert(table.Resolve(first & 0xFFFFFFFFull, &object, nullptr, nullptr) ==
+         ENGINE_NATIVE_STATUS_INVALID_ARGUMENT);
+  assert(table.Resolve((first & 0xFFFFFFFF00000000ull) | 0xFFFFFFFFull,
+                       &object, nullptr, nullptr) ==
+         ENGINE_NATIVE_STATUS_NOT_FOUND);
+}
+
+void TestRemovalInvalidatesAndRecyclesSlots() {
+  HandleTable table;
+  uint64_t engine_a = 0u;
+  uint64_t renderer_a = 0u;
+  uint64_t renderer_b = 0u;
+  assert(table.GetOrCreate(FakeObject(10u), nullptr, false, &engine_a) ==
+         ENGINE_NATIVE_STATUS_OK);
+  assert(table.GetOrCreate(FakeObject(11u), FakeOwner(1u), false,
+                           &renderer_a) == ENGINE_NATIVE_STATUS_OK);
+  assert(table.GetOrCreate(FakeObject(12u), FakeOwner(2u), false,
+                           &renderer_b) == ENGINE_NATIVE_STATUS_OK);
+
+  table.RemoveByOwner(FakeOwner(1u));
+  void* object = nullptr;
+  assert(table.Resolve(renderer_a, &object, nullptr, nullptr) ==
+         ENGINE_NATIVE_STATUS_NOT_FOUND);
+  assert(object == nullptr);
+  assert(table.Resolve(renderer_b, &object, nullptr, nullptr) ==
+         ENGINE_NATIVE_STATUS_OK);
+  assert(table.live_count() == 2u);
+
+  uint64_t recycled = 0u;
+  assert(table.GetOrCreate(FakeObject(11u), FakeOwner(3u), false, &recycled) ==
+         ENGINE_NATIVE_STATUS_OK);
+  assert((recycled & 0xFFFFFFFFull) == (renderer_a & 0xFFFFFFFFull));
+  assert(recycled != renderer_a);
+
+  table.RemoveByObject(FakeObject(12u));
+  table.RemoveByOwner(FakeOwner(2u));
+  assert(table.Resolve(renderer_b, &object, nullptr, nullptr) ==
+         ENGINE_NATIVE_STATUS_NOT_FOUND);
+  table.RemoveByOwner(FakeOwner(3u));
+  assert(table.Resolve(recycled, &object, nullptr, nullptr) ==
+         ENGINE_NATIVE_STATUS_NOT_FOUND);
+  assert(table.Resolve(engine_a, &object, nullptr, nullptr) ==
+         ENGINE_NATIVE_STATUS_OK);
+  assert(table.live_count() == 1u);
+}
+
+void TestScalesToManyLiveHandles() {
+  constexpr uint32_t kLiveCount = HandleTable::kChunkSize * 64u;
+  HandleTable table;
+  std::vector<uint64_t> handles(kLiveCount);
+  for (uint32_t i = 0u; i < kLiveCount; ++i) {
+    assert(table.GetOrCreate(FakeObject(i + 1u), FakeOwner(i % 100u), false,
+                             &handles[i]) == ENGINE_NATIVE_STATUS_OK);
+  }
+  assert(table.live_count() == kLiveCount);
+
+  table.RemoveByOwner(FakeOwner(7u));
+  assert(table.live_count() == kLiveCount - kLiveCount / 100u - 1u);
+  for (uint32_t i = 0u; i < kLiveCount; ++i) {
+    void* object = nullptr;
+    const engine_native_status_t status =
+        table.Resolve(handles[i], &object, nullptr, nullptr);
+    if (i % 100u == 7u) {
+      assert(status == ENGINE_NATIVE_STATUS_NOT_FOUND);
+    } else {
+      assert(status == ENGINE_NATIVE_STATUS_OK);
+      assert(object == FakeObject(i + 1u));
+    }
+  }
+}
+
+void TestResolveRacesWithChurn() {
+  constexpr uint32_t kStableCount = HandleTable::kChunkSize * 3u;
+  HandleTable table;
+  std::vector<uint64_t> stable(kStableCount);
+  for (uint32_t i = 0u; i < kStableCount; ++i) {
+    assert(table.GetOrCreate(FakeObject(i + 1u), FakeOwner(i + 1u), false,
+                             &stable[i]) == ENGINE_NATIVE_STATUS_OK);
+  }
+
+  std::atomic<bool> done{false};
+  std::thread reader([&]() {
+    while (!done.load(std::memory_order_acquire)) {
+      for (uint32_t i = 0u; i < kStableCount; ++i) {
+        void* object = nullptr;
+        engine_native_engine_t* owner = nullptr;
+        assert(table.Resolve(stable[i], &object, &owner, nullptr) ==
+               ENGINE_NATIVE_STATUS_OK);
+        assert(object == FakeObject(i + 1u));
+        assert(owner == FakeOwner(i + 1u));
+      }
+    }
+  });
+
+  for (uint32_t round = 0u; round < 2000u; ++round) {
+    uint64_t transient = 0u;
+    void* object = FakeObject(100000u + round);
+    assert(table.GetOrCreate(object, nullptr, false, &transient) ==
+           ENGINE_NATIVE_STATUS_OK);
+    table.RemoveByObject(object);
+  }
+  done.store(true, std::memory_order_release);
+  reader.join();
+  assert(table.live_count() == kStableCount);
+}
+
+}  // namespace
+
+void RunHandleTableTests() {
+  TestGetOrCreateReturnsStableHandlePerObject();
+  TestRemovalInvalidatesAndRecyclesSlots();
+  TestScalesToManyLiveHandles();
+  TestResolveRacesWithChurn();
+}
+
+}  // namespace dff::native::tests
@@ -9,13 +9,27 @@
 #include <vector>
 
 #include "bridge_capi/bridge_state.h"
+#include "content/asset_cache_tests.h"
+#include "content/asset_path_tests.h"
+#include "content/content_read_queue_tests.h"
 #include "content/content_runtime_tests.h"
+#include "content/lz4_block_tests.h"
+#include "content/streaming_scheduler_tests.h"
+#include "content/vfs_index_tests.h"
+#include "core/concurrent_resource_table_tests.h"
 #include "core/engine_pipeline_cache_persistence_tests.h"
 #include "core/resource_table.h"
+#include "core/resource_table_tests.h"
 #include "engine_native.h"
+#include "handle/handle_table_tests.h"
 #include "platform/platform_state_tests.h"
+#include "render/frame_arena_ring_tests.h"
 #include "render/frame_graph_builder_tests.h"
+#include "render/frame_graph_cache_tests.h"
+#include "render/draw_item_sorter_tests.h"
+#include "render/material_pipeline_memo_tests.h"
 #include "render/material_system_tests.h"
+#include "render/parallel_pass_recorder_tests.h"
 #include "render/render_graph_tests.h"
 #include "rhi/pipeline_state_cache_tests.h"
 #include "rhi/rhi_device_tests.h"
@@ -152,6 +166,8 @@ void TestEngineAndSubsystemFlow() {
   assert(events.should_close == 0u);
   const auto* internal_engine = reinterpret_cast<const engine_native_engine*>(engine);
   assert(internal_engine->state.platform.pump_count() == 1u);
+  assert(internal_engine->state.renderer.render_target_width() == events.width);
+  assert(internal_engine->state.renderer.render_target_height() == events.height);
 
   engine_native_renderer_t* renderer = nullptr;
   engine_native_physics_t* physics = nullptr;
@@ -200,6 +216,22 @@ void TestEngineAndSubsystemFlow() {
   assert(renderer_stats.triangle_count == 0u);
   assert(renderer_stats.upload_bytes == 0u);
   assert(renderer_stats.gpu_memory_bytes == 0u);
+  assert(renderer_stats.frame_arena_grow_count == 1u);
+  assert(renderer_stats.frame_arena_reuse_count == 0u);
+  assert(renderer_stats.frame_arena_high_water_bytes == 1024u);
+  assert(renderer_stats.frame_arena_reserved_bytes >= 1024u);
+  assert(renderer_stats.frame_graph_cache_misses == 1u);
+  assert(renderer_stats.frame_graph_cache_hits == 0u);
+  assert(renderer_stats.transient_aliased_bytes <=
+         renderer_stats.transient_naive_bytes);
+  assert(renderer_stats.pass_record_level_count > 0u);
+  assert(renderer_stats.pass_record_max_parallel_passes > 0u);
+  assert(internal_engine->state.renderer.last_pass_cpu_ns().size() ==
+         renderer_stats.executed_pass_count);
+  assert(renderer_stats.draw_batch_count == 2u);
+  assert(renderer_stats.draw_batch_max_instances == 1u);
+  assert(renderer_stats.material_resolve_lookups == 2u);
+  assert(renderer_stats.material_resolve_unique == 2u);
   assert((renderer_stats.pass_mask &
           (static_cast<uint64_t>(1u) << 3u)) != 0u);  // shadow
   assert((renderer_stats.pass_mask &
@@ -714,6 +746,13 @@ void TestRendererPassOrderForDrawAndUiScenarios() {
   assert(renderer_present(renderer) == ENGINE_NATIVE_STATUS_OK);
   AssertPassOrder(internal_engine->state.renderer.last_executed_rhi_passes(),
                   {"shadow", "pbr_opaque", "debug_depth", "present"});
+  engine_native_renderer_frame_stats_t debug_stats{};
+  assert(renderer_get_last_frame_stats(renderer, &debug_stats) ==
+         ENGINE_NATIVE_STATUS_OK);
+  assert(debug_stats.culled_pass_mask ==
+         (static_cast<uint64_t>(1u)
+          << static_cast<uint32_t>(dff::native::rhi::RhiDevice::PassKind::kAmbientOcclusion)));
+  assert((debug_stats.pass_mask & debug_stats.culled_pass_mask) == 0u);
 
   frame_memory = nullptr;
   assert(renderer_begin_frame(renderer, 1024u, 64u, &frame_memory) ==
@@ -858,12 +897,32 @@ void TestRendererPassOrderForDrawAndUiScenarios() {
       .ui_item_count = 0u,
       .debug_view_mode = ENGINE_NATIVE_DEBUG_VIEW_NONE,
       .reserved0 = 0u,
-      .reserved1 = 1u};
+      .reserved1 = 0x80u};
   assert(renderer_submit(renderer, &invalid_reserved_packet) ==
          ENGINE_NATIVE_STATUS_INVALID_ARGUMENT);
+  engine_native_render_packet_t outside_frame_memory_packet{
+      .draw_items = draw_batch,
+      .draw_item_count = 1u,
+      .ui_items = nullptr,
+      .ui_item_count = 0u,
+      .debug_view_mode = ENGINE_NATIVE_DEBUG_VIEW_NONE,
+      .reserved0 = 0u,
+      .reserved1 = ENGINE_NATIVE_RENDER_PACKET_FLAG_DRAW_ITEMS_IN_FRAME_MEMORY};
+  assert(renderer_submit(renderer, &outside_frame_memory_packet) ==
+         ENGINE_NATIVE_STATUS_INVALID_ARGUMENT);
   assert(renderer_submit(renderer, &draw_packet_a) == ENGINE_NATIVE_STATUS_OK);
   assert(renderer_present(renderer) == ENGINE_NATIVE_STATUS_OK);
 
+  const auto& frame_arenas = internal_engine->state.renderer.frame_arenas();
+  assert(frame_arenas.grow_count() == frame_arenas.depth());
+  assert(frame_arenas.reuse_count() > 0u);
+  assert(!frame_arenas.has_active_arena());
+
+  const auto& frame_graph_cache =
+      internal_engine->state.renderer.frame_graph_cache();
+  assert(frame_graph_cache.hit_count() > 0u);
+  assert(frame_graph_cache.miss_count() == frame_graph_cache.size());
+
   assert(engine_destroy(engine) == ENGINE_NATIVE_STATUS_OK);
 }
 
@@ -1038,6 +1097,501 @@ void TestRendererResourceBlobLifecycle() {
   assert(engine_destroy(engine) == ENGINE_NATIVE_STATUS_OK);
 }
 
+void TestRendererFrameMemoryDrawItemSubmission() {
+  engine_native_create_desc_t create_desc{
+      .api_version = ENGINE_NATIVE_API_VERSION,
+      .user_data = nullptr};
+
+  engine_native_engine_t* engine = nullptr;
+  assert(engine_create(&create_desc, &engine) == ENGINE_NATIVE_STATUS_OK);
+  assert(engine != nullptr);
+
+  engine_native_renderer_t* renderer = nullptr;
+  assert(engine_get_renderer(engine, &renderer) == ENGINE_NATIVE_STATUS_OK);
+  assert(renderer != nullptr);
+
+  float positions[9]{0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 0.0f, 1.0f, 0.0f};
+  uint32_t indices[3]{0u, 1u, 2u};
+  engine_native_mesh_cpu_data_t mesh_cpu{
+      .positions = positions,
+      .vertex_count = 3u,
+      .indices = indices,
+      .index_count = 3u};
+  engine_native_resource_handle_t mesh = 0u;
+  assert(renderer_create_mesh_from_cpu(renderer, &mesh_cpu, &mesh) ==
+         ENGINE_NATIVE_STATUS_OK);
+
+  constexpr size_t kFrameBytes = 4096u;
+  void* frame_memory = nullptr;
+  assert(renderer_begin_frame(renderer, kFrameBytes, 64u, &frame_memory) ==
+         ENGINE_NATIVE_STATUS_OK);
+  assert(frame_memory != nullptr);
+
+  auto* frame_draw_items = static_cast<engine_native_draw_item_t*>(frame_memory);
+  for (uint32_t i = 0u; i < 3u; ++i) {
+    frame_draw_items[i] = engine_native_draw_item_t{};
+    frame_draw_items[i].mesh = mesh;
+    frame_draw_items[i].sort_key_high = i;
+  }
+
+  engine_native_render_packet_t frame_memory_packet{
+      .draw_items = frame_draw_items,
+      .draw_item_count = 2u,
+      .ui_items = nullptr,
+      .ui_item_count = 0u,
+      .debug_view_mode = ENGINE_NATIVE_DEBUG_VIEW_NONE,
+      .reserved0 = 0u,
+      .reserved1 = ENGINE_NATIVE_RENDER_PACKET_FLAG_DRAW_ITEMS_IN_FRAME_MEMORY};
+  assert(renderer_submit(renderer, &frame_memory_packet) ==
+         ENGINE_NATIVE_STATUS_OK);
+
+  engine_native_render_packet_t overflowing_packet = frame_memory_packet;
+  overflowing_packet.draw_items = reinterpret_cast<const engine_native_draw_item_t*>(
+      static_cast<uint8_t*>(frame_memory) + kFrameBytes -
+      sizeof(engine_native_draw_item_t) / 2u);
+  overflowing_packet.draw_item_count = 1u;
+  assert(renderer_submit(renderer, &overflowing_packet) ==
+         ENGINE_NATIVE_STATUS_INVALID_ARGUMENT);
+
+  engine_native_render_packet_t copied_packet{
+      .draw_items = frame_draw_items + 2u,
+      .draw_item_count = 1u,
+      .ui_items = nullptr,
+      .ui_item_count = 0u};
+  assert(renderer_submit(renderer, &copied_packet) == ENGINE_NATIVE_STATUS_OK);
+
+  auto* internal_engine = reinterpret_cast<const engine_native_engine*>(engine);
+  const auto& renderer_state = internal_engine->state.renderer;
+  assert(renderer_state.referenced_draw_span_count() == 1u);
+  assert(renderer_state.copied_draw_item_count() == 1u);
+  assert(renderer_state.submitted_draw_count() == 3u);
+
+  assert(renderer_present(renderer) == ENGINE_NATIVE_STATUS_OK);
+  engine_native_renderer_frame_stats_t renderer_stats{};
+  assert(renderer_get_last_frame_stats(renderer, &renderer_stats) ==
+         ENGINE_NATIVE_STATUS_OK);
+  assert(renderer_stats.draw_item_count == 3u);
+  assert(renderer_stats.triangle_count == 3u);
+  assert(renderer_stats.transient_naive_bytes > 0u);
+  assert(renderer_stats.transient_aliased_bytes > 0u);
+  assert(renderer_stats.transient_aliased_bytes <
+         renderer_stats.transient_naive_bytes);
+  assert(renderer_state.referenced_draw_span_count() == 0u);
+  assert(renderer_state.copied_draw_item_count() == 0u);
+
+  assert(engine_destroy(engine) == ENGINE_NATIVE_STATUS_OK);
+}
+
+void TestRendererDeduplicatesMaterialResolvesPerFrame() {
+  engine_native_create_desc_t create_desc{
+      .api_version = ENGINE_NATIVE_API_VERSION,
+      .user_data = nullptr};
+
+  engine_native_engine_t* engine = nullptr;
+  assert(engine_create(&create_desc, &engine) == ENGINE_NATIVE_STATUS_OK);
+
+  engine_native_renderer_t* renderer = nullptr;
+  assert(engine_get_renderer(engine, &renderer) == ENGINE_NATIVE_STATUS_OK);
+
+  std::vector<engine_native_draw_item_t> draw_items(512u);
+  for (uint32_t i = 0u; i < draw_items.size(); ++i) {
+    draw_items[i].mesh = 1u;
+    draw_items[i].material = 100u + (i % 4u);
+    draw_items[i].sort_key_high = (i / 4u) % 2u;
+  }
+
+  engine_native_render_packet_t packet{
+      .draw_items = draw_items.data(),
+      .draw_item_count = static_cast<uint32_t>(draw_items.size()),
+      .ui_items = nullptr,
+      .ui_item_count = 0u};
+
+  for (int frame = 0; frame < 2; ++frame) {
+    void* frame_memory = nullptr;
+    assert(renderer_begin_frame(renderer, 64u * 1024u, 64u, &frame_memory) ==
+           ENGINE_NATIVE_STATUS_OK);
+    assert(renderer_submit(renderer, &packet) == ENGINE_NATIVE_STATUS_OK);
+    engine_native_renderer_frame_stats_t stats{};
+    assert(renderer_present_with_stats(renderer, &stats) ==
+           ENGINE_NATIVE_STATUS_OK);
+    assert(stats.material_resolve_lookups == 512u);
+    assert(stats.material_resolve_unique == 8u);
+    assert(stats.pipeline_cache_misses == 8u);
+    assert(stats.pipeline_cache_hits == (frame == 0 ? 0u : 8u));
+  }
+
+  assert(engine_destroy(engine) == ENGINE_NATIVE_STATUS_OK);
+}
+
+void TestRendererPrewarmsPipelinesBeforeFirstFrame() {
+  engine_native_create_desc_t create_desc{
+      .api_version = ENGINE_NATIVE_API_VERSION,
+      .user_data = nullptr};
+
+  engine_native_engine_t* engine = nullptr;
+  assert(engine_create(&create_desc, &engine) == ENGINE_NATIVE_STATUS_OK);
+
+  engine_native_renderer_t* renderer = nullptr;
+  assert(engine_get_renderer(engine, &renderer) == ENGINE_NATIVE_STATUS_OK);
+
+  assert(renderer_prewarm_pipelines(renderer, nullptr, 2u) ==
+         ENGINE_NATIVE_STATUS_INVALID_ARGUMENT);
+  assert(renderer_get_pipeline_prewarm_progress(renderer, nullptr) ==
+         ENGINE_NATIVE_STATUS_INVALID_ARGUMENT);
+
+  const std::vector<uint8_t> material_blob = CreateValidMaterialBlob();
+  engine_native_resource_handle_t materials[4]{};
+  for (engine_native_resource_handle_t& material : materials) {
+    assert(renderer_create_material_from_blob(renderer, material_blob.data(),
+                                              material_blob.size(), &material) ==
+           ENGINE_NATIVE_STATUS_OK);
+  }
+  assert(renderer_destroy_resource(renderer, materials[3]) ==
+         ENGINE_NATIVE_STATUS_OK);
+
+  const engine_native_pipeline_prewarm_item_t items[5]{
+      {materials[0], 0u, 0u},
+      {materials[1], 1u, 0u},
+      {0u, 0u, 0u},
+      {materials[2], 0x80u, 0u},
+      {materials[3], 0u, 0u}};
+  assert(renderer_prewarm_pipelines(renderer, items, 5u) == ENGINE_NATIVE_STATUS_OK);
+
+  auto* internal_engine = reinterpret_cast<engine_native_engine*>(engine);
+
+  engine_native_pipeline_prewarm_progress_t progress{};
+  assert(renderer_get_pipeline_prewarm_progress(renderer, &progress) ==
+         ENGINE_NATIVE_STATUS_OK);
+  assert(progress.requested_count == 5u);
+  assert(progress.resolved_count == 2u);
+  assert(progress.rejected_count == 3u);
+  assert(progress.already_cached_count == 0u);
+  assert(progress.is_complete == 1u);
+  assert(progress.first_frame_measured == 0u);
+  assert(internal_engine->state.renderer.cached_pipeline_count() == 2u);
+
+  engine_native_draw_item_t draw_items[3]{};
+  draw_items[0].material = materials[0];
+  draw_items[1].material = materials[1];
+  draw_items[1].sort_key_high = 1u;
+  draw_items[2].material = 604u;
+  engine_native_render_packet_t packet{
+      .draw_items = draw_items,
+      .draw_item_count = 3u,
+      .ui_items = nullptr,
+      .ui_item_count = 0u};
+
+  void* frame_memory = nullptr;
+  assert(renderer_begin_frame(renderer, 1024u, 64u, &frame_memory) ==
+         ENGINE_NATIVE_STATUS_OK);
+  assert(renderer_submit(renderer, &packet) == ENGINE_NATIVE_STATUS_OK);
+  engine_native_renderer_frame_stats_t stats{};
+  assert(renderer_present_with_stats(renderer, &stats) == ENGINE_NATIVE_STATUS_OK);
+  assert(stats.pipeline_cache_hits == 2u);
+  assert(stats.pipeline_cache_misses == 1u);
+
+  assert(renderer_get_pipeline_prewarm_progress(renderer, &progress) ==
+         ENGINE_NATIVE_STATUS_OK);
+  assert(progress.first_frame_measured == 1u);
+  assert(progress.first_frame_miss_count == 1u);
+
+  assert(renderer_prewarm_pipelines(renderer, items, 2u) == ENGINE_NATIVE_STATUS_OK);
+  assert(renderer_get_pipeline_prewarm_progress(renderer, &progress) ==
+         ENGINE_NATIVE_STATUS_OK);
+  assert(progress.requested_count == 7u);
+  assert(progress.resolved_count == 4u);
+  assert(progress.already_cached_count == 2u);
+  assert(progress.first_frame_measured == 0u);
+
+  assert(engine_destroy(engine) == ENGINE_NATIVE_STATUS_OK);
+}
+
+template <typename Payload, typename Item = uint8_t>
+size_t AppendFrameCommand(uint8_t* stream,
+                          size_t offset,
+                          uint32_t kind,
+                          const Payload* payload,
+                          const Item* items = nullptr,
+                          uint32_t item_count = 0u) {
+  const size_t payload_size = payload != nullptr ? sizeof(Payload) : 0u;
+  const size_t unaligned_size = sizeof(engine_native_frame_command_header_t) +
+                                payload_size +
+                                static_cast<size_t>(item_count) * sizeof(Item);
+  const size_t size = (unaligned_size + ENGINE_NATIVE_FRAME_COMMAND_ALIGNMENT - 1u) &
+                      ~static_cast<size_t>(ENGINE_NATIVE_FRAME_COMMAND_ALIGNMENT - 1u);
+  std::memset(stream + offset, 0, size);
+
+  const engine_native_frame_command_header_t header{
+      .kind = kind, .size = static_cast<uint32_t>(size)};
+  std::memcpy(stream + offset, &header, sizeof(header));
+  if (payload != nullptr) {
+    std::memcpy(stream + offset + sizeof(header), payload, sizeof(Payload));
+  }
+  if (item_count > 0u) {
+    std::memcpy(stream + offset + sizeof(header) + payload_size, items,
+                static_cast<size_t>(item_count) * sizeof(Item));
+  }
+  return offset + size;
+}
+
+void TestEngineExecutesFrameCommandStream() {
+  engine_native_create_desc_t create_desc{
+      .api_version = ENGINE_NATIVE_API_VERSION,
+      .user_data = nullptr};
+
+  engine_native_engine_t* engine = nullptr;
+  assert(engine_create(&create_desc, &engine) == ENGINE_NATIVE_STATUS_OK);
+  engine_native_renderer_t* renderer = nullptr;
+  assert(engine_get_renderer(engine, &renderer) == ENGINE_NATIVE_STATUS_OK);
+
+  float positions[9]{0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 0.0f, 1.0f, 0.0f};
+  uint32_t indices[3]{0u, 1u, 2u};
+  engine_native_mesh_cpu_data_t mesh_cpu{
+      .positions = positions,
+      .vertex_count = 3u,
+      .indices = indices,
+      .index_count = 3u};
+  engine_native_resource_handle_t mesh = 0u;
+  assert(renderer_create_mesh_from_cpu(renderer, &mesh_cpu, &mesh) ==
+         ENGINE_NATIVE_STATUS_OK);
+
+  std::vector<uint64_t> heap_stream(512u, 0u);
+  auto* heap_bytes = reinterpret_cast<uint8_t*>(heap_stream.data());
+  engine_native_frame_command_results_t results{};
+
+  const engine_native_frame_command_begin_frame_t begin{
+      .requested_bytes = 64u * 1024u, .alignment = 64u};
+  size_t heap_size = AppendFrameCommand(
+      heap_bytes, 0u, ENGINE_NATIVE_FRAME_COMMAND_RENDERER_BEGIN_FRAME, &begin);
+  assert(engine_execute_frame_commands(engine, heap_bytes, heap_size, &results) ==
+         ENGINE_NATIVE_STATUS_OK);
+  assert(results.executed_command_count == 1u);
+  assert(results.failed_command_index == ENGINE_NATIVE_FRAME_COMMAND_NO_FAILURE);
+  assert(results.has_frame_memory == 1u);
+  assert(results.frame_memory != nullptr);
+  assert(results.has_frame_stats == 0u);
+
+  engine_native_draw_item_t draw_items[2]{};
+  draw_items[0].mesh = mesh;
+  draw_items[1].mesh = mesh;
+  draw_items[1].sort_key_high = 1u;
+  engine_native_ui_draw_item_t ui_item{};
+  ui_item.vertex_count = 4u;
+  ui_item.index_count = 6u;
+  const engine_native_frame_command_items_t ui_append{.item_count = 1u};
+
+  auto* frame_bytes = static_cast<uint8_t*>(results.frame_memory);
+  auto* arena_draw_items =
+      reinterpret_cast<engine_native_draw_item_t*>(frame_bytes + 32u * 1024u);
+  std::memcpy(arena_draw_items, draw_items, sizeof(draw_items));
+  const engine_native_frame_command_submit_t submit{
+      .draw_items = arena_draw_items, .draw_item_count = 2u};
+  size_t frame_size = AppendFrameCommand(
+      frame_bytes, 0u, ENGINE_NATIVE_FRAME_COMMAND_RENDERER_SUBMIT, &submit);
+  frame_size = AppendFrameCommand(
+      frame_bytes, frame_size, ENGINE_NATIVE_FRAME_COMMAND_RENDERER_UI_APPEND,
+      &ui_append, &ui_item, 1u);
+  assert(engine_execute_frame_commands(engine, frame_bytes, frame_size,
+                                       &results) == ENGINE_NATIVE_STATUS_OK);
+  assert(results.executed_command_count == 2u);
+
+  const auto* internal_engine = reinterpret_cast<const engine_native_engine*>(engine);
+  const auto& renderer_state = internal_engine->state.renderer;
+  assert(renderer_state.referenced_draw_span_count() == 1u);
+  assert(renderer_state.copied_draw_item_count() == 0u);
+  assert(renderer_state.submitted_draw_count() == 2u);
+
+  const engine_native_frame_command_submit_t inline_submit{.draw_item_count = 1u};
+  heap_size = AppendFrameCommand(
+      heap_bytes, 0u, ENGINE_NATIVE_FRAME_COMMAND_RENDERER_SUBMIT, &inline_submit,
+      draw_items, 1u);
+  assert(engine_execute_frame_commands(engine, heap_bytes, heap_size, &results) ==
+         ENGINE_NATIVE_STATUS_OK);
+  assert(renderer_state.referenced_draw_span_count() == 1u);
+  assert(renderer_state.copied_draw_item_count() == 1u);
+  assert(renderer_state.submitted_draw_count() == 3u);
+
+  engine_native_body_write_t body{};
+  body.body = 77u;
+  body.body_type = 1u;
+  body.collider_dimensions[0] = 1.0f;
+  body.collider_dimensions[1] = 1.0f;
+  body.collider_dimensions[2] = 1.0f;
+  body.rotation[3] = 1.0f;
+  body.linear_velocity[0] = 1.0f;
+  const engine_native_frame_command_items_t sync_from{.item_count = 1u};
+  const engine_native_frame_command_physics_step_t step{.dt_seconds = 1.0 / 60.0};
+  engine_native_body_read_t reads[4]{};
+  const engine_native_frame_command_sync_to_world_t sync_to{
+      .reads = reads, .read_capacity = 4u};
+
+  heap_size = AppendFrameCommand(
+      heap_bytes, 0u, ENGINE_NATIVE_FRAME_COMMAND_PHYSICS_SYNC_FROM_WORLD,
+      &sync_from, &body, 1u);
+  heap_size = AppendFrameCommand(
+      heap_bytes, heap_size, ENGINE_NATIVE_FRAME_COMMAND_PHYSICS_STEP, &step);
+  heap_size = AppendFrameCommand(
+      heap_bytes, heap_size, ENGINE_NATIVE_FRAME_COMMAND_PHYSICS_SYNC_TO_WORLD,
+      &sync_to);
+  heap_size = AppendFrameCommand<uint8_t>(
+      heap_bytes, heap_size, ENGINE_NATIVE_FRAME_COMMAND_NET_PUMP, nullptr);
+  heap_size = AppendFrameCommand<uint8_t>(
+      heap_bytes, heap_size, ENGINE_NATIVE_FRAME_COMMAND_RENDERER_PRESENT, nullptr);
+  heap_size = AppendFrameCommand(
+      heap_bytes, heap_size, ENGINE_NATIVE_FRAME_COMMAND_RENDERER_BEGIN_FRAME,
+      &begin);
+  assert(engine_execute_frame_commands(engine, heap_bytes, heap_size, &results) ==
+         ENGINE_NATIVE_STATUS_OK);
+  assert(results.executed_command_count == 6u);
+  assert(results.physics_read_count == 1u);
+  assert(reads[0].body == 77u);
+  assert(reads[0].position[0] > 0.0f);
+  assert(results.has_net_events == 1u);
+  assert(results.has_frame_stats == 1u);
+  assert(results.frame_stats.draw_item_count == 3u);
+  assert(results.frame_stats.ui_item_count == 1u);
+  assert(results.frame_stats.triangle_count == 3u);
+  assert(results.has_frame_memory == 1u);
+  assert(results.frame_memory != nullptr);
+
+  const engine_native_frame_command_physics_step_t bad_step{.dt_seconds = 0.0};
+  heap_size = AppendFrameCommand<uint8_t>(
+      heap_bytes, 0u, ENGINE_NATIVE_FRAME_COMMAND_NET_PUMP, nullptr);
+  heap_size = AppendFrameCommand(
+      heap_bytes, heap_size, ENGINE_NATIVE_FRAME_COMMAND_PHYSICS_STEP, &bad_step);
+  heap_size = AppendFrameCommand<uint8_t>(
+      heap_bytes, heap_size, ENGINE_NATIVE_FRAME_COMMAND_RENDERER_PRESENT, nullptr);
+  assert(engine_execute_frame_commands(engine, heap_bytes, heap_size, &results) ==
+         ENGINE_NATIVE_STATUS_INVALID_ARGUMENT);
+  assert(results.executed_command_count == 1u);
+  assert(results.failed_command_index == 1u);
+  assert(results.failed_status == ENGINE_NATIVE_STATUS_INVALID_ARGUMENT);
+  assert(results.has_frame_stats == 0u);
+
+  engine_native_frame_command_header_t corrupt{};
+  std::memcpy(&corrupt, heap_bytes + 8u, sizeof(corrupt));
+  corrupt.kind = 0xBADu;
+  std::memcpy(heap_bytes + 8u, &corrupt, sizeof(corrupt));
+  assert(engine_execute_frame_commands(engine, heap_bytes, heap_size, &results) ==
+         ENGINE_NATIVE_STATUS_INVALID_ARGUMENT);
+  assert(results.executed_command_count == 0u);
+  assert(results.failed_command_index == 1u);
+
+  assert(engine_execute_frame_commands(engine, heap_bytes, 12u, &results) ==
+         ENGINE_NATIVE_STATUS_INVALID_ARGUMENT);
+  assert(engine_execute_frame_commands(engine, heap_bytes + 4u, 8u, &results) ==
+         ENGINE_NATIVE_STATUS_INVALID_ARGUMENT);
+  assert(engine_execute_frame_commands(engine, nullptr, 0u, &results) ==
+         ENGINE_NATIVE_STATUS_OK);
+  assert(engine_execute_frame_commands(engine, heap_bytes, heap_size, nullptr) ==
+         ENGINE_NATIVE_STATUS_INVALID_ARGUMENT);
+
+  assert(renderer_present(renderer) == ENGINE_NATIVE_STATUS_OK);
+  assert(engine_destroy(engine) == ENGINE_NATIVE_STATUS_OK);
+}
+
+void TestFrameCommandStreamInSingleArenaRing() {
+  engine_native_create_desc_t create_desc{
+      .api_version = ENGINE_NATIVE_API_VERSION,
+      .user_data = nullptr};
+
+  engine_native_engine_t* engine = nullptr;
+  assert(engine_create(&create_desc, &engine) == ENGINE_NATIVE_STATUS_OK);
+  auto* internal_engine = reinterpret_cast<engine_native_engine*>(engine);
+  assert(internal_engine->state.renderer.SetFrameArenaDepth(1u) ==
+         ENGINE_NATIVE_STATUS_OK);
+
+  uint64_t first_stream[3]{};
+  const engine_native_frame_command_begin_frame_t small_begin{
+      .requested_bytes = 4096u, .alignment = 64u};
+  size_t size = AppendFrameCommand(
+      reinterpret_cast<uint8_t*>(first_stream), 0u,
+      ENGINE_NATIVE_FRAME_COMMAND_RENDERER_BEGIN_FRAME, &small_begin);
+  engine_native_frame_command_results_t results{};
+  assert(engine_execute_frame_commands(engine, first_stream, size, &results) ==
+         ENGINE_NATIVE_STATUS_OK);
+  assert(results.has_frame_memory == 1u);
+
+  const engine_native_frame_command_begin_frame_t grown_begin{
+      .requested_bytes = 1024u * 1024u, .alignment = 64u};
+  auto* frame_bytes = static_cast<uint8_t*>(results.frame_memory);
+  size = AppendFrameCommand<uint8_t>(
+      frame_bytes, 0u, ENGINE_NATIVE_FRAME_COMMAND_NET_PUMP, nullptr);
+  size = AppendFrameCommand(
+      frame_bytes, size, ENGINE_NATIVE_FRAME_COMMAND_RENDERER_BEGIN_FRAME,
+      &grown_begin);
+  size = AppendFrameCommand<uint8_t>(
+      frame_bytes, size, ENGINE_NATIVE_FRAME_COMMAND_RENDERER_PRESENT, nullptr);
+  assert(engine_execute_frame_commands(engine, frame_bytes, size, &results) ==
+         ENGINE_NATIVE_STATUS_INVALID_ARGUMENT);
+  assert(results.executed_command_count == 0u);
+  assert(results.failed_command_index == 1u);
+
+  size = AppendFrameCommand<uint8_t>(
+      frame_bytes, 0u, ENGINE_NATIVE_FRAME_COMMAND_RENDERER_PRESENT, nullptr);
+  size = AppendFrameCommand(
+      frame_bytes, size, ENGINE_NATIVE_FRAME_COMMAND_RENDERER_BEGIN_FRAME,
+      &grown_begin);
+  assert(engine_execute_frame_commands(engine, frame_bytes, size, &results) ==
+         ENGINE_NATIVE_STATUS_OK);
+  assert(results.executed_command_count == 2u);
+  assert(results.has_frame_stats == 1u);
+  assert(results.has_frame_memory == 1u);
+
+  const auto& frame_arenas = internal_engine->state.renderer.frame_arenas();
+  assert(frame_arenas.depth() == 1u);
+  assert(frame_arenas.grow_count() == 2u);
+  assert(frame_arenas.active_capacity() == grown_begin.requested_bytes);
+
+  // Resizing regrows the open frame from a stream that lives in it and does
+  // not present.
+  const uint64_t presents_before_resize = results.frame_stats.present_count;
+  const engine_native_frame_command_begin_frame_t resized_begin{
+      .requested_bytes = 4u * 1024u * 1024u, .alignment = 64u};
+  frame_bytes = static_cast<uint8_t*>(results.frame_memory);
+  size = AppendFrameCommand<uint8_t>(
+      frame_bytes, 0u, ENGINE_NATIVE_FRAME_COMMAND_NET_PUMP, nullptr);
+  size = AppendFrameCommand(
+      frame_bytes, size, ENGINE_NATIVE_FRAME_COMMAND_RENDERER_RESIZE_FRAME,
+      &resized_begin);
+  assert(engine_execute_frame_commands(engine, frame_bytes, size, &results) ==
+         ENGINE_NATIVE_STATUS_OK);
+  assert(results.executed_command_count == 2u);
+  assert(results.has_frame_stats == 0u);
+  assert(results.has_frame_memory == 1u);
+  assert(internal_engine->state.renderer.is_frame_open());
+  assert(frame_arenas.grow_count() == 3u);
+  assert(frame_arenas.active_capacity() == resized_begin.requested_bytes);
+
+  engine_native_ui_draw_item_t ui_item{};
+  ui_item.vertex_count = 4u;
+  ui_item.index_count = 6u;
+  const engine_native_frame_command_items_t ui_append{.item_count = 1u};
+  size = AppendFrameCommand(
+      static_cast<uint8_t*>(results.frame_memory), 0u,
+      ENGINE_NATIVE_FRAME_COMMAND_RENDERER_UI_APPEND, &ui_append, &ui_item, 1u);
+  assert(engine_execute_frame_commands(engine, results.frame_memory, size,
+                                       &results) == ENGINE_NATIVE_STATUS_OK);
+  void* unchanged_memory = nullptr;
+  engine_native_renderer_t* renderer = nullptr;
+  assert(engine_get_renderer(engine, &renderer) == ENGINE_NATIVE_STATUS_OK);
+  assert(renderer_resize_frame(renderer, 8u * 1024u * 1024u, 64u,
+                               &unchanged_memory) ==
+         ENGINE_NATIVE_STATUS_INVALID_STATE);
+  assert(unchanged_memory == nullptr);
+  assert(internal_engine->state.renderer.is_frame_open());
+
+  uint64_t present_stream[1]{};
+  size = AppendFrameCommand<uint8_t>(
+      reinterpret_cast<uint8_t*>(present_stream), 0u,
+      ENGINE_NATIVE_FRAME_COMMAND_RENDERER_PRESENT, nullptr);
+  assert(engine_execute_frame_commands(engine, present_stream, size, &results) ==
+         ENGINE_NATIVE_STATUS_OK);
+  assert(results.frame_stats.present_count == presents_before_resize + 1u);
+  assert(results.frame_stats.ui_item_count == 1u);
+  assert(engine_destroy(engine) == ENGINE_NATIVE_STATUS_OK);
+}
+
 void TestResourceTableGeneration() {
   dff::native::ResourceTable<int> table;
 
@@ -1078,12 +1632,31 @@ int main() {
   TestEngineAndSubsystemFlow();
   TestRendererPassOrderForDrawAndUiScenarios();
   TestRendererResourceBlobLifecycle();
+  TestRendererFrameMemoryDrawItemSubmission();
+  TestRendererDeduplicatesMaterialResolvesPerFrame();
+  TestRendererPrewarmsPipelinesBeforeFirstFrame();
+  TestEngineExecutesFrameCommandStream();
+  TestFrameCommandStreamInSingleArenaRing();
   dff::native::tests::RunContentRuntimeTests();
+  dff::native::tests::RunAssetPathTests();
+  dff::native::tests::RunVfsIndexTests();
+  dff::native::tests::RunLz4BlockTests();
+  dff::native::tests::RunContentReadQueueTests();
+  dff::native::tests::RunAssetCacheTests();
+  dff::native::tests::RunStreamingSchedulerTests();
   dff::native::tests::RunEnginePipelineCachePersistenceTests();
+  dff::native::tests::RunResourceTableTests();
+  dff::native::tests::RunConcurrentResourceTableTests();
+  dff::native::tests::RunHandleTableTests();
   TestResourceTableGeneration();
   dff::native::tests::RunPlatformStateTests();
+  dff::native::tests::RunFrameArenaRingTests();
   dff::native::tests::RunFrameGraphBuilderTests();
+  dff::native::tests::RunFrameGraphCacheTests();
+  dff::native::tests::RunDrawItemSorterTests();
+  dff::native::tests::RunMaterialPipelineMemoTests();
   dff::native::tests::RunMaterialSystemTests();
+  dff::native::tests::RunParallelPassRecorderTests();
   dff::native::tests::RunPipelineStateCacheTests();
   dff::native::tests::RunRhiDeviceTests();
   dff::native::tests::RunRenderGraphTests();
@@ -0,0 +1,116 @@
+#include "render/draw_item_sorter_tests.h"
+
+#include <assert.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include "render/draw_item_sorter.h"
+
+namespace dff::native::tests {
+namespace {
+
+using dff::native::render::DrawBatch;
+using dff::native::render::DrawItemSorter;
+
+engine_native_draw_item_t CreateItem(engine_native_resource_handle_t mesh,
+                                     engine_native_resource_handle_t material,
+                                     uint32_t sort_key_high,
+                                     uint32_t sort_key_low) {
+  engine_native_draw_item_t item{};
+  item.mesh = mesh;
+  item.material = material;
+  item.sort_key_high = sort_key_high;
+  item.sort_key_low = sort_key_low;
+  return item;
+}
+
+void TestSortMatchesStableSortAcrossSpans() {
+  std::mt19937 random(1234u);
+  std::vector<engine_native_draw_item_t> first;
+  std::vector<engine_native_draw_item_t> second;
+  for (uint32_t i = 0u; i < 5000u; ++i) {
+    std::vector<engine_native_draw_item_t>& target = (i % 3u) == 0u ? second : first;
+    target.push_back(CreateItem(i, i, random() % 7u, random()));
+  }
+
+  DrawItemSorter sorter;
+  assert(sorter.Append(first) == ENGINE_NATIVE_STATUS_OK);
+  assert(sorter.Append(second) == ENGINE_NATIVE_STATUS_OK);
+  assert(sorter.SortAndBatch() == ENGINE_NATIVE_STATUS_OK);
+
+  std::vector<const engine_native_draw_item_t*> expected;
+  for (const engine_native_draw_item_t& item : first) {
+    expected.push_back(&item);
+  }
+  for (const engine_native_draw_item_t& item : second) {
+    expected.push_back(&item);
+  }
+  std::stable_sort(expected.begin(), expected.end(),
+                   [](const engine_native_draw_item_t* lhs,
+                      const engine_native_draw_item_t* rhs) {
+                     return DrawItemSorter::ComposeSortKey(*lhs) <
+                            DrawItemSorter::ComposeSortKey(*rhs);
+                   });
+
+  assert(sorter.item_count() == expected.size());
+  for (size_t i = 0u; i < expected.size(); ++i) {
+    assert(&sorter.sorted_item(i) == expected[i]);
+  }
+  assert(sorter.last_radix_pass_count() > 0u);
+  assert(sorter.batches().size() == expected.size());
+}
+
+void TestSortIsStableForEqualKeys() {
+  const std::vector<engine_native_draw_item_t> items{
+      CreateItem(1u, 1u, 0u, 5u), CreateItem(2u, 1u, 0u, 5u),
+      CreateItem(3u, 1u, 0u, 1u), CreateItem(4u, 1u, 0u, 5u)};
+
+  DrawItemSorter sorter;
+  assert(sorter.Append(items) == ENGINE_NATIVE_STATUS_OK);
+  assert(sorter.SortAndBatch() == ENGINE_NATIVE_STATUS_OK);
+  assert(sorter.sorted_item(0).mesh == 3u);
+  assert(sorter.sorted_item(1).mesh == 1u);
+  assert(sorter.sorted_item(2).mesh == 2u);
+  assert(sorter.sorted_item(3).mesh == 4u);
+  assert(sorter.last_radix_pass_count() == 1u);
+}
+
+void TestBatchesMergeConsecutiveMeshMaterialRuns() {
+  const std::vector<engine_native_draw_item_t> items{
+      CreateItem(7u, 2u, 1u, 0u), CreateItem(5u, 1u, 0u, 0u),
+      CreateItem(7u, 2u, 1u, 1u), CreateItem(5u, 1u, 0u, 1u),
+      CreateItem(5u, 1u, 0u, 2u), CreateItem(5u, 3u, 0u, 3u)};
+
+  DrawItemSorter sorter;
+  assert(sorter.Append(items) == ENGINE_NATIVE_STATUS_OK);
+  assert(sorter.SortAndBatch() == ENGINE_NATIVE_STATUS_OK);
+
+  const std::vector<DrawBatch>& batches = sorter.batches();
+  assert(batches.size() == 3u);
+  assert(batches[0].mesh == 5u && batches[0].material == 1u);
+  assert(batches[0].first_item == 0u && batches[0].instance_count == 3u);
+  assert(batches[1].mesh == 5u && batches[1].material == 3u);
+  assert(batches[1].first_item == 3u && batches[1].instance_count == 1u);
+  assert(batches[2].mesh == 7u && batches[2].material == 2u);
+  assert(batches[2].first_item == 4u && batches[2].instance_count == 2u);
+  assert(sorter.max_batch_instance_count() == 3u);
+
+  sorter.Reset();
+  assert(sorter.item_count() == 0u);
+  assert(sorter.SortAndBatch() == ENGINE_NATIVE_STATUS_OK);
+  assert(sorter.batches().empty());
+  assert(sorter.max_batch_instance_count() == 0u);
+}
+
+}  // namespace
+
+void RunDrawItemSorterTests() {
+  TestSortMatchesStableSortAcrossSpans();
+  TestSortIsStableForEqualKeys();
+  TestBatchesMergeConsecutiveMeshMaterialRuns();
+}
+
+}  // namespace dff::native::tests
@@ -0,0 +1,10 @@
+#ifndef DFF_ENGINE_NATIVE_DRAW_ITEM_SORTER_TESTS_H
+#define DFF_ENGINE_NATIVE_DRAW_ITEM_SORTER_TESTS_H
+
+namespace dff::native::tests {
+
+void RunDrawItemSorterTests();
+
+}  // namespace dff::native::tests
+
+#endif
@@ -0,0 +1,125 @@
+#include "render/frame_arena_ring_tests.h"
+
+#include <assert.h>
+
+#include <cstdint>
+
+#include "render/frame_arena_ring.h"
+
+namespace dff::native::tests {
+namespace {
+
+using dff::native::render::FrameArenaRing;
+
+bool IsAligned(const void* memory, size_t alignment) {
+  return (reinterpret_cast<uintptr_t>(memory) & (alignment - 1u)) == 0u;
+}
+
+void TestAcquireReturnsPageAlignedMemory() {
+  FrameArenaRing ring(2u);
+  void* memory = nullptr;
+
+  assert(ring.Acquire(100u, 16u, &memory) == ENGINE_NATIVE_STATUS_OK);
+  assert(memory != nullptr);
+  assert(IsAligned(memory, FrameArenaRing::kPageSize));
+  assert(ring.active_capacity() == 100u);
+  assert(ring.reserved_bytes() == FrameArenaRing::kPageSize);
+  ring.Release();
+
+  assert(ring.Acquire(100u, 8192u, &memory) == ENGINE_NATIVE_STATUS_OK);
+  assert(IsAligned(memory, 8192u));
+  ring.Release();
+}
+
+void TestRingReusesArenasWithoutReallocation() {
+  FrameArenaRing ring(2u);
+  void* first = nullptr;
+  void* second = nullptr;
+  void* third = nullptr;
+
+  assert(ring.Acquire(1024u, 64u, &first) == ENGINE_NATIVE_STATUS_OK);
+  ring.Release();
+  assert(ring.Acquire(1024u, 64u, &second) == ENGINE_NATIVE_STATUS_OK);
+  ring.Release();
+  assert(first != second);
+  assert(ring.grow_count() == 2u);
+  assert(ring.reuse_count() == 0u);
+
+  assert(ring.Acquire(512u, 64u, &third) == ENGINE_NATIVE_STATUS_OK);
+  ring.Release();
+  assert(third == first);
+  assert(ring.grow_count() == 2u);
+  assert(ring.reuse_count() == 1u);
+  assert(ring.high_water_mark_bytes() == 1024u);
+}
+
+void TestRingGrowsOnlyWhenRequestExceedsCapacity() {
+  FrameArenaRing ring(1u);
+  void* memory = nullptr;
+
+  assert(ring.Acquire(FrameArenaRing::kPageSize, 64u, &memory) ==
+         ENGINE_NATIVE_STATUS_OK);
+  ring.Release();
+  assert(ring.Acquire(FrameArenaRing::kPageSize * 3u, 64u, &memory) ==
+         ENGINE_NATIVE_STATUS_OK);
+  ring.Release();
+  assert(ring.grow_count() == 2u);
+  assert(ring.reserved_bytes() == FrameArenaRing::kPageSize * 3u);
+
+  assert(ring.Acquire(16u, 64u, &memory) == ENGINE_NATIVE_STATUS_OK);
+  ring.Release();
+  assert(ring.grow_count() == 2u);
+  assert(ring.reuse_count() == 1u);
+  assert(ring.reserved_bytes() == FrameArenaRing::kPageSize * 3u);
+  assert(ring.high_water_mark_bytes() == FrameArenaRing::kPageSize * 3u);
+}
+
+void TestContainsChecksActiveArenaBounds() {
+  FrameArenaRing ring(1u);
+  void* memory = nullptr;
+
+  assert(!ring.Contains(&memory, sizeof(memory)));
+  assert(ring.Acquire(256u, 64u, &memory) == ENGINE_NATIVE_STATUS_OK);
+  const auto* bytes = static_cast<const uint8_t*>(memory);
+  assert(ring.Contains(bytes, 256u));
+  assert(ring.Contains(bytes + 128u, 128u));
+  assert(!ring.Contains(bytes + 128u, 129u));
+  assert(!ring.Contains(bytes + 257u, 0u));
+  assert(!ring.Contains(nullptr, 0u));
+  ring.Release();
+  assert(!ring.Contains(bytes, 1u));
+}
+
+void TestInputValidation() {
+  FrameArenaRing ring(1u);
+  void* memory = nullptr;
+
+  assert(ring.Acquire(0u, 64u, &memory) == ENGINE_NATIVE_STATUS_INVALID_ARGUMENT);
+  assert(ring.Acquire(64u, 3u, &memory) == ENGINE_NATIVE_STATUS_INVALID_ARGUMENT);
+  assert(ring.Acquire(64u, 64u, nullptr) == ENGINE_NATIVE_STATUS_INVALID_ARGUMENT);
+  assert(ring.SetDepth(0u) == ENGINE_NATIVE_STATUS_INVALID_ARGUMENT);
+  assert(ring.SetDepth(FrameArenaRing::kMaxDepth + 1u) ==
+         ENGINE_NATIVE_STATUS_INVALID_ARGUMENT);
+
+  assert(ring.Acquire(64u, 64u, &memory) == ENGINE_NATIVE_STATUS_OK);
+  assert(ring.Acquire(64u, 64u, &memory) == ENGINE_NATIVE_STATUS_INVALID_STATE);
+  assert(ring.SetDepth(2u) == ENGINE_NATIVE_STATUS_INVALID_STATE);
+  ring.Release();
+
+  assert(ring.SetDepth(4u) == ENGINE_NATIVE_STATUS_OK);
+  assert(ring.depth() == 4u);
+  assert(ring.SetDepth(1u) == ENGINE_NATIVE_STATUS_OK);
+  assert(ring.depth() == 1u);
+}
+
+}  // namespace
+
+void RunFrameArenaRingTests() {
+  TestAcquireReturnsPageAlignedMemory();
+  TestRingReusesArenasWithoutReallocation();
+  TestRingGrowsOnlyWhenRequestExceedsCapacity();
+  TestContainsChecksActiveArenaBounds();
+  TestInputValidation();
+}
+
+}  // namespace dff::native::tests
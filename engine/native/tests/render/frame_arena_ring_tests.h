@@ -0,0 +1,10 @@
+#ifndef DFF_ENGINE_NATIVE_FRAME_ARENA_RING_TESTS_H
+#define DFF_ENGINE_NATIVE_FRAME_ARENA_RING_TESTS_H
+
+namespace dff::native::tests {
+
+void RunFrameArenaRingTests();
+
+}  // namespace dff::native::tests
+
+#endif
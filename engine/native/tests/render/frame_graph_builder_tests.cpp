@@ -39,6 +39,8 @@ void TestBuildCanonicalFrameGraphCombinations() {
       {PassKind::kShadowMap, PassKind::kPbrOpaque,
        PassKind::kAmbientOcclusion, PassKind::kBloom, PassKind::kTonemap,
        PassKind::kColorGrading, PassKind::kFxaa, PassKind::kPresent});
+  assert(output.culled_passes.empty());
+  assert(output.culled_pass_mask == 0u);
 
   assert(dff::native::render::BuildCanonicalFrameGraph(
              FrameGraphBuildConfig{.has_draws = false, .has_ui = true}, &graph,
@@ -68,6 +70,10 @@ void TestBuildCanonicalFrameGraphCombinations() {
       output,
       {PassKind::kShadowMap, PassKind::kPbrOpaque, PassKind::kDebugDepth,
        PassKind::kPresent});
+  assert(output.culled_passes.size() == 1u);
+  assert(output.culled_pass_mask ==
+         (static_cast<uint64_t>(1u)
+          << static_cast<uint32_t>(PassKind::kAmbientOcclusion)));
 
   assert(dff::native::render::BuildCanonicalFrameGraph(
              FrameGraphBuildConfig{
@@ -152,11 +158,36 @@ void TestBuildCanonicalFrameGraphValidation() {
              &graph, &output, &error) == ENGINE_NATIVE_STATUS_INVALID_ARGUMENT);
 }
 
+void TestBuildCanonicalFrameGraphAliasesTransients() {
+  RenderGraph graph;
+  FrameGraphBuildOutput output;
+  std::string error;
+
+  assert(dff::native::render::BuildCanonicalFrameGraph(
+             FrameGraphBuildConfig{.has_draws = true, .has_ui = true}, &graph,
+             &output, &error) == ENGINE_NATIVE_STATUS_OK);
+  assert(output.aliasing_plan.naive_bytes == 0u);
+  assert(output.aliasing_plan.aliased_bytes == 0u);
+
+  assert(dff::native::render::BuildCanonicalFrameGraph(
+             FrameGraphBuildConfig{.has_draws = true,
+                                   .has_ui = true,
+                                   .target_width = 3840u,
+                                   .target_height = 2160u},
+             &graph, &output, &error) == ENGINE_NATIVE_STATUS_OK);
+  const uint64_t pixels = 3840u * 2160u;
+  const uint64_t shadow_bytes = 2048u * 2048u * 4u;
+  assert(output.aliasing_plan.naive_bytes == shadow_bytes + pixels * 42u);
+  assert(output.aliasing_plan.aliased_bytes > 0u);
+  assert(output.aliasing_plan.aliased_bytes < output.aliasing_plan.naive_bytes);
+}
+
 }  // namespace
 
 void RunFrameGraphBuilderTests() {
   TestBuildCanonicalFrameGraphCombinations();
   TestBuildCanonicalFrameGraphValidation();
+  TestBuildCanonicalFrameGraphAliasesTransients();
 }
 
 }  // namespace dff::native::tests
@@ -0,0 +1,140 @@
+#include "render/frame_graph_cache_tests.h"
+
+#include <assert.h>
+
+#include <string>
+
+#include "render/frame_graph_cache.h"
+
+namespace dff::native::tests {
+namespace {
+
+using dff::native::render::FrameGraphBuildConfig;
+using dff::native::render::FrameGraphBuildOutput;
+using dff::native::render::FrameGraphCache;
+using dff::native::render::RenderGraph;
+
+void TestCacheReusesCompiledGraphPerConfig() {
+  FrameGraphCache cache;
+  const FrameGraphBuildConfig draws{.has_draws = true, .has_ui = false};
+  const FrameGraphBuildConfig draws_and_ui{.has_draws = true, .has_ui = true};
+
+  const FrameGraphBuildOutput* first = nullptr;
+  assert(cache.GetOrBuild(draws, &first) == ENGINE_NATIVE_STATUS_OK);
+  assert(first != nullptr);
+  assert(cache.miss_count() == 1u);
+  assert(cache.hit_count() == 0u);
+
+  const FrameGraphBuildOutput* second = nullptr;
+  assert(cache.GetOrBuild(draws, &second) == ENGINE_NATIVE_STATUS_OK);
+  assert(second == first);
+  assert(cache.hit_count() == 1u);
+
+  const FrameGraphBuildOutput* with_ui = nullptr;
+  assert(cache.GetOrBuild(draws_and_ui, &with_ui) == ENGINE_NATIVE_STATUS_OK);
+  assert(with_ui != first);
+  assert(with_ui->pass_order.size() == first->pass_order.size() + 1u);
+  assert(cache.miss_count() == 2u);
+  assert(cache.size() == 2u);
+
+  const FrameGraphBuildOutput* again = nullptr;
+  assert(cache.GetOrBuild(draws, &again) == ENGINE_NATIVE_STATUS_OK);
+  assert(again == first);
+  assert(cache.hit_count() == 2u);
+
+  cache.Clear();
+  assert(cache.size() == 0u);
+}
+
+void TestCachedOutputMatchesDirectBuild() {
+  FrameGraphCache cache;
+  const FrameGraphBuildConfig config{
+      .has_draws = true,
+      .has_ui = true,
+      .debug_view_mode = ENGINE_NATIVE_DEBUG_VIEW_NORMALS};
+
+  RenderGraph graph;
+  FrameGraphBuildOutput expected;
+  std::string error;
+  assert(dff::native::render::BuildCanonicalFrameGraph(config, &graph, &expected,
+                                                       &error) ==
+         ENGINE_NATIVE_STATUS_OK);
+
+  const FrameGraphBuildOutput* cached = nullptr;
+  assert(cache.GetOrBuild(config, &cached) == ENGINE_NATIVE_STATUS_OK);
+  assert(cached->pass_order == expected.pass_order);
+  assert(cached->pass_kinds_by_id == expected.pass_kinds_by_id);
+}
+
+void TestCacheKeyAndValidation() {
+  FrameGraphCache cache;
+  const FrameGraphBuildConfig base{.has_draws = true};
+  FrameGraphBuildConfig flagged = base;
+  flagged.render_feature_flags = ENGINE_NATIVE_RENDER_FLAG_DISABLE_AUTO_EXPOSURE;
+  assert(FrameGraphCache::ComposeKey(base) != FrameGraphCache::ComposeKey(flagged));
+
+  assert(cache.GetOrBuild(base, nullptr) == ENGINE_NATIVE_STATUS_INVALID_ARGUMENT);
+
+  const FrameGraphBuildOutput* output = nullptr;
+  const FrameGraphBuildConfig invalid{
+      .has_draws = false,
+      .has_ui = false,
+      .debug_view_mode = ENGINE_NATIVE_DEBUG_VIEW_DEPTH};
+  assert(cache.GetOrBuild(invalid, &output) ==
+         ENGINE_NATIVE_STATUS_INVALID_ARGUMENT);
+  assert(output == nullptr);
+  assert(cache.size() == 0u);
+}
+
+void TestExtentChangeRebuildsWithoutGrowing() {
+  FrameGraphCache cache;
+  FrameGraphBuildConfig config{.has_draws = true,
+                               .target_width = 1280u,
+                               .target_height = 720u};
+  FrameGraphBuildConfig with_ui = config;
+  with_ui.has_ui = true;
+
+  const FrameGraphBuildOutput* output = nullptr;
+  assert(cache.GetOrBuild(config, &output) == ENGINE_NATIVE_STATUS_OK);
+  assert(cache.GetOrBuild(with_ui, &output) == ENGINE_NATIVE_STATUS_OK);
+  assert(cache.size() == 2u);
+  const uint64_t small_bytes = output->aliasing_plan.naive_bytes;
+
+  for (uint32_t step = 1u; step <= 64u; ++step) {
+    config.target_width = 1280u + step * 16u;
+    config.target_height = 720u + step * 9u;
+    assert(cache.GetOrBuild(config, &output) == ENGINE_NATIVE_STATUS_OK);
+    assert(cache.size() == 1u);
+  }
+  assert(cache.miss_count() == 66u);
+
+  with_ui.target_width = config.target_width;
+  with_ui.target_height = config.target_height;
+  assert(cache.GetOrBuild(with_ui, &output) == ENGINE_NATIVE_STATUS_OK);
+  assert(cache.size() == 2u);
+  assert(output->aliasing_plan.naive_bytes > small_bytes);
+
+  RenderGraph graph;
+  FrameGraphBuildOutput expected;
+  std::string error;
+  assert(dff::native::render::BuildCanonicalFrameGraph(with_ui, &graph,
+                                                       &expected, &error) ==
+         ENGINE_NATIVE_STATUS_OK);
+  assert(output->aliasing_plan.naive_bytes == expected.aliasing_plan.naive_bytes);
+  assert(output->aliasing_plan.aliased_bytes ==
+         expected.aliasing_plan.aliased_bytes);
+
+  assert(cache.GetOrBuild(config, &output) == ENGINE_NATIVE_STATUS_OK);
+  assert(cache.hit_count() == 1u);
+}
+
+}  // namespace
+
+void RunFrameGraphCacheTests() {
+  TestCacheReusesCompiledGraphPerConfig();
+  TestCachedOutputMatchesDirectBuild();
+  TestCacheKeyAndValidation();
+  TestExtentChangeRebuildsWithoutGrowing();
+}
+
+}  // namespace dff::native::tests
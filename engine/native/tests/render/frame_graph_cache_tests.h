@@ -0,0 +1,10 @@
+#ifndef DFF_ENGINE_NATIVE_FRAME_GRAPH_CACHE_TESTS_H
+#define DFF_ENGINE_NATIVE_FRAME_GRAPH_CACHE_TESTS_H
+
+namespace dff::native::tests {
+
+void RunFrameGraphCacheTests();
+
+}  // namespace dff::native::tests
+
+#endif
@@ -0,0 +1,87 @@
+#include "render/material_pipeline_memo_tests.h"
+
+#include <assert.h>
+
+#include <cstdint>
+
+#include "render/material_pipeline_memo.h"
+
+namespace dff::native::tests {
+namespace {
+
+using dff::native::render::MaterialPipelineMemo;
+using dff::native::rhi::PipelineStateRecord;
+
+void TestFindReturnsInsertedRecordPerFlags() {
+  MaterialPipelineMemo memo;
+  memo.BeginFrame();
+  assert(memo.Find(7u, 0u) == nullptr);
+  assert(memo.Insert(7u, 0u, PipelineStateRecord{100u, 1u}) ==
+         ENGINE_NATIVE_STATUS_OK);
+  assert(memo.Find(7u, 1u) == nullptr);
+  assert(memo.Insert(7u, 1u, PipelineStateRecord{101u, 2u}) ==
+         ENGINE_NATIVE_STATUS_OK);
+
+  const PipelineStateRecord* record = memo.Find(7u, 0u);
+  assert(record != nullptr && record->key == 100u);
+  record = memo.Find(7u, 1u);
+  assert(record != nullptr && record->key == 101u);
+
+  assert(memo.size() == 2u);
+  assert(memo.lookup_count() == 4u);
+  assert(memo.hit_count() == 2u);
+  assert(memo.unique_count() == 2u);
+}
+
+void TestGrowKeepsEntriesAndBeginFrameForgetsThem() {
+  MaterialPipelineMemo memo;
+  memo.BeginFrame();
+  constexpr uint32_t kMaterialCount = 1000u;
+  for (uint32_t material = 1u; material <= kMaterialCount; ++material) {
+    assert(memo.Find(material, material & 0x7u) == nullptr);
+    assert(memo.Insert(material, material & 0x7u,
+                       PipelineStateRecord{material * 10u, material}) ==
+           ENGINE_NATIVE_STATUS_OK);
+  }
+
+  assert(memo.size() == kMaterialCount);
+  assert(memo.capacity() >= kMaterialCount * 2u);
+  for (uint32_t material = 1u; material <= kMaterialCount; ++material) {
+    const PipelineStateRecord* record = memo.Find(material, material & 0x7u);
+    assert(record != nullptr && record->key == material * 10u);
+  }
+  assert(memo.hit_count() == kMaterialCount);
+
+  const size_t capacity = memo.capacity();
+  memo.BeginFrame();
+  assert(memo.size() == 0u);
+  assert(memo.capacity() == capacity);
+  assert(memo.lookup_count() == 0u);
+  assert(memo.Find(1u, 1u) == nullptr);
+  assert(memo.hit_count() == 0u);
+}
+
+void TestInvalidateKeepsFrameCounters() {
+  MaterialPipelineMemo memo;
+  memo.BeginFrame();
+  assert(memo.Find(3u, 0u) == nullptr);
+  assert(memo.Insert(3u, 0u, PipelineStateRecord{3u, 1u}) ==
+         ENGINE_NATIVE_STATUS_OK);
+  assert(memo.Find(3u, 0u) != nullptr);
+
+  memo.Invalidate();
+  assert(memo.size() == 0u);
+  assert(memo.Find(3u, 0u) == nullptr);
+  assert(memo.lookup_count() == 3u);
+  assert(memo.hit_count() == 1u);
+}
+
+}  // namespace
+
+void RunMaterialPipelineMemoTests() {
+  TestFindReturnsInsertedRecordPerFlags();
+  TestGrowKeepsEntriesAndBeginFrameForgetsThem();
+  TestInvalidateKeepsFrameCounters();
+}
+
+}  // namespace dff::native::tests
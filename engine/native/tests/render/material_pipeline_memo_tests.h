@@ -0,0 +1,10 @@
+#ifndef DFF_ENGINE_NATIVE_MATERIAL_PIPELINE_MEMO_TESTS_H
+#define DFF_ENGINE_NATIVE_MATERIAL_PIPELINE_MEMO_TESTS_H
+
+namespace dff::native::tests {
+
+void RunMaterialPipelineMemoTests();
+
+}  // namespace dff::native::tests
+
+#endif
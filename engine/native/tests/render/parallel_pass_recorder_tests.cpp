@@ -0,0 +1,120 @@
+#include "render/parallel_pass_recorder_tests.h"
+
+#include <assert.h>
+
+#include <cstdint>
+#include <vector>
+
+#include "render/parallel_pass_recorder.h"
+
+namespace dff::native::tests {
+namespace {
+
+using dff::native::render::FrameGraphBuildOutput;
+using dff::native::render::ParallelPassRecorder;
+using dff::native::rhi::RhiCommandList;
+using PassKind = dff::native::rhi::RhiDevice::PassKind;
+
+FrameGraphBuildOutput CreateWideGraph(uint32_t wide_pass_count) {
+  FrameGraphBuildOutput output;
+  for (uint32_t i = 0u; i < wide_pass_count; ++i) {
+    output.pass_order.push_back(i);
+    output.pass_levels.push_back(i % 2u == 0u ? 0u : 1u);
+    output.pass_kinds_by_id.push_back(i % 3u == 0u ? PassKind::kShadowMap
+                                                   : PassKind::kBloom);
+  }
+
+  output.pass_order.push_back(wide_pass_count);
+  output.pass_levels.push_back(2u);
+  output.pass_kinds_by_id.push_back(PassKind::kPresent);
+  return output;
+}
+
+void AssertRecordedInOrder(const FrameGraphBuildOutput& graph,
+                           const std::vector<RhiCommandList>& command_lists,
+                           const std::vector<uint64_t>& pass_cpu_ns) {
+  assert(command_lists.size() == graph.pass_order.size());
+  assert(pass_cpu_ns.size() == graph.pass_order.size());
+  for (size_t position = 0u; position < graph.pass_order.size(); ++position) {
+    assert(command_lists[position].passes().size() == 1u);
+    assert(command_lists[position].passes()[0] ==
+           graph.pass_kinds_by_id[graph.pass_order[position]]);
+  }
+}
+
+void TestRecordsIndependentPassesOnWorkers() {
+  ParallelPassRecorder recorder(3u);
+  const FrameGraphBuildOutput graph = CreateWideGraph(96u);
+  std::vector<RhiCommandList> command_lists;
+  std::vector<uint64_t> pass_cpu_ns;
+
+  for (int iteration = 0; iteration < 64; ++iteration) {
+    assert(recorder.Record(graph, &command_lists, &pass_cpu_ns) ==
+           ENGINE_NATIVE_STATUS_OK);
+    AssertRecordedInOrder(graph, command_lists, pass_cpu_ns);
+  }
+
+  assert(recorder.started_worker_count() == 3u);
+  assert(recorder.last_level_count() == 3u);
+  assert(recorder.last_max_level_width() == 48u);
+}
+
+void TestRecordsSeriallyWithoutWorkers() {
+  ParallelPassRecorder recorder(0u);
+  const FrameGraphBuildOutput graph = CreateWideGraph(8u);
+  std::vector<RhiCommandList> command_lists;
+  std::vector<uint64_t> pass_cpu_ns;
+
+  assert(recorder.Record(graph, &command_lists, &pass_cpu_ns) ==
+         ENGINE_NATIVE_STATUS_OK);
+  AssertRecordedInOrder(graph, command_lists, pass_cpu_ns);
+  assert(recorder.started_worker_count() == 0u);
+}
+
+void TestChainDoesNotStartWorkers() {
+  ParallelPassRecorder recorder(2u);
+  FrameGraphBuildOutput graph;
+  graph.pass_order = {0u, 1u};
+  graph.pass_levels = {0u, 1u};
+  graph.pass_kinds_by_id = {PassKind::kUiOverlay, PassKind::kPresent};
+  std::vector<RhiCommandList> command_lists;
+  std::vector<uint64_t> pass_cpu_ns;
+
+  assert(recorder.Record(graph, &command_lists, &pass_cpu_ns) ==
+         ENGINE_NATIVE_STATUS_OK);
+  AssertRecordedInOrder(graph, command_lists, pass_cpu_ns);
+  assert(recorder.started_worker_count() == 0u);
+  assert(recorder.last_max_level_width() == 1u);
+}
+
+void TestRecordValidation() {
+  ParallelPassRecorder recorder(2u);
+  FrameGraphBuildOutput graph = CreateWideGraph(4u);
+  std::vector<RhiCommandList> command_lists;
+  std::vector<uint64_t> pass_cpu_ns;
+
+  assert(recorder.Record(graph, nullptr, &pass_cpu_ns) ==
+         ENGINE_NATIVE_STATUS_INVALID_ARGUMENT);
+  assert(recorder.Record(graph, &command_lists, nullptr) ==
+         ENGINE_NATIVE_STATUS_INVALID_ARGUMENT);
+
+  graph.pass_levels.pop_back();
+  assert(recorder.Record(graph, &command_lists, &pass_cpu_ns) ==
+         ENGINE_NATIVE_STATUS_INVALID_ARGUMENT);
+
+  graph = CreateWideGraph(4u);
+  graph.pass_kinds_by_id[1] = static_cast<PassKind>(200u);
+  assert(recorder.Record(graph, &command_lists, &pass_cpu_ns) ==
+         ENGINE_NATIVE_STATUS_INVALID_ARGUMENT);
+}
+
+}  // namespace
+
+void RunParallelPassRecorderTests() {
+  TestRecordsIndependentPassesOnWorkers();
+  TestRecordsSeriallyWithoutWorkers();
+  TestChainDoesNotStartWorkers();
+  TestRecordValidation();
+}
+
+}  // namespace dff::native::tests
@@ -0,0 +1,10 @@
+#ifndef DFF_ENGINE_NATIVE_PARALLEL_PASS_RECORDER_TESTS_H
+#define DFF_ENGINE_NATIVE_PARALLEL_PASS_RECORDER_TESTS_H
+
+namespace dff::native::tests {
+
+void RunParallelPassRecorderTests();
+
+}  // namespace dff::native::tests
+
+#endif
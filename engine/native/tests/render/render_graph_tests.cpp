@@ -12,6 +12,8 @@ namespace {
 
 using dff::native::render::RenderGraph;
 using dff::native::render::RenderPassId;
+using dff::native::render::RenderResourceId;
+using dff::native::render::TransientAliasingPlan;
 
 void AssertOrder(const std::vector<RenderPassId>& actual,
                  const std::vector<RenderPassId>& expected) {
@@ -144,6 +146,194 @@ void TestInputValidation() {
   AssertOrder(order, {pass});
 }
 
+void TestRegisterResourceInternsNames() {
+  RenderGraph graph;
+  RenderResourceId depth = 0u;
+  RenderResourceId color = 0u;
+  RenderResourceId depth_again = 0u;
+
+  assert(graph.RegisterResource("depth", &depth) == ENGINE_NATIVE_STATUS_OK);
+  assert(graph.RegisterResource("color", &color) == ENGINE_NATIVE_STATUS_OK);
+  assert(graph.RegisterResource("depth", &depth_again) == ENGINE_NATIVE_STATUS_OK);
+  assert(depth == depth_again);
+  assert(depth != color);
+  assert(graph.ResourceCount() == 2u);
+  assert(graph.ResourceName(color) == "color");
+
+  assert(graph.RegisterResource("", &depth) == ENGINE_NATIVE_STATUS_INVALID_ARGUMENT);
+  assert(graph.RegisterResource("depth", nullptr) ==
+         ENGINE_NATIVE_STATUS_INVALID_ARGUMENT);
+
+  RenderPassId pass = 0u;
+  assert(graph.AddPass("main", &pass) == ENGINE_NATIVE_STATUS_OK);
+  assert(graph.AddRead(pass, 42u) == ENGINE_NATIVE_STATUS_INVALID_ARGUMENT);
+  assert(graph.AddWrite(pass, 42u) == ENGINE_NATIVE_STATUS_INVALID_ARGUMENT);
+  assert(graph.ImportResource(42u) == ENGINE_NATIVE_STATUS_INVALID_ARGUMENT);
+  assert(graph.AddWrite(pass, depth) == ENGINE_NATIVE_STATUS_OK);
+  assert(graph.AddWrite(pass, "depth") == ENGINE_NATIVE_STATUS_INVALID_ARGUMENT);
+
+  graph.Clear();
+  assert(graph.ResourceCount() == 0u);
+}
+
+void TestCompileLongPostChainWithResourceIds() {
+  constexpr uint32_t kChainLength = 512u;
+  RenderGraph graph;
+  std::vector<RenderResourceId> colors(kChainLength + 1u);
+  for (uint32_t i = 0u; i <= kChainLength; ++i) {
+    assert(graph.RegisterResource("color_" + std::to_string(i), &colors[i]) ==
+           ENGINE_NATIVE_STATUS_OK);
+  }
+  RenderResourceId history = 0u;
+  assert(graph.RegisterResource("history", &history) == ENGINE_NATIVE_STATUS_OK);
+  assert(graph.ImportResource(history) == ENGINE_NATIVE_STATUS_OK);
+
+  std::vector<RenderPassId> passes(kChainLength + 1u);
+  for (uint32_t i = 0u; i <= kChainLength; ++i) {
+    assert(graph.AddPass("pass_" + std::to_string(i), &passes[i]) ==
+           ENGINE_NATIVE_STATUS_OK);
+  }
+
+  assert(graph.AddWrite(passes[0], colors[0]) == ENGINE_NATIVE_STATUS_OK);
+  for (uint32_t i = 1u; i <= kChainLength; ++i) {
+    assert(graph.AddRead(passes[i], colors[i - 1u]) == ENGINE_NATIVE_STATUS_OK);
+    assert(graph.AddRead(passes[i], history) == ENGINE_NATIVE_STATUS_OK);
+    assert(graph.AddWrite(passes[i], colors[i]) == ENGINE_NATIVE_STATUS_OK);
+  }
+
+  std::vector<RenderPassId> order;
+  std::string error;
+  assert(graph.Compile(&order, &error) == ENGINE_NATIVE_STATUS_OK);
+  assert(error.empty());
+  AssertOrder(order, passes);
+}
+
+void TestAliasingPlanSharesDisjointLifetimes() {
+  RenderGraph graph;
+  RenderPassId scene = 0u;
+  RenderPassId blur = 0u;
+  RenderPassId composite = 0u;
+  RenderPassId present = 0u;
+  RenderResourceId color = 0u;
+  RenderResourceId blurred = 0u;
+  RenderResourceId composed = 0u;
+  RenderResourceId swapchain = 0u;
+
+  assert(graph.RegisterResource("color", &color) == ENGINE_NATIVE_STATUS_OK);
+  assert(graph.RegisterResource("blurred", &blurred) == ENGINE_NATIVE_STATUS_OK);
+  assert(graph.RegisterResource("composed", &composed) == ENGINE_NATIVE_STATUS_OK);
+  assert(graph.RegisterResource("swapchain", &swapchain) == ENGINE_NATIVE_STATUS_OK);
+  assert(graph.SetResourceByteSize(color, 100u) == ENGINE_NATIVE_STATUS_OK);
+  assert(graph.SetResourceByteSize(blurred, 50u) == ENGINE_NATIVE_STATUS_OK);
+  assert(graph.SetResourceByteSize(composed, 80u) == ENGINE_NATIVE_STATUS_OK);
+  assert(graph.SetResourceByteSize(swapchain, 1000u) == ENGINE_NATIVE_STATUS_OK);
+  assert(graph.SetResourceByteSize(99u, 1u) == ENGINE_NATIVE_STATUS_INVALID_ARGUMENT);
+  assert(graph.ImportResource(swapchain) == ENGINE_NATIVE_STATUS_OK);
+
+  assert(graph.AddPass("scene", &scene) == ENGINE_NATIVE_STATUS_OK);
+  assert(graph.AddPass("blur", &blur) == ENGINE_NATIVE_STATUS_OK);
+  assert(graph.AddPass("composite", &composite) == ENGINE_NATIVE_STATUS_OK);
+  assert(graph.AddPass("present", &present) == ENGINE_NATIVE_STATUS_OK);
+  assert(graph.AddWrite(scene, color) == ENGINE_NATIVE_STATUS_OK);
+  assert(graph.AddRead(blur, color) == ENGINE_NATIVE_STATUS_OK);
+  assert(graph.AddWrite(blur, blurred) == ENGINE_NATIVE_STATUS_OK);
+  assert(graph.AddRead(composite, blurred) == ENGINE_NATIVE_STATUS_OK);
+  assert(graph.AddWrite(composite, composed) == ENGINE_NATIVE_STATUS_OK);
+  assert(graph.AddRead(present, composed) == ENGINE_NATIVE_STATUS_OK);
+  assert(graph.AddWrite(present, swapchain) == ENGINE_NATIVE_STATUS_OK);
+
+  std::vector<RenderPassId> order;
+  assert(graph.Compile(&order, nullptr) == ENGINE_NATIVE_STATUS_OK);
+
+  TransientAliasingPlan plan;
+  assert(graph.BuildAliasingPlan(order, nullptr) ==
+         ENGINE_NATIVE_STATUS_INVALID_ARGUMENT);
+  assert(graph.BuildAliasingPlan({0u, 1u, 2u, 3u, 4u}, &plan) ==
+         ENGINE_NATIVE_STATUS_INVALID_ARGUMENT);
+  assert(graph.BuildAliasingPlan(order, &plan) == ENGINE_NATIVE_STATUS_OK);
+
+  assert(plan.first_use[color] == 0u);
+  assert(plan.last_use[color] == 1u);
+  assert(plan.first_use[composed] == 2u);
+  assert(plan.last_use[composed] == 3u);
+  assert(plan.slot_by_resource[swapchain] == TransientAliasingPlan::kUnused);
+  assert(plan.slot_by_resource[composed] == plan.slot_by_resource[color]);
+  assert(plan.slot_by_resource[blurred] != plan.slot_by_resource[color]);
+  assert(plan.slot_bytes.size() == 2u);
+  assert(plan.naive_bytes == 230u);
+  assert(plan.aliased_bytes == 150u);
+}
+
+void TestCompileCullsPassesUnreachableFromRoots() {
+  RenderGraph graph;
+  RenderPassId gbuffer = 0u;
+  RenderPassId ssao = 0u;
+  RenderPassId debug = 0u;
+  RenderPassId lighting = 0u;
+  RenderPassId present = 0u;
+
+  assert(graph.AddPass("gbuffer", &gbuffer) == ENGINE_NATIVE_STATUS_OK);
+  assert(graph.AddPass("ssao", &ssao) == ENGINE_NATIVE_STATUS_OK);
+  assert(graph.AddPass("debug", &debug) == ENGINE_NATIVE_STATUS_OK);
+  assert(graph.AddPass("lighting", &lighting) == ENGINE_NATIVE_STATUS_OK);
+  assert(graph.AddPass("present", &present) == ENGINE_NATIVE_STATUS_OK);
+
+  assert(graph.AddWrite(gbuffer, "depth") == ENGINE_NATIVE_STATUS_OK);
+  assert(graph.AddRead(ssao, "depth") == ENGINE_NATIVE_STATUS_OK);
+  assert(graph.AddWrite(ssao, "ao") == ENGINE_NATIVE_STATUS_OK);
+  assert(graph.AddRead(debug, "ao") == ENGINE_NATIVE_STATUS_OK);
+  assert(graph.AddWrite(debug, "debug_color") == ENGINE_NATIVE_STATUS_OK);
+  assert(graph.AddRead(lighting, "depth") == ENGINE_NATIVE_STATUS_OK);
+  assert(graph.AddWrite(lighting, "color") == ENGINE_NATIVE_STATUS_OK);
+  assert(graph.AddRead(present, "color") == ENGINE_NATIVE_STATUS_OK);
+
+  std::vector<RenderPassId> order;
+  std::vector<RenderPassId> culled;
+  assert(graph.Compile(&order, &culled, nullptr) == ENGINE_NATIVE_STATUS_OK);
+  AssertOrder(order, {gbuffer, ssao, debug, lighting, present});
+  assert(culled.empty());
+
+  assert(graph.MarkRoot(99u) == ENGINE_NATIVE_STATUS_INVALID_ARGUMENT);
+  assert(graph.MarkRoot(present) == ENGINE_NATIVE_STATUS_OK);
+  assert(graph.Compile(&order, &culled, nullptr) == ENGINE_NATIVE_STATUS_OK);
+  AssertOrder(order, {gbuffer, lighting, present});
+  AssertOrder(culled, {ssao, debug});
+
+  assert(graph.MarkRoot(debug) == ENGINE_NATIVE_STATUS_OK);
+  assert(graph.Compile(&order, &culled, nullptr) == ENGINE_NATIVE_STATUS_OK);
+  AssertOrder(order, {gbuffer, ssao, debug, lighting, present});
+  assert(culled.empty());
+}
+
+void TestCompileAssignsDependencyLevels() {
+  RenderGraph graph;
+  RenderPassId gbuffer = 0u;
+  RenderPassId shadow = 0u;
+  RenderPassId ssao = 0u;
+  RenderPassId lighting = 0u;
+
+  assert(graph.AddPass("gbuffer", &gbuffer) == ENGINE_NATIVE_STATUS_OK);
+  assert(graph.AddPass("shadow", &shadow) == ENGINE_NATIVE_STATUS_OK);
+  assert(graph.AddPass("ssao", &ssao) == ENGINE_NATIVE_STATUS_OK);
+  assert(graph.AddPass("lighting", &lighting) == ENGINE_NATIVE_STATUS_OK);
+  assert(graph.AddWrite(gbuffer, "depth") == ENGINE_NATIVE_STATUS_OK);
+  assert(graph.AddWrite(shadow, "shadow_map") == ENGINE_NATIVE_STATUS_OK);
+  assert(graph.AddRead(ssao, "depth") == ENGINE_NATIVE_STATUS_OK);
+  assert(graph.AddWrite(ssao, "ao") == ENGINE_NATIVE_STATUS_OK);
+  assert(graph.AddRead(lighting, "ao") == ENGINE_NATIVE_STATUS_OK);
+  assert(graph.AddRead(lighting, "shadow_map") == ENGINE_NATIVE_STATUS_OK);
+
+  std::vector<RenderPassId> order;
+  std::vector<uint32_t> levels;
+  assert(graph.Compile(&order, nullptr, &levels, nullptr) == ENGINE_NATIVE_STATUS_OK);
+  AssertOrder(order, {gbuffer, shadow, ssao, lighting});
+  assert(levels.size() == order.size());
+  assert(levels[0] == 0u);
+  assert(levels[1] == 0u);
+  assert(levels[2] == 1u);
+  assert(levels[3] == 2u);
+}
+
 }  // namespace
 
 void RunRenderGraphTests() {
@@ -153,6 +343,11 @@ void RunRenderGraphTests() {
   TestCompileFailsOnUnknownReadResource();
   TestCompileAllowsImportedResources();
   TestInputValidation();
+  TestRegisterResourceInternsNames();
+  TestCompileLongPostChainWithResourceIds();
+  TestAliasingPlanSharesDisjointLifetimes();
+  TestCompileCullsPassesUnreachableFromRoots();
+  TestCompileAssignsDependencyLevels();
 }
 
 }  // namespace dff::native::tests
@@ -2,9 +2,15 @@
 
 #include <assert.h>
 
+#include <algorithm>
 #include <chrono>
+#include <cstdint>
 #include <filesystem>
+#include <fstream>
+#include <random>
 #include <string>
+#include <thread>
+#include <vector>
 
 #include "rhi/pipeline_state_cache.h"
 
@@ -86,6 +92,203 @@ void TestCacheRejectsInvalidPersistenceInputs() {
   assert(!cache.LoadFromFile(missing_path.string().c_str()));
 }
 
+void TestCacheMatchesReferenceLruUnderChurn() {
+  constexpr size_t kCapacity = 37u;
+  dff::native::rhi::PipelineStateCache cache(kCapacity);
+  std::vector<uint64_t> reference_lru;
+  std::mt19937_64 random(42u);
+  uint64_t expected_hits = 0u;
+  uint64_t expected_misses = 0u;
+
+  for (int i = 0; i < 20000; ++i) {
+    const uint64_t key = (random() % 96u) * 0x10000u;
+    const auto it = std::find(reference_lru.begin(), reference_lru.end(), key);
+    if (it != reference_lru.end()) {
+      reference_lru.erase(it);
+      ++expected_hits;
+    } else {
+      if (reference_lru.size() == kCapacity) {
+        reference_lru.erase(reference_lru.begin());
+      }
+      ++expected_misses;
+    }
+    reference_lru.push_back(key);
+
+    assert(cache.GetOrCreate(key).key == key);
+    assert(cache.size() == reference_lru.size());
+  }
+
+  assert(cache.hit_count() == expected_hits);
+  assert(cache.miss_count() == expected_misses);
+
+  const uint64_t misses_before = cache.miss_count();
+  for (uint64_t key : reference_lru) {
+    static_cast<void>(cache.GetOrCreate(key));
+  }
+  assert(cache.miss_count() == misses_before);
+}
+
+void TestCacheRestoresRecencyOrderFromFile() {
+  const std::filesystem::path path = MakeTempCachePath();
+
+  dff::native::rhi::PipelineStateCache source_cache(3u);
+  static_cast<void>(source_cache.GetOrCreate(1u));
+  static_cast<void>(source_cache.GetOrCreate(2u));
+  static_cast<void>(source_cache.GetOrCreate(3u));
+  static_cast<void>(source_cache.GetOrCreate(1u));
+  assert(source_cache.SaveToFile(path.string().c_str()));
+
+  dff::native::rhi::PipelineStateCache restored_cache(3u);
+  assert(restored_cache.LoadFromFile(path.string().c_str()));
+  static_cast<void>(restored_cache.GetOrCreate(4u));
+  static_cast<void>(restored_cache.GetOrCreate(1u));
+  static_cast<void>(restored_cache.GetOrCreate(3u));
+  assert(restored_cache.hit_count() == 2u);
+  assert(restored_cache.miss_count() == 1u);
+
+  std::error_code remove_error;
+  std::filesystem::remove(path, remove_error);
+}
+
+void TestSnapshotRoundTripsUseCountsAndFingerprint() {
+  const dff::native::rhi::PipelineCacheFingerprint fingerprint{0x1234u, 2u};
+  dff::native::rhi::PipelineStateCache source_cache(8u);
+  source_cache.SetFingerprint(fingerprint);
+  for (int i = 0; i < 5; ++i) {
+    static_cast<void>(source_cache.GetOrCreate(10u));
+  }
+  static_cast<void>(source_cache.GetOrCreate(20u));
+
+  std::vector<uint8_t> snapshot;
+  assert(source_cache.Serialize(&snapshot));
+
+  dff::native::rhi::PipelineStateCache restored_cache(8u);
+  assert(!restored_cache.Deserialize(snapshot));
+  restored_cache.SetFingerprint(dff::native::rhi::PipelineCacheFingerprint{0x1234u, 1u});
+  assert(!restored_cache.Deserialize(snapshot));
+  restored_cache.SetFingerprint(fingerprint);
+  assert(restored_cache.Deserialize(snapshot));
+  assert(restored_cache.size() == 2u);
+  assert(restored_cache.GetOrCreate(10u).use_count == 6u);
+  assert(restored_cache.GetOrCreate(20u).use_count == 2u);
+  assert(restored_cache.hit_count() == 2u);
+
+  snapshot[8] ^= 0xFFu;
+  dff::native::rhi::PipelineStateCache tampered_cache(8u);
+  tampered_cache.SetFingerprint(fingerprint);
+  assert(!tampered_cache.Deserialize(snapshot));
+}
+
+void TestSnapshotKeepsBlocksBeforeCorruption() {
+  dff::native::rhi::PipelineStateCache source_cache(2048u);
+  for (uint64_t key = 1u; key <= 1200u; ++key) {
+    static_cast<void>(source_cache.GetOrCreate(key));
+  }
+
+  std::vector<uint8_t> snapshot;
+  assert(source_cache.Serialize(&snapshot));
+  snapshot.back() ^= 0x5Au;
+
+  dff::native::rhi::PipelineStateCache restored_cache(2048u);
+  assert(restored_cache.Deserialize(snapshot));
+  assert(restored_cache.size() == 1024u);
+  static_cast<void>(restored_cache.GetOrCreate(1024u));
+  static_cast<void>(restored_cache.GetOrCreate(1025u));
+  assert(restored_cache.hit_count() == 1u);
+  assert(restored_cache.miss_count() == 1u);
+}
+
+void TestSnapshotLoadKeepsHottestEntriesWhenOverCapacity() {
+  dff::native::rhi::PipelineStateCache source_cache(16u);
+  for (uint64_t key = 1u; key <= 8u; ++key) {
+    for (uint64_t use = 0u; use < key; ++use) {
+      static_cast<void>(source_cache.GetOrCreate(key));
+    }
+  }
+
+  std::vector<uint8_t> snapshot;
+  assert(source_cache.Serialize(&snapshot));
+
+  dff::native::rhi::PipelineStateCache restored_cache(3u);
+  assert(restored_cache.Deserialize(snapshot));
+  assert(restored_cache.size() == 3u);
+  assert(restored_cache.GetOrCreate(8u).use_count == 9u);
+  assert(restored_cache.GetOrCreate(7u).use_count == 8u);
+  assert(restored_cache.GetOrCreate(6u).use_count == 7u);
+  assert(restored_cache.miss_count() == 0u);
+}
+
+void TestLegacyVersionOneFileIsRejected() {
+  const std::filesystem::path path = MakeTempCachePath();
+  {
+    std::ofstream stream(path, std::ios::binary | std::ios::trunc);
+    const uint32_t header[4]{0x43465044u, 1u, 1u, 0u};
+    const uint64_t key = 0xABCDu;
+    stream.write(reinterpret_cast<const char*>(header), sizeof(header));
+    stream.write(reinterpret_cast<const char*>(&key), sizeof(key));
+  }
+
+  dff::native::rhi::PipelineStateCache cache(4u);
+  assert(!cache.LoadFromFile(path.string().c_str()));
+  assert(cache.size() == 0u);
+
+  std::error_code remove_error;
+  std::filesystem::remove(path, remove_error);
+}
+
+void TestPrewarmInsertsWithoutCountingLookups() {
+  dff::native::rhi::PipelineStateCache cache(4u);
+  assert(cache.Prewarm(5u));
+  assert(!cache.Prewarm(5u));
+  assert(cache.size() == 1u);
+  assert(cache.hit_count() == 0u);
+  assert(cache.miss_count() == 0u);
+
+  assert(cache.GetOrCreate(5u).use_count == 1u);
+  assert(cache.hit_count() == 1u);
+  assert(cache.miss_count() == 0u);
+}
+
+void TestConcurrentSnapshotWritersUseSeparateTempFiles() {
+  constexpr uint32_t kWriterCount = 4u;
+  constexpr uint32_t kWritesPerWriter = 32u;
+  const std::filesystem::path path = MakeTempCachePath();
+
+  std::vector<std::thread> writers;
+  std::vector<uint8_t> failed(kWriterCount, 0u);
+  for (uint32_t writer = 0u; writer < kWriterCount; ++writer) {
+    writers.emplace_back([&path, &failed, writer] {
+      dff::native::rhi::PipelineStateCache cache(16u);
+      for (uint64_t key = 0u; key <= writer; ++key) {
+        static_cast<void>(cache.GetOrCreate(0x100u + key));
+      }
+      for (uint32_t i = 0u; i < kWritesPerWriter; ++i) {
+        if (!cache.SaveToFile(path.string().c_str())) {
+          failed[writer] = 1u;
+        }
+      }
+    });
+  }
+  for (std::thread& writer : writers) {
+    writer.join();
+  }
+
+  assert(std::find(failed.begin(), failed.end(), 1u) == failed.end());
+  dff::native::rhi::PipelineStateCache restored_cache(16u);
+  assert(restored_cache.LoadFromFile(path.string().c_str()));
+  assert(restored_cache.size() >= 1u && restored_cache.size() <= kWriterCount);
+
+  const std::string temp_prefix = path.filename().string() + ".tmp";
+  for (const std::filesystem::directory_entry& entry :
+       std::filesystem::directory_iterator(path.parent_path())) {
+    assert(entry.path().filename().string().rfind(temp_prefix, 0u) ==
+           std::string::npos);
+  }
+
+  std::error_code remove_error;
+  std::filesystem::remove(path, remove_error);
+}
+
 }  // namespace
 
 void RunPipelineStateCacheTests() {
@@ -93,6 +296,14 @@ void RunPipelineStateCacheTests() {
   TestCacheEvictsLeastRecentlyUsedEntry();
   TestCacheCanPersistAndRestoreEntries();
   TestCacheRejectsInvalidPersistenceInputs();
+  TestCacheMatchesReferenceLruUnderChurn();
+  TestCacheRestoresRecencyOrderFromFile();
+  TestSnapshotRoundTripsUseCountsAndFingerprint();
+  TestSnapshotKeepsBlocksBeforeCorruption();
+  TestSnapshotLoadKeepsHottestEntriesWhenOverCapacity();
+  TestLegacyVersionOneFileIsRejected();
+  TestPrewarmInsertsWithoutCountingLookups();
+  TestConcurrentSnapshotWritersUseSeparateTempFiles();
 }
 
 }  // namespace dff::native::tests
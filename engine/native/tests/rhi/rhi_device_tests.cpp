@@ -4,6 +4,7 @@
 
 #include <array>
 
+#include "rhi/rhi_command_list.h"
 #include "rhi/rhi_device.h"
 
 namespace dff::native::tests {
@@ -104,6 +105,35 @@ void TestValidationAndPassOrdering() {
   assert(device.EndFrame() == ENGINE_NATIVE_STATUS_INVALID_STATE);
 }
 
+void TestSubmitCommandListExecutesRecordedPasses() {
+  dff::native::rhi::RhiDevice device;
+  dff::native::rhi::RhiCommandList scene;
+  dff::native::rhi::RhiCommandList present;
+
+  assert(scene.RecordPass(PassKind::kShadowMap) == ENGINE_NATIVE_STATUS_OK);
+  assert(scene.RecordPass(PassKind::kPbrOpaque) == ENGINE_NATIVE_STATUS_OK);
+  assert(scene.RecordPass(static_cast<PassKind>(200u)) ==
+         ENGINE_NATIVE_STATUS_INVALID_ARGUMENT);
+  assert(scene.passes().size() == 2u);
+  assert(present.RecordPass(PassKind::kPresent) == ENGINE_NATIVE_STATUS_OK);
+
+  assert(device.SubmitCommandList(scene) == ENGINE_NATIVE_STATUS_INVALID_STATE);
+  assert(device.BeginFrame() == ENGINE_NATIVE_STATUS_OK);
+  assert(device.Clear({0.0f, 0.0f, 0.0f, 1.0f}) == ENGINE_NATIVE_STATUS_OK);
+  assert(device.SubmitCommandList(scene) == ENGINE_NATIVE_STATUS_OK);
+  assert(device.SubmitCommandList(present) == ENGINE_NATIVE_STATUS_OK);
+  assert(device.SubmitCommandList(scene) == ENGINE_NATIVE_STATUS_INVALID_STATE);
+  assert(device.EndFrame() == ENGINE_NATIVE_STATUS_OK);
+
+  assert(device.executed_passes().size() == 3u);
+  assert(device.executed_passes()[0] == PassKind::kShadowMap);
+  assert(device.executed_passes()[1] == PassKind::kPbrOpaque);
+  assert(device.executed_passes()[2] == PassKind::kPresent);
+
+  scene.Reset();
+  assert(scene.passes().empty());
+}
+
 }  // namespace
 
 void RunRhiDeviceTests() {
@@ -111,6 +141,7 @@ void RunRhiDeviceTests() {
   TestFrameLifecycleWithUiOnlyPass();
   TestFrameLifecycleWithDebugViewPasses();
   TestValidationAndPassOrdering();
+  TestSubmitCommandListExecutesRecordedPasses();
 }
 
 }  // namespace dff::native::tests
@@ -4,7 +4,9 @@ namespace Engine.AssetPipeline;
 
 public static class AssetPipelineService
 {
-    private const int PakVersion = 3;
+    private const int PakVersion = 5;
+    private const int UncompressedPakVersion = 4;
+    private const int LegacyPakVersion = 3;
     public const int SourceManifestVersion = 1;
     public const string CompiledManifestFileName = "compiled.manifest.bin";
 
@@ -126,7 +128,9 @@ public static class AssetPipelineService
         ArgumentException.ThrowIfNullOrWhiteSpace(pakPath);
 
         PakArchive archive = PakBinaryCodec.Read(pakPath);
-        if (archive.Version != PakVersion)
+        if (archive.Version != PakVersion &&
+            archive.Version != UncompressedPakVersion &&
+            archive.Version != LegacyPakVersion)
         {
             throw new InvalidDataException($"Unsupported pak version {archive.Version}. Expected {PakVersion}.");
         }
@@ -172,6 +176,14 @@ public static class AssetPipelineService
         return archive;
     }
 
+    public static byte[] ReadPakPayload(string pakPath, PakEntry entry)
+    {
+        ArgumentException.ThrowIfNullOrWhiteSpace(pakPath);
+        ArgumentNullException.ThrowIfNull(entry);
+
+        return PakBinaryCodec.ReadPayload(pakPath, entry);
+    }
+
     public static string ResolveRelativePath(string baseDirectory, string path)
     {
         ArgumentException.ThrowIfNullOrWhiteSpace(baseDirectory);
@@ -0,0 +1,222 @@
+using System.Buffers.Binary;
+
+namespace Engine.AssetPipeline;
+
+// LZ4 block format, matching the native decoder in engine/native/src/content/lz4_block.cpp.
+internal static class Lz4BlockCodec
+{
+    private const int MinMatch = 4;
+    private const int LastLiterals = 5;
+    private const int MatchFindLimit = 12;
+    private const int MaxOffset = 65535;
+    private const int HashBits = 12;
+    private const int SkipTrigger = 6;
+
+    public static int CompressBound(int sourceSize)
+    {
+        return checked(sourceSize + (sourceSize / 255) + 16);
+    }
+
+    public static int Compress(ReadOnlySpan<byte> source, Span<byte> destination)
+    {
+        int op = 0;
+        int anchor = 0;
+        if (source.Length > MatchFindLimit)
+        {
+            Span<int> table = stackalloc int[1 << HashBits];
+            int matchStartLimit = source.Length - MatchFindLimit;
+            int matchEndLimit = source.Length - LastLiterals;
+            int ip = 0;
+            int searchCount = 0;
+            while (ip < matchStartLimit)
+            {
+                uint sequence = BinaryPrimitives.ReadUInt32LittleEndian(source[ip..]);
+                int hash = HashSequence(sequence);
+                int candidate = table[hash];
+                table[hash] = ip;
+                if (candidate >= ip ||
+                    ip - candidate > MaxOffset ||
+                    BinaryPrimitives.ReadUInt32LittleEndian(source[candidate..]) != sequence)
+                {
+                    ip += 1 + (searchCount++ >> SkipTrigger);
+                    continue;
+                }
+
+                int matchEnd = ip + MinMatch;
+                while (matchEnd < matchEndLimit && source[matchEnd] == source[candidate + (matchEnd - ip)])
+                {
+                    matchEnd++;
+                }
+
+                if (!WriteSequence(destination, ref op, source[anchor..ip], ip - candidate, matchEnd - ip))
+                {
+                    return 0;
+                }
+
+                ip = matchEnd;
+                anchor = ip;
+                searchCount = 0;
+                if (ip - 2 < matchStartLimit)
+                {
+                    table[HashSequence(BinaryPrimitives.ReadUInt32LittleEndian(source[(ip - 2)..]))] = ip - 2;
+                }
+            }
+        }
+
+        return WriteSequence(destination, ref op, source[anchor..], offset: 0, matchLength: 0) ? op : 0;
+    }
+
+    public static bool Decompress(ReadOnlySpan<byte> source, Span<byte> destination)
+    {
+        int ip = 0;
+        int op = 0;
+        while (ip < source.Length)
+        {
+            int token = source[ip++];
+            int literalLength = token >> 4;
+            if (literalLength == 15 && !ReadLengthExtension(source, ref ip, ref literalLength))
+            {
+                return false;
+            }
+
+            if (literalLength > source.Length - ip || literalLength > destination.Length - op)
+            {
+                return false;
+            }
+
+            source.Slice(ip, literalLength).CopyTo(destination[op..]);
+            ip += literalLength;
+            op += literalLength;
+            if (ip == source.Length)
+            {
+                return op == destination.Length;
+            }
+
+            if (source.Length - ip < 2)
+            {
+                return false;
+            }
+
+            int offset = source[ip] | (source[ip + 1] << 8);
+            ip += 2;
+            if (offset == 0 || offset > op)
+            {
+                return false;
+            }
+
+            int matchLength = token & 15;
+            if (matchLength == 15 && !ReadLengthExtension(source, ref ip, ref matchLength))
+            {
+                return false;
+            }
+
+            matchLength += MinMatch;
+            if (matchLength > destination.Length - op)
+            {
+                return false;
+            }
+
+            for (int i = 0; i < matchLength; i++)
+            {
+                destination[op + i] = destination[op - offset + i];
+            }
+
+            op += matchLength;
+        }
+
+        return false;
+    }
+
+    private static int HashSequence(uint sequence)
+    {
+        return (int)((sequence * 2654435761u) >> (32 - HashBits));
+    }
+
+    private static bool WriteSequence(
+        Span<byte> destination,
+        ref int op,
+        ReadOnlySpan<byte> literals,
+        int offset,
+        int matchLength)
+    {
+        if (op == destination.Length)
+        {
+            return false;
+        }
+
+        int token = op++;
+        destination[token] = (byte)(Math.Min(literals.Length, 15) << 4);
+        if (literals.Length >= 15 && !WriteLengthExtension(destination, ref op, literals.Length - 15))
+        {
+            return false;
+        }
+
+        if (literals.Length > destination.Length - op)
+        {
+            return false;
+        }
+
+        literals.CopyTo(destination[op..]);
+        op += literals.Length;
+        if (matchLength == 0)
+        {
+            return true;
+        }
+
+        if (destination.Length - op < 2)
+        {
+            return false;
+        }
+
+        destination[op++] = (byte)(offset & 0xFF);
+        destination[op++] = (byte)(offset >> 8);
+        int encodedMatch = matchLength - MinMatch;
+        destination[token] |= (byte)Math.Min(encodedMatch, 15);
+        return encodedMatch < 15 || WriteLengthExtension(destination, ref op, encodedMatch - 15);
+    }
+
+    private static bool WriteLengthExtension(Span<byte> destination, ref int op, int length)
+    {
+        while (length >= 255)
+        {
+            if (op == destination.Length)
+            {
+                return false;
+            }
+
+            destination[op++] = 255;
+            length -= 255;
+        }
+
+        if (op == destination.Length)
+        {
+            return false;
+        }
+
+        destination[op++] = (byte)length;
+        return true;
+    }
+
+    private static bool ReadLengthExtension(ReadOnlySpan<byte> source, ref int ip, ref int length)
+    {
+        byte value;
+        do
+        {
+            if (ip == source.Length)
+            {
+                return false;
+            }
+
+            value = source[ip++];
+            if (length > int.MaxValue - value)
+            {
+                return false;
+            }
+
+            length += value;
+        }
+        while (value == 255);
+
+        return true;
+    }
+}
@@ -2,6 +2,15 @@ namespace Engine.AssetPipeline;
 
 public sealed record PakArchive(int Version, DateTime CreatedAtUtc, IReadOnlyList<PakEntry> Entries);
 
+public enum PakEntryCompression
+{
+    Stored = 0,
+    Lz4Chunked = 1,
+}
+
+// SizeBytes is the uncompressed asset size; StoredSizeBytes is the span the
+// payload occupies in the pak at OffsetBytes. Compressed payloads are split into
+// independently decodable chunks of ChunkSizeBytes.
 public sealed record PakEntry(
     string Path,
     string Kind,
@@ -10,4 +19,7 @@ public sealed record PakEntry(
     long OffsetBytes = 0,
     string AssetKey = "",
     string Category = "",
-    IReadOnlyList<string>? Tags = null);
+    IReadOnlyList<string>? Tags = null,
+    PakEntryCompression Compression = PakEntryCompression.Stored,
+    long StoredSizeBytes = 0,
+    int ChunkSizeBytes = 0);
@@ -1,3 +1,4 @@
+using System.Buffers.Binary;
 using System.Text;
 
 namespace Engine.AssetPipeline;
@@ -5,8 +6,18 @@ namespace Engine.AssetPipeline;
 internal static class PakBinaryCodec
 {
     private const uint Magic = 0x50464644; // DFFP
-    private const int Version = 3;
-    private const int HeaderSizeBytes = sizeof(uint) + sizeof(uint) + sizeof(int) + sizeof(uint) + sizeof(long);
+    private const int Version = 5;
+    private const int UncompressedVersion = 4;
+    private const int LegacyVersion = 3;
+    private const int HeaderSizeBytes = 64;
+    private const int TocEntrySizeBytes = 72;
+    private const int ChunkSizeBytes = 64 * 1024;
+    private const int MaxChunkSizeBytes = 1 << 24;
+    private const uint ChunkStoredBit = 0x80000000;
+    private const int MinCompressionSavingsDivisor = 8;
+    private const int MaxBucketBits = 30;
+    private const ulong FnvOffsetBasis = 14695981039346656037UL;
+    private const ulong FnvPrime = 1099511628211UL;
 
     public static PakArchive WriteFromCompiledEntries(string outputPakPath, IReadOnlyList<PakEntry> entries)
     {
@@ -110,7 +121,7 @@ internal static class PakBinaryCodec
         }
 
         uint version = reader.ReadUInt32();
-        if (version != Version)
+        if (version != Version && version != UncompressedVersion && version != LegacyVersion)
         {
             throw new InvalidDataException($"Unsupported pak version {version}. Expected {Version}.");
         }
@@ -129,6 +140,111 @@ internal static class PakBinaryCodec
             createdAtUtc = new DateTime(createdAtTicks, DateTimeKind.Utc);
         }
 
+        List<PakEntry> entries = version == LegacyVersion
+            ? ReadLegacyEntries(reader, entryCount)
+            : ReadHashedEntries(reader, entryCount, version);
+
+        long fileLength = stream.Length;
+        foreach (PakEntry entry in entries)
+        {
+            if (entry.StoredSizeBytes == 0)
+            {
+                continue;
+            }
+
+            long end = checked(entry.OffsetBytes + entry.StoredSizeBytes);
+            if (end > fileLength)
+            {
+                throw new InvalidDataException(
+                    $"Pak entry '{entry.Path}' points outside file bounds ({entry.OffsetBytes}+{entry.StoredSizeBytes}>{fileLength}).");
+            }
+        }
+
+        return new PakArchive((int)version, createdAtUtc, entries);
+    }
+
+    public static byte[] ReadPayload(string inputPakPath, PakEntry entry)
+    {
+        ArgumentException.ThrowIfNullOrWhiteSpace(inputPakPath);
+        ArgumentNullException.ThrowIfNull(entry);
+
+        using FileStream stream = File.OpenRead(Path.GetFullPath(inputPakPath));
+        if (entry.OffsetBytes < 0 ||
+            entry.StoredSizeBytes < 0 ||
+            entry.StoredSizeBytes > int.MaxValue ||
+            checked(entry.OffsetBytes + entry.StoredSizeBytes) > stream.Length)
+        {
+            throw new InvalidDataException($"Pak entry '{entry.Path}' points outside file bounds.");
+        }
+
+        byte[] stored = new byte[entry.StoredSizeBytes];
+        stream.Seek(entry.OffsetBytes, SeekOrigin.Begin);
+        stream.ReadExactly(stored);
+        if (entry.Compression == PakEntryCompression.Stored)
+        {
+            return stored;
+        }
+
+        if (entry.SizeBytes > Array.MaxLength || entry.ChunkSizeBytes <= 0)
+        {
+            throw new InvalidDataException($"Pak entry '{entry.Path}' has an invalid compressed size.");
+        }
+
+        byte[] payload = new byte[entry.SizeBytes];
+        int chunkCount = (int)((entry.SizeBytes + entry.ChunkSizeBytes - 1) / entry.ChunkSizeBytes);
+        long dataOffset = (long)chunkCount * sizeof(uint);
+        if (dataOffset > stored.Length)
+        {
+            throw new InvalidDataException($"Pak entry '{entry.Path}' has a truncated chunk table.");
+        }
+
+        for (int chunk = 0; chunk < chunkCount; chunk++)
+        {
+            uint descriptor = BinaryPrimitives.ReadUInt32LittleEndian(stored.AsSpan(chunk * sizeof(uint)));
+            long chunkStoredSize = descriptor & ~ChunkStoredBit;
+            int outputOffset = chunk * entry.ChunkSizeBytes;
+            int outputSize = Math.Min(entry.ChunkSizeBytes, payload.Length - outputOffset);
+            if (chunkStoredSize > stored.Length - dataOffset)
+            {
+                throw new InvalidDataException($"Pak entry '{entry.Path}' has a chunk outside its payload.");
+            }
+
+            ReadOnlySpan<byte> source = stored.AsSpan((int)dataOffset, (int)chunkStoredSize);
+            Span<byte> destination = payload.AsSpan(outputOffset, outputSize);
+            if ((descriptor & ChunkStoredBit) != 0)
+            {
+                if (source.Length != outputSize)
+                {
+                    throw new InvalidDataException($"Pak entry '{entry.Path}' has a mis-sized stored chunk.");
+                }
+
+                source.CopyTo(destination);
+            }
+            else if (!Lz4BlockCodec.Decompress(source, destination))
+            {
+                throw new InvalidDataException($"Pak entry '{entry.Path}' has a corrupt compressed chunk.");
+            }
+
+            dataOffset += chunkStoredSize;
+        }
+
+        return payload;
+    }
+
+    internal static ulong HashPath(string normalizedPath)
+    {
+        ulong hash = FnvOffsetBasis;
+        foreach (byte value in Encoding.UTF8.GetBytes(normalizedPath))
+        {
+            hash ^= value;
+            hash *= FnvPrime;
+        }
+
+        return hash;
+    }
+
+    private static List<PakEntry> ReadLegacyEntries(BinaryReader reader, int entryCount)
+    {
         var entries = new List<PakEntry>(entryCount);
         for (int i = 0; i < entryCount; i++)
         {
@@ -149,124 +265,395 @@ internal static class PakBinaryCodec
                 assetKey = PakEntryKeyBuilder.Compute(path, kind, compiledPath, sizeBytes);
             }
 
-            entries.Add(new PakEntry(path, kind, compiledPath, sizeBytes, offsetBytes, assetKey));
+            entries.Add(
+                new PakEntry(path, kind, compiledPath, sizeBytes, offsetBytes, assetKey, StoredSizeBytes: sizeBytes));
         }
 
-        long fileLength = stream.Length;
-        foreach (PakEntry entry in entries)
+        return entries;
+    }
+
+    private static List<PakEntry> ReadHashedEntries(BinaryReader reader, int entryCount, uint version)
+    {
+        long tocOffset = checked((long)reader.ReadUInt64());
+        long stringsOffset = checked((long)reader.ReadUInt64());
+        long stringsSize = checked((long)reader.ReadUInt64());
+        _ = reader.ReadUInt64(); // bucket table offset.
+        _ = reader.ReadUInt32(); // bucket bits.
+        _ = reader.ReadUInt32(); // reserved.
+
+        Stream stream = reader.BaseStream;
+        if (stringsOffset < 0 || stringsSize > int.MaxValue || checked(stringsOffset + stringsSize) > stream.Length)
+        {
+            throw new InvalidDataException("Pak string table points outside file bounds.");
+        }
+
+        stream.Seek(stringsOffset, SeekOrigin.Begin);
+        byte[] strings = reader.ReadBytes((int)stringsSize);
+        if (strings.Length != stringsSize)
         {
-            if (entry.SizeBytes == 0)
+            throw new InvalidDataException("Pak string table is truncated.");
+        }
+
+        stream.Seek(tocOffset, SeekOrigin.Begin);
+        var entries = new List<PakEntry>(entryCount);
+        for (int i = 0; i < entryCount; i++)
+        {
+            ulong pathHash = reader.ReadUInt64();
+            ulong offsetBytes = reader.ReadUInt64();
+            ulong storedSizeBytes = reader.ReadUInt64();
+            ulong sizeBytes = storedSizeBytes;
+            var compression = PakEntryCompression.Stored;
+            uint chunkSizeBytes = 0;
+            if (version == Version)
             {
-                continue;
+                sizeBytes = reader.ReadUInt64();
+                compression = (PakEntryCompression)reader.ReadUInt32();
+                chunkSizeBytes = reader.ReadUInt32();
             }
 
-            long end = checked(entry.OffsetBytes + entry.SizeBytes);
-            if (end > fileLength)
+            string path = ReadTableString(reader, strings);
+            string kind = ReadTableString(reader, strings);
+            string compiledPath = ReadTableString(reader, strings);
+            string assetKey = ReadTableString(reader, strings);
+
+            if (offsetBytes > long.MaxValue || sizeBytes > long.MaxValue || storedSizeBytes > long.MaxValue)
             {
-                throw new InvalidDataException(
-                    $"Pak entry '{entry.Path}' points outside file bounds ({entry.OffsetBytes}+{entry.SizeBytes}>{fileLength}).");
+                throw new InvalidDataException($"Pak entry '{path}' has an out of range offset or size.");
             }
+
+            bool validCompression = compression switch
+            {
+                PakEntryCompression.Stored => sizeBytes == storedSizeBytes,
+                PakEntryCompression.Lz4Chunked => chunkSizeBytes is > 0 and <= MaxChunkSizeBytes,
+                _ => false,
+            };
+            if (!validCompression)
+            {
+                throw new InvalidDataException($"Pak entry '{path}' has an invalid compression descriptor.");
+            }
+
+            if (pathHash != HashPath(path))
+            {
+                throw new InvalidDataException($"Pak entry '{path}' has a mismatched path hash.");
+            }
+
+            entries.Add(
+                new PakEntry(
+                    path,
+                    kind,
+                    compiledPath,
+                    (long)sizeBytes,
+                    (long)offsetBytes,
+                    assetKey,
+                    Compression: compression,
+                    StoredSizeBytes: (long)storedSizeBytes,
+                    ChunkSizeBytes: (int)chunkSizeBytes));
         }
 
-        return new PakArchive(Version, createdAtUtc, entries);
+        return entries;
     }
 
+    private static string ReadTableString(BinaryReader reader, byte[] strings)
+    {
+        uint offset = reader.ReadUInt32();
+        uint length = reader.ReadUInt32();
+        if (offset > strings.Length || length > strings.Length - offset)
+        {
+            throw new InvalidDataException("Pak string reference points outside the string table.");
+        }
+
+        return Encoding.UTF8.GetString(strings, (int)offset, (int)length);
+    }
+
+    // A mounted pak stays memory-mapped by the engine, and truncating it in
+    // place faults the next read past the new end. The pak is therefore written
+    // beside the target and renamed over it, leaving a mapped inode intact.
     private static PakArchive WriteInternal(
         string fullOutputPath,
         IReadOnlyList<PakEntrySource> sourceItems,
         bool metadataOnly)
+    {
+        string tempPath = fullOutputPath + ".tmp";
+        try
+        {
+            PakArchive archive = WritePakFile(tempPath, sourceItems, metadataOnly);
+            File.Move(tempPath, fullOutputPath, overwrite: true);
+            return archive;
+        }
+        catch
+        {
+            File.Delete(tempPath);
+            throw;
+        }
+    }
+
+    private static PakArchive WritePakFile(
+        string fullOutputPath,
+        IReadOnlyList<PakEntrySource> sourceItems,
+        bool metadataOnly)
     {
         DateTime createdAtUtc = DateTime.UtcNow;
-        int indexSize = ComputeIndexSize(sourceItems);
-        long nextOffset = checked(HeaderSizeBytes + indexSize);
 
-        var resolvedEntries = new List<PakEntry>(sourceItems.Count);
-        for (int i = 0; i < sourceItems.Count; i++)
+        var strings = new MemoryStream();
+        var seenPaths = new HashSet<string>(StringComparer.Ordinal);
+        var records = new List<TocRecord>(sourceItems.Count);
+        foreach (PakEntrySource item in sourceItems)
         {
-            PakEntry baseEntry = sourceItems[i].Entry;
-            long offset = metadataOnly || baseEntry.SizeBytes == 0 ? 0 : nextOffset;
-            resolvedEntries.Add(baseEntry with { OffsetBytes = offset });
-            if (!metadataOnly)
+            PakEntry entry = item.Entry with { Path = NormalizeTocPath(item.Entry.Path) };
+            if (!seenPaths.Add(entry.Path))
             {
-                nextOffset = checked(nextOffset + baseEntry.SizeBytes);
+                throw new InvalidDataException($"Pak contains duplicate asset path '{entry.Path}'.");
             }
+
+            entry = entry with
+            {
+                OffsetBytes = 0,
+                Compression = PakEntryCompression.Stored,
+                StoredSizeBytes = entry.SizeBytes,
+                ChunkSizeBytes = 0,
+            };
+            records.Add(
+                new TocRecord(
+                    entry,
+                    HashPath(entry.Path),
+                    AppendTableString(strings, entry.Path),
+                    AppendTableString(strings, entry.Kind),
+                    AppendTableString(strings, entry.CompiledPath),
+                    AppendTableString(strings, entry.AssetKey)));
+        }
+
+        int bucketBits = 0;
+        while ((1L << bucketBits) < records.Count && bucketBits < MaxBucketBits)
+        {
+            bucketBits++;
         }
 
+        long bucketCount = 1L << bucketBits;
+        long tocOffset = HeaderSizeBytes;
+        long bucketsOffset = checked(tocOffset + ((long)records.Count * TocEntrySizeBytes));
+        long stringsOffset = checked(bucketsOffset + ((bucketCount + 1) * sizeof(uint)));
+        long payloadsOffset = checked(stringsOffset + strings.Length);
+
         using FileStream output = File.Create(fullOutputPath);
+
+        // The header, TOC, and string table have a fixed size once the entry
+        // list is known, so payloads are streamed in after that region and the
+        // region is filled in last with the final offsets and stored sizes.
+        if (!metadataOnly)
+        {
+            output.Position = payloadsOffset;
+            byte[] chunk = new byte[ChunkSizeBytes];
+            byte[] scratch = new byte[Lz4BlockCodec.CompressBound(ChunkSizeBytes)];
+            for (int i = 0; i < records.Count; i++)
+            {
+                PakEntry entry = records[i].Entry;
+                if (entry.SizeBytes == 0)
+                {
+                    continue;
+                }
+
+                string fullCompiledPath = sourceItems[i].FullCompiledPath
+                    ?? throw new InvalidDataException($"Missing compiled source for asset '{entry.Path}'.");
+                records[i] = records[i] with { Entry = WritePayload(output, entry, fullCompiledPath, chunk, scratch) };
+            }
+
+            output.SetLength(output.Position);
+            output.Position = 0;
+        }
+
+        var resolvedEntries = new List<PakEntry>(records.Count);
+        foreach (TocRecord record in records)
+        {
+            resolvedEntries.Add(record.Entry);
+        }
+
+        List<TocRecord> sortedRecords = records
+            .OrderBy(static x => x.PathHash)
+            .ThenBy(static x => x.Entry.Path, StringComparer.Ordinal)
+            .ToList();
+
         using var writer = new BinaryWriter(output, Encoding.UTF8, leaveOpen: true);
         writer.Write(Magic);
         writer.Write((uint)Version);
-        writer.Write(resolvedEntries.Count);
+        writer.Write(records.Count);
         writer.Write(0u); // reserved.
         writer.Write(createdAtUtc.Ticks);
+        writer.Write((ulong)tocOffset);
+        writer.Write((ulong)stringsOffset);
+        writer.Write((ulong)strings.Length);
+        writer.Write((ulong)bucketsOffset);
+        writer.Write((uint)bucketBits);
+        writer.Write(0u); // reserved.
 
-        foreach (PakEntry entry in resolvedEntries)
+        foreach (TocRecord record in sortedRecords)
         {
-            writer.Write(entry.Path);
-            writer.Write(entry.Kind);
-            writer.Write(entry.CompiledPath);
-            writer.Write(entry.AssetKey);
-            writer.Write(entry.OffsetBytes);
-            writer.Write(entry.SizeBytes);
+            writer.Write(record.PathHash);
+            writer.Write((ulong)record.Entry.OffsetBytes);
+            writer.Write((ulong)record.Entry.StoredSizeBytes);
+            writer.Write((ulong)record.Entry.SizeBytes);
+            writer.Write((uint)record.Entry.Compression);
+            writer.Write((uint)record.Entry.ChunkSizeBytes);
+            WriteTableString(writer, record.Path);
+            WriteTableString(writer, record.Kind);
+            WriteTableString(writer, record.CompiledPath);
+            WriteTableString(writer, record.AssetKey);
         }
 
-        if (!metadataOnly)
+        int nextRecord = 0;
+        for (long bucket = 0; bucket <= bucketCount; bucket++)
         {
-            foreach ((PakEntry entry, string? fullCompiledPath) in sourceItems)
+            while (nextRecord < sortedRecords.Count &&
+                   bucketBits != 0 &&
+                   (long)(sortedRecords[nextRecord].PathHash >> (64 - bucketBits)) < bucket)
             {
-                if (entry.SizeBytes == 0)
-                {
-                    continue;
-                }
+                nextRecord++;
+            }
+
+            writer.Write((uint)(bucket == bucketCount ? sortedRecords.Count : nextRecord));
+        }
 
-                if (fullCompiledPath is null)
+        writer.Write(strings.GetBuffer(), 0, checked((int)strings.Length));
+        writer.Flush();
+
+        return new PakArchive(Version, createdAtUtc, resolvedEntries);
+    }
+
+    // Streams one asset into the pak at the current position as a chunked LZ4
+    // payload, patching its chunk table once every chunk is written. When that
+    // saves less than an eighth of the asset the payload is rewritten raw in
+    // the same place. Only one chunk of the source is held at a time.
+    private static PakEntry WritePayload(
+        FileStream output,
+        PakEntry entry,
+        string fullCompiledPath,
+        byte[] chunk,
+        byte[] scratch)
+    {
+        long offset = output.Position;
+        if (entry.SizeBytes <= Array.MaxLength)
+        {
+            int chunkCount = (int)((entry.SizeBytes + ChunkSizeBytes - 1) / ChunkSizeBytes);
+            byte[] chunkTable = new byte[chunkCount * sizeof(uint)];
+            output.Position = offset + chunkTable.Length;
+            using (FileStream input = OpenCompiledSource(fullCompiledPath, entry))
+            {
+                for (int index = 0; index < chunkCount; index++)
                 {
-                    throw new InvalidDataException($"Missing compiled source for asset '{entry.Path}'.");
+                    Span<byte> source = chunk.AsSpan(
+                        0,
+                        (int)Math.Min(ChunkSizeBytes, entry.SizeBytes - ((long)index * ChunkSizeBytes)));
+                    input.ReadExactly(source);
+                    int compressedSize = Lz4BlockCodec.Compress(source, scratch);
+                    uint descriptor;
+                    if (compressedSize == 0 || compressedSize >= source.Length)
+                    {
+                        descriptor = (uint)source.Length | ChunkStoredBit;
+                        output.Write(source);
+                    }
+                    else
+                    {
+                        descriptor = (uint)compressedSize;
+                        output.Write(scratch, 0, compressedSize);
+                    }
+
+                    BinaryPrimitives.WriteUInt32LittleEndian(chunkTable.AsSpan(index * sizeof(uint)), descriptor);
                 }
+            }
 
-                using FileStream input = File.OpenRead(fullCompiledPath);
-                input.CopyTo(output);
+            long storedSize = output.Position - offset;
+            if (storedSize <= entry.SizeBytes - (entry.SizeBytes / MinCompressionSavingsDivisor))
+            {
+                output.Position = offset;
+                output.Write(chunkTable);
+                output.Position = offset + storedSize;
+                return entry with
+                {
+                    OffsetBytes = offset,
+                    Compression = PakEntryCompression.Lz4Chunked,
+                    StoredSizeBytes = storedSize,
+                    ChunkSizeBytes = ChunkSizeBytes,
+                };
             }
+
+            output.Position = offset;
         }
 
-        return new PakArchive(Version, createdAtUtc, resolvedEntries);
+        using (FileStream input = OpenCompiledSource(fullCompiledPath, entry))
+        {
+            input.CopyTo(output);
+        }
+
+        return entry with { OffsetBytes = offset };
     }
 
-    private static int ComputeIndexSize(IReadOnlyList<PakEntrySource> sourceItems)
+    private static FileStream OpenCompiledSource(string fullCompiledPath, PakEntry entry)
     {
-        int size = 0;
-        foreach (PakEntrySource item in sourceItems)
+        FileStream input = File.OpenRead(fullCompiledPath);
+        if (input.Length != entry.SizeBytes)
         {
-            PakEntry entry = item.Entry;
-            size = checked(size + GetSerializedStringSize(entry.Path));
-            size = checked(size + GetSerializedStringSize(entry.Kind));
-            size = checked(size + GetSerializedStringSize(entry.CompiledPath));
-            size = checked(size + GetSerializedStringSize(entry.AssetKey));
-            size = checked(size + sizeof(long) + sizeof(long));
+            input.Dispose();
+            throw new InvalidDataException(
+                $"Compiled asset '{entry.Path}' changed size while the pak was being written.");
         }
 
-        return size;
+        return input;
     }
 
-    private static int GetSerializedStringSize(string value)
+    private static string NormalizeTocPath(string path)
     {
-        int byteLength = Encoding.UTF8.GetByteCount(value);
-        return checked(Get7BitEncodedIntByteCount(byteLength) + byteLength);
-    }
+        if (path.Length == 0 || path[0] == '/' || path[0] == '\\')
+        {
+            throw new InvalidDataException($"Pak asset path '{path}' must be relative.");
+        }
 
-    private static int Get7BitEncodedIntByteCount(int value)
-    {
-        uint remaining = checked((uint)value);
-        int count = 0;
-        do
+        string[] segments = path.Replace('\\', '/').Split('/');
+        var normalized = new List<string>(segments.Length);
+        foreach (string segment in segments)
         {
-            count++;
-            remaining >>= 7;
+            if (segment.Length == 0)
+            {
+                continue;
+            }
+
+            if (segment == "." || segment == "..")
+            {
+                throw new InvalidDataException($"Pak asset path '{path}' cannot contain '.' or '..' segments.");
+            }
+
+            normalized.Add(segment);
         }
-        while (remaining != 0);
 
-        return count;
+        if (normalized.Count == 0)
+        {
+            throw new InvalidDataException($"Pak asset path '{path}' is empty.");
+        }
+
+        return string.Join('/', normalized);
+    }
+
+    private static TableString AppendTableString(MemoryStream strings, string value)
+    {
+        byte[] bytes = Encoding.UTF8.GetBytes(value);
+        uint offset = checked((uint)strings.Length);
+        strings.Write(bytes, 0, bytes.Length);
+        return new TableString(offset, checked((uint)bytes.Length));
+    }
+
+    private static void WriteTableString(BinaryWriter writer, TableString value)
+    {
+        writer.Write(value.Offset);
+        writer.Write(value.Length);
     }
 
     private sealed record PakEntrySource(PakEntry Entry, string? FullCompiledPath);
+
+    private readonly record struct TableString(uint Offset, uint Length);
+
+    private sealed record TocRecord(
+        PakEntry Entry,
+        ulong PathHash,
+        TableString Path,
+        TableString Kind,
+        TableString CompiledPath,
+        TableString AssetKey);
 }
@@ -67,13 +67,13 @@ public sealed class CompiledAssetFormatTests
             string textureCompiledPath = ResolveCompiledPath(pakPath, textureEntry.CompiledPath);
             Assert.True(File.Exists(textureCompiledPath));
             VerifyTextureBinary(textureCompiledPath, expectedWidth: 1u, expectedHeight: 1u);
-            Assert.Equal(File.ReadAllBytes(textureCompiledPath), ReadPakPayload(pakPath, textureEntry));
+            Assert.Equal(File.ReadAllBytes(textureCompiledPath), AssetPipelineService.ReadPakPayload(pakPath, textureEntry));
 
             PakEntry meshEntry = pak.Entries.Single(x => x.Kind == "mesh");
             string meshCompiledPath = ResolveCompiledPath(pakPath, meshEntry.CompiledPath);
             Assert.True(File.Exists(meshCompiledPath));
             VerifyMeshBinary(meshCompiledPath, expectedSourceKind: 1u);
-            Assert.Equal(File.ReadAllBytes(meshCompiledPath), ReadPakPayload(pakPath, meshEntry));
+            Assert.Equal(File.ReadAllBytes(meshCompiledPath), AssetPipelineService.ReadPakPayload(pakPath, meshEntry));
         }
         finally
         {
@@ -146,6 +146,131 @@ public sealed class CompiledAssetFormatTests
         }
     }
 
+    [Fact]
+    public void WritePak_CompressesLargeCompiledAssetsInChunks()
+    {
+        string tempRoot = CreateTempDirectory();
+        try
+        {
+            string compiledDirectory = Path.Combine(tempRoot, "compiled", "textures");
+            Directory.CreateDirectory(compiledDirectory);
+            byte[] texture = new byte[200_000];
+            for (int i = 0; i < texture.Length; i++)
+            {
+                texture[i] = (byte)((i / 1024) + ((i & 3) << 6));
+            }
+
+            byte[] small = [1, 2, 3];
+            File.WriteAllBytes(Path.Combine(compiledDirectory, "albedo.tex"), texture);
+            File.WriteAllBytes(Path.Combine(compiledDirectory, "small.tex"), small);
+
+            string pakPath = Path.Combine(tempRoot, "content.pak");
+            AssetPipelineService.WritePak(
+                pakPath,
+                [
+                    new PakEntry("textures/albedo.tex", "texture", "textures/albedo.tex", 0),
+                    new PakEntry("textures/small.tex", "texture", "textures/small.tex", 0),
+                ]);
+
+            PakArchive pak = AssetPipelineService.ReadPak(pakPath);
+            Assert.Equal(5, pak.Version);
+
+            PakEntry compressed = pak.Entries.Single(x => x.Path == "textures/albedo.tex");
+            Assert.Equal(PakEntryCompression.Lz4Chunked, compressed.Compression);
+            Assert.Equal(texture.Length, compressed.SizeBytes);
+            Assert.True(compressed.StoredSizeBytes < texture.Length / 2);
+            Assert.Equal(texture, AssetPipelineService.ReadPakPayload(pakPath, compressed));
+
+            PakEntry stored = pak.Entries.Single(x => x.Path == "textures/small.tex");
+            Assert.Equal(PakEntryCompression.Stored, stored.Compression);
+            Assert.Equal(small.Length, stored.StoredSizeBytes);
+            Assert.Equal(small, AssetPipelineService.ReadPakPayload(pakPath, stored));
+        }
+        finally
+        {
+            Directory.Delete(tempRoot, true);
+        }
+    }
+
+    [Fact]
+    public void WritePak_RewritesIncompressibleAssetsRawBetweenCompressedEntries()
+    {
+        string tempRoot = CreateTempDirectory();
+        try
+        {
+            string compiledDirectory = Path.Combine(tempRoot, "compiled", "textures");
+            Directory.CreateDirectory(compiledDirectory);
+            byte[] noise = new byte[150_000];
+            new Random(1234).NextBytes(noise);
+            byte[] flat = new byte[150_000];
+            Array.Fill(flat, (byte)7);
+            File.WriteAllBytes(Path.Combine(compiledDirectory, "a_flat.tex"), flat);
+            File.WriteAllBytes(Path.Combine(compiledDirectory, "b_noise.tex"), noise);
+            File.WriteAllBytes(Path.Combine(compiledDirectory, "c_flat.tex"), flat);
+
+            string pakPath = Path.Combine(tempRoot, "content.pak");
+            AssetPipelineService.WritePak(
+                pakPath,
+                [
+                    new PakEntry("textures/a_flat.tex", "texture", "textures/a_flat.tex", 0),
+                    new PakEntry("textures/b_noise.tex", "texture", "textures/b_noise.tex", 0),
+                    new PakEntry("textures/c_flat.tex", "texture", "textures/c_flat.tex", 0),
+                ]);
+
+            PakArchive pak = AssetPipelineService.ReadPak(pakPath);
+            PakEntry noiseEntry = pak.Entries.Single(x => x.Path == "textures/b_noise.tex");
+            Assert.Equal(PakEntryCompression.Stored, noiseEntry.Compression);
+            Assert.Equal(noise, AssetPipelineService.ReadPakPayload(pakPath, noiseEntry));
+
+            PakEntry lastEntry = pak.Entries.Single(x => x.Path == "textures/c_flat.tex");
+            Assert.Equal(PakEntryCompression.Lz4Chunked, lastEntry.Compression);
+            Assert.Equal(noiseEntry.OffsetBytes + noise.Length, lastEntry.OffsetBytes);
+            Assert.Equal(flat, AssetPipelineService.ReadPakPayload(pakPath, lastEntry));
+            Assert.Equal(lastEntry.OffsetBytes + lastEntry.StoredSizeBytes, new FileInfo(pakPath).Length);
+        }
+        finally
+        {
+            Directory.Delete(tempRoot, true);
+        }
+    }
+
+    [Fact]
+    public void WritePak_ReplacesExistingPakWithoutTruncatingOpenReaders()
+    {
+        string tempRoot = CreateTempDirectory();
+        try
+        {
+            string compiledDirectory = Path.Combine(tempRoot, "compiled", "textures");
+            Directory.CreateDirectory(compiledDirectory);
+            File.WriteAllBytes(Path.Combine(compiledDirectory, "large.tex"), new byte[100_000]);
+            File.WriteAllBytes(Path.Combine(compiledDirectory, "small.tex"), [1, 2, 3]);
+
+            string pakPath = Path.Combine(tempRoot, "content.pak");
+            AssetPipelineService.WritePak(
+                pakPath,
+                [new PakEntry("textures/large.tex", "texture", "textures/large.tex", 0)]);
+            long originalLength = new FileInfo(pakPath).Length;
+
+            using var mounted = new FileStream(
+                pakPath,
+                FileMode.Open,
+                FileAccess.Read,
+                FileShare.ReadWrite | FileShare.Delete);
+            AssetPipelineService.WritePak(
+                pakPath,
+                [new PakEntry("textures/small.tex", "texture", "textures/small.tex", 0)]);
+
+            Assert.Equal(originalLength, mounted.Length);
+            Assert.False(File.Exists(pakPath + ".tmp"));
+            PakArchive pak = AssetPipelineService.ReadPak(pakPath);
+            Assert.Equal("textures/small.tex", Assert.Single(pak.Entries).Path);
+        }
+        finally
+        {
+            Directory.Delete(tempRoot, true);
+        }
+    }
+
     private static void VerifyTextureBinary(string filePath, uint expectedWidth, uint expectedHeight)
     {
         TextureBlobData texture = TextureBlobCodec.Read(File.ReadAllBytes(filePath));
@@ -182,16 +307,6 @@ public sealed class CompiledAssetFormatTests
                 compiledRelativePath.Replace('/', Path.DirectorySeparatorChar)));
     }
 
-    private static byte[] ReadPakPayload(string pakPath, PakEntry entry)
-    {
-        using FileStream stream = File.OpenRead(pakPath);
-        stream.Seek(entry.OffsetBytes, SeekOrigin.Begin);
-        byte[] bytes = new byte[checked((int)entry.SizeBytes)];
-        int read = stream.Read(bytes, 0, bytes.Length);
-        Assert.Equal(bytes.Length, read);
-        return bytes;
-    }
-
     private static string CreateTempDirectory()
     {
         string path = Path.Combine(Path.GetTempPath(), $"assetc-formats-{Guid.NewGuid():N}");